@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/counter/mux.h>
+
+static void mux_hw_cb(const struct device *dev, uint8_t chan_id, uint32_t ticks, void *user_data);
+
+/* Distance from now to an absolute target, modulo the counter's span.
+ * All ordering decisions use distances from a common "now" so the
+ * counter wrapping does not reorder alarms.
+ */
+static uint32_t mux_distance(const struct counter_mux *mux, uint32_t now, uint32_t target)
+{
+	if (mux->top == UINT32_MAX) {
+		return target - now;
+	}
+
+	return (target >= now) ? (target - now) : (mux->top + 1U - now + target);
+}
+
+/* Program the hardware with the earliest deadline; called under lock */
+static int mux_rearm(struct counter_mux *mux, uint32_t now)
+{
+	sys_dnode_t *head = sys_dlist_peek_head(&mux->alarms);
+	struct counter_mux_alarm *alarm;
+	struct counter_alarm_cfg cfg;
+	int err;
+
+	if (head == NULL) {
+		if (mux->armed) {
+			(void)counter_cancel_channel_alarm(mux->dev, mux->chan_id);
+			mux->armed = false;
+		}
+
+		return 0;
+	}
+
+	alarm = CONTAINER_OF(head, struct counter_mux_alarm, node);
+
+	if (mux->armed) {
+		(void)counter_cancel_channel_alarm(mux->dev, mux->chan_id);
+	}
+
+	cfg.ticks = alarm->target;
+	cfg.callback = mux_hw_cb;
+	cfg.user_data = mux;
+	cfg.flags = COUNTER_ALARM_CFG_ABSOLUTE | COUNTER_ALARM_CFG_EXPIRE_WHEN_LATE;
+
+	err = counter_set_channel_alarm(mux->dev, mux->chan_id, &cfg);
+	if (err == -ETIME) {
+		/* Deadline already passed: with EXPIRE_WHEN_LATE the
+		 * driver delivers the callback anyway, so the alarm is
+		 * handled, not lost.
+		 */
+		err = 0;
+	}
+	mux->armed = (err == 0);
+
+	ARG_UNUSED(now);
+
+	return err;
+}
+
+/* Fire every alarm whose deadline has been reached. An alarm whose
+ * distance from now exceeds half the counter span is treated as
+ * already expired (it is behind us, not almost a full wrap ahead).
+ */
+static void mux_expire(struct counter_mux *mux)
+{
+	uint32_t half_span = (mux->top == UINT32_MAX) ? (UINT32_MAX / 2U) : ((mux->top + 1U) / 2U);
+
+	while (true) {
+		struct counter_mux_alarm *alarm;
+		counter_mux_alarm_cb_t cb;
+		void *user_data;
+		sys_dnode_t *head;
+		uint32_t dist;
+		uint32_t now;
+		k_spinlock_key_t key;
+
+		key = k_spin_lock(&mux->lock);
+
+		head = sys_dlist_peek_head(&mux->alarms);
+		if (head == NULL) {
+			mux->armed = false;
+			k_spin_unlock(&mux->lock, key);
+			return;
+		}
+
+		alarm = CONTAINER_OF(head, struct counter_mux_alarm, node);
+
+		(void)counter_get_value(mux->dev, &now);
+		dist = mux_distance(mux, now, alarm->target);
+
+		if ((dist != 0U) && (dist < half_span)) {
+			/* Head still in the future: rearm and stop */
+			(void)mux_rearm(mux, now);
+			k_spin_unlock(&mux->lock, key);
+			return;
+		}
+
+		sys_dlist_remove(&alarm->node);
+		cb = alarm->cb;
+		user_data = alarm->user_data;
+
+		k_spin_unlock(&mux->lock, key);
+
+		cb(mux, alarm, alarm->target, user_data);
+	}
+}
+
+static void mux_hw_cb(const struct device *dev, uint8_t chan_id, uint32_t ticks, void *user_data)
+{
+	struct counter_mux *mux = user_data;
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(chan_id);
+	ARG_UNUSED(ticks);
+
+	mux_expire(mux);
+}
+
+int counter_mux_init(struct counter_mux *mux, const struct device *dev, uint8_t chan_id)
+{
+	if ((mux == NULL) || (dev == NULL)) {
+		return -EINVAL;
+	}
+
+	if (chan_id >= counter_get_num_of_channels(dev)) {
+		return -EINVAL;
+	}
+
+	mux->dev = dev;
+	mux->chan_id = chan_id;
+	mux->top = counter_get_top_value(dev);
+	mux->armed = false;
+	sys_dlist_init(&mux->alarms);
+
+	return 0;
+}
+
+int counter_mux_alarm_set(struct counter_mux *mux, struct counter_mux_alarm *alarm,
+			  uint32_t ticks, counter_mux_alarm_cb_t cb, void *user_data)
+{
+	struct counter_mux_alarm *pos;
+	k_spinlock_key_t key;
+	uint32_t now;
+	uint32_t dist;
+	bool inserted = false;
+	int err = 0;
+
+	if ((mux == NULL) || (alarm == NULL) || (cb == NULL)) {
+		return -EINVAL;
+	}
+
+	/* Deadlines are limited to half the counter span so that a
+	 * larger-than-half distance can unambiguously mean "already
+	 * expired" when the expiry handler classifies the queue head.
+	 */
+	if (ticks > ((mux->top == UINT32_MAX) ? (UINT32_MAX / 2U) : ((mux->top + 1U) / 2U) - 1U)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&mux->lock);
+
+	if (sys_dnode_is_linked(&alarm->node)) {
+		sys_dlist_remove(&alarm->node);
+	}
+
+	(void)counter_get_value(mux->dev, &now);
+
+	alarm->cb = cb;
+	alarm->user_data = user_data;
+	alarm->target = (mux->top == UINT32_MAX) ? (now + ticks)
+						 : ((now + ticks) % (mux->top + 1U));
+	dist = ticks;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&mux->alarms, pos, node) {
+		if (dist < mux_distance(mux, now, pos->target)) {
+			sys_dlist_insert(&pos->node, &alarm->node);
+			inserted = true;
+			break;
+		}
+	}
+
+	if (!inserted) {
+		sys_dlist_append(&mux->alarms, &alarm->node);
+	}
+
+	/* Reprogram only when the head changed */
+	if (sys_dlist_peek_head(&mux->alarms) == &alarm->node) {
+		err = mux_rearm(mux, now);
+	}
+
+	k_spin_unlock(&mux->lock, key);
+
+	return err;
+}
+
+int counter_mux_alarm_cancel(struct counter_mux *mux, struct counter_mux_alarm *alarm)
+{
+	k_spinlock_key_t key;
+	bool was_head;
+	uint32_t now;
+
+	if ((mux == NULL) || (alarm == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&mux->lock);
+
+	if (!sys_dnode_is_linked(&alarm->node)) {
+		k_spin_unlock(&mux->lock, key);
+		return 0;
+	}
+
+	was_head = (sys_dlist_peek_head(&mux->alarms) == &alarm->node);
+	sys_dlist_remove(&alarm->node);
+
+	if (was_head) {
+		(void)counter_get_value(mux->dev, &now);
+		(void)mux_rearm(mux, now);
+	}
+
+	k_spin_unlock(&mux->lock, key);
+
+	return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
+
+/* One queued program operation at a time per request object; requests
+ * on different objects execute in submission order on the system work
+ * queue, so callers overlap page program time with preparing the next
+ * buffer and collect completions through the poll signal.
+ */
+
+/* Read back and compare in small chunks; returns -EIO on mismatch */
+static int flash_async_verify(const struct device *dev, off_t offset, const void *data,
+			      size_t len)
+{
+	const uint8_t *src = data;
+	uint8_t buf[32];
+	int rc;
+
+	while (len > 0) {
+		size_t chunk = MIN(len, sizeof(buf));
+
+		rc = flash_read(dev, offset, buf, chunk);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (memcmp(buf, src, chunk) != 0) {
+			return -EIO;
+		}
+
+		offset += chunk;
+		src += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static void flash_async_work_handler(struct k_work *work)
+{
+	struct flash_async_op *op = CONTAINER_OF(work, struct flash_async_op, work);
+	int rc;
+
+	rc = flash_write(op->dev, op->offset, op->data, op->len);
+
+	if ((rc == 0) && op->verify) {
+		rc = flash_async_verify(op->dev, op->offset, op->data, op->len);
+	}
+
+	k_poll_signal_raise(&op->signal, rc);
+}
+
+int flash_write_async(const struct device *dev, struct flash_async_op *op, off_t offset,
+		      const void *data, size_t len, bool verify)
+{
+	if ((dev == NULL) || (op == NULL) || (data == NULL)) {
+		return -EINVAL;
+	}
+
+	if (k_work_is_pending(&op->work)) {
+		return -EBUSY;
+	}
+
+	op->dev = dev;
+	op->offset = offset;
+	op->data = data;
+	op->len = len;
+	op->verify = verify;
+
+	k_work_init(&op->work, flash_async_work_handler);
+	k_poll_signal_init(&op->signal);
+
+	return k_work_submit(&op->work);
+}
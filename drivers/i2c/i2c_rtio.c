@@ -97,6 +97,9 @@ void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 {
 	k_sem_init(&ctx->lock, 1, 1);
 	mpsc_init(&ctx->io_q);
+#ifdef CONFIG_I2C_RTIO_PRIO
+	ctx->staged_head = NULL;
+#endif
 	ctx->txn_curr = NULL;
 	ctx->txn_head = NULL;
 	ctx->dt_spec.bus = dev;
@@ -104,6 +107,54 @@ void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 	ctx->iodev.api = &i2c_iodev_api;
 }
 
+#ifdef CONFIG_I2C_RTIO_PRIO
+/* Insert into the staged list ordered by descending SQE priority with
+ * FIFO order within a priority. The list links through the mpsc node
+ * next pointer, which is free once the node left io_q, and is only
+ * touched by the single consumer under slock.
+ */
+static void i2c_rtio_stage(struct i2c_rtio *ctx, struct mpsc_node *node)
+{
+	struct rtio_iodev_sqe *iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+	struct mpsc_node **link = &ctx->staged_head;
+
+	while (*link != NULL) {
+		struct rtio_iodev_sqe *cur = CONTAINER_OF(*link, struct rtio_iodev_sqe, q);
+
+		if (iodev_sqe->sqe.prio > cur->sqe.prio) {
+			break;
+		}
+
+		link = (struct mpsc_node **)&(*link)->next;
+	}
+
+	mpsc_ptr_set(node->next, *link);
+	*link = node;
+}
+
+static struct mpsc_node *i2c_rtio_pop(struct i2c_rtio *ctx)
+{
+	struct mpsc_node *node;
+
+	/* Everything submitted so far competes on priority */
+	while ((node = mpsc_pop(&ctx->io_q)) != NULL) {
+		i2c_rtio_stage(ctx, node);
+	}
+
+	node = ctx->staged_head;
+	if (node != NULL) {
+		ctx->staged_head = (struct mpsc_node *)mpsc_ptr_get(node->next);
+	}
+
+	return node;
+}
+#else
+static inline struct mpsc_node *i2c_rtio_pop(struct i2c_rtio *ctx)
+{
+	return mpsc_pop(&ctx->io_q);
+}
+#endif /* CONFIG_I2C_RTIO_PRIO */
+
 /**
  * @private
  * @brief Setup the next transaction (could be a single op) if needed
@@ -121,7 +172,7 @@ static bool i2c_rtio_next(struct i2c_rtio *ctx, bool completion)
 		return false;
 	}
 
-	struct mpsc_node *next = mpsc_pop(&ctx->io_q);
+	struct mpsc_node *next = i2c_rtio_pop(ctx);
 
 	/* Nothing left to do */
 	if (next == NULL) {
@@ -40,6 +40,9 @@ static int pd_on_domain_visitor(const struct device *dev, void *context)
 	}
 
 	dev->pm->base.usage = 0;
+#ifdef CONFIG_PM_DEVICE_RUNTIME_FAST_PATH
+	atomic_set(&dev->pm->base.fast_refs, 0);
+#endif
 	(void)pm_device_action_run(dev, visitor_context->action);
 	return 0;
 }
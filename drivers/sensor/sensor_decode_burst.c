@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/sensor_data_types.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_DSP
+#include <zephyr/dsp/basicmath.h>
+#endif
+
+/* Scratch sized for one pass over a typical FIFO burst; larger bursts
+ * simply loop. 32 frames of 3 promoted axes.
+ */
+#define BURST_CHUNK_FRAMES 32
+
+static inline int16_t frame_sample(const int16_t *raw, bool swap_endian)
+{
+	return swap_endian ? (int16_t)BSWAP_16((uint16_t)*raw) : *raw;
+}
+
+int sensor_three_axis_decode_q15_burst(const int16_t *raw, uint16_t num_frames,
+				       bool swap_endian, const uint8_t axis_map[3],
+				       const int8_t axis_sign[3], int8_t shift,
+				       uint32_t timestamp_delta,
+				       struct sensor_three_axis_data *out)
+{
+	if ((raw == NULL) || (out == NULL) || (num_frames == 0U)) {
+		return -EINVAL;
+	}
+
+	if ((axis_map != NULL) &&
+	    ((axis_map[0] > 2U) || (axis_map[1] > 2U) || (axis_map[2] > 2U))) {
+		return -EINVAL;
+	}
+
+	out->shift = shift;
+
+#ifdef CONFIG_DSP
+	/* Fast path: identity layout lets the whole burst be promoted to
+	 * Q31 as one flat vector through the DSP backend (Q31 value =
+	 * sample << 16, i.e. a Q15-to-Q31 promotion done as a shift).
+	 */
+	if (!swap_endian && (axis_map == NULL) && (axis_sign == NULL)) {
+		uint32_t remaining = (uint32_t)num_frames * 3U;
+		const int16_t *src = raw;
+		size_t frame = 0;
+
+		while (remaining > 0U) {
+			q31_t chunk[BURST_CHUNK_FRAMES * 3];
+			uint32_t n = MIN(remaining, (uint32_t)(BURST_CHUNK_FRAMES * 3));
+
+			for (uint32_t i = 0; i < n; i++) {
+				chunk[i] = (q31_t)src[i];
+			}
+
+			zdsp_shift_q31(chunk, 16, chunk, n);
+
+			for (uint32_t i = 0; i < n; i += 3U) {
+				struct sensor_three_axis_sample_data *s = &out->readings[frame];
+
+				s->timestamp_delta = timestamp_delta * (uint32_t)frame;
+				s->v[0] = chunk[i];
+				s->v[1] = chunk[i + 1];
+				s->v[2] = chunk[i + 2];
+				frame++;
+			}
+
+			src += n;
+			remaining -= n;
+		}
+
+		return 0;
+	}
+#endif /* CONFIG_DSP */
+
+	for (uint16_t frame = 0; frame < num_frames; frame++) {
+		const int16_t *f = &raw[frame * 3];
+		struct sensor_three_axis_sample_data *s = &out->readings[frame];
+
+		s->timestamp_delta = timestamp_delta * (uint32_t)frame;
+
+		for (uint8_t axis = 0; axis < 3U; axis++) {
+			uint8_t src_axis = (axis_map != NULL) ? axis_map[axis] : axis;
+			int32_t value = frame_sample(&f[src_axis], swap_endian);
+
+			if (axis_sign != NULL) {
+				value *= axis_sign[axis];
+			}
+
+			/* Negating INT16_MIN yields +32768, which does not
+			 * survive the Q31 promotion; saturate it.
+			 */
+			value = CLAMP(value, INT16_MIN, INT16_MAX);
+
+			/* Promote to Q31 with the sample in the top half,
+			 * matching what the per-sample decoders produce.
+			 */
+			s->v[axis] = (q31_t)(value << 16);
+		}
+	}
+
+	return 0;
+}
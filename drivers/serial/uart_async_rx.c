@@ -150,3 +150,93 @@ int uart_async_rx_init(struct uart_async_rx *rx_data,
 
 	return 0;
 }
+
+static void async_rx_uart_cb(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	struct uart_async_rx *rx_data = user_data;
+	uint8_t *buf;
+
+	switch (evt->type) {
+	case UART_RX_BUF_REQUEST:
+		/* Answering from callback context keeps the driver double
+		 * buffered at all times: the next buffer is armed before
+		 * the current one fills, so rotation causes no gap.
+		 */
+		buf = uart_async_rx_buf_req(rx_data);
+		if (buf != NULL) {
+			(void)uart_rx_buf_rsp(dev, buf, uart_async_rx_get_buf_len(rx_data));
+		}
+		break;
+	case UART_RX_RDY:
+		uart_async_rx_on_rdy(rx_data, evt->data.rx.buf, evt->data.rx.len);
+		rx_data->data_cb(rx_data, rx_data->user_data);
+		break;
+	case UART_RX_BUF_RELEASED:
+		uart_async_rx_on_buf_rel(rx_data, evt->data.rx_buf.buf);
+		break;
+	case UART_RX_DISABLED:
+		/* Reception stops when the ring was exhausted; restart
+		 * immediately when a buffer is free, otherwise record the
+		 * stop so uart_async_rx_kick() resumes after consumption.
+		 */
+		buf = uart_async_rx_buf_req(rx_data);
+		if (buf != NULL) {
+			(void)uart_rx_enable(dev, buf, uart_async_rx_get_buf_len(rx_data),
+					     rx_data->timeout_us);
+		} else {
+			atomic_set(&rx_data->rx_stopped, 1);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+int uart_async_rx_enable(const struct device *dev, struct uart_async_rx *rx_data,
+			 int32_t timeout_us, uart_async_rx_data_cb_t data_cb, void *user_data)
+{
+	uint8_t *buf;
+	int err;
+
+	if ((dev == NULL) || (rx_data == NULL) || (data_cb == NULL)) {
+		return -EINVAL;
+	}
+
+	rx_data->dev = dev;
+	rx_data->timeout_us = timeout_us;
+	rx_data->data_cb = data_cb;
+	rx_data->user_data = user_data;
+
+	err = uart_callback_set(dev, async_rx_uart_cb, rx_data);
+	if (err < 0) {
+		return err;
+	}
+
+	buf = uart_async_rx_buf_req(rx_data);
+	__ASSERT_NO_MSG(buf != NULL);
+
+	return uart_rx_enable(dev, buf, uart_async_rx_get_buf_len(rx_data), timeout_us);
+}
+
+int uart_async_rx_kick(struct uart_async_rx *rx_data)
+{
+	uint8_t *buf;
+
+	if (rx_data == NULL || rx_data->dev == NULL) {
+		return -EINVAL;
+	}
+
+	if (atomic_cas(&rx_data->rx_stopped, 1, 0) == false) {
+		return 0;
+	}
+
+	buf = uart_async_rx_buf_req(rx_data);
+	if (buf == NULL) {
+		/* Still exhausted; remain stopped */
+		atomic_set(&rx_data->rx_stopped, 1);
+		return -ENOMEM;
+	}
+
+	return uart_rx_enable(rx_data->dev, buf, uart_async_rx_get_buf_len(rx_data),
+			      rx_data->timeout_us);
+}
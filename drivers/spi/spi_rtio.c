@@ -18,25 +18,18 @@ const struct rtio_iodev_api spi_iodev_api = {
 	.submit = spi_iodev_submit,
 };
 
-static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+int spi_rtio_txn_bufsets(struct rtio_iodev_sqe *txn_head,
+			 struct spi_buf *tx_bufs, struct spi_buf *rx_bufs,
+			 size_t max_msgs,
+			 struct spi_buf_set *tx_buf_set,
+			 struct spi_buf_set *rx_buf_set)
 {
-	struct spi_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
-	const struct device *dev = dt_spec->bus;
-	uint8_t num_msgs = 0;
+	struct rtio_iodev_sqe *txn_curr = txn_head;
+	size_t num_msgs = 0;
 	int err = 0;
 
-	LOG_DBG("Sync RTIO work item for: %p", (void *)dev);
-
-	/** Take care of Multi-submissions transactions in the same context.
-	 * This guarantees that linked items will be consumed in the expected
-	 * order, regardless pending items in the workqueue.
-	 */
-	struct rtio_iodev_sqe *txn_head = iodev_sqe;
-	struct rtio_iodev_sqe *txn_curr = iodev_sqe;
-
-	/* We allocate the spi_buf's on the stack, to do so
-	 * the count of messages needs to be determined to
-	 * ensure we don't go over the statically sized array.
+	/* The count of messages needs to be determined first to ensure we
+	 * don't go over the caller's statically sized arrays.
 	 */
 	do {
 		switch (txn_curr->sqe.op) {
@@ -56,34 +49,13 @@ static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
 	} while (err == 0 && txn_curr != NULL);
 
 	if (err != 0) {
-		rtio_iodev_sqe_err(txn_head, err);
-		return;
+		return err;
 	}
 
-	/* Allocate msgs on the stack, MISRA doesn't like VLAs so we need a statically
-	 * sized array here. It's pretty unlikely we have more than 4 spi messages
-	 * in a transaction as we typically would only have 2, one to write a
-	 * register address, and another to read/write the register into an array
-	 */
-	if (num_msgs > CONFIG_SPI_RTIO_FALLBACK_MSGS) {
-		LOG_ERR("At most CONFIG_SPI_RTIO_FALLBACK_MSGS"
-			" submissions in a transaction are"
-			" allowed in the default handler");
-		rtio_iodev_sqe_err(txn_head, -ENOMEM);
-		return;
+	if (num_msgs > max_msgs) {
+		return -ENOMEM;
 	}
 
-	struct spi_buf tx_bufs[CONFIG_SPI_RTIO_FALLBACK_MSGS];
-	struct spi_buf rx_bufs[CONFIG_SPI_RTIO_FALLBACK_MSGS];
-	struct spi_buf_set tx_buf_set = {
-		.buffers = tx_bufs,
-		.count = num_msgs,
-	};
-	struct spi_buf_set rx_buf_set = {
-		.buffers = rx_bufs,
-		.count = num_msgs,
-	};
-
 	txn_curr = txn_head;
 
 	for (size_t i = 0 ; i < num_msgs ; i++) {
@@ -115,15 +87,54 @@ static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
 			tx_bufs[i].len = sqe->txrx.buf_len;
 			break;
 		default:
-			err = -EIO;
-			break;
+			return -EIO;
 		}
 
 		txn_curr = rtio_txn_next(txn_curr);
 	}
 
-	if (err == 0) {
-		__ASSERT_NO_MSG(num_msgs > 0);
+	tx_buf_set->buffers = tx_bufs;
+	tx_buf_set->count = num_msgs;
+	rx_buf_set->buffers = rx_bufs;
+	rx_buf_set->count = num_msgs;
+
+	return (int)num_msgs;
+}
+
+static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
+	const struct device *dev = dt_spec->bus;
+	int err;
+
+	LOG_DBG("Sync RTIO work item for: %p", (void *)dev);
+
+	/** Take care of Multi-submissions transactions in the same context.
+	 * This guarantees that linked items will be consumed in the expected
+	 * order, regardless pending items in the workqueue.
+	 */
+	struct rtio_iodev_sqe *txn_head = iodev_sqe;
+
+	/* Allocate msgs on the stack, MISRA doesn't like VLAs so we need a statically
+	 * sized array here. It's pretty unlikely we have more than 4 spi messages
+	 * in a transaction as we typically would only have 2, one to write a
+	 * register address, and another to read/write the register into an array
+	 */
+	struct spi_buf tx_bufs[CONFIG_SPI_RTIO_FALLBACK_MSGS];
+	struct spi_buf rx_bufs[CONFIG_SPI_RTIO_FALLBACK_MSGS];
+	struct spi_buf_set tx_buf_set;
+	struct spi_buf_set rx_buf_set;
+
+	err = spi_rtio_txn_bufsets(txn_head, tx_bufs, rx_bufs,
+				   CONFIG_SPI_RTIO_FALLBACK_MSGS,
+				   &tx_buf_set, &rx_buf_set);
+	if (err == -ENOMEM) {
+		LOG_ERR("At most CONFIG_SPI_RTIO_FALLBACK_MSGS"
+			" submissions in a transaction are"
+			" allowed in the default handler");
+	}
+
+	if (err > 0) {
 		err = spi_transceive_dt(dt_spec, &tx_buf_set, &rx_buf_set);
 	}
 
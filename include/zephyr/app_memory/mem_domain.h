@@ -166,6 +166,28 @@ int k_mem_domain_init(struct k_mem_domain *domain, uint8_t num_parts,
 int k_mem_domain_add_partition(struct k_mem_domain *domain,
 				      struct k_mem_partition *part);
 
+/**
+ * @brief Replace a memory domain's partition set in one pass
+ *
+ * Retires every current partition and installs @a parts under a
+ * single critical section, so reshaping a domain with many
+ * partitions costs one lock hold and one batched run of architecture
+ * updates instead of a remove/add round trip per partition.
+ *
+ * The same restrictions as k_mem_domain_init() apply to the new set.
+ *
+ * @param domain The memory domain to be reshaped
+ * @param num_parts The number of array items of @a parts
+ * @param parts An array of pointers to the memory partitions; can be
+ *              NULL when @a num_parts is zero (emptying the domain)
+ *
+ * @retval 0 if successful
+ * @retval -EINVAL if invalid parameters supplied
+ * @retval Negative errno from an architecture-specific update
+ */
+int k_mem_domain_set_partitions(struct k_mem_domain *domain, uint8_t num_parts,
+				struct k_mem_partition *parts[]);
+
 /**
  * @brief Remove a memory partition from a memory domain.
  *
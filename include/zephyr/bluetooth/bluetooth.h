@@ -2470,6 +2470,40 @@ struct bt_le_scan_recv_info {
 	uint8_t secondary_phy;
 };
 
+#if defined(CONFIG_BT_SCAN_FILTER) || defined(__DOXYGEN__)
+/** @brief Host-side advertising report filter.
+ *
+ *  Attached to a @ref bt_le_scan_cb listener; reports failing any
+ *  enabled criterion are dropped before the recv callback runs.
+ *
+ *  @kconfig_dep{CONFIG_BT_SCAN_FILTER}
+ */
+struct bt_le_scan_filter {
+	/** Minimum RSSI in dBm; 0 disables the check. */
+	int8_t rssi_min;
+	/** AD type that must be present in the data; 0 disables the check. */
+	uint8_t ad_type;
+	/**
+	 * 16-bit service UUID that must appear in a UUID16 list or
+	 * service data AD structure; 0 disables the check.
+	 */
+	uint16_t uuid16;
+	/**
+	 * Suppress further reports from an address for this many
+	 * milliseconds after one passed the filter; 0 disables
+	 * deduplication.
+	 */
+	uint16_t dedup_ttl_ms;
+
+	/** @cond INTERNAL_HIDDEN */
+	struct {
+		bt_addr_le_t addr;
+		uint32_t expire;
+	} _dedup[CONFIG_BT_SCAN_FILTER_DEDUP_SIZE];
+	/** @endcond */
+};
+#endif /* CONFIG_BT_SCAN_FILTER */
+
 /** Listener context for (LE) scanning. */
 struct bt_le_scan_cb {
 
@@ -2485,6 +2519,15 @@ struct bt_le_scan_cb {
 	/** @brief The scanner has stopped scanning after scan timeout. */
 	void (*timeout)(void);
 
+#if defined(CONFIG_BT_SCAN_FILTER) || defined(__DOXYGEN__)
+	/**
+	 * @brief Optional report filter, NULL to receive every report.
+	 *
+	 * Only available when @kconfig{CONFIG_BT_SCAN_FILTER} is enabled.
+	 */
+	struct bt_le_scan_filter *filter;
+#endif /* CONFIG_BT_SCAN_FILTER */
+
 	sys_snode_t node;
 };
 
@@ -34,6 +34,43 @@
 extern "C" {
 #endif
 
+#if defined(CONFIG_BT_BUF_STATS) || defined(__DOXYGEN__)
+/** @brief Usage statistics of one host buffer pool.
+ *
+ *  @kconfig_dep{CONFIG_BT_BUF_STATS}
+ */
+struct bt_buf_pool_stats {
+	/** Pool name */
+	const char *name;
+	/** Total number of buffers in the pool */
+	uint16_t capacity;
+	/** Highest number of buffers in use simultaneously */
+	uint16_t max_used;
+	/** Number of buffers currently free */
+	uint16_t free;
+	/** Number of allocations that found the pool empty */
+	uint32_t exhaustions;
+	/** Accumulated time spent waiting for a buffer, in microseconds */
+	uint32_t total_wait_us;
+	/** Longest single wait for a buffer, in microseconds */
+	uint32_t max_wait_us;
+};
+
+/** @brief Read usage statistics of a host buffer pool.
+ *
+ *  Iterate by calling with increasing @p index until -ENOENT is returned.
+ *
+ *  @kconfig_dep{CONFIG_BT_BUF_STATS}
+ *
+ *  @param index Pool index, starting at 0.
+ *  @param stats Output statistics.
+ *
+ *  @retval 0 on success.
+ *  @retval -ENOENT when @p index is past the last pool.
+ */
+int bt_buf_stats_get(size_t index, struct bt_buf_pool_stats *stats);
+#endif /* CONFIG_BT_BUF_STATS */
+
 /** Possible types of buffers passed around the Bluetooth stack in a form of bitmask. */
 enum bt_buf_type {
 	/** Unknown/invalid packet type, used for error checking */
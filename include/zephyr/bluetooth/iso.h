@@ -995,6 +995,72 @@ int bt_iso_chan_send(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq
 int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t seq_num,
 			uint32_t ts);
 
+#if defined(CONFIG_BT_ISO_TX_PACER) || defined(__DOXYGEN__)
+/**
+ * @brief ISO TX pacer object.
+ *
+ * Initialize with bt_iso_chan_pacer_init(); all members are internal.
+ */
+struct bt_iso_tx_pacer {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_fifo fifo;
+	struct k_work_delayable work;
+	struct bt_iso_chan *chan;
+	atomic_t active;
+	uint32_t interval_us;
+	uint16_t seq_num;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a TX pacer for a connected ISO channel
+ *
+ * The pacer releases one deposited SDU per SDU interval, using the
+ * interval reported by the controller for the TX direction of the
+ * channel, and manages the packet sequence number itself.
+ *
+ * @kconfig_dep{CONFIG_BT_ISO_TX_PACER}
+ *
+ * @param chan  Connected channel able to send data.
+ * @param pacer Pacer object to initialize.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTCONN if the channel is not connected.
+ * @retval -EINVAL if the channel cannot send or its SDU interval is unknown.
+ */
+int bt_iso_chan_pacer_init(struct bt_iso_chan *chan, struct bt_iso_tx_pacer *pacer);
+
+/**
+ * @brief Deposit an SDU for paced transmission
+ *
+ * Never blocks: the buffer is queued and sent by the pacer at the next
+ * SDU interval boundary. Buffer ownership is transferred to the stack.
+ *
+ * The buffer must fulfil the same requirements as for
+ * bt_iso_chan_send(), except that the sequence number is managed by
+ * the pacer.
+ *
+ * @kconfig_dep{CONFIG_BT_ISO_TX_PACER}
+ *
+ * @param pacer Initialized pacer object.
+ * @param buf   Buffer containing data to be sent.
+ *
+ * @retval 0 on success.
+ */
+int bt_iso_chan_send_paced(struct bt_iso_tx_pacer *pacer, struct net_buf *buf);
+
+/**
+ * @brief Stop a pacer and drop all SDUs still queued
+ *
+ * Call when the channel disconnects or the stream stops.
+ *
+ * @kconfig_dep{CONFIG_BT_ISO_TX_PACER}
+ *
+ * @param pacer Pacer object to flush.
+ */
+void bt_iso_chan_pacer_flush(struct bt_iso_tx_pacer *pacer);
+#endif /* CONFIG_BT_ISO_TX_PACER */
+
 /**
  * @brief Sets up the ISO data path for a ISO channel
  *
@@ -53,6 +53,18 @@ int cpu_freq_policy_select_pstate(const struct pstate **pstate_out);
  */
 void cpu_freq_policy_reset(void);
 
+#if defined(CONFIG_CPU_FREQ_POLICY_ON_DEMAND) || defined(__DOXYGEN__)
+/**
+ * @brief Read P-state transition latency statistics of the on-demand policy.
+ *
+ * @param count Total number of transitions applied, or NULL.
+ * @param last_cycles Duration of the most recent transition in
+ *                    hardware cycles, or NULL.
+ * @param max_cycles Longest observed transition in hardware cycles, or NULL.
+ */
+void cpu_freq_on_demand_stats_get(uint32_t *count, uint32_t *last_cycles, uint32_t *max_cycles);
+#endif
+
 /**
  * @brief Set the CPU frequency scaling P-state according to policy
  *
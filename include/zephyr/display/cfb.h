@@ -192,6 +192,21 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
  */
 int cfb_framebuffer_finalize(const struct device *dev);
 
+/**
+ * @brief Mark the whole framebuffer as modified.
+ *
+ * With @kconfig{CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING} enabled,
+ * cfb_framebuffer_finalize() transfers only rows changed through the
+ * cfb drawing functions. Call this to force the next finalize to
+ * transfer the full frame, e.g. after modifying the buffer directly or
+ * reinitializing the display. Without damage tracking this is a no-op.
+ *
+ * @param dev Pointer to device structure for driver instance
+ *
+ * @return 0 on success
+ */
+int cfb_framebuffer_invalidate(const struct device *dev);
+
 /**
  * @brief Get display parameter.
  *
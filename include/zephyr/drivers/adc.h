@@ -1193,11 +1193,16 @@ struct __attribute__((__packed__)) adc_data_generic_header {
 static inline int adc_stream(struct rtio_iodev *iodev, struct rtio *ctx, void *userdata,
 				struct rtio_sqe **handle)
 {
+	int ret;
+
 	if (IS_ENABLED(CONFIG_USERSPACE)) {
 		struct rtio_sqe sqe;
 
 		rtio_sqe_prep_read_multishot(&sqe, iodev, RTIO_PRIO_NORM, userdata);
-		rtio_sqe_copy_in_get_handles(ctx, &sqe, handle, 1);
+		ret = rtio_sqe_copy_in_get_handles(ctx, &sqe, handle, 1);
+		if (ret != 0) {
+			return ret;
+		}
 	} else {
 		struct rtio_sqe *sqe = rtio_sqe_acquire(ctx);
 
@@ -1209,8 +1214,8 @@ static inline int adc_stream(struct rtio_iodev *iodev, struct rtio *ctx, void *u
 		}
 		rtio_sqe_prep_read_multishot(sqe, iodev, RTIO_PRIO_NORM, userdata);
 	}
-	rtio_submit(ctx, 0);
-	return 0;
+
+	return rtio_submit(ctx, 0);
 }
 
 static inline int z_impl_adc_get_decoder(const struct device *dev,
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Multiplexing of many alarms onto one counter channel.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_COUNTER_MUX_H_
+#define ZEPHYR_INCLUDE_DRIVERS_COUNTER_MUX_H_
+
+#include <zephyr/drivers/counter.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct counter_mux;
+struct counter_mux_alarm;
+
+/** @brief Multiplexed alarm callback, called in the counter's alarm context.
+ *
+ * The alarm may be re-armed from the callback with
+ * counter_mux_alarm_set().
+ */
+typedef void (*counter_mux_alarm_cb_t)(struct counter_mux *mux,
+				       struct counter_mux_alarm *alarm,
+				       uint32_t ticks, void *user_data);
+
+/** @brief One virtual alarm; contents managed by the mux.
+ *
+ * Zero-initialize before first use.
+ */
+struct counter_mux_alarm {
+	/** @cond INTERNAL_HIDDEN */
+	sys_dnode_t node;
+	uint32_t target;
+	counter_mux_alarm_cb_t cb;
+	void *user_data;
+	/** @endcond */
+};
+
+/** @brief Alarm multiplexer over one hardware alarm channel. */
+struct counter_mux {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *dev;
+	struct k_spinlock lock;
+	sys_dlist_t alarms;
+	uint32_t top;
+	uint8_t chan_id;
+	bool armed;
+	/** @endcond */
+};
+
+/** @brief Initialize an alarm multiplexer on a counter channel.
+ *
+ * The channel must not be used with counter_set_channel_alarm()
+ * directly while the mux owns it. The counter must be started by the
+ * caller.
+ *
+ * @param mux Multiplexer instance.
+ * @param dev Counter device.
+ * @param chan_id Hardware alarm channel to own.
+ *
+ * @retval 0 on success, negative errno otherwise.
+ */
+int counter_mux_init(struct counter_mux *mux, const struct device *dev, uint8_t chan_id);
+
+/** @brief Arm a virtual alarm a number of ticks from now.
+ *
+ * Any number of virtual alarms share the hardware channel; the mux
+ * keeps them ordered by deadline and always programs the earliest one
+ * into the hardware. An already-armed alarm is re-armed with the new
+ * deadline.
+ *
+ * @param mux Multiplexer instance.
+ * @param alarm Virtual alarm storage, alive until it fires or is cancelled.
+ * @param ticks Relative number of ticks until expiry; at most half
+ *              the counter span, which is how wrapped and pending
+ *              deadlines are told apart.
+ * @param cb Callback invoked from the counter's alarm context.
+ * @param user_data Context passed to @p cb.
+ *
+ * @retval 0 on success, negative errno otherwise.
+ */
+int counter_mux_alarm_set(struct counter_mux *mux, struct counter_mux_alarm *alarm,
+			  uint32_t ticks, counter_mux_alarm_cb_t cb, void *user_data);
+
+/** @brief Cancel a pending virtual alarm.
+ *
+ * @param mux Multiplexer instance.
+ * @param alarm Alarm to cancel.
+ *
+ * @retval 0 on success (including an alarm not currently armed).
+ */
+int counter_mux_alarm_cancel(struct counter_mux *mux, struct counter_mux_alarm *alarm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_COUNTER_MUX_H_ */
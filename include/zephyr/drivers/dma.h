@@ -93,6 +93,14 @@ enum dma_attribute_type {
 	DMA_ATTR_BUFFER_SIZE_ALIGNMENT,
 	DMA_ATTR_COPY_ALIGNMENT,
 	DMA_ATTR_MAX_BLOCK_COUNT,
+	/**
+	 * 1 when the driver supports cyclic transfer lists
+	 * (@ref dma_config.cyclic): the descriptor chain wraps onto
+	 * itself and keeps streaming without software rearming. Drivers
+	 * that do not recognize this attribute return an error, which
+	 * callers should treat as "not supported".
+	 */
+	DMA_ATTR_CYCLIC_SUPPORTED,
 };
 
 /**
@@ -250,7 +258,14 @@ struct dma_config {
 	uint32_t  dest_chaining_en :     1;
 	/** Linked channel, HW specific */
 	uint32_t  linked_channel   :     7;
-	/** Cyclic transfer list, HW specific */
+	/** Cyclic transfer list, HW specific. Support is discoverable
+	 * at run time through dma_get_attribute() with
+	 * @ref DMA_ATTR_CYCLIC_SUPPORTED. With a cyclic list the
+	 * configured descriptor chain is persistent: the transfer wraps
+	 * from the last block back to the first and a stopped channel
+	 * can be re-triggered with dma_start() alone, no
+	 * reconfiguration required.
+	 */
 	uint32_t  cyclic :				 1;
 
 	uint32_t  _reserved :             2;
@@ -397,6 +397,54 @@ static inline int z_impl_flash_get_size(const struct device *dev, uint64_t *size
  */
 __syscall int flash_fill(const struct device *dev, uint8_t val, off_t offset, size_t size);
 
+#if defined(CONFIG_FLASH_ASYNC) || defined(__DOXYGEN__)
+/**
+ * @brief State of one asynchronous flash program operation.
+ *
+ * Zero-initialize the structure before its first use;
+ * flash_write_async() fills everything else. The object must stay
+ * alive, and the data buffer untouched, until the completion signal
+ * is raised.
+ */
+struct flash_async_op {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	const struct device *dev;
+	off_t offset;
+	const void *data;
+	size_t len;
+	bool verify;
+	/** @endcond */
+	/** Raised on completion with the operation result */
+	struct k_poll_signal signal;
+};
+
+/**
+ * @brief Queue a flash program operation for background execution.
+ *
+ * The write (and optional read-back verify) runs from the system work
+ * queue; completion is reported through @c op->signal, so the caller
+ * overlaps page program time with preparing the next buffer. Operations
+ * submitted through different op objects execute in submission order.
+ *
+ * @kconfig_dep{CONFIG_FLASH_ASYNC}
+ *
+ * @param dev flash device to write to.
+ * @param op per-operation state, alive until completion.
+ * @param offset starting offset for the write.
+ * @param data data to write.
+ * @param len number of bytes to write.
+ * @param verify read back and compare after programming.
+ *
+ * @retval 0 on successful submission.
+ * @retval -EBUSY when @p op is still in flight.
+ * @retval -EINVAL on invalid arguments.
+ */
+int flash_write_async(const struct device *dev, struct flash_async_op *op, off_t offset,
+		      const void *data, size_t len, bool verify);
+#endif /* CONFIG_FLASH_ASYNC */
+
+
 /**
  *  @brief  Erase part or all of a flash memory or level it
  *
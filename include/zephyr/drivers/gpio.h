@@ -1374,6 +1374,13 @@ static inline int z_impl_gpio_port_set_masked_raw(const struct device *port,
  *
  * Pin with index n is represented by bit n in mask and value parameter.
  *
+ * @note For latency-critical sequences (e.g. bit-banged protocols),
+ * precompute the physical-level values once - folding in any active-low
+ * inversion - and drive the pins with gpio_port_set_masked_raw() or
+ * gpio_port_set_clr_bits_raw(): the raw calls skip the per-call logical
+ * inversion done here, and the set/clear variant applies mixed rising
+ * and falling edges in a single port write.
+ *
  * @param port Pointer to the device structure for the driver instance.
  * @param mask Mask indicating which pins will be modified.
  * @param value Value assigned to the output pins.
@@ -23,6 +23,13 @@ struct i2c_rtio {
 	struct k_spinlock slock;
 	struct rtio *r;
 	struct mpsc io_q;
+#ifdef CONFIG_I2C_RTIO_PRIO
+	/* Pending transactions re-ordered by SQE priority, linked through
+	 * their mpsc node; filled from io_q under slock by the single
+	 * consumer.
+	 */
+	struct mpsc_node *staged_head;
+#endif
 	struct rtio_iodev iodev;
 	struct rtio_iodev_sqe *txn_head;
 	struct rtio_iodev_sqe *txn_curr;
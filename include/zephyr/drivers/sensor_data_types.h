@@ -66,6 +66,41 @@ struct sensor_three_axis_data {
 	} readings[1];
 };
 
+#if defined(CONFIG_SENSOR_DECODE_BURST) || defined(__DOXYGEN__)
+/**
+ * @brief Decode a burst of packed 16-bit three-axis frames in one pass
+ *
+ * Converts @p num_frames frames of three consecutive 16-bit samples
+ * (the common IMU FIFO layout) into @p out, applying an optional byte
+ * swap, axis remap and per-axis sign before promoting each sample to
+ * Q31. With an identity layout and @kconfig{CONFIG_DSP} enabled the
+ * promotion is vectorized through the zdsp backend.
+ *
+ * The caller must size @p out for @p num_frames readings and fill the
+ * header; reading timestamps are set to frame index times
+ * @p timestamp_delta.
+ *
+ * @kconfig_dep{CONFIG_SENSOR_DECODE_BURST}
+ *
+ * @param raw Packed frames: 3 x int16 per frame
+ * @param num_frames Number of frames in @p raw
+ * @param swap_endian True when samples need a byte swap
+ * @param axis_map Optional source index per output axis, NULL for identity
+ * @param axis_sign Optional +1/-1 per output axis, NULL for all positive
+ * @param shift Q31 shift to store in @p out
+ * @param timestamp_delta Nanoseconds between consecutive frames
+ * @param out Decoded data, readings[] sized for @p num_frames
+ *
+ * @retval 0 on success
+ * @retval -EINVAL on NULL buffers or zero frames
+ */
+int sensor_three_axis_decode_q15_burst(const int16_t *raw, uint16_t num_frames,
+				       bool swap_endian, const uint8_t axis_map[3],
+				       const int8_t axis_sign[3], int8_t shift,
+				       uint32_t timestamp_delta,
+				       struct sensor_three_axis_data *out);
+#endif /* CONFIG_SENSOR_DECODE_BURST */
+
 #define PRIsensor_three_axis_data PRIu64 "ns, (%" PRIq(6) ", %" PRIq(6) ", %" PRIq(6) ")"
 
 #define PRIsensor_three_axis_data_arg(data_, readings_offset_)                                     \
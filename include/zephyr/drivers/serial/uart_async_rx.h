@@ -32,11 +32,29 @@ struct uart_async_rx_buf {
 	uint8_t buffer[];
 };
 
+struct uart_async_rx;
+
+/** @brief Called from driver callback context when new data is claimable. */
+typedef void (*uart_async_rx_data_cb_t)(struct uart_async_rx *async_rx, void *user_data);
+
 /** @brief UART asynchronous RX helper structure. */
 struct uart_async_rx {
 	/* Pointer to the configuration structure. Structure must be persistent. */
 	const struct uart_async_rx_config *config;
 
+	/* Set by uart_async_rx_enable(): device, inactivity timeout and
+	 * the user notification used by the bundled event handler.
+	 */
+	const struct device *dev;
+	uart_async_rx_data_cb_t data_cb;
+	void *user_data;
+	int32_t timeout_us;
+
+	/* Set when reception stopped because the ring was exhausted;
+	 * cleared by uart_async_rx_kick().
+	 */
+	atomic_t rx_stopped;
+
 	/* Total amount of pending bytes. Bytes may be spread across multiple RX buffers. */
 	atomic_t pending_bytes;
 
@@ -101,6 +119,43 @@ static inline uint8_t uart_async_rx_get_buf_len(struct uart_async_rx *async_rx)
 int uart_async_rx_init(struct uart_async_rx *async_rx,
 		       const struct uart_async_rx_config *config);
 
+/** @brief Enable reception with the ring managed entirely in callback context.
+ *
+ * Installs a bundled UART callback that answers every
+ * #UART_RX_BUF_REQUEST immediately with the next ring buffer, feeds
+ * received chunks and buffer releases back into the helper, and
+ * re-enables reception from #UART_RX_DISABLED as soon as a buffer is
+ * free - so buffer rotation never waits on application scheduling.
+ * @p data_cb is invoked from driver callback context whenever new data
+ * became claimable; consume it with uart_async_rx_data_claim() and
+ * uart_async_rx_data_consume() from any context.
+ *
+ * The helper must have been initialized with uart_async_rx_init().
+ *
+ * @param dev UART device using the asynchronous API.
+ * @param async_rx Helper instance.
+ * @param timeout_us Inactivity timeout passed to uart_rx_enable().
+ * @param data_cb Data-ready notification, called from callback context.
+ * @param user_data Context passed to @p data_cb.
+ *
+ * @return 0 on success or negative error from the UART API.
+ */
+int uart_async_rx_enable(const struct device *dev, struct uart_async_rx *async_rx,
+			 int32_t timeout_us, uart_async_rx_data_cb_t data_cb, void *user_data);
+
+/** @brief Restart reception stopped by ring exhaustion.
+ *
+ * Only meaningful with uart_async_rx_enable(): when every ring buffer
+ * was full, reception stops on #UART_RX_DISABLED and resumes the next
+ * time this is called with a buffer free. Call it after consuming data
+ * whenever uart_async_rx_data_consume() returned true.
+ *
+ * @param async_rx Helper instance.
+ *
+ * @return 0 on success (including nothing to do) or negative error.
+ */
+int uart_async_rx_kick(struct uart_async_rx *async_rx);
+
 /** @brief Reset state of the helper instance.
  *
  * Helper can be reset after RX abort to discard all received data and bring
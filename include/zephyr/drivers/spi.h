@@ -1094,6 +1094,57 @@ static inline int spi_read_dt(const struct spi_dt_spec *spec,
 	return spi_read(spec->bus, &spec->config, rx_bufs);
 }
 
+/**
+ * @brief One transfer of a batch submitted with spi_transceive_batch().
+ */
+struct spi_transfer {
+	/** Buffers to transmit, or NULL for a pure read */
+	const struct spi_buf_set *tx_bufs;
+	/** Buffers to receive into, or NULL for a pure write */
+	const struct spi_buf_set *rx_bufs;
+};
+
+/**
+ * @brief Perform a sequence of transceive operations with one configuration.
+ *
+ * Every transfer of the batch uses the same @p config pointer, so
+ * drivers reprogram the peripheral at most once for the whole batch
+ * (they detect an unchanged configuration by pointer comparison); each
+ * transfer still gets its own chip-select cycle.  With @ref SPI_LOCK_ON
+ * set in @p config the bus stays locked across the whole batch, keeping
+ * other users from interleaving; release it afterwards with
+ * spi_release().
+ *
+ * Processing stops at the first failing transfer.
+ *
+ * @note This function is synchronous.
+ *
+ * @param dev Pointer to the device structure for the driver instance
+ * @param config Pointer to a valid spi_config structure instance.
+ * @param transfers Array of transfers to perform in order.
+ * @param count Number of transfers in @p transfers.
+ *
+ * @retval 0 If every transfer completed.
+ * @retval -errno Negative errno code of the first failing transfer.
+ */
+static inline int spi_transceive_batch(const struct device *dev,
+				       const struct spi_config *config,
+				       const struct spi_transfer *transfers,
+				       size_t count)
+{
+	int ret;
+
+	for (size_t i = 0; i < count; i++) {
+		ret = spi_transceive(dev, config, transfers[i].tx_bufs,
+				     transfers[i].rx_bufs);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 /**
  * @brief Write the specified amount of data from the SPI driver.
  *
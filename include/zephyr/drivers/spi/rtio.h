@@ -41,6 +41,31 @@ struct spi_rtio {
 		.r = &CONCAT(_name, _r),				       \
 	};
 
+/**
+ * @brief Compile a whole RTIO transaction into SPI buffer sets
+ *
+ * Flattens the transaction starting at @p txn_head into matching
+ * tx/rx buffer sets so a driver can issue the entire transaction as
+ * one transfer (e.g. one DMA descriptor chain) instead of one
+ * hardware transfer and interrupt per submission.
+ *
+ * @param[in] txn_head First submission of the transaction
+ * @param[out] tx_bufs Array of at least @p max_msgs transmit buffers
+ * @param[out] rx_bufs Array of at least @p max_msgs receive buffers
+ * @param[in] max_msgs Capacity of @p tx_bufs and @p rx_bufs
+ * @param[out] tx_buf_set Filled transmit buffer set
+ * @param[out] rx_buf_set Filled receive buffer set
+ *
+ * @retval Number of messages in the buffer sets
+ * @retval -EIO on an invalid submission op code
+ * @retval -ENOMEM when the transaction exceeds @p max_msgs
+ */
+int spi_rtio_txn_bufsets(struct rtio_iodev_sqe *txn_head,
+			 struct spi_buf *tx_bufs, struct spi_buf *rx_bufs,
+			 size_t max_msgs,
+			 struct spi_buf_set *tx_buf_set,
+			 struct spi_buf_set *rx_buf_set);
+
 /**
  * @brief Copy the tx_bufs and rx_bufs into a set of RTIO requests
  *
@@ -137,6 +137,15 @@ struct fcb {
 	/**< The value flash takes when it is erased. This is read from
 	 * flash parameters and initialized upon call to fcb_init.
 	 */
+
+#ifdef CONFIG_FCB_STATS
+	uint32_t f_erase_cnt;
+	/**< Sectors erased since init: erase count divided by appended
+	 * bytes approximates write amplification, internal state
+	 */
+	uint32_t f_append_bytes;
+	/**< Payload bytes appended since init, internal state */
+#endif
 #ifdef CONFIG_FCB_ALLOW_FIXED_ENDMARKER
 	const uint8_t f_flags;
 	/**< Flags for configuring the FCB. */
@@ -181,6 +190,43 @@ int fcb_init(int f_area_id, struct fcb *fcbp);
  */
 int fcb_append(struct fcb *fcbp, uint16_t len, struct fcb_entry *loc);
 
+/** @brief One element of a batched append. */
+struct fcb_batch_entry {
+	const void *data; /**< payload to write */
+	uint16_t len;     /**< payload length */
+};
+
+/**
+ * @brief Append several entries in one locked pass.
+ *
+ * Reserves, writes and finalizes @p cnt entries back to back, taking
+ * the FCB lock once and touching the rotation logic once per sector
+ * boundary instead of per entry, which matters for bursts of small
+ * records.  Entries keep their individual CRCs so the on-flash format
+ * (and every existing reader) is unchanged.
+ *
+ * @param fcbp FCB instance.
+ * @param entries Array of @p cnt payload descriptors.
+ * @param cnt Number of entries.
+ *
+ * @return 0 on success; on error, the negative errno of the first
+ *         failed entry (earlier entries remain appended).
+ */
+int fcb_append_batch(struct fcb *fcbp, const struct fcb_batch_entry *entries,
+		     size_t cnt);
+
+#ifdef CONFIG_FCB_STATS
+/**
+ * @brief Read the append/erase statistics accumulated since init.
+ *
+ * @param fcbp FCB instance.
+ * @param erase_cnt Filled with the number of sector erases.
+ * @param append_bytes Filled with the number of appended payload bytes.
+ */
+void fcb_stats_get(struct fcb *fcbp, uint32_t *erase_cnt,
+		   uint32_t *append_bytes);
+#endif
+
 /**
  * Finishes entry append operation.
  *
@@ -62,6 +62,16 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if defined(CONFIG_NVS_WRITE_CACHE)
+	/** Write-behind cache slots, see nvs_commit() */
+	struct nvs_wcache_entry {
+		uint16_t id;
+		uint16_t len;
+		uint8_t data[CONFIG_NVS_WRITE_CACHE_DATA_SIZE];
+	} wcache[CONFIG_NVS_WRITE_CACHE_SLOTS];
+	/** Auto-flush timer for the write-behind cache */
+	struct k_work_delayable wcache_flush;
+#endif
 };
 
 /**
@@ -112,6 +122,39 @@ int nvs_clear(struct nvs_fs *fs);
  */
 ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len);
 
+#if defined(CONFIG_NVS_LOOKUP_CACHE_STATS) || defined(__DOXYGEN__)
+/** @brief Lookup cache effectiveness counters */
+struct nvs_lookup_cache_stats {
+	/** Reads that started from a cached ATE address */
+	uint32_t probes;
+	/** Reads whose cache slot was empty (full backward walk) */
+	uint32_t empty;
+};
+
+/**
+ * @brief Read the lookup cache statistics accumulated since boot.
+ *
+ * @param stats Filled with the counters.
+ */
+void nvs_lookup_cache_stats_get(struct nvs_lookup_cache_stats *stats);
+#endif
+
+#if defined(CONFIG_NVS_WRITE_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Flush the write-behind cache to flash.
+ *
+ * With @kconfig{CONFIG_NVS_WRITE_CACHE} writes coalesce in RAM
+ * (multiple writes to one id collapse into the latest value) and
+ * reach flash in a batch.  Call this to force everything pending out,
+ * e.g. before an expected power transition; the auto-flush timer and
+ * cache pressure flush it otherwise.
+ *
+ * @param fs Pointer to the file system.
+ * @return 0 on success, negative errno of the first failed write.
+ */
+int nvs_commit(struct nvs_fs *fs);
+#endif
+
 /**
  * @brief Delete an entry from the file system
  *
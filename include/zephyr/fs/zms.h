@@ -65,6 +65,12 @@ struct zms_fs {
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_ZMS_SECTOR_BLOOM
+	/** Per-sector Bloom filter of the IDs written to each sector */
+	uint32_t sector_bloom[CONFIG_ZMS_SECTOR_BLOOM_MAX_SECTORS];
+	/** False when the partition has more sectors than the filter array */
+	bool sector_bloom_enabled;
+#endif
 };
 
 /**
@@ -97,6 +97,9 @@ struct icmsg_data_t {
 	const struct icmsg_config_t *cfg;
 #ifdef CONFIG_MULTITHREADING
 	struct k_work mbox_work;
+#endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_LAZY_NOTIFY
+	struct k_work notify_work;
 #endif
 	uint16_t remote_sid;
 	uint16_t local_sid;
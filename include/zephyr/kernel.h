@@ -23,6 +23,9 @@
 #include <zephyr/sys/mem_stats.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/ring_buffer.h>
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+#include <zephyr/sys/mpsc_lockfree.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -762,6 +765,42 @@ bool k_can_yield(void);
  */
 __syscall void k_yield(void);
 
+#if defined(CONFIG_SYSCALL_BATCH) || defined(__DOXYGEN__)
+/**
+ * @brief One call of a system call batch.
+ */
+struct k_syscall_batch_entry {
+	/** System call ID (K_SYSCALL_* from the generated syscall list) */
+	uint32_t call_id;
+	/** Arguments, in the marshalled register form of the call */
+	uintptr_t args[6];
+	/** Return value of the call, written by k_syscall_batch() */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Execute several system calls with a single user-kernel transition.
+ *
+ * Each entry is dispatched through the same verification handler an
+ * individual trap would use, so per-call argument validation is
+ * unchanged; only the trap overhead is amortized. Entries execute
+ * sequentially and each entry's return value is stored in its @a ret
+ * field. Batching k_syscall_batch() itself is rejected.
+ *
+ * From supervisor threads this returns -ENOSYS: kernel-mode callers
+ * can simply make the calls directly.
+ *
+ * @param entries Array of batch entries.
+ * @param count Number of entries, at most
+ *              @kconfig{CONFIG_SYSCALL_BATCH_MAX_CALLS}.
+ *
+ * @retval 0 when every entry was dispatched.
+ * @retval -EINVAL on an invalid count or call ID.
+ * @retval -ENOSYS when invoked from supervisor mode.
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count);
+#endif /* CONFIG_SYSCALL_BATCH */
+
 /**
  * @brief Wake up a sleeping thread.
  *
@@ -1121,6 +1160,32 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
  */
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
 
+/**
+ * @brief Reserve execution bandwidth for a deadline thread
+ *
+ * Grants the thread a constant-bandwidth reservation of @a budget
+ * execution cycles per @a period cycles (both in k_cycle_get_32()
+ * units) and performs admission control over all reservations.  A
+ * thread that exhausts its budget has its deadline postponed by one
+ * period per replenished budget the next time it is queued, keeping
+ * an over-running thread from starving other deadline threads or
+ * lower-priority work.  Pass a zero budget to drop the reservation.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_DEADLINE_BANDWIDTH} in
+ * your project configuration.
+ *
+ * @param thread A thread on which to set the reservation
+ * @param budget Execution budget per period, in cycles
+ * @param period Replenishment period, in cycles
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if the budget exceeds the period, or the period is zero
+ * @retval -EBUSY if admitting the reservation would exceed one CPU's
+ *         worth of total bandwidth
+ */
+__syscall int k_thread_deadline_budget_set(k_tid_t thread, uint32_t budget,
+					   uint32_t period);
+
 /**
  * @brief Set absolute deadline expiration time for scheduler
  *
@@ -2255,6 +2320,16 @@ struct k_queue {
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	/* Lock-free staging queue filled by k_queue_append() and
+	 * drained into data_q under the lock, plus the count of
+	 * pending (or committing-to-pend) consumers the append fast
+	 * path checks to know when a wakeup is needed.
+	 */
+	struct mpsc append_q;
+	atomic_t waiters;
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 	Z_DECL_POLL_EVENT
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_queue)
@@ -2264,11 +2339,18 @@ struct k_queue {
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+#define Z_QUEUE_MPSC_INITIALIZER(obj) .append_q = MPSC_INIT(obj.append_q),
+#else
+#define Z_QUEUE_MPSC_INITIALIZER(obj)
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 #define Z_QUEUE_INITIALIZER(obj) \
 	{ \
 	.data_q = SYS_SFLIST_STATIC_INIT(&obj.data_q), \
 	.lock = { }, \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q),	\
+	Z_QUEUE_MPSC_INITIALIZER(obj)		\
 	Z_POLL_EVENT_OBJ_INIT(obj)		\
 	}
 
@@ -2492,6 +2574,12 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	if (mpsc_ptr_get(queue->append_q.head) != &queue->append_q.stub) {
+		/* staged appends not yet drained into data_q */
+		return 0;
+	}
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
 	return sys_sflist_is_empty(&queue->data_q) ? 1 : 0;
 }
 
@@ -2607,6 +2695,73 @@ __syscall int k_futex_wait(struct k_futex *futex, int expected,
  */
 __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 
+#ifdef CONFIG_FUTEX_BITSET_OPS
+/**
+ * @brief Pend the current thread on a futex, tagged with a bitset
+ *
+ * Like k_futex_wait(), but the waiter is tagged with @a bitset and is
+ * only eligible to be woken by k_futex_wake_bitset() calls whose
+ * bitset intersects it (or by the untagged k_futex_wake()).  Mirrors
+ * FUTEX_WAIT_BITSET.
+ *
+ * @param futex Address of the futex.
+ * @param expected Expected value of the futex, otherwise -EAGAIN.
+ * @param bitset Non-zero wakeup selection mask.
+ * @param timeout Waiting period, or one of the special values
+ *                K_NO_WAIT and K_FOREVER.
+ *
+ * @retval -EACCES Caller does not have access to the futex address.
+ * @retval -EAGAIN Current futex value does not match the expected one.
+ * @retval -EINVAL Futex not recognized or bitset is zero.
+ * @retval -ETIMEDOUT Thread woke up due to timeout and not a wakeup.
+ * @retval 0 if the caller went to sleep and was woken up.
+ */
+__syscall int k_futex_wait_bitset(struct k_futex *futex, int expected,
+				  uint32_t bitset, k_timeout_t timeout);
+
+/**
+ * @brief Wake futex waiters selected by a bitset
+ *
+ * Wakes only those waiters whose wait bitset intersects @a bitset
+ * (untagged k_futex_wait() waiters match everything).  Mirrors
+ * FUTEX_WAKE_BITSET.
+ *
+ * @param futex Futex to wake up pending threads.
+ * @param wake_all If true, wake all matching threads; if false, only
+ *                 the first matching waiter in queue order.
+ * @param bitset Non-zero wakeup selection mask.
+ *
+ * @retval -EACCES Caller does not have access to the futex address.
+ * @retval -EINVAL Futex not recognized or bitset is zero.
+ * @retval Number of threads that were woken up.
+ */
+__syscall int k_futex_wake_bitset(struct k_futex *futex, bool wake_all,
+				  uint32_t bitset);
+#endif /* CONFIG_FUTEX_BITSET_OPS */
+
+#ifdef CONFIG_FUTEX_REQUEUE
+/**
+ * @brief Wake some waiters and requeue the rest onto another futex
+ *
+ * Wakes up to @a wake_count waiters of @a futex, then migrates all
+ * remaining waiters onto @a target without waking them; their
+ * timeouts stay armed.  In the style of FUTEX_CMP_REQUEUE: fails
+ * with -EAGAIN when the futex value does not match @a expected.
+ *
+ * @param futex Futex whose waiters are woken/requeued.
+ * @param expected Expected value of the futex, otherwise -EAGAIN.
+ * @param wake_count Maximum number of waiters to wake.
+ * @param target Futex the remaining waiters are moved to.
+ *
+ * @retval -EACCES Caller does not have access to a futex address.
+ * @retval -EAGAIN Current futex value does not match the expected one.
+ * @retval -EINVAL A futex was not recognized, or futex == target.
+ * @retval Number of threads that were woken up.
+ */
+__syscall int k_futex_requeue(struct k_futex *futex, int expected,
+			      unsigned int wake_count, struct k_futex *target);
+#endif /* CONFIG_FUTEX_REQUEUE */
+
 /** @} */
 #endif
 
@@ -2636,6 +2791,18 @@ struct k_event {
 	uint32_t          events;
 	struct k_spinlock lock;
 
+#ifdef CONFIG_EVENTS_INDEXED_WAIT
+	/* Waiter index: one list per event bit for single-bit wait
+	 * masks plus a catch-all for multi-bit masks, so a post only
+	 * visits threads whose masks can intersect the posted bits.
+	 * Lazily initialized (index_ready) so static definition stays
+	 * simple.
+	 */
+	sys_dlist_t bit_waiters[32];
+	sys_dlist_t misc_waiters;
+	uint8_t index_ready;
+#endif /* CONFIG_EVENTS_INDEXED_WAIT */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -3516,6 +3683,15 @@ __syscall int k_mutex_unlock(struct k_mutex *mutex);
 struct k_condvar {
 	_wait_q_t wait_q;
 
+#ifdef CONFIG_CONDVAR_WAIT_MORPH
+	/* Mutex associated by the most recent k_condvar_wait(); all
+	 * concurrent waiters must use the same mutex (the usual
+	 * condition variable contract), which lets broadcast morph
+	 * waiters onto its wait queue.
+	 */
+	struct k_mutex *mutex;
+#endif /* CONFIG_CONDVAR_WAIT_MORPH */
+
 #ifdef CONFIG_OBJ_CORE_CONDVAR
 	struct k_obj_core  obj_core;
 #endif
@@ -3611,7 +3787,15 @@ struct k_sem {
 	 * @cond INTERNAL_HIDDEN
 	 */
 	_wait_q_t wait_q;
+#ifdef CONFIG_SEM_FAST_PATH
+	atomic_t count;
+	/* Threads pending (or committed to pending) on wait_q; read
+	 * locklessly by the k_sem_give() fast path.
+	 */
+	atomic_t waiters;
+#else
 	unsigned int count;
+#endif
 	unsigned int limit;
 
 	Z_DECL_POLL_EVENT
@@ -3620,6 +3804,9 @@ struct k_sem {
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	struct k_obj_core  obj_core;
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	struct k_obj_core_sampled_stats  obj_core_stats;
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif
 	/** @endcond */
 };
@@ -3727,7 +3914,7 @@ __syscall unsigned int k_sem_count_get(struct k_sem *sem);
  */
 static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 {
-	return sem->count;
+	return (unsigned int)sem->count;
 }
 
 /**
@@ -3952,6 +4139,45 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 int k_work_submit(struct k_work *work);
 
+/** @brief Submit a batch of work items under one lock acquisition.
+ *
+ * Equivalent to calling k_work_submit_to_queue() for each element of
+ * @a works, but the whole array is enqueued under a single spinlock
+ * acquisition followed by a single reschedule point, which matters
+ * when bursts of small items are submitted from one place.
+ *
+ * Submission stops at the first item whose submission fails; earlier
+ * items remain queued.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue, or NULL for the system queue.
+ * @param works array of pointers to work items.
+ * @param count number of elements in @a works.
+ *
+ * @retval the number of items newly queued on success
+ * @retval negative errno from k_work_submit_to_queue() for the first
+ *         item whose submission failed
+ */
+int k_work_submit_batch(struct k_work_q *queue, struct k_work **works,
+			size_t count);
+
+#ifdef CONFIG_WORKQUEUE_PRIORITY_BANDS
+/** @brief Assign a work item to a priority band.
+ *
+ * Work queues built with @kconfig{CONFIG_WORKQUEUE_PRIORITY_BANDS}
+ * keep one FIFO per band and always run the oldest item of the
+ * highest-priority non-empty band.  Items default to band 0 (the
+ * highest); give slow, latency-tolerant items a larger band number so
+ * they stop delaying short jobs.  Must not be called while the item
+ * is queued.
+ *
+ * @param work pointer to the work item.
+ * @param prio band index, 0 through K_WORK_NUM_PRIO_BANDS - 1.
+ */
+static inline void k_work_priority_set(struct k_work *work, uint8_t prio);
+#endif /* CONFIG_WORKQUEUE_PRIORITY_BANDS */
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -4066,6 +4292,39 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/** @brief Start a work queue backed by a pool of worker threads.
+ *
+ * Like k_work_queue_start(), but the queue is animated by @a nworkers
+ * threads pulling from the shared pending list, so independent items
+ * run in parallel across CPUs.  Submission still goes through
+ * k_work_submit_to_queue() and friends; callers don't change.  Items
+ * have no mutual ordering or exclusion guarantees beyond dequeue
+ * order, as with any multi-worker pool.
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before use.
+ *
+ * @param workers array of @a nworkers uninitialized thread structures.
+ *
+ * @param stacks stack array created with K_THREAD_STACK_ARRAY_DEFINE().
+ *
+ * @param stack_size size of each stack in the array, in bytes.
+ *
+ * @param nworkers number of worker threads.
+ *
+ * @param prio initial priority of the worker threads.
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_start_pool(struct k_work_q *queue, struct k_thread *workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     size_t nworkers, int prio,
+			     const struct k_work_queue_config *cfg);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /** @brief Run work queue using calling thread
  *
  * This will run the work queue forever unless stopped by @ref k_work_queue_stop.
@@ -4501,6 +4760,11 @@ enum {
 	K_WORK_FLUSHING = BIT(K_WORK_FLUSHING_BIT),
 };
 
+#ifdef CONFIG_WORKQUEUE_PRIORITY_BANDS
+/** Number of FIFO priority bands in a work queue */
+#define K_WORK_NUM_PRIO_BANDS 4
+#endif /* CONFIG_WORKQUEUE_PRIORITY_BANDS */
+
 /** @brief A structure used to submit work. */
 struct k_work {
 	/* All fields are protected by the work module spinlock.  No fields
@@ -4523,6 +4787,14 @@ struct k_work {
 	 * It can be RUNNING and CANCELING simultaneously.
 	 */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_PRIORITY_BANDS
+	/* FIFO band within the queue, 0 (highest priority) through
+	 * K_WORK_NUM_PRIO_BANDS - 1; set via k_work_priority_set()
+	 * before submission.
+	 */
+	uint8_t prio;
+#endif /* CONFIG_WORKQUEUE_PRIORITY_BANDS */
 };
 
 #define Z_WORK_INITIALIZER(work_handler) { \
@@ -4677,8 +4949,14 @@ struct k_work_q {
 	 * work module spinlock is held.
 	 */
 
-	/* List of k_work items to be worked. */
+	/* List of k_work items to be worked; one FIFO per priority
+	 * band when CONFIG_WORKQUEUE_PRIORITY_BANDS is enabled.
+	 */
+#ifdef CONFIG_WORKQUEUE_PRIORITY_BANDS
+	sys_slist_t pending[K_WORK_NUM_PRIO_BANDS];
+#else
 	sys_slist_t pending;
+#endif /* CONFIG_WORKQUEUE_PRIORITY_BANDS */
 
 	/* Wait queue for idle work thread. */
 	_wait_q_t notifyq;
@@ -4689,6 +4967,22 @@ struct k_work_q {
 	/* Flags describing queue state. */
 	uint32_t flags;
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Worker thread pool fanning out this queue, or NULL when the
+	 * queue runs on a single thread as usual.
+	 */
+	struct k_thread *workers;
+
+	/* Number of pool workers (fixed at start) */
+	uint16_t nworkers;
+
+	/* Pool workers that have not yet exited after a stop */
+	uint16_t alive;
+
+	/* Pool workers currently executing a handler */
+	uint16_t active;
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
 	struct _timeout work_timeout_record;
 	struct k_work *work;
@@ -4703,6 +4997,13 @@ static inline bool k_work_is_pending(const struct k_work *work)
 	return k_work_busy_get(work) != 0;
 }
 
+#ifdef CONFIG_WORKQUEUE_PRIORITY_BANDS
+static inline void k_work_priority_set(struct k_work *work, uint8_t prio)
+{
+	work->prio = prio;
+}
+#endif /* CONFIG_WORKQUEUE_PRIORITY_BANDS */
+
 static inline struct k_work_delayable *
 k_work_delayable_from_work(struct k_work *work)
 {
@@ -5072,6 +5373,8 @@ int k_work_poll_cancel(struct k_work_poll *work);
 struct k_msgq {
 	/** Message queue wait queue */
 	_wait_q_t wait_q;
+	/** Threads waiting out an open reservation or claim */
+	_wait_q_t excl_wait_q;
 	/** Lock */
 	struct k_spinlock lock;
 	/** Message size */
@@ -5098,6 +5401,9 @@ struct k_msgq {
 
 #ifdef CONFIG_OBJ_CORE_MSGQ
 	struct k_obj_core  obj_core;
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	struct k_obj_core_sampled_stats  obj_core_stats;
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 #endif
 };
 /**
@@ -5108,6 +5414,7 @@ struct k_msgq {
 #define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.excl_wait_q = Z_WAIT_Q_INIT(&obj.excl_wait_q), \
 	.lock = {}, \
 	.msg_size = q_msg_size, \
 	.max_msgs = q_max_msgs, \
@@ -5126,6 +5433,10 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+/* Internal: a producer slot reservation is outstanding */
+#define K_MSGQ_FLAG_RESERVED	BIT(1)
+/* Internal: a consumer claim is outstanding */
+#define K_MSGQ_FLAG_CLAIMED	BIT(2)
 
 /**
  * @brief Message Queue Attributes
@@ -5302,6 +5613,84 @@ __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
  */
 __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
 
+/**
+ * @brief Reserve the next message slot for in-place construction
+ *
+ * Returns a pointer to the slot that the next committed message will
+ * occupy so the payload can be built directly in the ring buffer,
+ * avoiding the producer-side copy of k_msgq_put().  The slot becomes
+ * visible to consumers only after k_msgq_commit().
+ *
+ * Only one reservation may be outstanding per queue.  While one is
+ * open, concurrent k_msgq_put() callers wait for the commit (their
+ * timeout applies; K_NO_WAIT fails as if the queue were full), so the
+ * copying API interoperates safely with in-place construction.
+ * Not available from user mode.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Filled with the address of the reserved message slot.
+ *
+ * @retval 0 Slot reserved.
+ * @retval -ENOMSG Returned when the queue is full.
+ * @retval -EBUSY A reservation is already outstanding.
+ */
+int k_msgq_reserve(struct k_msgq *msgq, void **slot);
+
+/**
+ * @brief Commit a slot reserved with k_msgq_reserve()
+ *
+ * Publishes the reserved message.  If a consumer is already pending,
+ * the payload is copied straight into its buffer (the only copy on
+ * the whole path) and the ring slot is recycled.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message committed.
+ * @retval -EINVAL No reservation was outstanding.
+ */
+int k_msgq_commit(struct k_msgq *msgq);
+
+/**
+ * @brief Claim the oldest message in place
+ *
+ * Returns a pointer to the oldest message, leaving it in the queue so
+ * it can be consumed without the reader-side copy of k_msgq_get().
+ * The slot is recycled by k_msgq_release().  Only one claim may be
+ * outstanding per queue; while one is open, concurrent k_msgq_get()
+ * and k_msgq_put_front() callers wait for the release (K_NO_WAIT
+ * fails as if the queue were empty or full respectively).  Not
+ * available from user mode.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Filled with the address of the claimed message.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned when the queue has no message.
+ * @retval -EBUSY A claim is already outstanding.
+ */
+int k_msgq_peek_claim(struct k_msgq *msgq, void **slot);
+
+/**
+ * @brief Release a message claimed with k_msgq_peek_claim()
+ *
+ * Frees the claimed slot, making room for pending or future
+ * producers.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @retval 0 Message released.
+ * @retval -EINVAL No claim was outstanding.
+ */
+int k_msgq_release(struct k_msgq *msgq);
+
 /**
  * @brief Peek/read a message from a message queue at the specified index
  *
@@ -5405,6 +5794,22 @@ struct k_mbox_msg {
 	/** internal use only - semaphore used during asynchronous send */
 	struct k_sem *_async_sem;
 #endif
+#ifdef CONFIG_MBOX_BUF_TRANSFER
+	/**
+	 * Ownership release hook, or NULL for plain copy semantics.
+	 * Invoked exactly once with (tx_data, tx_buf_done_data) when
+	 * the message is disposed of, i.e. when the receiver has
+	 * consumed or dropped it.  Point it at a refcounted buffer
+	 * release (e.g. a net_buf_unref() wrapper) to pass buffers
+	 * through the mailbox without copying: the receiver reads
+	 * tx_data in place (deferred retrieval with a NULL buffer)
+	 * and takes its own reference before disposal if it keeps
+	 * the buffer.
+	 */
+	void (*tx_buf_done)(void *tx_data, void *user_data);
+	/** user data for the ownership release hook */
+	void *tx_buf_done_data;
+#endif /* CONFIG_MBOX_BUF_TRANSFER */
 };
 /**
  * @brief Mailbox Structure
@@ -5644,6 +6049,60 @@ __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
 __syscall int k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len,
 			  k_timeout_t timeout);
 
+/** @brief Scatter-gather segment for k_pipe_writev() and k_pipe_readv() */
+struct k_pipe_iovec {
+	/** Segment base address */
+	void *base;
+	/** Segment length in bytes */
+	size_t len;
+};
+
+/** Maximum number of segments accepted per vectored pipe operation */
+#define K_PIPE_IOV_MAX 8
+
+/**
+ * @brief Write a gathered vector of buffers to a pipe
+ *
+ * Writes the @a iovcnt segments of @a iov to @a pipe in order, under
+ * a single lock session and with one wakeup cycle, as if they were
+ * one contiguous buffer.  Pending readers are served by the same
+ * direct writer-to-reader copy fast path as k_pipe_write().
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of segments to write.
+ * @param iovcnt Number of segments (at most @ref K_PIPE_IOV_MAX).
+ * @param timeout Waiting period shared by the whole vector.
+ *
+ * @retval number of bytes written on success (including short writes
+ *         cut off by the timeout)
+ * @retval -EAGAIN if no data could be written before the timeout expired
+ * @retval -ECANCELED if the write was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ */
+__syscall int k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			    size_t iovcnt, k_timeout_t timeout);
+
+/**
+ * @brief Read a scattered vector of buffers from a pipe
+ *
+ * Fills the @a iovcnt segments of @a iov from @a pipe in order, under
+ * a single lock session and with one wakeup cycle, as if they were
+ * one contiguous buffer.
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of segments to fill.
+ * @param iovcnt Number of segments (at most @ref K_PIPE_IOV_MAX).
+ * @param timeout Waiting period shared by the whole vector.
+ *
+ * @retval number of bytes read on success (including short reads cut
+ *         off by the timeout or a closed pipe)
+ * @retval -EAGAIN if no data could be read before the timeout expired
+ * @retval -ECANCELED if the read was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed and had no data
+ */
+__syscall int k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			   size_t iovcnt, k_timeout_t timeout);
+
 /**
  * @brief Reset a pipe
  * This routine resets the pipe, discarding any unread data and unblocking any threads waiting to
@@ -5672,7 +6131,11 @@ __syscall void k_pipe_close(struct k_pipe *pipe);
 struct k_mem_slab_info {
 	uint32_t num_blocks;
 	size_t   block_size;
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	atomic_t num_used;
+#else
 	uint32_t num_used;
+#endif
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
@@ -5682,7 +6145,16 @@ struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
 	char *buffer;
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	/* Treiber stack of block indexes with an ABA tag packed into
+	 * the same atomic word; see slab_pop()/slab_push().
+	 */
+	atomic_t free_head;
+	/* Threads pending (or committing to pend) for a free block */
+	atomic_t waiters;
+#else
 	char *free_list;
+#endif
 	struct k_mem_slab_info info;
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
@@ -5692,13 +6164,19 @@ struct k_mem_slab {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+#define Z_MEM_SLAB_FREE_INITIALIZER .free_head = ATOMIC_INIT(0),
+#else
+#define Z_MEM_SLAB_FREE_INITIALIZER .free_list = NULL,
+#endif
+
 #define Z_MEM_SLAB_INITIALIZER(_slab, _slab_buffer, _slab_block_size, \
 			       _slab_num_blocks)                      \
 	{                                                             \
 	.wait_q = Z_WAIT_Q_INIT(&(_slab).wait_q),                     \
 	.lock = {},                                                   \
 	.buffer = _slab_buffer,                                       \
-	.free_list = NULL,                                            \
+	Z_MEM_SLAB_FREE_INITIALIZER                                   \
 	.info = {_slab_num_blocks, _slab_block_size, 0}               \
 	}
 
@@ -5775,6 +6253,104 @@ struct k_mem_slab {
 	K_MEM_SLAB_DEFINE_IN_SECT(name, __noinit_named(k_mem_slab_buf_##name), slab_block_size,    \
 				  slab_num_blocks, slab_align)
 
+#ifdef CONFIG_MEM_SLAB_CACHE_ALIGNED
+/**
+ * @brief Statically define a memory slab with cache-line padded blocks.
+ *
+ * Like K_MEM_SLAB_DEFINE(), but each block is padded up to a multiple
+ * of the data cache line size and the buffer is cache-line aligned,
+ * so adjacent blocks never share a cache line and CPUs working on
+ * neighbouring blocks stop false-sharing.
+ *
+ * @param name Name of the memory slab.
+ * @param slab_block_size Payload size of each memory block (in bytes).
+ * @param slab_num_blocks Number of memory blocks.
+ */
+#define K_MEM_SLAB_DEFINE_CACHE_ALIGNED(name, slab_block_size, slab_num_blocks)                    \
+	K_MEM_SLAB_DEFINE(name, ROUND_UP(slab_block_size, CONFIG_DCACHE_LINE_SIZE),                \
+			  slab_num_blocks, CONFIG_DCACHE_LINE_SIZE)
+
+/**
+ * @brief Statically define a striped set of per-CPU memory slabs.
+ *
+ * Defines an array of CONFIG_MP_MAX_NUM_CPUS cache-line padded slabs
+ * (@a name[0] through @a name[N-1]), each holding @a blocks_per_cpu
+ * blocks, for use with k_mem_slab_striped_alloc()/free().  Keeping
+ * each CPU allocating from its own stripe keeps it on its own cache
+ * lines.
+ *
+ * @param name Name of the slab array.
+ * @param slab_block_size Payload size of each memory block (in bytes).
+ * @param blocks_per_cpu Number of blocks per CPU stripe.
+ */
+#define K_MEM_SLAB_STRIPED_DEFINE(name, slab_block_size, blocks_per_cpu)                           \
+	static char __noinit                                                                       \
+		__aligned(CONFIG_DCACHE_LINE_SIZE) _k_mem_slab_buf_##name                          \
+		[CONFIG_MP_MAX_NUM_CPUS]                                                           \
+		[(blocks_per_cpu) * ROUND_UP(slab_block_size, CONFIG_DCACHE_LINE_SIZE)];           \
+	static struct k_mem_slab name[CONFIG_MP_MAX_NUM_CPUS]
+
+/**
+ * @brief Initialize a striped slab set defined with K_MEM_SLAB_STRIPED_DEFINE().
+ *
+ * Call once before first use.
+ *
+ * @param name Name of the slab array.
+ * @param slab_block_size Payload size passed to the define macro.
+ * @param blocks_per_cpu Blocks per stripe passed to the define macro.
+ */
+#define K_MEM_SLAB_STRIPED_INIT(name, slab_block_size, blocks_per_cpu)                             \
+	k_mem_slab_striped_init(name, _k_mem_slab_buf_##name,                                      \
+				ROUND_UP(slab_block_size, CONFIG_DCACHE_LINE_SIZE),                \
+				blocks_per_cpu)
+
+/**
+ * @brief Allocate a block from a striped slab set.
+ *
+ * Tries the calling CPU's stripe first and falls back to the other
+ * stripes, so allocation affinity keeps each CPU on its own cache
+ * lines while full stripes borrow from their neighbours.  Never
+ * blocks.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param stripes Slab array from K_MEM_SLAB_STRIPED_DEFINE().
+ * @param mem Filled with the address of the allocated block.
+ *
+ * @retval 0 Block allocated.
+ * @retval -ENOMEM All stripes are exhausted.
+ */
+int k_mem_slab_striped_alloc(struct k_mem_slab *stripes, void **mem);
+
+/**
+ * @brief Free a block obtained from k_mem_slab_striped_alloc().
+ *
+ * The owning stripe is recovered from the block address.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param stripes Slab array from K_MEM_SLAB_STRIPED_DEFINE().
+ * @param mem Block to free.
+ */
+void k_mem_slab_striped_free(struct k_mem_slab *stripes, void *mem);
+
+/**
+ * @brief Initialize a striped slab set at run time.
+ *
+ * Assigns each stripe its slice of the backing buffer; usually
+ * invoked through K_MEM_SLAB_STRIPED_INIT().
+ *
+ * @param stripes Slab array of CONFIG_MP_MAX_NUM_CPUS entries.
+ * @param buffer Backing buffer of CONFIG_MP_MAX_NUM_CPUS slices.
+ * @param block_size Padded block size.
+ * @param blocks_per_cpu Blocks per stripe.
+ *
+ * @retval 0 on success, -EINVAL on bad parameters.
+ */
+int k_mem_slab_striped_init(struct k_mem_slab *stripes, void *buffer,
+			    size_t block_size, uint32_t blocks_per_cpu);
+#endif /* CONFIG_MEM_SLAB_CACHE_ALIGNED */
+
 /**
  * @brief Statically define and initialize a memory slab in a user-provided memory section with
  * private (static) scope.
@@ -5978,10 +6554,26 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+/* Number of small size classes kept in the per-CPU front-end cache */
+#define K_HEAP_CACHE_NUM_CLASSES 4
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	/* Magazine front-end: singly linked free lists of small
+	 * blocks per size class and CPU, touched only with
+	 * interrupts masked on the owning CPU, so the hot small
+	 * alloc/free path skips the heap lock entirely.
+	 */
+	struct {
+		void *classes[K_HEAP_CACHE_NUM_CLASSES];
+		uint8_t count[K_HEAP_CACHE_NUM_CLASSES];
+	} cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif /* CONFIG_KHEAP_CPU_CACHE */
 };
 
 /**
@@ -6110,6 +6702,118 @@ void *k_heap_realloc(struct k_heap *h, void *ptr, size_t bytes, k_timeout_t time
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+#ifdef CONFIG_ARENA_ALLOCATOR
+/**
+ * @brief Arena (bump pointer) allocator
+ *
+ * Serves allocations by advancing an offset into a fixed region;
+ * individual allocations cannot be freed, the whole population is
+ * released at once by k_arena_reset() in O(1).  An optional backing
+ * k_heap absorbs allocations that no longer fit; spilled blocks are
+ * returned to the heap on reset.  For per-thread arenas simply give
+ * each thread its own object.  Kernel mode only, like k_heap.
+ */
+struct k_arena {
+	struct k_spinlock lock;
+	uint8_t *base;
+	size_t size;
+	size_t offset;
+	struct k_heap *spill;
+	sys_slist_t spill_blocks;
+};
+
+/**
+ * @brief Initialize an arena
+ *
+ * @param arena Arena to initialize.
+ * @param mem Backing region.
+ * @param size Size of the backing region in bytes.
+ * @param spill Heap absorbing overflow allocations, or NULL.
+ */
+void k_arena_init(struct k_arena *arena, void *mem, size_t size,
+		  struct k_heap *spill);
+
+/**
+ * @brief Allocate from an arena
+ *
+ * Allocation is a bounds check and an offset bump; when the region is
+ * exhausted the request spills to the backing heap (K_NO_WAIT).
+ * There is no matching free: memory is reclaimed by k_arena_reset().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param arena Arena to allocate from.
+ * @param bytes Number of bytes requested.
+ * @return Pointer to memory, or NULL when neither the region nor the
+ *         backing heap can satisfy the request.
+ */
+void *k_arena_alloc(struct k_arena *arena, size_t bytes);
+
+/**
+ * @brief Allocate aligned memory from an arena
+ *
+ * @funcprops \isr_ok
+ *
+ * @param arena Arena to allocate from.
+ * @param align Alignment, must be a power of two.
+ * @param bytes Number of bytes requested.
+ * @return Pointer to memory, or NULL.
+ */
+void *k_arena_aligned_alloc(struct k_arena *arena, size_t align, size_t bytes);
+
+/**
+ * @brief Release every allocation of an arena at once
+ *
+ * Rewinds the bump offset and returns any spilled blocks to the
+ * backing heap.  All memory previously returned by the arena becomes
+ * invalid.
+ *
+ * @param arena Arena to reset.
+ */
+void k_arena_reset(struct k_arena *arena);
+
+/**
+ * @brief Bytes left in the arena region
+ *
+ * @param arena Arena to query.
+ * @return Remaining capacity of the bump region, not counting the
+ *         backing heap.
+ */
+size_t k_arena_remaining(struct k_arena *arena);
+
+/**
+ * @brief Statically define and initialize an arena
+ *
+ * @param name Name of the arena.
+ * @param bytes Size of the backing region.
+ * @param spill_heap Address of a backing k_heap, or NULL.
+ */
+#define K_ARENA_DEFINE(name, bytes, spill_heap)				\
+	static uint8_t __noinit __aligned(sizeof(void *) * 2)		\
+		_k_arena_buf_##name[bytes];				\
+	static struct k_arena name = {					\
+		.base = _k_arena_buf_##name,				\
+		.size = (bytes),					\
+		.offset = 0,						\
+		.spill = (spill_heap),					\
+		.spill_blocks = SYS_SLIST_STATIC_INIT(&name.spill_blocks), \
+	}
+#endif /* CONFIG_ARENA_ALLOCATOR */
+
+#ifdef CONFIG_KHEAP_CPU_CACHE
+/**
+ * @brief Flush the calling CPU's heap cache magazines
+ *
+ * Returns every block held in the calling CPU's per-CPU front-end
+ * cache of @a h to the shared heap, waking any blocked allocators.
+ * Useful before entering low power states or when memory pressure
+ * matters more than allocation latency.
+ *
+ * @param h Heap whose cache to trim.
+ */
+void k_heap_cache_trim(struct k_heap *h) __attribute_nonnull(1);
+#endif /* CONFIG_KHEAP_CPU_CACHE */
+
 /* Minimum heap sizes needed to return a successful 1-byte allocation.
  * Assumes a chunk aligned (8 byte) memory buffer.
  */
@@ -6542,6 +7246,81 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+#ifdef CONFIG_POLL_SET
+/**
+ * @brief Persistent poll set
+ *
+ * A poll set keeps k_poll_event registrations alive across waits, in
+ * the style of epoll: events are registered once with
+ * k_poll_set_add() and each k_poll_set_wait() costs O(delivered)
+ * rather than the O(registered) re-registration loop of k_poll().
+ * Readiness is parked on an internal ready list until collected.
+ *
+ * All members are internal.  Kernel mode only, and intended for a
+ * single waiting thread per set.
+ */
+struct k_poll_set {
+	sys_dlist_t ready;      /* events that fired, not yet handed out */
+	sys_dlist_t delivered;  /* events handed out by the last wait */
+	_wait_q_t wait_q;
+	struct z_poller poller;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set Poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event's registration persists until k_poll_set_remove().  If
+ * its condition is already met it is immediately queued for delivery
+ * by the next k_poll_set_wait().  The event must not be in use by
+ * k_poll() or another set.
+ *
+ * @param set Poll set.
+ * @param event Initialized poll event (see k_poll_event_init()).
+ *
+ * @retval 0 Event added.
+ * @retval -EBUSY The event is already registered somewhere.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set Poll set.
+ * @param event Event previously added with k_poll_set_add().
+ *
+ * @retval 0 Event removed.
+ * @retval -EINVAL The event was not part of the set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to become ready.
+ *
+ * Re-arms the events delivered by the previous wait, then blocks
+ * until at least one registered event fires, filling @a ready with up
+ * to @a num_events ready events.  The state field of each returned
+ * event holds the triggering state; it is reset when the event is
+ * re-armed by the next wait.
+ *
+ * @param set Poll set.
+ * @param ready Output array of ready event pointers.
+ * @param num_events Capacity of @a ready.
+ * @param timeout Waiting period, or K_NO_WAIT / K_FOREVER.
+ *
+ * @retval n The number of ready events stored (n >= 1).
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int num_events, k_timeout_t timeout);
+#endif /* CONFIG_POLL_SET */
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -6827,6 +7606,36 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats);
  */
 int k_thread_runtime_stats_cpu_get(int cpu, k_thread_runtime_stats_t *stats);
 
+/**
+ * @brief Thread wakeup latency statistics
+ *
+ * Log2 histogram of the cycle-counter latency between a thread
+ * becoming ready and being switched in.  Bucket N counts samples in
+ * the range [2^N, 2^(N+1)) cycles (bucket 0 covers [0, 2)).
+ */
+struct k_thread_latency_stats {
+	uint32_t buckets[32];   /* samples per power-of-two latency range */
+	uint64_t num_samples;   /* total recorded wakeups */
+	uint64_t total_cycles;  /* summed latency of all samples */
+	uint32_t max_cycles;    /* worst observed latency */
+};
+
+/**
+ * @brief Get the accumulated wakeup latency statistics
+ *
+ * Sums the per-CPU histograms collected since boot (or the last call
+ * to k_thread_latency_stats_reset()).  Requires
+ * CONFIG_SCHED_LATENCY_STATS.
+ *
+ * @param stats Pointer to struct to copy statistics into.
+ */
+void k_thread_latency_stats_get(struct k_thread_latency_stats *stats);
+
+/**
+ * @brief Reset the accumulated wakeup latency statistics
+ */
+void k_thread_latency_stats_reset(void);
+
 /**
  * @brief Enable gathering of runtime statistics for specified thread
  *
@@ -6874,6 +7683,20 @@ void k_sys_runtime_stats_disable(void);
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/syscalls/kernel.h>
 
+#ifdef CONFIG_THREAD_CUSTOM_DATA_IN_TLS
+extern Z_THREAD_LOCAL void *z_thread_custom_data;
+
+/* Supersede the syscall (and, when enabled, syscall tracing) wrappers
+ * above: with the value kept in the thread's TLS area a direct
+ * load/store works from both kernel and user mode, like
+ * CONFIG_ERRNO_IN_TLS does for errno.
+ */
+#undef k_thread_custom_data_get
+#undef k_thread_custom_data_set
+#define k_thread_custom_data_get() (z_thread_custom_data)
+#define k_thread_custom_data_set(value) ((void)(z_thread_custom_data = (value)))
+#endif /* CONFIG_THREAD_CUSTOM_DATA_IN_TLS */
+
 #endif /* !_ASMLANGUAGE */
 
 #endif /* ZEPHYR_INCLUDE_KERNEL_H_ */
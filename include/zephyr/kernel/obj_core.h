@@ -390,5 +390,39 @@ int k_obj_core_stats_disable(struct k_obj_core *obj_core);
  */
 int k_obj_core_stats_enable(struct k_obj_core *obj_core);
 
+#if defined(CONFIG_OBJ_CORE_STATS_SAMPLED) || defined(__DOXYGEN__)
+
+/** Number of operations each sampled tally stands for */
+#define K_OBJ_CORE_STATS_SAMPLE_WEIGHT \
+	(1U << CONFIG_OBJ_CORE_STATS_SAMPLE_SHIFT)
+
+/**
+ * @brief Operation counts gathered by sampled collection
+ *
+ * Only every Nth operation observed on a CPU is tallied (N being
+ * @ref K_OBJ_CORE_STATS_SAMPLE_WEIGHT) and each tally adds N, so the
+ * counts converge on the true operation totals while the remaining
+ * operations pay only for a per-CPU counter decrement. The counts are
+ * statistical estimates and are updated without locking.
+ */
+struct k_obj_core_sampled_stats {
+	uint64_t produced; /**< Estimated give/put style operations */
+	uint64_t consumed; /**< Estimated take/get style operations */
+};
+
+/**
+ * @brief Decide whether the current operation is to be tallied
+ *
+ * Advances the current CPU's decimation counter. Callers record the
+ * operation, weighted by @ref K_OBJ_CORE_STATS_SAMPLE_WEIGHT, only
+ * when this returns true.
+ *
+ * @retval true if the caller is to record this operation
+ * @retval false if this operation goes uncounted
+ */
+bool k_obj_core_stats_sample(void);
+
+#endif /* CONFIG_OBJ_CORE_STATS_SAMPLED */
+
 /** @} */
 #endif /* __KERNEL_OBJ_CORE_H__ */
@@ -88,6 +88,17 @@ struct _thread_base {
 
 #ifdef CONFIG_SCHED_DEADLINE
 	int prio_deadline;
+
+#ifdef CONFIG_SCHED_DEADLINE_BANDWIDTH
+	/* Constant-bandwidth reservation, in k_cycle_get_32() units.
+	 * A zero budget means "no reservation".  budget_left is
+	 * signed because a thread can overrun by up to one accounting
+	 * quantum before the charge lands.
+	 */
+	uint32_t dl_budget;
+	uint32_t dl_period;
+	int32_t dl_budget_left;
+#endif /* CONFIG_SCHED_DEADLINE_BANDWIDTH */
 #endif /* CONFIG_SCHED_DEADLINE */
 
 #if defined(CONFIG_SCHED_SCALABLE) || defined(CONFIG_WAITQ_SCALABLE)
@@ -131,6 +142,21 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK
+	/** Unused-stack bytes found by the last watermark query; scans
+	 * only descend from here, since painted stack is never repainted.
+	 * Zero means no query has run yet.
+	 */
+	size_t stack_unused_cache;
+#endif
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/* Cycle counter value when the thread last became ready,
+	 * zeroed once the switch-in accounting has consumed it.
+	 */
+	uint32_t wakeup_cycle;
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -281,6 +307,11 @@ struct k_thread {
 
 	/** true if timeout should not wake the thread */
 	bool no_wake_on_timeout;
+
+#ifdef CONFIG_EVENTS_INDEXED_WAIT
+	/** membership in a k_event per-bit (or catch-all) waiter index */
+	sys_dnode_t event_node;
+#endif /* CONFIG_EVENTS_INDEXED_WAIT */
 #endif /* CONFIG_EVENTS */
 
 #if defined(CONFIG_THREAD_MONITOR)
@@ -122,6 +122,14 @@ struct _priq_rb {
 struct _priq_mq {
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
 	unsigned long bitmask[PRIQ_BITMAP_SIZE];
+#if PRIQ_BITMAP_SIZE > 1
+	/* Second bitmap level: bit N set when bitmask[N] is nonzero.
+	 * Makes best-queue selection two find-first-set operations
+	 * regardless of how many priority levels are configured, and
+	 * (unlike the cached index below) stays valid under SMP.
+	 */
+	unsigned long bitmask_summary;
+#endif
 #ifndef CONFIG_SMP
 	unsigned int cached_queue_index;
 #endif
@@ -157,7 +165,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -199,6 +207,11 @@ struct _cpu {
 	sys_dlist_t ipi_workq;
 #endif
 
+#ifdef CONFIG_IPI_COALESCE
+	/* Causes to process at the next z_sched_ipi() on this CPU */
+	atomic_t ipi_causes;
+#endif
+
 	/* Per CPU architecture specifics */
 	struct _cpu_arch arch;
 };
@@ -216,7 +229,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -234,6 +247,14 @@ struct z_kernel {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	/* Identify CPUs to send IPIs to at the next scheduling point */
 	atomic_t pending_ipi;
+
+#ifdef CONFIG_IPI_COALESCE
+	/* CPUs with a scheduler IPI sent but not yet taken; no new
+	 * IPI is sent to them, they pick up fresh causes in the
+	 * interrupt they are already due to take.
+	 */
+	atomic_t ipi_inflight;
+#endif
 #endif
 };
 
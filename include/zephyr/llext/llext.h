@@ -260,6 +260,28 @@ int llext_load(struct llext_loader *loader, const char *name, struct llext **ext
  */
 int llext_unload(struct llext **ext);
 
+#if defined(CONFIG_LLEXT_RELOAD_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Free a cached extension.
+ *
+ * With @kconfig{CONFIG_LLEXT_RELOAD_CACHE}, llext_unload() keeps the
+ * fully linked image resident when the use count reaches zero so a
+ * following llext_load() of the same name is instant. This call
+ * performs the actual teardown of such a cached, unused extension and
+ * releases its memory.
+ *
+ * A cached extension keeps the state of its data sections; purge it
+ * first if a subsequent load must start from a freshly initialized
+ * image.
+ *
+ * @param ext Extension to purge; set to NULL on success.
+ *
+ * @retval 0 on success.
+ * @retval >0 the extension is still in use (its use count).
+ */
+int llext_purge(struct llext **ext);
+#endif /* CONFIG_LLEXT_RELOAD_CACHE */
+
 /**
  * @brief Free any inspection-related memory for the specified loader and extension.
  *
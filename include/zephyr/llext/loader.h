@@ -58,6 +58,17 @@ enum llext_storage_type {
 	 * always accessible for as long as the extension is loaded. LLEXT may
 	 * directly reuse constant data from the buffer, but may still allocate
 	 * copies if relocations need to be applied.
+	 *
+	 * This is the execute-in-place mode for memory-mapped storage:
+	 * read-only regions without relocations - .text included, when the
+	 * storage is instruction-fetchable and the region meets the
+	 * platform's alignment rules - are used directly from the buffer
+	 * via llext_peek(), and RAM is allocated only for writable and
+	 * relocated regions. Code that must XIP therefore needs to be
+	 * built so its text carries no load-time relocations (or be fully
+	 * pre-located with a linker script and loaded with
+	 * @ref llext_load_param.pre_located); text that the linker must
+	 * patch cannot execute from read-only storage.
 	 */
 	LLEXT_STORAGE_PERSISTENT,
 	/**
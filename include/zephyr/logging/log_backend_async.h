@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_ASYNC_H_
+#define ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_ASYNC_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/sys/mpsc_pbuf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous backend wrapper context.
+ *
+ * Instantiated by LOG_BACKEND_ASYNC_DEFINE(); all members internal.
+ */
+struct log_backend_async_ctx {
+	const struct log_backend_api *real_api;
+	const struct log_backend *backend;
+	struct mpsc_pbuf_buffer pbuf;
+	uint32_t *buf;
+	uint32_t buf_wlen;
+	struct k_sem sem;
+	struct k_thread thread;
+	k_thread_stack_t *stack;
+	size_t stack_size;
+	int prio;
+	uint32_t dropped;
+	bool panic;
+};
+
+void log_backend_async_process(const struct log_backend *const backend,
+			       union log_msg_generic *msg);
+void log_backend_async_dropped(const struct log_backend *const backend,
+			       uint32_t cnt);
+void log_backend_async_panic(const struct log_backend *const backend);
+void log_backend_async_init(const struct log_backend *const backend);
+
+/**
+ * @brief Define an asynchronous wrapper around a backend API.
+ *
+ * The wrapped backend's process()/panic()/init() run from a dedicated
+ * thread fed by a private message queue, so a slow backend (flash,
+ * network) stops delaying the shared log processing thread and the
+ * fast backends on it.  When the private queue overflows only this
+ * backend drops messages (reported through its dropped() handler);
+ * on panic the queue drains synchronously and messages pass through.
+ *
+ * @param _name Name for the wrapper backend.
+ * @param _real_api The wrapped struct log_backend_api.
+ * @param _buf_words Queue buffer size in 32-bit words.
+ * @param _stack_size Flush thread stack size.
+ * @param _prio Flush thread priority.
+ * @param _autostart Automatically activate the backend.
+ */
+#define LOG_BACKEND_ASYNC_DEFINE(_name, _real_api, _buf_words,		\
+				 _stack_size, _prio, _autostart)	\
+	static uint32_t _name##_async_buf[_buf_words];			\
+	static K_KERNEL_STACK_DEFINE(_name##_async_stack, _stack_size);	\
+	static struct log_backend_async_ctx _name##_async_ctx = {	\
+		.real_api = &(_real_api),				\
+		.buf = _name##_async_buf,				\
+		.buf_wlen = (_buf_words),				\
+		.stack = _name##_async_stack,				\
+		.stack_size = K_KERNEL_STACK_SIZEOF(_name##_async_stack), \
+		.prio = (_prio),					\
+	};								\
+	static const struct log_backend_api _name##_async_api = {	\
+		.process = log_backend_async_process,			\
+		.dropped = log_backend_async_dropped,			\
+		.panic = log_backend_async_panic,			\
+		.init = log_backend_async_init,				\
+	};								\
+	LOG_BACKEND_DEFINE(_name, _name##_async_api, _autostart,	\
+			   &_name##_async_ctx)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_ASYNC_H_ */
@@ -520,6 +520,19 @@ do { \
 	bool has_rw_str = CBPRINTF_MUST_RUNTIME_PACKAGE( \
 					Z_LOG_MSG_CBPRINTF_FLAGS(_cstr_cnt), \
 					__VA_ARGS__); \
+	IF_ENABLED(CONFIG_LOG_FORBID_RUNTIME_PACKAGING, ( \
+		/* Catch call sites whose arguments force runtime \
+		 * cbprintf packaging (read-write strings): they pay \
+		 * the format-walking cost this option forbids.  The \
+		 * condition constant-folds for static call sites, so \
+		 * the reference below evaporates; offending sites \
+		 * fail the link naming this symbol. \
+		 */ \
+		if (has_rw_str) { \
+			extern void z_log_runtime_packaging_forbidden(void); \
+			z_log_runtime_packaging_forbidden(); \
+		} \
+	)) \
 	if (IS_ENABLED(CONFIG_LOG_SPEED) && (_try_0cpy) && ((_dlen) == 0) && !has_rw_str) {\
 		LOG_MSG_DBG("create zero-copy message\n");\
 		Z_LOG_MSG_SIMPLE_CREATE(_cstr_cnt, _domain_id, _source, \
@@ -249,6 +249,22 @@ void coap_client_cancel_request(struct coap_client *client, struct coap_client_r
  */
 struct coap_client_option coap_client_option_initial_block2(void);
 
+/**
+ * @brief Build a block2 option for starting a transfer at a given block.
+ *
+ * Lets an application split one large resource into several ranges and
+ * fetch them through parallel requests (each request slot has its own
+ * token and retransmission state), reassembling by the absolute offset
+ * reported to the response callback. The block size is the configured
+ * @kconfig{CONFIG_COAP_CLIENT_BLOCK_SIZE}.
+ *
+ * @param block_num Block number to start from, capped to the maximum
+ *                  block number.
+ *
+ * @return CoAP client initial block2 option structure.
+ */
+struct coap_client_option coap_client_option_block2(uint32_t block_num);
+
 /**
  * @brief Check if client has ongoing exchange.
  *
@@ -347,6 +347,74 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+#if defined(CONFIG_HTTP_CLIENT_PIPELINING) || defined(__DOXYGEN__)
+/**
+ * @brief Pipeline several HTTP requests over one connection.
+ *
+ * All requests are sent back to back before any response is read, then
+ * the responses are received in order, so a burst costs one round trip
+ * instead of one per request. The server must support HTTP/1.1
+ * keep-alive; responses are matched to requests by order as the
+ * protocol requires.
+ *
+ * @param sock Socket id of the connection.
+ * @param reqs Array of request pointers, sent in order.
+ * @param num_reqs Number of requests.
+ * @param timeout Max timeout for the whole exchange, in milliseconds.
+ * @param user_data User specified data passed to the callbacks.
+ *
+ * @return <0 if error, >=0 total amount of data sent to the server
+ */
+int http_client_pipeline(int sock, struct http_request **reqs, size_t num_reqs,
+			 int32_t timeout, void *user_data);
+#endif /* CONFIG_HTTP_CLIENT_PIPELINING */
+
+#if defined(CONFIG_HTTP_CLIENT_POOL) || defined(__DOXYGEN__)
+/**
+ * @brief Get a pooled keep-alive connection for a host.
+ *
+ * The returned socket is marked busy until released. Socket creation
+ * stays with the application: on -ENOENT, connect as usual and hand
+ * the socket to the pool with http_client_pool_add().
+ *
+ * @param host Peer host name.
+ * @param port Peer port.
+ *
+ * @return Socket id, or -ENOENT when no idle pooled connection exists.
+ */
+int http_client_pool_get(const char *host, uint16_t port);
+
+/**
+ * @brief Place an established connection into the pool.
+ *
+ * The connection is marked busy for the caller; release it with
+ * http_client_pool_release(). An idle pooled connection may be closed
+ * to make room.
+ *
+ * @param host Peer host name.
+ * @param port Peer port.
+ * @param sock Connected socket id, ownership moves to the pool.
+ *
+ * @return 0 if ok, -EALREADY if the peer is already pooled, -ENOMEM
+ *	   when every pool slot is busy.
+ */
+int http_client_pool_add(const char *host, uint16_t port, int sock);
+
+/**
+ * @brief Return a pooled connection after use.
+ *
+ * @param sock Socket id obtained from the pool.
+ * @param keep true to keep the connection alive for reuse, false to
+ *	  close it (e.g. after a Connection: close response or error).
+ */
+void http_client_pool_release(int sock, bool keep);
+
+/**
+ * @brief Close every idle pooled connection.
+ */
+void http_client_pool_purge(void);
+#endif /* CONFIG_HTTP_CLIENT_POOL */
+
 #ifdef __cplusplus
 }
 #endif
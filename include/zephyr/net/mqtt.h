@@ -1087,6 +1087,30 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to publish messages on topic with a scattered payload.
+ *
+ * Like mqtt_publish(), but the payload is gathered from an array of
+ * buffers (e.g. the fragments of a net_buf chain) without flattening
+ * it first. The @c message.payload.len field of @p param must hold the
+ * total payload length; its data pointer is ignored.
+ *
+ * @param[in] client Identifies client instance for which procedure is
+ *                   requested.
+ * @param[in] param Publish message parameters.
+ * @param[in] payload Array of payload fragments.
+ * @param[in] payload_count Number of fragments, at most
+ *                          @c MQTT_PUBLISH_MAX_IOVEC.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_vec(struct mqtt_client *client,
+		     const struct mqtt_publish_param *param,
+		     const struct net_iovec *payload, size_t payload_count);
+
+/** Maximum number of payload fragments accepted by mqtt_publish_vec(). */
+#define MQTT_PUBLISH_MAX_IOVEC 8
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
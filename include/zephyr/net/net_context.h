@@ -223,6 +223,27 @@ __net_socket struct net_context {
 	 */
 	struct k_mutex lock;
 
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+	/** Zero-copy TX completion callback: invoked (from the TCP
+	 *  stack context) when a buffer queued by a zero-copy send
+	 *  has been fully acknowledged and may be reused.
+	 */
+	void (*zc_complete_cb)(struct net_context *context, void *buf,
+			       size_t len, void *user_data);
+	/** User data for the zero-copy completion callback */
+	void *zc_user_data;
+#endif /* CONFIG_NET_TCP_ZEROCOPY_TX */
+
+#if defined(CONFIG_NET_UDP_TX_TEMPLATE)
+	/** Cached IPv4+UDP header image for connected-send replay;
+	 *  see udp_template_capture() in net_context.c.
+	 */
+	struct {
+		uint8_t hdr[NET_IPV4UDPH_LEN];
+		bool valid;
+	} tx_template;
+#endif /* CONFIG_NET_UDP_TX_TEMPLATE */
+
 	/** Local endpoint address. Note that the values are in network byte
 	 * order.
 	 */
@@ -444,6 +465,30 @@ __net_socket struct net_context {
  *
  * @return True if the context is currently in use, False otherwise.
  */
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+/**
+ * @brief Register a zero-copy TX completion callback.
+ *
+ * While a callback is registered, plain (non-iovec) sends on a TCP
+ * context queue the caller's buffer by reference instead of copying
+ * it; the callback fires once the bytes are acknowledged and the
+ * buffer may be reused.  Unregister by passing NULL.
+ *
+ * @param context Network context.
+ * @param cb Completion callback, or NULL to return to copying sends.
+ * @param user_data Passed through to the callback.
+ */
+static inline void net_context_set_zerocopy_cb(
+	struct net_context *context,
+	void (*cb)(struct net_context *context, void *buf, size_t len,
+		   void *user_data),
+	void *user_data)
+{
+	context->zc_complete_cb = cb;
+	context->zc_user_data = user_data;
+}
+#endif /* CONFIG_NET_TCP_ZEROCOPY_TX */
+
 static inline bool net_context_is_used(struct net_context *context)
 {
 	NET_ASSERT(context);
@@ -727,6 +727,13 @@ struct net_if {
 	/** The net_if_dev instance the net_if is related to */
 	struct net_if_dev *if_dev;
 
+#if CONFIG_NET_TC_TX_BYTE_LIMIT > 0
+	/** Bytes currently sitting in this interface's TX traffic class
+	 * queues, for the queue byte limit.
+	 */
+	atomic_t tx_bytes_queued;
+#endif
+
 #if defined(CONFIG_NET_STATISTICS_PER_INTERFACE)
 	/** Network statistics related to this network interface */
 	struct net_stats stats;
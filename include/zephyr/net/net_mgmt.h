@@ -308,6 +308,17 @@ void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb);
 #if defined(CONFIG_NET_MGMT_EVENT)
 void net_mgmt_event_notify_with_info(uint64_t mgmt_event, struct net_if *iface,
 				     const void *info, size_t length);
+
+/**
+ * @brief Get the number of events lost to event queue overflow
+ *
+ * Counts events that could not be queued for deferred handling since
+ * boot. Always returns 0 when @kconfig{CONFIG_NET_MGMT_EVENT_QUEUE}
+ * is disabled, since events are then delivered synchronously.
+ *
+ * @return Number of dropped events.
+ */
+uint32_t net_mgmt_event_queue_dropped(void);
 #else
 #define net_mgmt_event_notify_with_info(...)
 #endif
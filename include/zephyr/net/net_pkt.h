@@ -237,6 +237,13 @@ struct net_pkt {
 	uint8_t chksum_done : 1; /* Checksum has already been computed for
 				  * the packet.
 				  */
+#if defined(CONFIG_NET_PKT_TX_MORE)
+	uint8_t tx_more : 1;	 /* More packets are queued right behind
+				  * this one; the driver may batch its
+				  * hardware submission (defer the TX
+				  * doorbell) like Linux xmit_more.
+				  */
+#endif
 	uint8_t loopback : 1; /* Packet is a loop back packet. */
 #if defined(CONFIG_NET_IP_FRAGMENT)
 	uint8_t ip_reassembled : 1; /* Packet is a reassembled IP packet. */
@@ -576,6 +583,31 @@ static inline void net_pkt_set_chksum_done(struct net_pkt *pkt,
 	pkt->chksum_done = is_chksum_done;
 }
 
+#if defined(CONFIG_NET_PKT_TX_MORE)
+static inline bool net_pkt_tx_more(struct net_pkt *pkt)
+{
+	return !!(pkt->tx_more);
+}
+
+static inline void net_pkt_set_tx_more(struct net_pkt *pkt, bool tx_more)
+{
+	pkt->tx_more = tx_more;
+}
+#else
+static inline bool net_pkt_tx_more(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_pkt_set_tx_more(struct net_pkt *pkt, bool tx_more)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(tx_more);
+}
+#endif /* CONFIG_NET_PKT_TX_MORE */
+
 static inline uint8_t net_pkt_ip_hdr_len(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_IP)
@@ -2167,6 +2199,33 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
  */
 void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer);
 
+#if defined(CONFIG_NET_PKT_DRIVER_BUF) || defined(__DOXYGEN__)
+/**
+ * @brief Build an RX packet around a driver-owned buffer chain.
+ *
+ * Zero-copy reception support: instead of allocating stack buffers
+ * and copying the frame out of the DMA ring, a driver defines its own
+ * net_buf pool whose buffers are handed to the DMA engine, and passes
+ * the filled buffer (chain) here.  Only the packet descriptor is
+ * allocated; the packet takes over the caller's buffer reference, and
+ * once the stack unrefs the packet the buffer returns to the driver's
+ * pool, whose destroy callback can recycle it straight back into the
+ * RX ring.  The buffer's length fields must already describe the
+ * received frame.
+ *
+ * @param iface The network interface the packet arrived on.
+ * @param buffer DMA-filled buffer chain to loan to the stack.
+ * @param timeout Maximum time to wait for a packet descriptor.
+ *
+ * @return a pointer to a newly allocated packet on success, NULL
+ *         otherwise (in which case the caller keeps its buffer
+ *         reference).
+ */
+struct net_pkt *net_pkt_rx_alloc_on_buf(struct net_if *iface,
+					struct net_buf *buffer,
+					k_timeout_t timeout);
+#endif /* CONFIG_NET_PKT_DRIVER_BUF */
+
 /**
  * @brief Get available buffer space from a pkt
  *
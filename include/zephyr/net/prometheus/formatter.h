@@ -49,6 +49,23 @@ int prometheus_format_exposition(struct prometheus_collector *collector, char *b
 int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 				 size_t buffer_size, int *written);
 
+#if defined(CONFIG_PROMETHEUS_PRERENDER) || defined(__DOXYGEN__)
+/**
+ * @brief Pre-render the stable exposition text of a metric
+ *
+ * Renders the HELP and TYPE lines, and for counters and gauges the
+ * per-label sample prefixes, into an internal arena so that a scrape
+ * only formats the values. Called by the collector at metric
+ * registration; the metric falls back to full formatting when the
+ * arena is exhausted.
+ *
+ * @param metric Pointer to the metric to pre-render.
+ *
+ * @return 0 on success, -ENOMEM when the arena is exhausted.
+ */
+int prometheus_metric_prerender(struct prometheus_metric *metric);
+#endif /* CONFIG_PROMETHEUS_PRERENDER */
+
 /**
  * @}
  */
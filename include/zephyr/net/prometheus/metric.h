@@ -64,6 +64,14 @@ struct prometheus_metric {
 	struct prometheus_label labels[MAX_PROMETHEUS_LABELS_PER_METRIC];
 	/** Number of labels associated with the Prometheus metric. */
 	int num_labels;
+#if defined(CONFIG_PROMETHEUS_PRERENDER)
+	/** Pre-rendered HELP and TYPE lines, NULL until registered */
+	const char *render_head;
+	/** Pre-rendered per-label sample prefixes, NUL separated */
+	const char *render_sample;
+	/** Length of the pre-rendered head */
+	uint16_t render_head_len;
+#endif /* CONFIG_PROMETHEUS_PRERENDER */
 	/** User defined data */
 	void *user_data;
 	/* Add any other necessary fields */
@@ -145,6 +145,68 @@ int sntp_read_async(struct net_socket_service_event *event, struct sntp_time *ts
  */
 void sntp_close_async(const struct net_socket_service_desc *service);
 
+#if defined(CONFIG_SNTP_SERVICE) || defined(__DOXYGEN__)
+
+/**
+ * @brief Callback invoked by the SNTP client service after each
+ *	  successful poll.
+ *
+ * @param time Time reported by the server.
+ * @param drift_ppb Smoothed local clock drift estimate in parts per
+ *	  billion, positive when the local clock runs slow.
+ * @param user_data User data given to sntp_service_start().
+ */
+typedef void (*sntp_service_cb_t)(const struct sntp_time *time,
+				  int32_t drift_ppb, void *user_data);
+
+/**
+ * @brief Start the persistent SNTP client service
+ *
+ * Keeps one socket open and polls the server periodically (interval
+ * set by @kconfig{CONFIG_SNTP_SERVICE_POLL_INTERVAL}, with +/- 12.5 %
+ * jitter) over @kconfig{CONFIG_NET_SOCKETS_SERVICE}, estimating the
+ * local clock drift between polls. No calling thread blocks on the
+ * network at any point.
+ *
+ * @param addr IP address of NTP/SNTP server.
+ * @param addr_len IP address length of NTP/SNTP server.
+ * @param cb Callback invoked after each successful poll, may be NULL.
+ * @param user_data User data passed to the callback.
+ *
+ * @return 0 if ok, -EALREADY if already started, <0 other errors.
+ */
+int sntp_service_start(struct net_sockaddr *addr, net_socklen_t addr_len,
+		       sntp_service_cb_t cb, void *user_data);
+
+/**
+ * @brief Stop the persistent SNTP client service
+ *
+ * @return 0 if ok, -EALREADY if not running.
+ */
+int sntp_service_stop(void);
+
+/**
+ * @brief Get the current time extrapolated from the last poll
+ *
+ * Combines the last server time, the uptime elapsed since it, and the
+ * drift estimate; costs no network traffic.
+ *
+ * @param ts Time output.
+ *
+ * @return 0 if ok, -ENODATA before the first successful poll.
+ */
+int sntp_service_time_get(struct sntp_time *ts);
+
+/**
+ * @brief Get the smoothed local clock drift estimate
+ *
+ * @return Drift in parts per billion, positive when the local clock
+ *	   runs slow.
+ */
+int32_t sntp_service_drift_ppb(void);
+
+#endif /* CONFIG_SNTP_SERVICE */
+
 /**
  * @brief Convenience function to query SNTP in one-shot fashion
  *
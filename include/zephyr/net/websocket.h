@@ -178,6 +178,34 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		       uint32_t *message_type, uint64_t *remaining,
 		       int32_t timeout);
 
+/**
+ * @brief Receive a view into the next websocket payload span.
+ *
+ * @details Unlike websocket_recv_msg(), the payload is not copied out:
+ * the returned pointer refers directly into the receive buffer given to
+ * websocket_register() or websocket_connect(), with the websocket header
+ * stripped and the payload already unmasked in place. The view stays
+ * valid until the next websocket API call on this socket, which reclaims
+ * the buffer space. A large message is delivered as a sequence of spans;
+ * use @p remaining to detect the message boundary.
+ *
+ * @param ws_sock Websocket id returned by websocket_connect().
+ * @param payload_view Set to point at the payload bytes.
+ * @param message_type Type of the message.
+ * @param remaining How much data is left in the message after this span.
+ * @param timeout How long to try to receive the message.
+ *        The value is in milliseconds. Value SYS_FOREVER_MS means to wait
+ *        forever.
+ *
+ * @retval >=0 length of the payload view.
+ * @retval -EAGAIN on timeout.
+ * @retval -ENOTCONN on socket close.
+ * @retval -errno other negative errno value in case of failure.
+ */
+int websocket_recv_msg_view(int ws_sock, uint8_t **payload_view,
+			    uint32_t *message_type, uint64_t *remaining,
+			    int32_t timeout);
+
 /**
  * @brief Close websocket.
  *
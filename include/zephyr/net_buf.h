@@ -1083,6 +1083,13 @@ struct net_buf_pool {
 	/** To prevent concurrent access/modifications */
 	struct k_spinlock lock;
 
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+	/** Per-CPU magazines of free buffers, see buf.c */
+	struct net_buf *cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+	/** Buffers held per CPU magazine */
+	uint8_t cpu_cache_count[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 	/** Number of buffers in pool */
 	const uint16_t buf_count;
 
@@ -1562,6 +1569,36 @@ void net_buf_slist_put(sys_slist_t *list, struct net_buf *buf);
  */
 struct net_buf * __must_check net_buf_slist_get(sys_slist_t *list);
 
+/**
+ * @brief Allocate multiple buffers from a pool in one call.
+ *
+ * Allocates @a count buffers, amortizing the allocation overhead (and
+ * with CONFIG_NET_BUF_CPU_CACHE, serving most of them from the CPU
+ * local magazine without touching the pool lock).  All-or-nothing:
+ * on failure every buffer already allocated is released and -ENOMEM
+ * returned.  The timeout bounds the whole operation.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param bufs Output array of @a count buffer pointers.
+ * @param count Number of buffers to allocate.
+ * @param timeout Affects the action taken should the pool be empty.
+ *
+ * @retval 0 All buffers allocated.
+ * @retval -ENOMEM Pool exhausted before the timeout.
+ */
+int net_buf_alloc_bulk(struct net_buf_pool *pool, struct net_buf **bufs,
+		       size_t count, k_timeout_t timeout);
+
+/**
+ * @brief Release an array of buffers.
+ *
+ * Unreferences every non-NULL entry of @a bufs and NULLs it out.
+ *
+ * @param bufs Array of buffers to release.
+ * @param count Number of entries in @a bufs.
+ */
+void net_buf_unref_bulk(struct net_buf **bufs, size_t count);
+
 /**
  * @brief Decrements the reference count of a buffer.
  *
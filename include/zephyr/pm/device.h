@@ -200,6 +200,14 @@ struct pm_device_base {
 #if defined(CONFIG_PM_DEVICE_RUNTIME) || defined(__DOXYGEN__)
 	/** Device usage count */
 	uint32_t usage;
+#ifdef CONFIG_PM_DEVICE_RUNTIME_FAST_PATH
+	/** Lock-free reference count used by the runtime-PM fast path.
+	 * Non-zero only while the device is active and no suspend or
+	 * resume transition is in flight, which is what makes the
+	 * lock-free increment/decrement safe.
+	 */
+	atomic_t fast_refs;
+#endif
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 #ifdef CONFIG_PM_DEVICE_POWER_DOMAIN
 	/** Power Domain it belongs */
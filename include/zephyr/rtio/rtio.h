@@ -416,6 +416,51 @@ struct rtio_cqe_pool {
  *
  * No work is started until rtio_submit() is called.
  */
+#ifdef CONFIG_RTIO_USER_RING
+/** Completion record delivered through a user ring */
+struct rtio_user_cqe {
+	/** Result from operation */
+	int32_t result;
+	/** Associated userdata from the submission */
+	void *userdata;
+	/** Flags from the completion; RTIO_USER_CQE_F_VALID is owned by the ring */
+	uint32_t flags;
+};
+
+/** Marks a user ring completion slot as filled; cleared by the consumer */
+#define RTIO_USER_CQE_F_VALID BIT(31)
+
+/**
+ * @brief Shared-memory submission/completion ring control block
+ *
+ * Placed in memory accessible to the user thread (e.g. the RTIO
+ * partition). The user produces submissions and consumes completions
+ * with plain memory operations; the kernel consumes submissions and
+ * produces completions. Indexes are free-running and masked by the
+ * power-of-two sizes.
+ */
+struct rtio_user_ring {
+	/** Submission slots consumed (kernel side) */
+	atomic_t sq_head;
+	/** Submission slots produced (user side) */
+	atomic_t sq_tail;
+	/** Completion slots consumed (user side) */
+	atomic_t cq_head;
+	/** Completion slots produced (kernel side) */
+	atomic_t cq_tail;
+	/** Non-zero while the kernel is draining; doorbell only when 0 */
+	atomic_t kernel_active;
+	/** Power-of-two number of submission slots */
+	uint16_t sq_size;
+	/** Power-of-two number of completion slots */
+	uint16_t cq_size;
+	/** Submission slot array */
+	struct rtio_sqe *sq;
+	/** Completion slot array */
+	struct rtio_user_cqe *cq;
+};
+#endif /* CONFIG_RTIO_USER_RING */
+
 struct rtio {
 #ifdef CONFIG_RTIO_SUBMIT_SEM
 	/* A wait semaphore which may suspend the calling thread
@@ -458,6 +503,22 @@ struct rtio {
 
 	/* Completion queue */
 	struct mpsc cq;
+
+#ifdef CONFIG_RTIO_USER_RING
+	/* Attached user ring control block and kernel-side snapshots of
+	 * its entry arrays, sizes, bound iodev and allowed buffer region.
+	 * The snapshots are taken at attach time so a user thread cannot
+	 * redirect the kernel after validation.
+	 */
+	struct rtio_user_ring *u_ring;
+	struct rtio_sqe *u_sq;
+	struct rtio_user_cqe *u_cq;
+	struct rtio_iodev *u_iodev;
+	uintptr_t u_region;
+	size_t u_region_size;
+	uint16_t u_sq_size;
+	uint16_t u_cq_size;
+#endif
 };
 
 /** The memory partition associated with all RTIO context information */
@@ -1273,6 +1334,105 @@ static inline struct rtio_cqe *rtio_cqe_consume_block(struct rtio *r)
 	return cqe;
 }
 
+/**
+ * @brief Consume a batch of completion queue events if available
+ *
+ * Claims up to @p n completion queue events in one call, paying the
+ * consumer-side synchronization once per batch instead of once per
+ * event. Each returned event must eventually be released with
+ * rtio_cqe_release().
+ *
+ * @param r RTIO context
+ * @param cqes Array to fill with consumed completion queue events
+ * @param n Size of @p cqes
+ *
+ * @return Number of completion queue events consumed, possibly 0
+ */
+static inline size_t rtio_cqe_consume_batch(struct rtio *r, struct rtio_cqe **cqes, size_t n)
+{
+	size_t i = 0;
+
+	while (i < n) {
+		struct mpsc_node *node;
+
+#ifdef CONFIG_RTIO_CONSUME_SEM
+		if (k_sem_take(r->consume_sem, K_NO_WAIT) != 0) {
+			break;
+		}
+
+		node = mpsc_pop(&r->cq);
+		while (node == NULL) {
+			/* The semaphore guarantees a produced event; ride
+			 * out the window where its push is not yet linked.
+			 */
+			Z_SPIN_DELAY(1);
+			node = mpsc_pop(&r->cq);
+		}
+#else
+		node = mpsc_pop(&r->cq);
+		if (node == NULL) {
+			break;
+		}
+#endif
+		cqes[i++] = CONTAINER_OF(node, struct rtio_cqe, q);
+	}
+
+	return i;
+}
+
+/**
+ * @brief Wait for and consume a batch of completion queue events
+ *
+ * Blocks until at least one completion queue event is available or the
+ * deadline passes, then keeps collecting until @p n events are claimed
+ * or the deadline passes, whichever comes first. This lets a consumer
+ * wake once per batch (or per deadline) instead of once per
+ * completion. Each returned event must eventually be released with
+ * rtio_cqe_release().
+ *
+ * @param r RTIO context
+ * @param cqes Array to fill with consumed completion queue events
+ * @param n Number of completion queue events to collect
+ * @param timeout How long to collect the batch for
+ *
+ * @return Number of completion queue events consumed, possibly 0
+ */
+static inline size_t rtio_cqe_consume_batch_block(struct rtio *r, struct rtio_cqe **cqes,
+						  size_t n, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t i = 0;
+
+	while (i < n) {
+		struct mpsc_node *node;
+
+#ifdef CONFIG_RTIO_CONSUME_SEM
+		if (k_sem_take(r->consume_sem, sys_timepoint_timeout(end)) != 0) {
+			break;
+		}
+
+		node = mpsc_pop(&r->cq);
+		while (node == NULL) {
+			Z_SPIN_DELAY(1);
+			node = mpsc_pop(&r->cq);
+		}
+#else
+		node = mpsc_pop(&r->cq);
+		if (node == NULL) {
+			if (sys_timepoint_expired(end)) {
+				break;
+			}
+
+			Z_SPIN_DELAY(25);
+			continue;
+		}
+#endif
+		cqes[i++] = CONTAINER_OF(node, struct rtio_cqe, q);
+	}
+
+	return i;
+}
+
 /**
  * @brief Release consumed completion queue event
  *
@@ -1285,6 +1445,20 @@ static inline void rtio_cqe_release(struct rtio *r, struct rtio_cqe *cqe)
 	rtio_cqe_pool_free(r->cqe_pool, cqe);
 }
 
+/**
+ * @brief Release a batch of consumed completion queue events
+ *
+ * @param r RTIO context
+ * @param cqes Completion queue entries to release
+ * @param n Number of entries in @p cqes
+ */
+static inline void rtio_cqe_release_batch(struct rtio *r, struct rtio_cqe **cqes, size_t n)
+{
+	for (size_t i = 0; i < n; i++) {
+		rtio_cqe_release(r, cqes[i]);
+	}
+}
+
 /**
  * @brief Flush completion queue
  *
@@ -1434,9 +1608,24 @@ static inline void rtio_iodev_sqe_err(struct rtio_iodev_sqe *iodev_sqe, int resu
  * @param userdata Userdata to pass along to completion
  * @param flags Flags to use for the CEQ see RTIO_CQE_FLAG_*
  */
+#ifdef CONFIG_RTIO_USER_RING
+/* Implemented in rtio_user_ring.c */
+void rtio_user_cq_produce(struct rtio *r, int result, void *userdata, uint32_t flags);
+void rtio_user_ring_drain(struct rtio *r);
+#endif
+
 static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, uint32_t flags)
 {
 	SYS_PORT_TRACING_FUNC_ENTER(rtio, cqe_submit, r, result, flags);
+
+#ifdef CONFIG_RTIO_USER_RING
+	if (r->u_cq != NULL) {
+		/* Completions bypass the kernel completion queue and go
+		 * straight to the shared ring the user polls.
+		 */
+		rtio_user_cq_produce(r, result, userdata, flags);
+	} else {
+#endif
 	struct rtio_cqe *cqe = rtio_cqe_acquire(r);
 
 	if (cqe == NULL) {
@@ -1450,6 +1639,9 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 		k_sem_give(r->consume_sem);
 #endif
 	}
+#ifdef CONFIG_RTIO_USER_RING
+	}
+#endif
 
 	/* atomic_t isn't guaranteed to wrap correctly as it could be signed, so
 	 * we must resort to a cas loop.
@@ -1468,6 +1660,14 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 			k_sem_give(r->submit_sem);
 		}
 	}
+#endif
+#ifdef CONFIG_RTIO_USER_RING
+	/* A completion frees SQE pool entries: pick up ring submissions
+	 * the last drain had to leave behind, without a doorbell.
+	 */
+	if (r->u_sq != NULL) {
+		rtio_user_ring_drain(r);
+	}
 #endif
 	SYS_PORT_TRACING_FUNC_EXIT(rtio, cqe_submit, r);
 }
@@ -1786,6 +1986,120 @@ static inline int z_impl_rtio_cqe_copy_out(struct rtio *r,
  */
 __syscall int rtio_submit(struct rtio *r, uint32_t wait_count);
 
+#if defined(CONFIG_RTIO_USER_RING) || defined(__DOXYGEN__)
+/**
+ * @brief Attach a shared-memory ring to an RTIO context
+ *
+ * Validates and binds the ring, the iodev every ring submission will
+ * target, and the only memory region ring submissions may reference as
+ * buffers. Validation happens once here so that steady-state ring
+ * processing needs no per-submission syscall.
+ *
+ * @param r RTIO context
+ * @param ring Ring control block, in memory shared with the kernel
+ * @param iodev The iodev all ring submissions are bound to
+ * @param region Start of the region buffers must lie within
+ * @param region_size Size of the buffer region
+ *
+ * @retval 0 on success
+ * @retval -EINVAL on invalid ring geometry
+ *
+ * @kconfig_dep{CONFIG_RTIO_USER_RING}
+ */
+__syscall int rtio_user_ring_attach(struct rtio *r, struct rtio_user_ring *ring,
+				    struct rtio_iodev *iodev, void *region, size_t region_size);
+
+/**
+ * @brief Ring the doorbell for an attached user ring
+ *
+ * Only needed when rtio_user_ring_needs_kick() is true; while the
+ * kernel side is active it re-drains the ring on every completion.
+ *
+ * @param r RTIO context
+ *
+ * @retval 0 on success
+ * @retval -EINVAL when no ring is attached
+ *
+ * @kconfig_dep{CONFIG_RTIO_USER_RING}
+ */
+__syscall int rtio_user_ring_kick(struct rtio *r);
+
+/**
+ * @brief Produce a submission into a user ring
+ *
+ * Plain memory operation, callable from user mode without a syscall.
+ * The iodev of @p sqe is ignored; ring submissions target the iodev
+ * bound at attach time.
+ *
+ * @param ring Attached ring
+ * @param sqe Submission to copy into the ring
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM when the submission ring is full
+ */
+static inline int rtio_user_sqe_produce(struct rtio_user_ring *ring, const struct rtio_sqe *sqe)
+{
+	uint32_t head = (uint32_t)atomic_get(&ring->sq_head);
+	uint32_t tail = (uint32_t)atomic_get(&ring->sq_tail);
+
+	if ((tail - head) >= ring->sq_size) {
+		return -ENOMEM;
+	}
+
+	ring->sq[tail & (ring->sq_size - 1U)] = *sqe;
+	atomic_set(&ring->sq_tail, (atomic_val_t)(tail + 1U));
+
+	return 0;
+}
+
+/**
+ * @brief Check whether the doorbell syscall is needed
+ *
+ * @param ring Attached ring
+ *
+ * @retval true The kernel side is idle and rtio_user_ring_kick() is required
+ */
+static inline bool rtio_user_ring_needs_kick(struct rtio_user_ring *ring)
+{
+	return atomic_get(&ring->kernel_active) == 0;
+}
+
+/**
+ * @brief Consume a completion from a user ring
+ *
+ * Plain memory operation, callable from user mode without a syscall.
+ *
+ * @param ring Attached ring
+ * @param cqe Filled with the consumed completion
+ *
+ * @retval 0 on success
+ * @retval -EAGAIN when no completion is available
+ */
+static inline int rtio_user_cqe_consume(struct rtio_user_ring *ring, struct rtio_user_cqe *cqe)
+{
+	uint32_t head = (uint32_t)atomic_get(&ring->cq_head);
+	uint32_t tail = (uint32_t)atomic_get(&ring->cq_tail);
+	struct rtio_user_cqe *slot;
+
+	if (head == tail) {
+		return -EAGAIN;
+	}
+
+	slot = &ring->cq[head & (ring->cq_size - 1U)];
+	if ((slot->flags & RTIO_USER_CQE_F_VALID) == 0U) {
+		/* Claimed but not yet filled by the producer */
+		return -EAGAIN;
+	}
+
+	*cqe = *slot;
+	cqe->flags &= ~RTIO_USER_CQE_F_VALID;
+	slot->flags = 0U;
+	atomic_set(&ring->cq_head, (atomic_val_t)(head + 1U));
+
+	return 0;
+}
+#endif /* CONFIG_RTIO_USER_RING */
+
 #ifdef CONFIG_RTIO_SUBMIT_SEM
 static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 {
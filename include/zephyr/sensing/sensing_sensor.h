@@ -81,6 +81,8 @@ struct sensing_connection {
 	struct sensing_sensor *source; /**< Source sensor of the connection. */
 	struct sensing_sensor *sink;   /**< Sink sensor of the connection. */
 	uint32_t interval;             /**< Report interval in micro seconds. */
+	/** Maximum batching latency requested by the client in micro seconds. */
+	uint64_t latency;
 	/** Sensitivity of the connection. */
 	int sensitivity[CONFIG_SENSING_MAX_SENSITIVITY_COUNT];
 	void *data;                 /**< Pointer to sensor sample data of the connection. */
@@ -106,6 +108,8 @@ struct sensing_sensor {
 	const uint16_t reporter_num; /**< Reporter number of the sensor instance. */
 	sys_slist_t client_list;     /**< List of the sensor clients. */
 	uint32_t interval;           /**< Report interval of the sensor sample in micro seconds. */
+	/** Arbitrated hardware batching latency in micro seconds. */
+	uint64_t latency;
 	uint8_t sensitivity_count;   /**< Sensitivity count of the sensor instance. */
 	/** Sensitivity array of the sensor instance. */
 	int sensitivity[CONFIG_SENSING_MAX_SENSITIVITY_COUNT];
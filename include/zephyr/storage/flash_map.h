@@ -225,6 +225,65 @@ int flash_area_copy(const struct flash_area *src_fa, off_t src_off,
  */
 int flash_area_erase(const struct flash_area *fa, off_t off, size_t len);
 
+#if defined(CONFIG_FLASH_MAP_ASYNC) || defined(__DOXYGEN__)
+/** @cond INTERNAL_HIDDEN */
+#define FLASH_AREA_OP_ERASE 0U
+#define FLASH_AREA_OP_WRITE 1U
+/** @endcond */
+
+/**
+ * @brief Asynchronous flash area request.
+ *
+ * Caller-provided storage for one in-flight asynchronous operation;
+ * must stay valid until completion is signalled.
+ */
+struct flash_area_async {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	const struct flash_area *fa;
+	const void *data;
+	off_t off;
+	size_t len;
+	struct k_poll_signal *signal;
+	int result;
+	uint8_t op;
+	/** @endcond */
+};
+
+/**
+ * @brief Erase a flash area region without blocking the caller.
+ *
+ * The erase runs from the system work queue; completion (and the
+ * operation result) is delivered by raising @p signal, and the
+ * result is also stored in @p req->result.  Useful for log/data
+ * maintenance that should overlap multi-millisecond erases with
+ * useful work instead of blocking on them.
+ *
+ * @param fa Flash area.
+ * @param off Offset of the region to erase.
+ * @param len Size of the region.
+ * @param req Caller-provided request storage.
+ * @param signal Completion signal, or NULL to poll req->result.
+ *
+ * @return 0 when queued, negative errno otherwise.
+ */
+int flash_area_erase_async(const struct flash_area *fa, off_t off, size_t len,
+			   struct flash_area_async *req,
+			   struct k_poll_signal *signal);
+
+/**
+ * @brief Write to a flash area without blocking the caller.
+ *
+ * Asynchronous counterpart of flash_area_write(); see
+ * flash_area_erase_async() for the completion contract.  The source
+ * buffer must stay valid until completion.
+ */
+int flash_area_write_async(const struct flash_area *fa, off_t off,
+			   const void *src, size_t len,
+			   struct flash_area_async *req,
+			   struct k_poll_signal *signal);
+#endif /* CONFIG_FLASH_MAP_ASYNC */
+
 /**
  * @brief Erase flash area or fill with erase-value
  *
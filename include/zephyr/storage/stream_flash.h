@@ -65,6 +65,17 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK
 	stream_flash_callback_t callback; /* Callback invoked after write op */
 #endif
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	/* Double-buffer pipelining state, see stream_flash_pipeline_init() */
+	struct k_work pipe_work;
+	struct k_sem pipe_done;
+	uint8_t *pipe_shadow;
+	uint8_t *pipe_buf;
+	size_t pipe_addr;
+	size_t pipe_len;
+	int pipe_rc;
+	bool pipe_pending;
+#endif
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	size_t erased_up_to;		/* First offset in continuous range,
 					 * relative to the stream_flash_ctx.offset,
@@ -97,6 +108,28 @@ struct stream_flash_ctx {
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb);
+
+#if defined(CONFIG_STREAM_FLASH_PIPELINE) || defined(__DOXYGEN__)
+/**
+ * @brief Arm double-buffered pipelining on a stream flash context.
+ *
+ * With a shadow buffer (same size as the context buffer) armed, a
+ * full buffer is programmed from the system work queue while the
+ * transport keeps filling the other buffer, overlapping flash
+ * program latency with transport I/O (e.g. the mcumgr image upload
+ * path).  Flushes wait for the in-flight program, so completion
+ * semantics are unchanged.  Not compatible with the post-write
+ * verify callback, which needs the synchronous path.
+ *
+ * @param ctx Initialized stream flash context.
+ * @param shadow_buf Second buffer of the same size as the one given
+ *        to stream_flash_init().
+ *
+ * @return 0 on success, -EINVAL on invalid arguments.
+ */
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx,
+			       uint8_t *shadow_buf);
+#endif
 /**
  * @brief Read number of bytes written to the flash.
  *
@@ -39,6 +39,15 @@ struct sys_bitarray {
 	/* Bundle of bits */
 	uint32_t *bundles;
 
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+	/* One bit per bundle, set when that bundle is fully set, so
+	 * region searches skip runs of fully allocated words.  May be
+	 * NULL for bitarrays built without summary storage, in which
+	 * case the index is simply not used.
+	 */
+	uint32_t *summary;
+#endif
+
 	/* Spinlock guarding access to this bit array */
 	struct k_spinlock lock;
 };
@@ -54,15 +63,29 @@ typedef struct sys_bitarray sys_bitarray_t;
  * @param total_bits Total number of bits in this bitarray object.
  * @param sba_mod Modifier to the bitarray variables.
  */
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+#define Z_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)	\
+	sba_mod uint32_t _sys_bitarray_summary_##name			\
+		[DIV_ROUND_UP(DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8), \
+					   sizeof(uint32_t)), 32)] = {0};
+#define Z_SYS_BITARRAY_SUMMARY_INIT(name)				\
+	.summary = _sys_bitarray_summary_##name,
+#else
+#define Z_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)
+#define Z_SYS_BITARRAY_SUMMARY_INIT(name)
+#endif /* CONFIG_SYS_BITARRAY_SUMMARY */
+
 #define _SYS_BITARRAY_DEFINE(name, total_bits, sba_mod)			\
 	sba_mod uint32_t _sys_bitarray_bundles_##name			\
 		[DIV_ROUND_UP(DIV_ROUND_UP(total_bits, 8),		\
 			       sizeof(uint32_t))] = {0};		\
+	Z_SYS_BITARRAY_SUMMARY_DEFINE(name, total_bits, sba_mod)	\
 	sba_mod sys_bitarray_t name = {					\
 		.num_bits = (total_bits),				\
 		.num_bundles = DIV_ROUND_UP(				\
 			DIV_ROUND_UP(total_bits, 8), sizeof(uint32_t)),	\
 		.bundles = _sys_bitarray_bundles_##name,		\
+		Z_SYS_BITARRAY_SUMMARY_INIT(name)			\
 	}
 
 /**
@@ -29,6 +29,14 @@ struct sys_hashmap_oa_lp_data {
 	size_t n_buckets;
 	size_t size;
 	size_t n_tombstones;
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	/* Previous table still being drained; entries migrate to the new
+	 * table a bounded number of slots per mutating operation.
+	 */
+	void *old_buckets;
+	size_t old_n_buckets;
+	size_t migrate_pos;
+#endif
 };
 
 /**
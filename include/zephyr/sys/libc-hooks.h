@@ -81,6 +81,22 @@ void __stdout_hook_install(int (*hook)(int));
 extern struct k_mem_partition z_malloc_partition;
 #endif
 
+#ifdef CONFIG_COMMON_LIBC_MALLOC
+struct sys_heap;
+
+/**
+ * @brief Get the sys_heap backing the C library malloc.
+ *
+ * Only available with the common malloc implementation. The returned
+ * heap can be passed to the sys_heap statistics and validation APIs
+ * (e.g. sys_heap_runtime_stats_get()), giving libc allocations the
+ * same telemetry surface as every other sys_heap.
+ *
+ * @return The malloc heap.
+ */
+struct sys_heap *z_malloc_heap_get(void);
+#endif /* CONFIG_COMMON_LIBC_MALLOC */
+
 #ifdef CONFIG_NEED_LIBC_MEM_PARTITION
 /* - All newlib globals will be placed into z_libc_partition.
  * - Minimal C library globals, if any, will be placed into
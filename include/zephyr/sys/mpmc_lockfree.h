@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SYS_MPMC_LOCKFREE_H_
+#define ZEPHYR_SYS_MPMC_LOCKFREE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util_macro.h>
+#include <zephyr/toolchain/common.h>
+
+/**
+ * @brief Multiple Producer Multiple Consumer (MPMC) Lockfree Queue API
+ * @defgroup mpmc_lockfree MPMC Lockfree Queue API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/**
+ * @brief A lock-free and type safe power of 2 fixed sized multiple producer
+ * multiple consumer (MPMC) queue.
+ *
+ * Each slot carries a sequence counter that hands it back and forth between
+ * producers and consumers (the classic bounded MPMC design): a producer
+ * claims a slot with a compare-and-swap on the enqueue position, fills it,
+ * and publishes it by advancing the slot sequence; consumers mirror the
+ * scheme on the dequeue position. Producers and consumers therefore never
+ * block each other, and any number of execution contexts may produce and
+ * consume concurrently, including ISRs, with O(1) operations.
+ *
+ * Memory ordering contract: the data stored in a slot is written before the
+ * sequence publish and read after the sequence check; the atomic operations
+ * used provide the required release/acquire ordering on every architecture
+ * with working Zephyr atomics.
+ *
+ * Like the SPSC queue this is type safe as the underlying buffer is typed
+ * and all usage is done through macros. Unlike the SPSC queue, elements are
+ * copied in and out rather than acquired in place: in-place access would
+ * let a slow producer or consumer publish a half-written slot.
+ */
+
+/**
+ * @private
+ * @brief Internal MPMC slot bookkeeping
+ */
+struct mpmc_slot {
+	atomic_t seq;
+};
+
+/**
+ * @private
+ * @brief Common MPMC attributes
+ *
+ * @warning Not to be manipulated without the macros!
+ */
+struct mpmc {
+	/* producers claim slots with a CAS here */
+	atomic_t in;
+
+	/* consumers claim slots with a CAS here */
+	atomic_t out;
+
+	/* mask used to automatically wrap values */
+	const unsigned long mask;
+};
+
+/**
+ * @brief Statically initialize an mpmc
+ *
+ * The slot sequence numbers cannot be numbered by a static
+ * initializer; the first push or pop performs that lazily, and
+ * mpmc_reset() does it explicitly.
+ *
+ * @param sz Size of the mpmc, must be power of 2 (ex: 2, 4, 8)
+ * @param sbuf Slot bookkeeping buffer pointer
+ * @param buf Data buffer pointer
+ */
+#define MPMC_INITIALIZER(sz, sbuf, buf)                                                            \
+	{                                                                                          \
+		._mpmc =                                                                           \
+			{                                                                          \
+				.in = ATOMIC_INIT(0),                                              \
+				.out = ATOMIC_INIT(0),                                             \
+				.mask = (sz) - 1UL,                                                \
+			},                                                                         \
+		.slots = (sbuf),                                                                   \
+		.buffer = (buf),                                                                   \
+		.initialized = ATOMIC_INIT(0),                                                     \
+	}
+
+/**
+ * @brief Declare an anonymous struct type for an mpmc
+ *
+ * @param name Name of the mpmc symbol to be provided
+ * @param type Type stored in the mpmc
+ */
+#define MPMC_DECLARE(name, type)                                                                   \
+	struct mpmc_##name {                                                                       \
+		struct mpmc _mpmc;                                                                 \
+		struct mpmc_slot * const slots;                                                    \
+		type * const buffer;                                                               \
+		atomic_t initialized;                                                              \
+	}
+
+/**
+ * @brief Define an mpmc with a fixed size
+ *
+ * @param name Name of the mpmc symbol to be provided
+ * @param type Type stored in the mpmc
+ * @param sz Size of the mpmc, must be power of 2 (ex: 2, 4, 8)
+ */
+#define MPMC_DEFINE(name, type, sz)                                                                \
+	BUILD_ASSERT(IS_POWER_OF_TWO(sz));                                                         \
+	static struct mpmc_slot __mpmc_slots_##name[sz];                                           \
+	static type __mpmc_buf_##name[sz];                                                         \
+	MPMC_DECLARE(name, type) name =                                                            \
+		MPMC_INITIALIZER(sz, __mpmc_slots_##name, __mpmc_buf_##name);
+
+/**
+ * @brief Size of the MPMC queue
+ *
+ * @param mpmc MPMC reference
+ */
+#define mpmc_size(mpmc) ((mpmc)->_mpmc.mask + 1UL)
+
+/**
+ * @brief Initialize/reset an mpmc such that it is empty
+ *
+ * Not thread safe: must not race concurrent producers or consumers.
+ *
+ * @param mpmc MPMC reference
+ */
+#define mpmc_reset(mpmc)                                                                           \
+	({                                                                                         \
+		atomic_set(&(mpmc)->_mpmc.in, 0);                                                  \
+		atomic_set(&(mpmc)->_mpmc.out, 0);                                                 \
+		for (unsigned long _i = 0; _i <= (mpmc)->_mpmc.mask; _i++) {                       \
+			atomic_set(&(mpmc)->slots[_i].seq, (atomic_val_t)_i);                      \
+		}                                                                                  \
+		atomic_set(&(mpmc)->initialized, 2);                                               \
+	})
+
+/**
+ * @private
+ * @brief Reset the queue on its first use
+ *
+ * The static initializer cannot number the slot sequences, so the
+ * first caller does; racing first-callers are serialized by a CAS on
+ * the initialized flag (the loser spins until numbering is visible,
+ * which is bounded by the winner's loop over the slots).
+ */
+#define z_mpmc_lazy_init(mpmc)                                                                     \
+	({                                                                                         \
+		if (atomic_get(&(mpmc)->initialized) != 2) {                                       \
+			/* Interrupts are masked before the CAS so an ISR on   \
+			 * this CPU can never observe the winner mid-numbering \
+			 * and spin against it; a loser spinning below is      \
+			 * therefore always waiting on another CPU actively    \
+			 * finishing, which is bounded.                        \
+			 */                                                    \
+			unsigned int _key = irq_lock();                                            \
+											           \
+			if (atomic_cas(&(mpmc)->initialized, 0, 1)) {                              \
+				for (unsigned long _i = 0; _i <= (mpmc)->_mpmc.mask; _i++) {       \
+					atomic_set(&(mpmc)->slots[_i].seq, (atomic_val_t)_i);      \
+				}                                                                  \
+				atomic_set(&(mpmc)->initialized, 2);                               \
+			} else {                                                                   \
+				while (atomic_get(&(mpmc)->initialized) != 2) {                    \
+				}                                                                  \
+			}                                                                          \
+			irq_unlock(_key);                                                          \
+		}                                                                                  \
+	})
+
+/**
+ * @brief Push an element into the MPMC queue
+ *
+ * Safe to call from any number of concurrent contexts.
+ *
+ * @param mpmc MPMC reference
+ * @param val Value to copy into the queue
+ *
+ * @retval true Element enqueued
+ * @retval false Queue full
+ */
+#define mpmc_push(mpmc, val)                                                                       \
+	({                                                                                         \
+		bool _ok = false;                                                                  \
+		unsigned long _pos;                                                                \
+		z_mpmc_lazy_init(mpmc);                                                            \
+		_pos = (unsigned long)atomic_get(&(mpmc)->_mpmc.in);                               \
+		while (true) {                                                                     \
+			struct mpmc_slot *_slot = &(mpmc)->slots[_pos & (mpmc)->_mpmc.mask];       \
+			unsigned long _seq = (unsigned long)atomic_get(&_slot->seq);               \
+			long _dif = (long)(_seq - _pos);                                           \
+			if (_dif == 0) {                                                           \
+				if (atomic_cas(&(mpmc)->_mpmc.in, (atomic_val_t)_pos,              \
+					       (atomic_val_t)(_pos + 1UL))) {                      \
+					(mpmc)->buffer[_pos & (mpmc)->_mpmc.mask] = (val);         \
+					atomic_set(&_slot->seq, (atomic_val_t)(_pos + 1UL));       \
+					_ok = true;                                                \
+					break;                                                     \
+				}                                                                  \
+				_pos = (unsigned long)atomic_get(&(mpmc)->_mpmc.in);               \
+			} else if (_dif < 0) {                                                     \
+				break;                                                             \
+			} else {                                                                   \
+				_pos = (unsigned long)atomic_get(&(mpmc)->_mpmc.in);               \
+			}                                                                          \
+		}                                                                                  \
+		_ok;                                                                               \
+	})
+
+/**
+ * @brief Pop an element from the MPMC queue
+ *
+ * Safe to call from any number of concurrent contexts.
+ *
+ * @param mpmc MPMC reference
+ * @param out Lvalue the element is copied to
+ *
+ * @retval true Element dequeued into @p out
+ * @retval false Queue empty
+ */
+#define mpmc_pop(mpmc, out)                                                                        \
+	({                                                                                         \
+		bool _ok = false;                                                                  \
+		unsigned long _pos;                                                                \
+		z_mpmc_lazy_init(mpmc);                                                            \
+		_pos = (unsigned long)atomic_get(&(mpmc)->_mpmc.out);                              \
+		while (true) {                                                                     \
+			struct mpmc_slot *_slot = &(mpmc)->slots[_pos & (mpmc)->_mpmc.mask];       \
+			unsigned long _seq = (unsigned long)atomic_get(&_slot->seq);               \
+			long _dif = (long)(_seq - (_pos + 1UL));                                   \
+			if (_dif == 0) {                                                           \
+				if (atomic_cas(&(mpmc)->_mpmc.out, (atomic_val_t)_pos,             \
+					       (atomic_val_t)(_pos + 1UL))) {                      \
+					(out) = (mpmc)->buffer[_pos & (mpmc)->_mpmc.mask];         \
+					atomic_set(&_slot->seq,                                    \
+						   (atomic_val_t)(_pos + (mpmc)->_mpmc.mask +      \
+								  1UL));                           \
+					_ok = true;                                                \
+					break;                                                     \
+				}                                                                  \
+				_pos = (unsigned long)atomic_get(&(mpmc)->_mpmc.out);              \
+			} else if (_dif < 0) {                                                     \
+				break;                                                             \
+			} else {                                                                   \
+				_pos = (unsigned long)atomic_get(&(mpmc)->_mpmc.out);              \
+			}                                                                          \
+		}                                                                                  \
+		_ok;                                                                               \
+	})
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_SYS_MPMC_LOCKFREE_H_ */
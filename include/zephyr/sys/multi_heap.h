@@ -69,6 +69,52 @@ struct sys_multi_heap {
 	struct sys_multi_heap_rec heaps[MAX_MULTI_HEAPS];
 };
 
+#ifdef CONFIG_SYS_MULTI_HEAP_POLICY
+/**
+ * @brief Per-heap placement attributes for the built-in policies
+ *
+ * Pass a pointer to one of these as the user_data argument of
+ * sys_multi_heap_add_heap() when using one of the built-in policy
+ * choice functions.  A NULL user_data means "tier 0, no size window,
+ * no occupancy cap".
+ */
+struct sys_multi_heap_policy_attrs {
+	/** Preference tier, lower is preferred (e.g. TCM 0, SRAM 1, PSRAM 2) */
+	uint8_t tier;
+	/** Occupancy cap in percent, 0 for none (needs
+	 *  CONFIG_SYS_HEAP_RUNTIME_STATS to take effect)
+	 */
+	uint8_t max_percent;
+	/** Route only allocations of at least this many bytes */
+	size_t size_min;
+	/** Route only allocations of at most this many bytes, 0 for no cap */
+	size_t size_max;
+};
+
+/**
+ * @brief Built-in tiered placement policy
+ *
+ * Choice function for sys_multi_heap_init(): among the heaps whose
+ * size window admits the request and whose occupancy cap is not
+ * exceeded, allocate from the lowest tier first, falling back tier by
+ * tier when a heap is exhausted.  Size-thresholded routing falls out
+ * of the per-heap size windows (e.g. descriptors to TCM, frame
+ * buffers to PSRAM) with no hand-written callback.
+ */
+void *sys_multi_heap_policy_tiered(struct sys_multi_heap *mheap, void *cfg,
+				   size_t align, size_t bytes);
+
+/**
+ * @brief Built-in occupancy balancing policy
+ *
+ * Like sys_multi_heap_policy_tiered() but orders eligible heaps by
+ * current occupancy (emptiest first), spreading load across heaps.
+ * Requires CONFIG_SYS_HEAP_RUNTIME_STATS for meaningful ordering.
+ */
+void *sys_multi_heap_policy_balanced(struct sys_multi_heap *mheap, void *cfg,
+				     size_t align, size_t bytes);
+#endif /* CONFIG_SYS_MULTI_HEAP_POLICY */
+
 /**
  * @brief Initialize multi-heap
  *
@@ -317,6 +317,22 @@ static inline bool onoff_has_error(const struct onoff_manager *mgr)
 	return (mgr->flags & ONOFF_FLAG_ERROR) != 0;
 }
 
+/**
+ * @brief Read the current state of an on-off service without locking.
+ *
+ * Returns one of the ONOFF_STATE_* values. Like onoff_has_error()
+ * this is an unlocked convenience function: the state may change
+ * concurrently, so it is suitable for opportunistic fast paths (e.g.
+ * skipping a request on a service known to be held on elsewhere) and
+ * diagnostics, not for decisions that require the state to hold.
+ *
+ * @return the ONOFF_STATE_* value current at the time of the call.
+ */
+static inline uint32_t onoff_state(const struct onoff_manager *mgr)
+{
+	return mgr->flags & ONOFF_STATE_MASK;
+}
+
 /**
  * @brief Request a reservation to use an on-off service.
  *
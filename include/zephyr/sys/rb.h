@@ -95,6 +95,10 @@ struct rbtree {
 	rb_lessthan_t lessthan_fn;
 	/** @cond INTERNAL_HIDDEN */
 	int max_depth;
+#ifdef CONFIG_RBTREE_CACHED_MIN
+	/* Cached leftmost node; NULL means "unknown", recomputed lazily */
+	struct rbnode *min_node;
+#endif
 #ifdef CONFIG_MISRA_SANE
 	struct rbnode *iter_stack[Z_MAX_RBTREE_DEPTH];
 	unsigned char iter_left[Z_MAX_RBTREE_DEPTH];
@@ -116,6 +120,22 @@ void z_rb_walk(struct rbnode *node, rb_visit_t visit_fn, void *cookie);
 #endif
 struct rbnode *z_rb_get_minmax(struct rbtree *tree, uint8_t side);
 
+/**
+ * @brief Build a tree from a sorted array of nodes in O(n)
+ *
+ * Replaces the contents of @p tree with a balanced tree over the given
+ * nodes, which must be sorted in ascending order with respect to the
+ * tree's comparison function. Building this way performs no
+ * rebalancing, unlike inserting the nodes one by one.
+ *
+ * Any nodes previously in the tree are dropped.
+ *
+ * @param tree The tree to build, with lessthan_fn already set
+ * @param nodes Array of pointers to nodes, sorted ascending
+ * @param count Number of nodes in @p nodes
+ */
+void rb_build_sorted(struct rbtree *tree, struct rbnode **nodes, size_t count);
+
 /**
  * @brief Insert node into tree
  */
@@ -131,7 +151,15 @@ void rb_remove(struct rbtree *tree, struct rbnode *node);
  */
 static inline struct rbnode *rb_get_min(struct rbtree *tree)
 {
+#ifdef CONFIG_RBTREE_CACHED_MIN
+	if (tree->min_node == NULL) {
+		tree->min_node = z_rb_get_minmax(tree, 0U);
+	}
+
+	return tree->min_node;
+#else
 	return z_rb_get_minmax(tree, 0U);
+#endif
 }
 
 /**
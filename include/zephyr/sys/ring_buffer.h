@@ -42,6 +42,17 @@ typedef uint16_t ring_buf_idx_t;
 
 struct ring_buf_index { ring_buf_idx_t head, tail, base; };
 
+/* With the cache-aware layout the producer-owned and consumer-owned
+ * index groups live on separate cache lines, so an ISR producer and a
+ * thread consumer on different CPUs stop invalidating each other's
+ * line on every index update.
+ */
+#ifdef CONFIG_RING_BUFFER_CACHE_ALIGNED
+#define Z_RING_BUF_IDX_ALIGN __aligned(CONFIG_DCACHE_LINE_SIZE)
+#else
+#define Z_RING_BUF_IDX_ALIGN
+#endif
+
 /** @endcond */
 
 /**
@@ -50,8 +61,8 @@ struct ring_buf_index { ring_buf_idx_t head, tail, base; };
 struct ring_buf {
 	/** @cond INTERNAL_HIDDEN */
 	uint8_t *buffer;
-	struct ring_buf_index put;
-	struct ring_buf_index get;
+	struct ring_buf_index put Z_RING_BUF_IDX_ALIGN;
+	struct ring_buf_index get Z_RING_BUF_IDX_ALIGN;
 	uint32_t size;
 	/** @endcond */
 };
@@ -218,6 +218,39 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
  */
 size_t sys_heap_usable_size(struct sys_heap *heap, void *mem);
 
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+/** @brief Warm the heap's quick lists for a size
+ *
+ * Allocates and frees @a count blocks of @a bytes so that the exact
+ * size-class quick lists (see CONFIG_SYS_HEAP_QUICK_CLASSES) are
+ * populated before the hot path needs them, e.g. at boot.  Blocks
+ * beyond the per-class quick list depth simply return to the regular
+ * free lists.
+ *
+ * @param heap Heap to warm
+ * @param bytes Allocation size the hot path will use
+ * @param count Number of blocks to cycle
+ * @retval 0 on success, -ENOMEM if the heap ran out of space
+ */
+int sys_heap_prealloc(struct sys_heap *heap, size_t bytes, unsigned int count);
+#endif /* CONFIG_SYS_HEAP_QUICK_CLASSES */
+
+#ifdef CONFIG_SYS_HEAP_RB_INDEX
+/** @brief Enable the large-chunk red/black index for a heap
+ *
+ * Opts the heap into an O(log n) best-fit index over free chunks of
+ * at least @a threshold_bytes (clamped up to the minimum size able to
+ * hold the index node), bounding worst-case allocation latency for
+ * big requests on fragmented heaps.  Call right after
+ * sys_heap_init(); existing qualifying free chunks are indexed.
+ * Heaps that never call this keep the plain bucket behavior.
+ *
+ * @param heap Heap to index
+ * @param threshold_bytes Minimum allocation size served by the index
+ */
+void sys_heap_rb_index_init(struct sys_heap *heap, size_t threshold_bytes);
+#endif /* CONFIG_SYS_HEAP_RB_INDEX */
+
 /** @brief Validate heap integrity
  *
  * Validates the internal integrity of a sys_heap.  Intended for unit
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Shared time page for syscall-free uptime reads.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_
+#define ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/app_memory/app_memdomain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(CONFIG_SYS_TIME_PAGE) || defined(__DOXYGEN__)
+
+/**
+ * @brief Kernel-published time snapshot.
+ *
+ * Updated from the system clock announcement path under a sequence
+ * counter (odd while an update is in flight). Readers interpolate from
+ * the snapshot with the hardware cycle counter, so no syscall is
+ * needed; see sys_time_page_uptime_ticks().
+ */
+struct sys_time_page {
+	/** Sequence counter, odd while the kernel is updating */
+	uint32_t seq;
+	/** Tick count at the time of the snapshot */
+	uint64_t base_ticks;
+	/** Hardware cycle counter at the time of the snapshot */
+	uint32_t base_cycles;
+};
+
+/** Memory partition holding the time page; add it to any user memory
+ * domain that wants syscall-free time reads. Threads in a domain that
+ * includes the partition can also write it, so only grant it to
+ * domains that may legitimately trust each other's view of time.
+ */
+extern struct k_mem_partition z_time_page_partition;
+
+extern struct sys_time_page z_time_page;
+
+/**
+ * @brief Read the kernel uptime in ticks without a system call.
+ *
+ * Interpolates from the last kernel-published snapshot using the
+ * hardware cycle counter. Callable from user mode provided the cycle
+ * counter is readable there (architecture dependent) and the calling
+ * domain includes @ref z_time_page_partition.
+ *
+ * @return Current uptime in kernel ticks.
+ */
+static inline uint64_t sys_time_page_uptime_ticks(void)
+{
+	uint32_t cyc_per_tick = sys_clock_hw_cycles_per_sec() / CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+	uint64_t base_ticks;
+	uint32_t base_cycles;
+	uint32_t seq;
+
+	while (true) {
+		seq = __atomic_load_n(&z_time_page.seq, __ATOMIC_ACQUIRE);
+		if ((seq & 1U) != 0U) {
+			/* Update in flight: start over (a continue in a
+			 * do/while would re-test the exit condition and
+			 * leave with an uninitialized snapshot).
+			 */
+			continue;
+		}
+
+		base_ticks = z_time_page.base_ticks;
+		base_cycles = z_time_page.base_cycles;
+
+		/* Read fence: the snapshot loads above must complete
+		 * before the validating re-load below.
+		 */
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		if (__atomic_load_n(&z_time_page.seq, __ATOMIC_RELAXED) == seq) {
+			break;
+		}
+	}
+
+	if (cyc_per_tick == 0U) {
+		return base_ticks;
+	}
+
+	/* The interpolation window is bounded by the 32-bit cycle
+	 * counter: during tickless idle stretches longer than one
+	 * counter wrap with no announcements, the value degrades to the
+	 * last published tick.
+	 */
+	return base_ticks + ((arch_k_cycle_get_32() - base_cycles) / cyc_per_tick);
+}
+
+/**
+ * @brief Monotonic time without a system call.
+ *
+ * @param ts Filled with the interpolated monotonic time.
+ */
+static inline void sys_time_page_gettime(struct timespec *ts)
+{
+	uint64_t ticks = sys_time_page_uptime_ticks();
+	uint64_t ns = k_ticks_to_ns_floor64(ticks);
+
+	ts->tv_sec = (time_t)(ns / NSEC_PER_SEC);
+	ts->tv_nsec = (long)(ns % NSEC_PER_SEC);
+}
+
+/** @cond INTERNAL_HIDDEN */
+/* Called by the kernel clock announcement path */
+void z_time_page_publish(uint64_t ticks);
+/** @endcond */
+
+#endif /* CONFIG_SYS_TIME_PAGE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_ */
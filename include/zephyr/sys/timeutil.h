@@ -113,6 +113,50 @@ int64_t timeutil_timegm64(const struct tm *tm);
  */
 time_t timeutil_timegm(const struct tm *tm);
 
+/**
+ * @}
+ * @defgroup timeutil_mulshift_apis Reciprocal conversion APIs
+ * @ingroup timeutil_apis
+ *
+ * Convert between clock domains whose frequencies are only known at
+ * run time without per-conversion division: the ratio is folded once
+ * into a multiply-shift reciprocal, and each conversion is one 64x64
+ * multiply plus shifts.
+ *
+ * @{
+ */
+
+/** @brief Precomputed to_hz/from_hz reciprocal. */
+struct timeutil_mulshift {
+	/** Scaled reciprocal: round(to_hz * 2^32 / from_hz) */
+	uint64_t mult;
+};
+
+/**
+ * @brief Fold a frequency ratio into a multiply-shift reciprocal.
+ *
+ * Recompute whenever either frequency changes (e.g. after clock
+ * recalibration).
+ *
+ * @param ms Receives the reciprocal.
+ * @param to_hz Frequency of the result domain, non-zero.
+ * @param from_hz Frequency of the input domain, non-zero.
+ */
+void timeutil_mulshift_init(struct timeutil_mulshift *ms, uint32_t to_hz, uint32_t from_hz);
+
+/**
+ * @brief Convert a count between the folded clock domains.
+ *
+ * Computes t * to_hz / from_hz to within a relative error below
+ * 2^-32, with no division.
+ *
+ * @param ms Reciprocal prepared by timeutil_mulshift_init().
+ * @param t Count in the input domain.
+ *
+ * @return Count in the result domain.
+ */
+uint64_t timeutil_mulshift_convert(const struct timeutil_mulshift *ms, uint64_t t);
+
 /**
  * @}
  * @defgroup timeutil_sync_apis Time Synchronization APIs
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Meta Platforms
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_ZVFS_AIO_H_
+#define ZEPHYR_INCLUDE_SYS_ZVFS_AIO_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One asynchronous file descriptor operation.
+ *
+ * Fill in the request fields, submit with zvfs_aio_submit(), and wait
+ * on @a signal (directly or through k_poll()); the signal's result is
+ * 0 and the outcome is in @a result and @a error. The request and the
+ * buffer must stay alive untouched until completion.
+ */
+struct zvfs_aio_req {
+	/** File descriptor to operate on */
+	int fd;
+	/** Buffer to read into or write from */
+	void *buf;
+	/** Number of bytes to transfer */
+	size_t len;
+	/** Absolute offset of the transfer, used when @a use_offset is set */
+	size_t offset;
+	/** Operate at @a offset instead of the file position */
+	bool use_offset;
+	/** True for a write, false for a read */
+	bool is_write;
+
+	/** Bytes transferred, or -1 on failure */
+	ssize_t result;
+	/** errno value of a failed operation, 0 on success */
+	int error;
+	/** Raised on completion; also usable with k_poll() */
+	struct k_poll_signal signal;
+
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	/** @endcond */
+};
+
+/**
+ * @brief Submit an asynchronous read or write.
+ *
+ * The operation executes on the AIO worker queue; submission never
+ * blocks on the underlying file system. Operations complete in
+ * submission order.
+ *
+ * @param req Request to submit; zero-initialize before first use.
+ *
+ * @retval 0 on successful submission.
+ * @retval -EINVAL on invalid arguments.
+ * @retval -EBUSY when @p req is still in flight.
+ */
+int zvfs_aio_submit(struct zvfs_aio_req *req);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_ZVFS_AIO_H_ */
@@ -83,6 +83,33 @@ void soc_timing_stop(void);
  */
 timing_t soc_timing_counter_get(void);
 
+/**
+ * @brief A named timing probe point.
+ *
+ * Captures are two stores plus one counter read; all cycle math is
+ * deferred to timing_probes_elapsed(), so instrumenting a hot path
+ * costs nanoseconds per probe.
+ */
+struct timing_probe {
+	const char *name;
+	timing_t cycles;
+};
+
+/**
+ * @brief Capture one probe point into a preallocated array slot.
+ *
+ * @param probes Preallocated probe array.
+ * @param idx Slot to fill.
+ * @param probe_name Label for the slot (string literal, stored by
+ *        pointer).
+ */
+static inline void timing_capture(struct timing_probe *probes, size_t idx,
+				  const char *probe_name)
+{
+	probes[idx].name = probe_name;
+	probes[idx].cycles = timing_counter_get();
+}
+
 /**
  * @brief Get number of cycles between @p start and @p end.
  *
@@ -327,6 +354,27 @@ static inline uint64_t timing_cycles_get(volatile timing_t *const start,
 #endif
 }
 
+/**
+ * @brief Compute elapsed cycles between consecutive captured probes.
+ *
+ * Deferred math companion of timing_capture(): call it once after the
+ * measured section, outside the hot path.
+ *
+ * @param probes Array of @p num captured probes.
+ * @param num Number of captured probes (at least 2).
+ * @param cycles Output array of @p num - 1 elapsed cycle counts,
+ *        cycles[i] being the distance from probes[i] to probes[i+1].
+ */
+static inline void timing_probes_elapsed(struct timing_probe *probes,
+					 size_t num, uint64_t *cycles)
+{
+	for (size_t i = 1; i < num; i++) {
+		cycles[i - 1] = timing_cycles_get(&probes[i - 1].cycles,
+						  &probes[i].cycles);
+	}
+}
+
+
 /**
  * @brief Get frequency of counter used (in Hz).
  *
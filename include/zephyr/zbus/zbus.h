@@ -46,6 +46,14 @@ struct zbus_channel_data {
 	 */
 	struct k_sem sem;
 
+#if defined(CONFIG_ZBUS_SEQLOCK) || defined(__DOXYGEN__)
+	/** Message sequence counter. Odd while a publisher or claimer may
+	 * be mutating the message; bumped again when the mutation ends so
+	 * seqlock readers can detect torn snapshots.
+	 */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_SEQLOCK */
+
 #if defined(CONFIG_ZBUS_PRIORITY_BOOST)
 	/** Highest observer priority. Indicates the priority that the VDED will use to boost the
 	 * notification process avoiding preemptions.
@@ -714,6 +722,32 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
  */
 int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_SEQLOCK) || defined(__DOXYGEN__)
+/**
+ * @brief Read a channel message without taking the channel lock.
+ *
+ * Copies the message under a sequence counter and retries when a
+ * concurrent publish or claim tore the snapshot. Readers never block
+ * publishers or each other, so read cost is independent of the number
+ * of subscribers and there is no priority inversion through the
+ * channel semaphore. While a writer is mid-update the reader retries a
+ * bounded number of times - yielding first, then sleeping a tick per
+ * attempt so even a lower priority writer can finish - so keep claim
+ * windows short on channels read this way.
+ *
+ * @kconfig_dep{CONFIG_ZBUS_SEQLOCK}
+ *
+ * @param chan The channel's reference.
+ * @param[out] msg Reference to the message where the copy will be kept.
+ *
+ * @retval 0 Channel read.
+ * @retval -EFAULT A parameter is a null pointer.
+ * @retval -EAGAIN A writer was mid-update: immediately when called from
+ *	   an ISR, or after the bounded retries elsewhere.
+ */
+int zbus_chan_read_seq(const struct zbus_channel *chan, void *msg);
+#endif /* CONFIG_ZBUS_SEQLOCK */
+
 /**
  * @brief Claim a channel
  *
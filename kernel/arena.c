@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Arena (bump pointer) allocator.
+ *
+ * Arenas serve allocations by advancing an offset into a fixed
+ * region and release everything at once with an O(1) reset, which
+ * fits object populations that die together (parse trees, request
+ * contexts).  An optional backing k_heap absorbs allocations that no
+ * longer fit the region; spilled blocks are returned to the heap on
+ * reset.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/sys/util.h>
+
+/* Spilled allocations are prefixed with a list node so the arena can
+ * hand them back to the backing heap on reset.
+ */
+struct arena_spill_hdr {
+	sys_snode_t node;
+} __aligned(sizeof(void *) * 2);
+
+void k_arena_init(struct k_arena *arena, void *mem, size_t size,
+		  struct k_heap *spill)
+{
+	arena->lock = (struct k_spinlock) {};
+	arena->base = mem;
+	arena->size = size;
+	arena->offset = 0;
+	arena->spill = spill;
+	sys_slist_init(&arena->spill_blocks);
+}
+
+void *k_arena_aligned_alloc(struct k_arena *arena, size_t align, size_t bytes)
+{
+	void *ret = NULL;
+
+	__ASSERT((align != 0U) && ((align & (align - 1)) == 0U),
+		 "align must be a power of 2");
+
+	k_spinlock_key_t key = k_spin_lock(&arena->lock);
+
+	size_t offset = ROUND_UP(arena->offset, align);
+
+	if ((bytes <= arena->size) && (offset <= (arena->size - bytes))) {
+		ret = &arena->base[offset];
+		arena->offset = offset + bytes;
+		k_spin_unlock(&arena->lock, key);
+		return ret;
+	}
+
+	k_spin_unlock(&arena->lock, key);
+
+	/* Spill to the backing heap, if any.  The block is
+	 * over-allocated so the payload can be placed at the first
+	 * align boundary past the header; the list node tracks the
+	 * header, so reset doesn't need to recover it from the
+	 * payload address.
+	 */
+	if (arena->spill != NULL) {
+		struct arena_spill_hdr *hdr;
+		size_t pad = MAX(sizeof(*hdr), align);
+
+		hdr = k_heap_aligned_alloc(arena->spill, align,
+					   pad + bytes, K_NO_WAIT);
+		if (hdr != NULL) {
+			key = k_spin_lock(&arena->lock);
+			sys_slist_append(&arena->spill_blocks, &hdr->node);
+			k_spin_unlock(&arena->lock, key);
+			ret = (uint8_t *)hdr + pad;
+		}
+	}
+
+	return ret;
+}
+
+void *k_arena_alloc(struct k_arena *arena, size_t bytes)
+{
+	return k_arena_aligned_alloc(arena, sizeof(void *) * 2, bytes);
+}
+
+void k_arena_reset(struct k_arena *arena)
+{
+	sys_slist_t spilled;
+	sys_snode_t *node;
+
+	k_spinlock_key_t key = k_spin_lock(&arena->lock);
+
+	arena->offset = 0;
+	spilled = arena->spill_blocks;
+	sys_slist_init(&arena->spill_blocks);
+
+	k_spin_unlock(&arena->lock, key);
+
+	/* return spill-over blocks outside the arena lock */
+	while ((node = sys_slist_get(&spilled)) != NULL) {
+		k_heap_free(arena->spill,
+			    CONTAINER_OF(node, struct arena_spill_hdr, node));
+	}
+}
+
+size_t k_arena_remaining(struct k_arena *arena)
+{
+	k_spinlock_key_t key = k_spin_lock(&arena->lock);
+	size_t ret = arena->size - arena->offset;
+
+	k_spin_unlock(&arena->lock, key);
+
+	return ret;
+}
@@ -21,6 +21,9 @@ static struct k_spinlock lock;
 int z_impl_k_condvar_init(struct k_condvar *condvar)
 {
 	z_waitq_init(&condvar->wait_q);
+#ifdef CONFIG_CONDVAR_WAIT_MORPH
+	condvar->mutex = NULL;
+#endif /* CONFIG_CONDVAR_WAIT_MORPH */
 	k_object_init(condvar);
 
 #ifdef CONFIG_OBJ_CORE_CONDVAR
@@ -83,7 +86,51 @@ int z_impl_k_condvar_broadcast(struct k_condvar *condvar)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_condvar, broadcast, condvar);
 
-	/* wake up any threads that are waiting to write */
+#ifdef CONFIG_CONDVAR_WAIT_MORPH
+	struct k_mutex *mutex = condvar->mutex;
+
+	/* Wait morphing: wake exactly one thread to contend for the
+	 * mutex and move the others straight onto the mutex wait
+	 * queue, where successive unlocks hand the lock over, instead
+	 * of making every waiter stampede into k_mutex_lock() at
+	 * once.
+	 */
+	pending_thread = z_unpend_first_thread(&condvar->wait_q);
+	if (pending_thread != NULL) {
+		woken++;
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+
+		while (mutex != NULL) {
+			struct k_thread *thread;
+			int morphed;
+
+			LOCK_SCHED_SPINLOCK {
+				thread = _priq_wait_best(&condvar->wait_q.waitq);
+			}
+			if (thread == NULL) {
+				break;
+			}
+			morphed = z_mutex_wait_morph(mutex, &condvar->wait_q,
+						     thread);
+			if (morphed < 0) {
+				/* unowned mutex: nobody would ever
+				 * pass the lock on, wake the rest
+				 */
+				break;
+			}
+			/* morphed == 0: the waiter timed out between
+			 * the peek and the requeue; the next peek will
+			 * not see it.
+			 */
+			woken += morphed;
+		}
+	}
+#endif /* CONFIG_CONDVAR_WAIT_MORPH */
+
+	/* wake up any threads that are waiting to write (all of them
+	 * when wait morphing is disabled or not possible)
+	 */
 	for (pending_thread = z_unpend_first_thread(&condvar->wait_q); pending_thread != NULL;
 		 pending_thread = z_unpend_first_thread(&condvar->wait_q)) {
 		woken++;
@@ -126,11 +173,24 @@ int z_impl_k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
 	}
 
 	key = k_spin_lock(&lock);
+#ifdef CONFIG_CONDVAR_WAIT_MORPH
+	condvar->mutex = mutex;
+#endif /* CONFIG_CONDVAR_WAIT_MORPH */
 	k_mutex_unlock(mutex);
 
 	ret = z_pend_curr(&lock, key, &condvar->wait_q, timeout);
 	if (ret == 0) {
+#ifdef CONFIG_CONDVAR_WAIT_MORPH
+		/* A morphed waiter may already have been handed the
+		 * mutex by k_mutex_unlock(); locking again would
+		 * recursively bump the lock count.
+		 */
+		if (mutex->owner != _current) {
+			k_mutex_lock(mutex, K_FOREVER);
+		}
+#else
 		k_mutex_lock(mutex, K_FOREVER);
+#endif /* CONFIG_CONDVAR_WAIT_MORPH */
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_condvar, wait, condvar, timeout, ret);
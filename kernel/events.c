@@ -26,6 +26,7 @@
 
 #include <zephyr/toolchain.h>
 #include <zephyr/sys/dlist.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
@@ -51,12 +52,41 @@ struct event_walk_data {
 static struct k_obj_type obj_type_event;
 #endif /* CONFIG_OBJ_CORE_EVENT */
 
+#ifdef CONFIG_EVENTS_INDEXED_WAIT
+/* Initialize the waiter index; event->lock must be held (or the
+ * event not yet shared).
+ */
+static void event_index_init(struct k_event *event)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(event->bit_waiters); i++) {
+		sys_dlist_init(&event->bit_waiters[i]);
+	}
+	sys_dlist_init(&event->misc_waiters);
+	event->index_ready = 1U;
+}
+
+/* Pick the index list for a wait mask: single-bit masks get their
+ * own per-bit list, anything else lands in the catch-all.
+ */
+static sys_dlist_t *event_index_list(struct k_event *event, uint32_t events)
+{
+	if ((events & (events - 1)) == 0U) {
+		return &event->bit_waiters[u32_count_trailing_zeros(events)];
+	}
+
+	return &event->misc_waiters;
+}
+#endif /* CONFIG_EVENTS_INDEXED_WAIT */
+
 void z_impl_k_event_init(struct k_event *event)
 {
 	__ASSERT_NO_MSG(!arch_is_in_isr());
 
 	event->events = 0;
 	event->lock = (struct k_spinlock) {};
+#ifdef CONFIG_EVENTS_INDEXED_WAIT
+	event_index_init(event);
+#endif /* CONFIG_EVENTS_INDEXED_WAIT */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
 
@@ -144,6 +174,29 @@ static int event_walk_op(struct k_thread *thread, void *data)
 	return 0;
 }
 
+#ifdef CONFIG_EVENTS_INDEXED_WAIT
+static void event_index_walk(struct k_event *event, sys_dlist_t *list,
+			     struct event_walk_data *data)
+{
+	struct k_thread *thread;
+
+	ARG_UNUSED(event);
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, thread, event_node) {
+		LOCK_SCHED_SPINLOCK {
+			/* A registered thread that has already
+			 * unpended (e.g. on timeout) deregisters
+			 * itself before it can pend anywhere else, so
+			 * "pending" here implies pended on this event.
+			 */
+			if (z_is_thread_pending(thread)) {
+				(void)event_walk_op(thread, data);
+			}
+		}
+	}
+}
+#endif /* CONFIG_EVENTS_INDEXED_WAIT */
+
 static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
@@ -174,7 +227,23 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 
 	data.events = events;
 	data.clear_events = 0;
+#ifdef CONFIG_EVENTS_INDEXED_WAIT
+	if (likely(event->index_ready != 0U)) {
+		/* Only visit waiters whose masks can intersect the
+		 * posted value: the per-bit lists of every set bit,
+		 * plus the catch-all for multi-bit masks.
+		 */
+		for (uint32_t scan = data.events; scan != 0U;
+		     scan &= (scan - 1)) {
+			event_index_walk(event,
+					 &event->bit_waiters[u32_count_trailing_zeros(scan)],
+					 &data);
+		}
+		event_index_walk(event, &event->misc_waiters, &data);
+	}
+#else
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+#endif /* CONFIG_EVENTS_INDEXED_WAIT */
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -311,10 +380,31 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
+#ifdef CONFIG_EVENTS_INDEXED_WAIT
+	if (unlikely(event->index_ready == 0U)) {
+		/* statically defined event on its first wait */
+		event_index_init(event);
+	}
+	sys_dlist_append(event_index_list(event, events), &thread->event_node);
+
+	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
+		/* Retrieve the set of events that woke the thread */
+		rv = thread->events;
+	}
+
+	/* Deregister from the waiter index before doing anything
+	 * else; posts treat a registered, pended thread as pended on
+	 * this event.
+	 */
+	key = k_spin_lock(&event->lock);
+	sys_dlist_remove(&thread->event_node);
+	k_spin_unlock(&event->lock, key);
+#else
 	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
 		/* Retrieve the set of events that woke the thread */
 		rv = thread->events;
 	}
+#endif /* CONFIG_EVENTS_INDEXED_WAIT */
 
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, wait, event, events, rv);
@@ -84,6 +84,17 @@ FUNC_NORETURN void k_fatal_halt(unsigned int reason)
 
 void z_fatal_error(unsigned int reason, const struct arch_esf *esf)
 {
+#if defined(CONFIG_RAM_TRACING_FLIGHT_RECORDER)
+	{
+		/* stop the trace flight recorder first so the window
+		 * leading up to this error survives the dump
+		 */
+		extern void tracing_buffer_freeze(void);
+
+		tracing_buffer_freeze();
+	}
+#endif /* CONFIG_RAM_TRACING_FLIGHT_RECORDER */
+
 	/* We can't allow this code to be preempted, but don't need to
 	 * synchronize between CPUs, so an arch-layer lock is
 	 * appropriate.
@@ -11,6 +11,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/init.h>
 #include <ksched.h>
+#include <wait_q.h>
 
 static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 {
@@ -84,6 +85,11 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 
 	key = k_spin_lock(&futex_data->lock);
 
+#ifdef CONFIG_FUTEX_BITSET_OPS
+	/* a plain wait matches any wake bitset */
+	_current->base.swap_data = (void *)(uintptr_t)UINT32_MAX;
+#endif /* CONFIG_FUTEX_BITSET_OPS */
+
 	ret = z_pend_curr(&futex_data->lock,
 			key, &futex_data->wait_q, timeout);
 	if (ret == -EAGAIN) {
@@ -103,3 +109,206 @@ static inline int z_vrfy_k_futex_wait(struct k_futex *futex, int expected,
 	return z_impl_k_futex_wait(futex, expected, timeout);
 }
 #include <zephyr/syscalls/k_futex_wait_mrsh.c>
+
+#ifdef CONFIG_FUTEX_BITSET_OPS
+
+int z_impl_k_futex_wait_bitset(struct k_futex *futex, int expected,
+			       uint32_t bitset, k_timeout_t timeout)
+{
+	int ret;
+	k_spinlock_key_t key;
+	struct z_futex_data *futex_data;
+
+	if (bitset == 0U) {
+		return -EINVAL;
+	}
+
+	futex_data = k_futex_find_data(futex);
+	if (futex_data == NULL) {
+		return -EINVAL;
+	}
+
+	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		return -EAGAIN;
+	}
+
+	key = k_spin_lock(&futex_data->lock);
+
+	/* The bitset rides in swap_data while we pend; wake-side
+	 * selection reads it under the scheduler lock.
+	 */
+	_current->base.swap_data = (void *)(uintptr_t)bitset;
+
+	ret = z_pend_curr(&futex_data->lock,
+			key, &futex_data->wait_q, timeout);
+	if (ret == -EAGAIN) {
+		ret = -ETIMEDOUT;
+	}
+
+	return ret;
+}
+
+static inline int z_vrfy_k_futex_wait_bitset(struct k_futex *futex, int expected,
+					     uint32_t bitset, k_timeout_t timeout)
+{
+	if (K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_wait_bitset(futex, expected, bitset, timeout);
+}
+#include <zephyr/syscalls/k_futex_wait_bitset_mrsh.c>
+
+int z_impl_k_futex_wake_bitset(struct k_futex *futex, bool wake_all,
+			       uint32_t bitset)
+{
+	k_spinlock_key_t key;
+	unsigned int woken = 0U;
+	unsigned int limit = wake_all ? UINT_MAX : 1U;
+	struct k_thread *thread;
+	struct k_thread *head = NULL;
+	struct z_futex_data *futex_data;
+
+	if (bitset == 0U) {
+		return -EINVAL;
+	}
+
+	futex_data = k_futex_find_data(futex);
+	if (futex_data == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&futex_data->lock);
+
+	/* Select matching waiters and pull them off the wait queue
+	 * under the scheduler lock (their timeouts are disarmed
+	 * there too), chaining them through the swap_data word that
+	 * carried their bitset; then make them runnable.
+	 */
+	LOCK_SCHED_SPINLOCK {
+		_WAIT_Q_FOR_EACH(&futex_data->wait_q, thread) {
+			uint32_t waiter_bits =
+				(uint32_t)(uintptr_t)thread->base.swap_data;
+
+			if ((woken < limit) && ((waiter_bits & bitset) != 0U)) {
+				thread->base.swap_data = head;
+				head = thread;
+				woken++;
+			}
+		}
+
+		for (thread = head; thread != NULL;
+		     thread = thread->base.swap_data) {
+			unpend_thread_no_timeout(thread);
+			z_abort_thread_timeout(thread);
+		}
+	}
+
+	while (head != NULL) {
+		thread = head;
+		head = thread->base.swap_data;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	if (woken == 0U) {
+		k_spin_unlock(&futex_data->lock, key);
+	} else {
+		z_reschedule(&futex_data->lock, key);
+	}
+
+	return (int)woken;
+}
+
+static inline int z_vrfy_k_futex_wake_bitset(struct k_futex *futex, bool wake_all,
+					     uint32_t bitset)
+{
+	if (K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_wake_bitset(futex, wake_all, bitset);
+}
+#include <zephyr/syscalls/k_futex_wake_bitset_mrsh.c>
+
+#endif /* CONFIG_FUTEX_BITSET_OPS */
+
+#ifdef CONFIG_FUTEX_REQUEUE
+
+int z_impl_k_futex_requeue(struct k_futex *futex, int expected,
+			   unsigned int wake_count, struct k_futex *target)
+{
+	k_spinlock_key_t key;
+	unsigned int woken = 0U;
+	struct k_thread *thread;
+	struct z_futex_data *futex_data;
+	struct z_futex_data *target_data;
+
+	futex_data = k_futex_find_data(futex);
+	target_data = k_futex_find_data(target);
+	if ((futex_data == NULL) || (target_data == NULL) ||
+	    (futex_data == target_data)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&futex_data->lock);
+
+	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(&futex_data->lock, key);
+		return -EAGAIN;
+	}
+
+	/* Wake up to wake_count waiters the usual way... */
+	while (woken < wake_count) {
+		thread = z_unpend_first_thread(&futex_data->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+		woken++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	/* ...and migrate the remainder onto the target futex without
+	 * waking them; their timeouts stay armed.  The target wait
+	 * queue is consistently manipulated under the scheduler lock,
+	 * so the target futex lock is not required.
+	 */
+	for (;;) {
+		LOCK_SCHED_SPINLOCK {
+			thread = _priq_wait_best(&futex_data->wait_q.waitq);
+		}
+		if (thread == NULL) {
+			break;
+		}
+		/* A false return means the waiter's timeout fired
+		 * between the peek and here and it is no longer pended
+		 * on this futex; the next peek will not see it.
+		 */
+		(void)z_requeue_pended(thread, &futex_data->wait_q,
+				       &target_data->wait_q);
+	}
+
+	if (woken == 0U) {
+		k_spin_unlock(&futex_data->lock, key);
+	} else {
+		z_reschedule(&futex_data->lock, key);
+	}
+
+	return (int)woken;
+}
+
+static inline int z_vrfy_k_futex_requeue(struct k_futex *futex, int expected,
+					 unsigned int wake_count,
+					 struct k_futex *target)
+{
+	if ((K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) ||
+	    (K_SYSCALL_MEMORY_WRITE(target, sizeof(struct k_futex)) != 0)) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_requeue(futex, expected, wake_count, target);
+}
+#include <zephyr/syscalls/k_futex_requeue_mrsh.c>
+
+#endif /* CONFIG_FUTEX_REQUEUE */
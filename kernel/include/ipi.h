@@ -16,16 +16,23 @@
 #define IPI_CPU_MASK(cpu_id)   \
 	(IS_ENABLED(CONFIG_IPI_OPTIMIZE) ? BIT(cpu_id) : IPI_ALL_CPUS_MASK)
 
+/* Reasons for an IPI, tracked per target CPU when CONFIG_IPI_COALESCE
+ * is enabled so one interrupt can process everything that accumulated.
+ */
+#define IPI_CAUSE_RESCHED	BIT(0)
+#define IPI_CAUSE_WORK		BIT(1)
 
 void z_sched_ipi(void);
 
 /* defined in ipi.c when CONFIG_SMP=y */
 #ifdef CONFIG_SMP
 void flag_ipi(uint32_t ipi_mask);
+void flag_ipi_cause(uint32_t ipi_mask, uint32_t cause);
 void signal_pending_ipi(void);
 atomic_val_t ipi_mask_create(struct k_thread *thread);
 #else
 #define flag_ipi(ipi_mask) do { } while (false)
+#define flag_ipi_cause(ipi_mask, cause) do { } while (false)
 #define signal_pending_ipi() do { } while (false)
 #endif /* CONFIG_SMP */
 
@@ -54,6 +54,12 @@ extern struct k_thread _thread_dummy;
 
 void z_sched_init(void);
 void z_unpend_thread_no_timeout(struct k_thread *thread);
+bool z_requeue_pended(struct k_thread *thread, _wait_q_t *from,
+		      _wait_q_t *to);
+#ifdef CONFIG_CONDVAR_WAIT_MORPH
+int z_mutex_wait_morph(struct k_mutex *mutex, _wait_q_t *from,
+			struct k_thread *thread);
+#endif /* CONFIG_CONDVAR_WAIT_MORPH */
 struct k_thread *z_unpend1_no_timeout(_wait_q_t *wait_q);
 int z_pend_curr(struct k_spinlock *lock, k_spinlock_key_t key,
 	       _wait_q_t *wait_q, k_timeout_t timeout);
@@ -68,6 +74,11 @@ void *z_get_next_switch_handle(void *interrupted);
 
 void z_time_slice(void);
 void z_reset_time_slice(struct k_thread *curr);
+#ifdef CONFIG_TIMESLICE_LAZY
+/* Both are called with _sched_spinlock held */
+bool z_sched_has_priority_peer(struct k_thread *thread);
+void z_time_slice_arm(struct k_thread *thread);
+#endif /* CONFIG_TIMESLICE_LAZY */
 void z_sched_start(struct k_thread *thread);
 void z_ready_thread(struct k_thread *thread);
 void z_requeue_current(struct k_thread *curr);
@@ -317,6 +328,30 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_DEADLINE_BANDWIDTH
+/* Charge consumed cycles against a thread's bandwidth reservation.
+ * Replenishment and the deadline postponement happen when the thread
+ * is next queued (see queue_thread()).
+ */
+static inline void z_sched_budget_charge(struct k_thread *thread, uint32_t cycles)
+{
+	if (thread->base.dl_budget != 0U) {
+		thread->base.dl_budget_left -= (int32_t)cycles;
+	}
+}
+#endif /* CONFIG_SCHED_DEADLINE_BANDWIDTH */
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+/**
+ * @brief Timestamp a thread's transition to the ready queue
+ *
+ * Called at wakeup time so the switch-in accounting in usage.c can
+ * compute the wakeup-to-run latency with the same clock it uses for
+ * runtime statistics.
+ */
+void z_sched_latency_mark(struct k_thread *thread);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
@@ -16,6 +16,7 @@
 #define _priq_run_add		z_priq_simple_add
 #define _priq_run_remove	z_priq_simple_remove
 #define _priq_run_yield         z_priq_simple_yield
+#define _priq_run_has_peer	z_priq_simple_has_peer
 # if defined(CONFIG_SCHED_CPU_MASK)
 #  define _priq_run_best	z_priq_simple_mask_best
 # else
@@ -35,6 +36,7 @@
 #define _priq_run_remove	z_priq_mq_remove
 #define _priq_run_yield         z_priq_mq_yield
 #define _priq_run_best		z_priq_mq_best
+#define _priq_run_has_peer	z_priq_mq_has_peer
 #endif
 
 /* Scalable Wait Queue */
@@ -186,6 +188,36 @@ static ALWAYS_INLINE struct k_thread *z_priq_simple_mask_best(sys_dlist_t *pq)
 }
 #endif /* CONFIG_SCHED_CPU_MASK */
 
+/* True when the queue holds a runnable thread other than <thread> at
+ * exactly its priority.  The list is kept sorted by z_sched_prio_cmp()
+ * order, so the scan stops at the first lower entry; with CPU masks a
+ * peer only counts when it may run on this CPU.
+ */
+static ALWAYS_INLINE bool z_priq_simple_has_peer(sys_dlist_t *pq,
+						 struct k_thread *thread)
+{
+	struct k_thread *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(pq, t, base.qnode_dlist) {
+		int32_t cmp = z_sched_prio_cmp(t, thread);
+
+		if (cmp < 0) {
+			break;
+		}
+
+		if ((cmp == 0) && (t != thread)) {
+#ifdef CONFIG_SCHED_CPU_MASK
+			if ((t->base.cpu_mask & BIT(_current_cpu->id)) == 0U) {
+				continue;
+			}
+#endif /* CONFIG_SCHED_CPU_MASK */
+			return true;
+		}
+	}
+
+	return false;
+}
+
 #if defined(CONFIG_SCHED_SCALABLE) || defined(CONFIG_WAITQ_SCALABLE)
 static ALWAYS_INLINE void z_priq_rb_init(struct _priq_rb *pq)
 {
@@ -269,14 +301,17 @@ static ALWAYS_INLINE struct prio_info get_prio_info(int8_t old_prio)
 
 static ALWAYS_INLINE unsigned int z_priq_mq_best_queue_index(struct _priq_mq *pq)
 {
-	unsigned int i = 0;
+#if PRIQ_BITMAP_SIZE > 1
+	if (likely(pq->bitmask_summary)) {
+		unsigned int i = TRAILING_ZEROS(pq->bitmask_summary);
 
-	do {
-		if (likely(pq->bitmask[i])) {
-			return i * NBITS + TRAILING_ZEROS(pq->bitmask[i]);
-		}
-		i++;
-	} while (i < PRIQ_BITMAP_SIZE);
+		return i * NBITS + TRAILING_ZEROS(pq->bitmask[i]);
+	}
+#else
+	if (likely(pq->bitmask[0])) {
+		return TRAILING_ZEROS(pq->bitmask[0]);
+	}
+#endif
 
 	return K_NUM_THREAD_PRIO - 1;
 }
@@ -299,6 +334,9 @@ static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
+#if PRIQ_BITMAP_SIZE > 1
+	pq->bitmask_summary |= BIT(pos.idx);
+#endif
 
 #ifndef CONFIG_SMP
 	if (pos.offset_prio < pq->cached_queue_index) {
@@ -315,12 +353,39 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 	sys_dlist_dequeue(&thread->base.qnode_dlist);
 	if (unlikely(sys_dlist_is_empty(&pq->queues[pos.offset_prio]))) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+#if PRIQ_BITMAP_SIZE > 1
+		if (pq->bitmask[pos.idx] == 0UL) {
+			pq->bitmask_summary &= ~BIT(pos.idx);
+		}
+#endif
 #ifndef CONFIG_SMP
 		pq->cached_queue_index = z_priq_mq_best_queue_index(pq);
 #endif
 	}
 }
 
+/* True when <thread>'s priority bucket holds any other entry.  MULTIQ
+ * orders by static priority only, so every other entry in the bucket
+ * is a peer.
+ */
+static ALWAYS_INLINE bool z_priq_mq_has_peer(struct _priq_mq *pq,
+					     struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+	sys_dlist_t *q = &pq->queues[pos.offset_prio];
+	sys_dnode_t *n = sys_dlist_peek_head(q);
+
+	if (n == NULL) {
+		return false;
+	}
+
+	if (n != &thread->base.qnode_dlist) {
+		return true;
+	}
+
+	return sys_dlist_peek_next(q, n) != NULL;
+}
+
 static ALWAYS_INLINE void z_priq_mq_yield(struct _priq_mq *pq)
 {
 #ifndef CONFIG_SMP
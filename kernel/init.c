@@ -206,6 +206,84 @@ static void z_device_state_init(void)
 	}
 }
 
+#ifdef CONFIG_BOOT_TIMING
+/* Boot chronograph: one record per executed init entry, reported
+ * sorted by cost once the application level has run.
+ */
+struct boot_timing_rec {
+	const struct init_entry *entry;
+	uint32_t cycles;
+	uint8_t level;
+};
+
+static struct boot_timing_rec boot_timings[CONFIG_BOOT_TIMING_MAX_ENTRIES];
+static uint16_t boot_timing_count;
+static uint16_t boot_timing_lost;
+
+static void boot_timing_record(const struct init_entry *entry, enum init_level level,
+			       uint32_t cycles)
+{
+	if (boot_timing_count == ARRAY_SIZE(boot_timings)) {
+		boot_timing_lost++;
+		return;
+	}
+
+	boot_timings[boot_timing_count].entry = entry;
+	boot_timings[boot_timing_count].level = level;
+	boot_timings[boot_timing_count].cycles = cycles;
+	boot_timing_count++;
+}
+
+static void boot_timing_report(void)
+{
+	static const char *const level_names[] = {
+		"EARLY", "PRE_KERNEL_1", "PRE_KERNEL_2", "POST_KERNEL", "APPLICATION", "SMP",
+	};
+	uint64_t total_us = 0;
+
+	/* Insertion sort by descending cost; the table is small */
+	for (uint16_t i = 1; i < boot_timing_count; i++) {
+		struct boot_timing_rec tmp = boot_timings[i];
+		int16_t j = i - 1;
+
+		while ((j >= 0) && (boot_timings[j].cycles < tmp.cycles)) {
+			boot_timings[j + 1] = boot_timings[j];
+			j--;
+		}
+		boot_timings[j + 1] = tmp;
+	}
+
+	printk("*** boot timing: %u init entries ***\n", boot_timing_count);
+
+	for (uint16_t i = 0; i < boot_timing_count; i++) {
+		const struct boot_timing_rec *rec = &boot_timings[i];
+		uint32_t usec = k_cyc_to_us_near32(rec->cycles);
+		bool over = (CONFIG_BOOT_TIMING_BUDGET_US > 0) &&
+			    (usec > CONFIG_BOOT_TIMING_BUDGET_US);
+
+		total_us += usec;
+
+		if (rec->entry->dev != NULL) {
+			printk("%s%-12s %6u us  %s\n", over ? "!" : " ",
+			       level_names[rec->level], usec, rec->entry->dev->name);
+		} else {
+			printk("%s%-12s %6u us  SYS_INIT %p\n", over ? "!" : " ",
+			       level_names[rec->level], usec, (void *)rec->entry->init_fn);
+		}
+	}
+
+	if (boot_timing_lost > 0) {
+		printk("(%u entries not recorded, increase "
+		       "CONFIG_BOOT_TIMING_MAX_ENTRIES)\n", boot_timing_lost);
+	}
+
+	printk("*** total instrumented: %llu us ***\n", total_us);
+}
+#else
+#define boot_timing_record(entry, level, cycles)
+#define boot_timing_report()
+#endif /* CONFIG_BOOT_TIMING */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -238,6 +316,9 @@ static void z_sys_init_run_level(enum init_level level)
 		int result = 0;
 
 		sys_trace_sys_init_enter(entry, level);
+#ifdef CONFIG_BOOT_TIMING
+		uint32_t start_cycles = k_cycle_get_32();
+#endif
 		if (dev != NULL) {
 			if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
 				result = do_device_init(dev);
@@ -245,6 +326,7 @@ static void z_sys_init_run_level(enum init_level level)
 		} else {
 			result = entry->init_fn();
 		}
+		boot_timing_record(entry, level, k_cycle_get_32() - start_cycles);
 		sys_trace_sys_init_exit(entry, level, result);
 	}
 }
@@ -334,6 +416,8 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 	z_mem_manage_boot_finish();
 #endif /* CONFIG_MMU */
 
+	boot_timing_report();
+
 #ifdef CONFIG_BOOTARGS
 	extern int main(int, char **);
 	extern char **prepare_main_args(int *argc);
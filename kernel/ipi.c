@@ -16,15 +16,40 @@ static struct k_spinlock ipi_lock;
 extern void z_trace_sched_ipi(void);
 #endif
 
-void flag_ipi(uint32_t ipi_mask)
+void flag_ipi_cause(uint32_t ipi_mask, uint32_t cause)
 {
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
+#ifdef CONFIG_IPI_COALESCE
+		unsigned int num_cpus = arch_num_cpus();
+
+		/* Record the cause before the pending/in-flight
+		 * checks in signal_pending_ipi(): a receiver clears
+		 * its in-flight bit before reading its causes, so
+		 * either it sees this cause or we send a fresh IPI.
+		 */
+		for (unsigned int i = 0; i < num_cpus; i++) {
+			if ((ipi_mask & BIT(i)) != 0U) {
+				atomic_or(&_kernel.cpus[i].ipi_causes,
+					  (atomic_val_t)cause);
+			}
+		}
+#else
+		ARG_UNUSED(cause);
+#endif /* CONFIG_IPI_COALESCE */
 		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
 	}
+#else
+	ARG_UNUSED(ipi_mask);
+	ARG_UNUSED(cause);
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
 
+void flag_ipi(uint32_t ipi_mask)
+{
+	flag_ipi_cause(ipi_mask, IPI_CAUSE_RESCHED);
+}
+
 /* Create a bitmask of CPUs that need an IPI. Note: sched_spinlock is held. */
 atomic_val_t ipi_mask_create(struct k_thread *thread)
 {
@@ -84,6 +109,18 @@ void signal_pending_ipi(void)
 		uint32_t  cpu_bitmap;
 
 		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+#ifdef CONFIG_IPI_COALESCE
+		/* Suppress IPIs to CPUs that already have one in
+		 * flight: they will pick the new causes up in the
+		 * interrupt they are about to take anyway.
+		 */
+		if (cpu_bitmap != 0) {
+			uint32_t inflight = (uint32_t)atomic_or(
+				&_kernel.ipi_inflight, (atomic_val_t)cpu_bitmap);
+
+			cpu_bitmap &= ~inflight;
+		}
+#endif /* CONFIG_IPI_COALESCE */
 		if (cpu_bitmap != 0) {
 #ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
 			arch_sched_directed_ipi(cpu_bitmap);
@@ -140,7 +177,7 @@ int k_ipi_work_add(struct k_ipi_work *work, uint32_t cpu_bitmask,
 		}
 	}
 
-	flag_ipi(cpu_bitmask);
+	flag_ipi_cause(cpu_bitmask, IPI_CAUSE_WORK);
 
 	k_spin_unlock(&ipi_lock, key);
 
@@ -186,12 +223,30 @@ void z_sched_ipi(void)
 	/* NOTE: When adding code to this, make sure this is called
 	 * at appropriate location when !CONFIG_SCHED_IPI_SUPPORTED.
 	 */
+#ifdef CONFIG_IPI_COALESCE
+	uint32_t causes;
+
+	/* Clear our in-flight bit before reading the causes: a sender
+	 * racing us either gets its cause seen below or finds the bit
+	 * clear and sends a fresh IPI.
+	 */
+	(void)atomic_and(&_kernel.ipi_inflight,
+			 ~(atomic_val_t)BIT(_current_cpu->id));
+	causes = (uint32_t)atomic_clear(&_current_cpu->ipi_causes);
+#endif /* CONFIG_IPI_COALESCE */
+
 #ifdef CONFIG_TRACE_SCHED_IPI
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
 #ifdef CONFIG_TIMESLICING
+#ifdef CONFIG_IPI_COALESCE
+	if ((causes & IPI_CAUSE_RESCHED) != 0U) {
+		z_time_slice();
+	}
+#else
 	z_time_slice();
+#endif /* CONFIG_IPI_COALESCE */
 #endif /* CONFIG_TIMESLICING */
 
 #ifdef CONFIG_ARCH_IPI_LAZY_COPROCESSORS_SAVE
@@ -199,6 +254,12 @@ void z_sched_ipi(void)
 #endif
 
 #ifdef CONFIG_SCHED_IPI_SUPPORTED
+#ifdef CONFIG_IPI_COALESCE
+	if ((causes & IPI_CAUSE_WORK) != 0U) {
+		ipi_work_process(&_kernel.cpus[_current_cpu->id].ipi_workq);
+	}
+#else
 	ipi_work_process(&_kernel.cpus[_current_cpu->id].ipi_workq);
-#endif
+#endif /* CONFIG_IPI_COALESCE */
+#endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
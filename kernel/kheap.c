@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
@@ -23,11 +25,149 @@ int k_heap_array_get(struct k_heap **heap)
 	return num;
 }
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+
+/* Upper payload bound of each cache class; a block is cached in the
+ * largest class not exceeding its usable size, provided it doesn't
+ * waste more than half of it (see kheap_class_for_free()).
+ */
+static const uint16_t kheap_class_size[K_HEAP_CACHE_NUM_CLASSES] = {
+	32, 64, 128, 256
+};
+
+/* Blocks retained per class and CPU before frees spill back */
+#define KHEAP_CACHE_DEPTH 8U
+
+/* Smallest class able to satisfy an allocation, or -1 */
+static int kheap_class_for_alloc(size_t bytes)
+{
+	for (int i = 0; i < K_HEAP_CACHE_NUM_CLASSES; i++) {
+		if (bytes <= kheap_class_size[i]) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/* Class a freed block of the given usable size may be cached in, or
+ * -1 when it fits no class or would waste more than half its space.
+ */
+static int kheap_class_for_free(size_t usable)
+{
+	for (int i = K_HEAP_CACHE_NUM_CLASSES - 1; i >= 0; i--) {
+		if ((usable >= kheap_class_size[i]) &&
+		    (usable < ((size_t)kheap_class_size[i] * 2U))) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static void *kheap_cache_alloc(struct k_heap *heap, size_t bytes)
+{
+	int class_idx = kheap_class_for_alloc(bytes);
+	void *mem = NULL;
+
+	if (class_idx < 0) {
+		return NULL;
+	}
+
+	unsigned int key = arch_irq_lock();
+	void **list = &heap->cpu_cache[arch_curr_cpu()->id].classes[class_idx];
+
+	mem = *list;
+	if (mem != NULL) {
+		*list = *(void **)mem;
+		heap->cpu_cache[arch_curr_cpu()->id].count[class_idx]--;
+	}
+	arch_irq_unlock(key);
+
+	return mem;
+}
+
+static bool kheap_cache_free(struct k_heap *heap, void *mem)
+{
+	/* The usable size of an allocated chunk is stable, so this is
+	 * safe without the heap lock.
+	 */
+	int class_idx = kheap_class_for_free(sys_heap_usable_size(&heap->heap, mem));
+	bool cached = false;
+
+	if (class_idx < 0) {
+		return false;
+	}
+
+	/* Don't capture frees while allocators are blocked waiting
+	 * for memory: they can only be satisfied by the real heap.
+	 * The unlocked peek is benign; a racing waiter wakes on the
+	 * next uncached free or its timeout.
+	 */
+	if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+	    (z_waitq_head(&heap->wait_q) != NULL)) {
+		return false;
+	}
+
+	unsigned int key = arch_irq_lock();
+	struct _cpu *cpu = arch_curr_cpu();
+
+	if (heap->cpu_cache[cpu->id].count[class_idx] < KHEAP_CACHE_DEPTH) {
+		*(void **)mem = heap->cpu_cache[cpu->id].classes[class_idx];
+		heap->cpu_cache[cpu->id].classes[class_idx] = mem;
+		heap->cpu_cache[cpu->id].count[class_idx]++;
+		cached = true;
+	}
+	arch_irq_unlock(key);
+
+	return cached;
+}
+
+void k_heap_cache_trim(struct k_heap *heap)
+{
+	void *chain = NULL;
+	void *mem;
+
+	/* Detach the calling CPU's magazines... */
+	unsigned int irq_key = arch_irq_lock();
+	struct _cpu *cpu = arch_curr_cpu();
+
+	for (int i = 0; i < K_HEAP_CACHE_NUM_CLASSES; i++) {
+		while ((mem = heap->cpu_cache[cpu->id].classes[i]) != NULL) {
+			heap->cpu_cache[cpu->id].classes[i] = *(void **)mem;
+			*(void **)mem = chain;
+			chain = mem;
+		}
+		heap->cpu_cache[cpu->id].count[i] = 0U;
+	}
+	arch_irq_unlock(irq_key);
+
+	/* ...and return them to the shared heap */
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+	while (chain != NULL) {
+		mem = chain;
+		chain = *(void **)mem;
+		sys_heap_free(&heap->heap, mem);
+	}
+
+	if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+	    (z_unpend_all(&heap->wait_q) != 0)) {
+		z_reschedule(&heap->lock, key);
+	} else {
+		k_spin_unlock(&heap->lock, key);
+	}
+}
+#endif /* CONFIG_KHEAP_CPU_CACHE */
+
 void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
 	sys_heap_init(&heap->heap, mem, bytes);
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	(void)memset(heap->cpu_cache, 0, sizeof(heap->cpu_cache));
+#endif /* CONFIG_KHEAP_CPU_CACHE */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
@@ -120,8 +260,17 @@ void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, heap, timeout);
 
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	void *ret = (bytes > 0U) ? kheap_cache_alloc(heap, bytes) : NULL;
+
+	if (ret == NULL) {
+		ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
+					  sys_heap_noalign_alloc);
+	}
+#else
 	void *ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
 					sys_heap_noalign_alloc);
+#endif /* CONFIG_KHEAP_CPU_CACHE */
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, ret);
 
@@ -205,6 +354,13 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_KHEAP_CPU_CACHE
+	if ((mem != NULL) && kheap_cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif /* CONFIG_KHEAP_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
@@ -136,6 +136,14 @@ static int mbox_message_match(struct k_mbox_msg *tx_msg,
 		/* update data location fields for receiver only */
 		rx_msg->tx_data = tx_msg->tx_data;
 
+#ifdef CONFIG_MBOX_BUF_TRANSFER
+		/* propagate the ownership release hook to the receiver
+		 * side descriptor, which is what gets disposed
+		 */
+		rx_msg->tx_buf_done = tx_msg->tx_buf_done;
+		rx_msg->tx_buf_done_data = tx_msg->tx_buf_done_data;
+#endif /* CONFIG_MBOX_BUF_TRANSFER */
+
 		/* update syncing thread field for receiver only */
 		rx_msg->_syncing_thread = tx_msg->_syncing_thread;
 
@@ -162,6 +170,17 @@ static void mbox_message_dispose(struct k_mbox_msg *rx_msg)
 		return;
 	}
 
+#ifdef CONFIG_MBOX_BUF_TRANSFER
+	/* Ownership transfer: the receiver (or the drop path) is done
+	 * with the transferred buffer, hand it back to its pool.
+	 * Fires exactly once per message, guarded by the
+	 * _syncing_thread check above.
+	 */
+	if (rx_msg->tx_buf_done != NULL) {
+		rx_msg->tx_buf_done(rx_msg->tx_data, rx_msg->tx_buf_done_data);
+	}
+#endif /* CONFIG_MBOX_BUF_TRANSFER */
+
 	/* recover sender info */
 	sending_thread = rx_msg->_syncing_thread;
 	rx_msg->_syncing_thread = NULL;
@@ -159,6 +159,82 @@ out:
 	return ret;
 }
 
+int k_mem_domain_set_partitions(struct k_mem_domain *domain, uint8_t num_parts,
+				struct k_mem_partition *parts[])
+{
+	k_spinlock_key_t key;
+	int ret = 0;
+	uint32_t i;
+
+	CHECKIF(domain == NULL) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	CHECKIF(!(num_parts == 0U || parts != NULL)) {
+		LOG_ERR("parts array is NULL and num_parts is nonzero");
+		ret = -EINVAL;
+		goto out;
+	}
+
+	CHECKIF(!(num_parts <= max_partitions)) {
+		LOG_ERR("num_parts of %d exceeds maximum allowable partitions (%d)",
+			num_parts, max_partitions);
+		ret = -EINVAL;
+		goto out;
+	}
+
+	key = k_spin_lock(&z_mem_domain_lock);
+
+	/* Retire the current partition set in the same lock hold, so
+	 * the whole replacement costs one critical section instead of
+	 * one per k_mem_domain_remove_partition()/add_partition()
+	 * round trip.
+	 */
+	for (i = 0U; i < max_partitions; i++) {
+		if (domain->partitions[i].size == 0U) {
+			continue;
+		}
+
+#ifdef CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API
+		int ret3 = arch_mem_domain_partition_remove(domain, i);
+
+		ARG_UNUSED(ret3);
+		CHECKIF(ret3 != 0) {
+			ret = ret3;
+		}
+#endif /* CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API */
+		domain->partitions[i].size = 0U;
+	}
+	domain->num_partitions = 0U;
+
+	for (i = 0U; i < num_parts; i++) {
+		CHECKIF(!check_add_partition(domain, parts[i])) {
+			LOG_ERR("invalid partition index %d (%p)",
+				i, parts[i]);
+			ret = -EINVAL;
+			goto unlock_out;
+		}
+
+		domain->partitions[i] = *parts[i];
+		domain->num_partitions++;
+#ifdef CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API
+		int ret2 = arch_mem_domain_partition_add(domain, i);
+
+		ARG_UNUSED(ret2);
+		CHECKIF(ret2 != 0) {
+			ret = ret2;
+		}
+#endif /* CONFIG_ARCH_MEM_DOMAIN_SYNCHRONOUS_API */
+	}
+
+unlock_out:
+	k_spin_unlock(&z_mem_domain_lock, key);
+
+out:
+	return ret;
+}
+
 int k_mem_domain_add_partition(struct k_mem_domain *domain,
 			       struct k_mem_partition *part)
 {
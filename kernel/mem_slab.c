@@ -101,16 +101,96 @@ static struct k_obj_core_stats_desc mem_slab_stats_desc = {
  * @retval 0 on success.
  * @retval -EINVAL if @p slab contains invalid configuration and/or values.
  */
-static int create_free_list(struct k_mem_slab *slab)
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+
+/* The free list head packs a 1-based block index and an ABA tag into
+ * one atomic word.  The tag is bumped on every successful pop, so a
+ * pop whose "next" read went stale (because the head block was
+ * popped, used and pushed back concurrently) fails its CAS.  On
+ * 32-bit targets this limits slabs to 2^20 blocks with a 12-bit tag.
+ */
+#ifdef CONFIG_64BIT
+#define SLAB_IDX_BITS 32U
+#else
+#define SLAB_IDX_BITS 20U
+#endif
+#define SLAB_IDX_MASK ((1UL << SLAB_IDX_BITS) - 1UL)
+#define SLAB_TAG_INC  (1UL << SLAB_IDX_BITS)
+
+static inline char *slab_block(struct k_mem_slab *slab, unsigned long idx1)
 {
-	char *p;
+	return slab->buffer + ((idx1 - 1UL) * slab->info.block_size);
+}
+
+static inline unsigned long slab_index1(struct k_mem_slab *slab, void *mem)
+{
+	return (unsigned long)(((char *)mem - slab->buffer) /
+			       slab->info.block_size) + 1UL;
+}
+
+static void *slab_pop(struct k_mem_slab *slab)
+{
+	while (true) {
+		atomic_val_t v = atomic_get(&slab->free_head);
+		unsigned long idx1 = (unsigned long)v & SLAB_IDX_MASK;
+
+		if (idx1 == 0UL) {
+			return NULL;
+		}
+
+		char *mem = slab_block(slab, idx1);
+		unsigned long next = *(unsigned long *)mem;
+		atomic_val_t nv = (atomic_val_t)(
+			(((unsigned long)v + SLAB_TAG_INC) & ~SLAB_IDX_MASK) | next);
+
+		if (atomic_cas(&slab->free_head, v, nv)) {
+			return mem;
+		}
+	}
+}
+
+static void slab_push(struct k_mem_slab *slab, void *mem)
+{
+	unsigned long idx1 = slab_index1(slab, mem);
+
+	while (true) {
+		atomic_val_t v = atomic_get(&slab->free_head);
+
+		*(unsigned long *)mem = (unsigned long)v & SLAB_IDX_MASK;
+
+		atomic_val_t nv = (atomic_val_t)(
+			((unsigned long)v & ~SLAB_IDX_MASK) | idx1);
+
+		if (atomic_cas(&slab->free_head, v, nv)) {
+			return;
+		}
+	}
+}
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
 
+static int create_free_list(struct k_mem_slab *slab)
+{
 	/* blocks must be word aligned */
 	CHECKIF(((slab->info.block_size | (uintptr_t)slab->buffer) &
 				(sizeof(void *) - 1)) != 0U) {
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+	CHECKIF(slab->info.num_blocks > SLAB_IDX_MASK) {
+		return -EINVAL;
+	}
+
+	atomic_set(&slab->free_head, 0);
+	atomic_clear(&slab->waiters);
+
+	/* no concurrency yet: pushing each block just builds the chain */
+	for (uint32_t i = slab->info.num_blocks; i > 0U; i--) {
+		slab_push(slab, slab_block(slab, i));
+	}
+#else
+	char *p;
+
 	slab->free_list = NULL;
 	p = slab->buffer + slab->info.block_size * (slab->info.num_blocks - 1);
 
@@ -119,6 +199,7 @@ static int create_free_list(struct k_mem_slab *slab)
 		slab->free_list = p;
 		p -= slab->info.block_size;
 	}
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
 
 	return 0;
 }
@@ -219,6 +300,110 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_LOCKFREE
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	int result;
+	void *blk;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+
+	blk = slab_pop(slab);
+
+	if ((blk == NULL) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+	    IS_ENABLED(CONFIG_MULTITHREADING)) {
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+		/* Declare ourselves a waiter before the final pop:
+		 * the free fast path re-reads waiters after its push,
+		 * so one side is guaranteed to see the other.
+		 */
+		atomic_inc(&slab->waiters);
+		blk = slab_pop(slab);
+		if (blk == NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mem_slab, alloc, slab, timeout);
+
+			result = z_pend_curr(&slab->lock, key, &slab->wait_q, timeout);
+			atomic_dec(&slab->waiters);
+			if (result == 0) {
+				/* direct handoff: accounting already done */
+				*mem = _current->base.swap_data;
+			}
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+			return result;
+		}
+		atomic_dec(&slab->waiters);
+		k_spin_unlock(&slab->lock, key);
+	}
+
+	if (blk != NULL) {
+		*mem = blk;
+		atomic_inc(&slab->info.num_used);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+		/* best effort under concurrency */
+		if ((uint32_t)atomic_get(&slab->info.num_used) > slab->info.max_used) {
+			slab->info.max_used = (uint32_t)atomic_get(&slab->info.num_used);
+		}
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+		result = 0;
+	} else {
+		*mem = NULL;
+		result = -ENOMEM;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	if (!slab_ptr_is_good(slab, mem)) {
+		__ASSERT(false, "Invalid memory pointer provided");
+		k_panic();
+		return;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	slab_push(slab, mem);
+	atomic_dec(&slab->info.num_used);
+
+	/* Closes the lost-wakeup window with the waiter accounting in
+	 * k_mem_slab_alloc(): push first, then check for waiters and
+	 * reclaim a block for direct handoff under the lock.
+	 */
+	if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+	    unlikely(atomic_get(&slab->waiters) != 0)) {
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+		void *blk = slab_pop(slab);
+
+		if (blk != NULL) {
+			struct k_thread *pending_thread =
+				z_unpend_first_thread(&slab->wait_q);
+
+			if (pending_thread != NULL) {
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+				atomic_inc(&slab->info.num_used);
+				z_thread_return_value_set_with_data(pending_thread, 0, blk);
+				z_ready_thread(pending_thread);
+				z_reschedule(&slab->lock, key);
+				return;
+			}
+			/* waiter left meanwhile: put it back */
+			slab_push(slab, blk);
+		}
+		k_spin_unlock(&slab->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+}
+
+#else /* !CONFIG_MEM_SLAB_LOCKFREE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
@@ -300,6 +485,70 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 	k_spin_unlock(&slab->lock, key);
 }
 
+#endif /* CONFIG_MEM_SLAB_LOCKFREE */
+
+#ifdef CONFIG_MEM_SLAB_CACHE_ALIGNED
+int k_mem_slab_striped_init(struct k_mem_slab *stripes, void *buffer,
+			    size_t block_size, uint32_t blocks_per_cpu)
+{
+	char *buf = buffer;
+	int rc;
+
+	CHECKIF((stripes == NULL) || (buffer == NULL) ||
+		(block_size == 0U) || (blocks_per_cpu == 0U)) {
+		return -EINVAL;
+	}
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		rc = k_mem_slab_init(&stripes[i],
+				     &buf[i * block_size * blocks_per_cpu],
+				     block_size, blocks_per_cpu);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+int k_mem_slab_striped_alloc(struct k_mem_slab *stripes, void **mem)
+{
+	unsigned int start = arch_curr_cpu()->id;
+
+	/* Own stripe first for cache affinity, then borrow */
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		unsigned int s = (start + i) % CONFIG_MP_MAX_NUM_CPUS;
+
+		if (k_mem_slab_alloc(&stripes[s], mem, K_NO_WAIT) == 0) {
+			return 0;
+		}
+	}
+
+	*mem = NULL;
+
+	return -ENOMEM;
+}
+
+void k_mem_slab_striped_free(struct k_mem_slab *stripes, void *mem)
+{
+	/* recover the owning stripe from the block address */
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct k_mem_slab *slab = &stripes[i];
+		char *p = mem;
+
+		if ((p >= slab->buffer) &&
+		    (p < &slab->buffer[slab->info.block_size *
+				       slab->info.num_blocks])) {
+			k_mem_slab_free(slab, mem);
+			return;
+		}
+	}
+
+	__ASSERT(false, "block %p belongs to no stripe", mem);
+	k_panic();
+}
+#endif /* CONFIG_MEM_SLAB_CACHE_ALIGNED */
+
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
 	if ((slab == NULL) || (stats == NULL)) {
@@ -1454,6 +1454,58 @@ int k_mem_page_out(void *addr, size_t size)
 	return 0;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_WRITEBACK
+/* Background writeback: while nothing better is runnable, proactively
+ * evict dirty page frames (paying the backing store write latency
+ * here, not on the fault path) until a reserve of free frames exists,
+ * so fault-time evictions find free frames or clean victims.
+ */
+static void paging_writeback_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_msleep(CONFIG_DEMAND_PAGING_WRITEBACK_PERIOD_MS);
+
+		if (!page_frames_initialized) {
+			continue;
+		}
+
+		for (int i = 0; i < CONFIG_DEMAND_PAGING_WRITEBACK_BATCH; i++) {
+			struct k_mem_page_frame *pf;
+			k_spinlock_key_t key;
+			bool dirty = false;
+			uintptr_t phys;
+
+			key = k_spin_lock(&z_mm_lock);
+			if (z_free_page_count >=
+			    CONFIG_DEMAND_PAGING_WRITEBACK_RESERVE) {
+				k_spin_unlock(&z_mm_lock, key);
+				break;
+			}
+			pf = k_mem_paging_eviction_select(&dirty);
+			phys = (pf != NULL) ? k_mem_page_frame_to_phys(pf) : 0;
+			k_spin_unlock(&z_mm_lock, key);
+
+			if ((pf == NULL) || !dirty) {
+				/* clean victims are cheap at fault
+				 * time, leave them where they are
+				 */
+				break;
+			}
+
+			(void)k_mem_page_frame_evict(phys);
+		}
+	}
+}
+
+K_THREAD_DEFINE(z_paging_writeback, CONFIG_DEMAND_PAGING_WRITEBACK_STACK_SIZE,
+		paging_writeback_fn, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+#endif /* CONFIG_DEMAND_PAGING_WRITEBACK */
+
 int k_mem_page_frame_evict(uintptr_t phys)
 {
 	k_spinlock_key_t key;
@@ -1801,7 +1853,34 @@ void k_mem_pin(void *addr, size_t size)
 
 bool k_mem_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	bool ret = do_page_fault(addr, false);
+
+#ifdef CONFIG_DEMAND_PAGING_READAHEAD
+	if (ret) {
+		/* Sequential access streams fault page after page;
+		 * pull the next window in now while the backing store
+		 * is warm.  Stop at the first page that isn't paged
+		 * out: readahead only helps contiguous runs.  The
+		 * unlocked location query is a hint, do_page_fault()
+		 * re-checks under the lock.
+		 */
+		uint8_t *next = (uint8_t *)ROUND_DOWN((uintptr_t)addr,
+						      CONFIG_MMU_PAGE_SIZE);
+
+		for (int i = 0; i < CONFIG_DEMAND_PAGING_READAHEAD_PAGES; i++) {
+			uintptr_t location;
+
+			next += CONFIG_MMU_PAGE_SIZE;
+			if (arch_page_location_get(next, &location) !=
+			    ARCH_PAGE_LOCATION_PAGED_OUT) {
+				break;
+			}
+			(void)do_page_fault(next, false);
+		}
+	}
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
+
+	return ret;
 }
 
 static void do_mem_unpin(void *addr)
@@ -27,6 +27,36 @@
 
 #ifdef CONFIG_OBJ_CORE_MSGQ
 static struct k_obj_type obj_type_msgq;
+
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+static int k_msgq_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	struct k_msgq *msgq = CONTAINER_OF(obj_core, struct k_msgq, obj_core);
+
+	memcpy(stats, &msgq->obj_core_stats, sizeof(msgq->obj_core_stats));
+
+	return 0;
+}
+
+static int k_msgq_stats_reset(struct k_obj_core *obj_core)
+{
+	struct k_msgq *msgq = CONTAINER_OF(obj_core, struct k_msgq, obj_core);
+
+	msgq->obj_core_stats = (struct k_obj_core_sampled_stats){ };
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc msgq_stats_desc = {
+	.raw_size = sizeof(struct k_obj_core_sampled_stats),
+	.query_size = sizeof(struct k_obj_core_sampled_stats),
+	.raw   = k_msgq_stats_raw,
+	.query = k_msgq_stats_raw,
+	.reset = k_msgq_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 #endif /* CONFIG_OBJ_CORE_MSGQ */
 
 static inline bool handle_poll_events(struct k_msgq *msgq)
@@ -52,6 +82,7 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->used_msgs = 0;
 	msgq->flags = 0;
 	z_waitq_init(&msgq->wait_q);
+	z_waitq_init(&msgq->excl_wait_q);
 	msgq->lock = (struct k_spinlock) {};
 #ifdef CONFIG_POLL
 	sys_dlist_init(&msgq->poll_events);
@@ -59,6 +90,10 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 
 #ifdef CONFIG_OBJ_CORE_MSGQ
 	k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	k_obj_core_stats_register(K_OBJ_CORE(msgq), &msgq->obj_core_stats,
+				  sizeof(struct k_obj_core_sampled_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 #endif /* CONFIG_OBJ_CORE_MSGQ */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_msgq, msgq);
@@ -108,7 +143,8 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 	int ret = 0;
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, cleanup, msgq);
 
-	CHECKIF(z_waitq_head(&msgq->wait_q) != NULL) {
+	CHECKIF((z_waitq_head(&msgq->wait_q) != NULL) ||
+		(z_waitq_head(&msgq->excl_wait_q) != NULL)) {
 		ret = -EBUSY;
 		goto exit;
 	}
@@ -123,6 +159,26 @@ exit:
 	return ret;
 }
 
+/* Wake every thread parked on the exclusion wait queue (blocked by an
+ * open reservation or claim); the woken threads retry their operation.
+ * Must be called with the queue lock held; returns whether a
+ * reschedule is needed.
+ */
+static bool msgq_excl_wake(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	bool resched = false;
+
+	while ((pending_thread =
+		z_unpend_first_thread(&msgq->excl_wait_q)) != NULL) {
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	}
+
+	return resched;
+}
+
 static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 			k_timeout_t timeout, bool put_at_back)
 {
@@ -133,6 +189,12 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	if (k_obj_core_stats_sample()) {
+		msgq->obj_core_stats.produced += K_OBJ_CORE_STATS_SAMPLE_WEIGHT;
+	}
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (put_at_back) {
@@ -141,6 +203,40 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_front, msgq, timeout);
 	}
 
+	/* An open reservation owns write_ptr's slot, and an open claim
+	 * pins read_ptr (which put-at-front moves): composing into or
+	 * shifting those slots underneath their holder would corrupt
+	 * the ring, so wait the holder out and re-evaluate.
+	 */
+	while (unlikely(((msgq->flags & K_MSGQ_FLAG_RESERVED) != 0U) ||
+			(!put_at_back &&
+			 ((msgq->flags & K_MSGQ_FLAG_CLAIMED) != 0U)))) {
+		result = -ENOMSG;
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = z_pend_curr(&msgq->lock, key,
+					     &msgq->excl_wait_q, timeout);
+			if (result == 0) {
+				key = k_spin_lock(&msgq->lock);
+				continue;
+			}
+			/* timed out waiting for the holder */
+			result = -EAGAIN;
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+
+		if (put_at_back) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq,
+						       timeout, result);
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_front, msgq,
+						       timeout, result);
+		}
+
+		return result;
+	}
+
 	if (msgq->used_msgs < msgq->max_msgs) {
 		/* message queue isn't full */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
@@ -253,6 +349,157 @@ static inline int z_vrfy_k_msgq_put_front(struct k_msgq *msgq, const void *data)
 #include <zephyr/syscalls/k_msgq_put_front_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int k_msgq_reserve(struct k_msgq *msgq, void **slot)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_RESERVED) != 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EBUSY;
+	}
+
+	if (msgq->used_msgs < msgq->max_msgs) {
+		__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+				msgq->write_ptr < msgq->buffer_end);
+		msgq->flags |= K_MSGQ_FLAG_RESERVED;
+		*slot = msgq->write_ptr;
+		result = 0;
+	} else {
+		result = -ENOMSG;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_commit(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_RESERVED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_RESERVED;
+	resched = msgq_excl_wake(msgq);
+
+	/* The reservation succeeded, so the queue was not full and
+	 * any pended thread on the main wait queue can only be a
+	 * reader.
+	 */
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (unlikely(pending_thread != NULL)) {
+		/* a reader is already waiting: one copy straight into
+		 * its buffer, and the ring slot is recycled
+		 */
+		(void)memcpy(pending_thread->base.swap_data, msgq->write_ptr,
+			     msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	} else {
+		msgq->write_ptr += msgq->msg_size;
+		if (msgq->write_ptr == msgq->buffer_end) {
+			msgq->write_ptr = msgq->buffer_start;
+		}
+		msgq->used_msgs++;
+		resched = handle_poll_events(msgq) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+int k_msgq_peek_claim(struct k_msgq *msgq, void **slot)
+{
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_CLAIMED) != 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EBUSY;
+	}
+
+	if (msgq->used_msgs > 0U) {
+		msgq->flags |= K_MSGQ_FLAG_CLAIMED;
+		*slot = msgq->read_ptr;
+		result = 0;
+	} else {
+		result = -ENOMSG;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+int k_msgq_release(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	CHECKIF((msgq->flags & K_MSGQ_FLAG_CLAIMED) == 0U) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	msgq->flags &= ~K_MSGQ_FLAG_CLAIMED;
+	resched = msgq_excl_wake(msgq);
+
+	msgq->read_ptr += msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs--;
+
+	/* handle first thread waiting to write (if any), exactly as
+	 * k_msgq_get() does once it frees a slot
+	 */
+	pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	if (unlikely(pending_thread != NULL)) {
+		__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+				msgq->write_ptr < msgq->buffer_end);
+		(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
+		       msgq->msg_size);
+		msgq->write_ptr += msgq->msg_size;
+		if (msgq->write_ptr == msgq->buffer_end) {
+			msgq->write_ptr = msgq->buffer_start;
+		}
+		msgq->used_msgs++;
+
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
 void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
@@ -280,10 +527,42 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	if (k_obj_core_stats_sample()) {
+		msgq->obj_core_stats.consumed += K_OBJ_CORE_STATS_SAMPLE_WEIGHT;
+	}
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
+	/* The head slot belongs to an open claim until it is released;
+	 * consuming (and recycling) it underneath the claimer would
+	 * hand the same message out twice.  Wait the claimer out.
+	 */
+	while (unlikely((msgq->flags & K_MSGQ_FLAG_CLAIMED) != 0U)) {
+		result = -ENOMSG;
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = z_pend_curr(&msgq->lock, key,
+					     &msgq->excl_wait_q, timeout);
+			if (result == 0) {
+				key = k_spin_lock(&msgq->lock);
+				continue;
+			}
+			/* timed out waiting for the holder */
+			result = -EAGAIN;
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout,
+					       result);
+
+		return result;
+	}
+
 	if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
@@ -492,11 +771,18 @@ static int init_msgq_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_msgq, K_OBJ_TYPE_MSGQ_ID,
 			offsetof(struct k_msgq, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	k_obj_type_stats_init(&obj_type_msgq, &msgq_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 
 	/* Initialize and link statically defined message queues */
 
 	STRUCT_SECTION_FOREACH(k_msgq, msgq) {
 		k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+		k_obj_core_stats_register(K_OBJ_CORE(msgq), &msgq->obj_core_stats,
+					  sizeof(struct k_obj_core_sampled_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 	}
 
 	return 0;
@@ -208,6 +208,41 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 #include <zephyr/syscalls/k_mutex_lock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_CONDVAR_WAIT_MORPH
+/* Move a condition variable waiter onto the mutex wait queue without
+ * waking it, applying the same priority-inheritance boost it would
+ * have applied had it pended in k_mutex_lock().  Returns false when
+ * the mutex is unowned, in which case no future unlock would hand the
+ * lock over and the caller must wake the thread normally instead.
+ */
+int z_mutex_wait_morph(struct k_mutex *mutex, _wait_q_t *from,
+			struct k_thread *thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (mutex->owner == NULL) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	if (!z_requeue_pended(thread, from, &mutex->wait_q)) {
+		/* The waiter's timeout fired since it was peeked and
+		 * it left the wait queue; nothing was morphed.
+		 */
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if (thread->base.prio < mutex->owner->base.prio) {
+		adjust_owner_prio(mutex, thread->base.prio);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 1;
+}
+#endif /* CONFIG_CONDVAR_WAIT_MORPH */
+
 int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 {
 	struct k_thread *new_owner;
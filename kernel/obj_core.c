@@ -284,4 +284,30 @@ int k_obj_core_stats_enable(struct k_obj_core *obj_core)
 
 	return rv;
 }
+
+#ifdef CONFIG_OBJ_CORE_STATS_SAMPLED
+static uint32_t sample_countdown[CONFIG_MP_MAX_NUM_CPUS];
+
+bool k_obj_core_stats_sample(void)
+{
+#if defined(CONFIG_SMP) && (CONFIG_MP_MAX_NUM_CPUS > 1)
+	/* A migration between reading the CPU id and updating its
+	 * counter merely misattributes one tally; sampling is
+	 * statistical so no locking or pinning is warranted.
+	 */
+	uint32_t *countdown = &sample_countdown[arch_curr_cpu()->id];
+#else
+	uint32_t *countdown = &sample_countdown[0];
+#endif /* CONFIG_SMP && (CONFIG_MP_MAX_NUM_CPUS > 1) */
+
+	if (*countdown != 0U) {
+		(*countdown)--;
+		return false;
+	}
+
+	*countdown = K_OBJ_CORE_STATS_SAMPLE_WEIGHT - 1U;
+
+	return true;
+}
+#endif /* CONFIG_OBJ_CORE_STATS_SAMPLED */
 #endif /* CONFIG_OBJ_CORE_STATS */
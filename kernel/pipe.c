@@ -144,20 +144,16 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 	return written;
 }
 
-int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_timeout_t timeout)
+/* Core of the write loop; pipe->lock must be held on entry and is
+ * held again on exit (wait_for() cycles it around pends).  Returns
+ * the bytes consumed from data, or a negative errno.
+ */
+static int pipe_write_locked(struct k_pipe *pipe, const uint8_t *data,
+			     size_t len, k_timepoint_t end,
+			     k_spinlock_key_t *key, bool *need_resched)
 {
 	int rc;
 	size_t written = 0;
-	k_timepoint_t end = sys_timepoint_calc(timeout);
-	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
-	bool need_resched = false;
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write, pipe, data, len, timeout);
-
-	if (unlikely(pipe_resetting(pipe))) {
-		rc = -ECANCELED;
-		goto exit;
-	}
 
 	for (;;) {
 		if (unlikely(pipe_closed(pipe))) {
@@ -176,9 +172,9 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 				 * supporting direct-to-readers copy with them.
 				 * Simply wake up all pending readers instead.
 				 */
-				need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+				*need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
 			} else if (pipe->waiting != 0) {
-				written += copy_to_pending_readers(pipe, &need_resched,
+				written += copy_to_pending_readers(pipe, need_resched,
 								   &data[written],
 								   len - written);
 				if (written >= len) {
@@ -189,8 +185,8 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 		}
 
 #ifdef CONFIG_POLL
-		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
-							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+		*need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							  K_POLL_STATE_PIPE_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
 
 		written += ring_buf_put(&pipe->buf, &data[written], len - written);
@@ -199,7 +195,7 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
-		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		rc = wait_for(&pipe->space, pipe, key, end, need_resched);
 		if (rc != 0) {
 			if (rc == -EAGAIN) {
 				rc = written ? written : -EAGAIN;
@@ -207,6 +203,25 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 	}
+
+	return rc;
+}
+
+int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_timeout_t timeout)
+{
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write, pipe, data, len, timeout);
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	rc = pipe_write_locked(pipe, data, len, end, &key, &need_resched);
 exit:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, write, pipe, rc);
 	if (need_resched) {
@@ -217,25 +232,70 @@ exit:
 	return rc;
 }
 
-int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout_t timeout)
+int z_impl_k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			 size_t iovcnt, k_timeout_t timeout)
 {
-	struct pipe_buf_spec buf = { data, len, 0 };
-	int rc;
+	int rc = 0;
+	size_t total = 0;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 	bool need_resched = false;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read, pipe, data, len, timeout);
-
 	if (unlikely(pipe_resetting(pipe))) {
 		rc = -ECANCELED;
 		goto exit;
 	}
 
+	/* All segments go through one lock session and share the one
+	 * deadline, so a gathered write costs a single lock/wakeup
+	 * cycle instead of one per segment.
+	 */
+	for (size_t i = 0; i < iovcnt; i++) {
+		if (iov[i].len == 0U) {
+			continue;
+		}
+
+		rc = pipe_write_locked(pipe, iov[i].base, iov[i].len, end,
+				       &key, &need_resched);
+		if (rc < 0) {
+			break;
+		}
+
+		total += (size_t)rc;
+		if ((size_t)rc < iov[i].len) {
+			/* timed out mid-segment */
+			rc = -EAGAIN;
+			break;
+		}
+	}
+
+	if ((rc >= 0) || ((rc == -EAGAIN) && (total != 0U))) {
+		rc = total;
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+/* Core of the read loop; pipe->lock must be held on entry and is
+ * held again on exit.  Returns the bytes placed into data, or a
+ * negative errno.
+ */
+static int pipe_read_locked(struct k_pipe *pipe, uint8_t *data, size_t len,
+			    k_timepoint_t end, k_spinlock_key_t *key,
+			    bool *need_resched)
+{
+	struct pipe_buf_spec buf = { data, len, 0 };
+	int rc;
+
 	for (;;) {
 		if (pipe_full(pipe)) {
 			/* One or more pending writers may exist. */
-			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+			*need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
 		}
 
 		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
@@ -252,7 +312,7 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 		/* provide our "direct copy" info to potential writers */
 		_current->base.swap_data = &buf;
 
-		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		rc = wait_for(&pipe->data, pipe, key, end, need_resched);
 		if (rc != 0) {
 			if (rc == -EAGAIN) {
 				rc = buf.used ? buf.used : -EAGAIN;
@@ -260,6 +320,25 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 			break;
 		}
 	}
+
+	return rc;
+}
+
+int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout_t timeout)
+{
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read, pipe, data, len, timeout);
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	rc = pipe_read_locked(pipe, data, len, end, &key, &need_resched);
 exit:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, read, pipe, rc);
 	if (need_resched) {
@@ -270,6 +349,51 @@ exit:
 	return rc;
 }
 
+int z_impl_k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			size_t iovcnt, k_timeout_t timeout)
+{
+	int rc = 0;
+	size_t total = 0;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	for (size_t i = 0; i < iovcnt; i++) {
+		if (iov[i].len == 0U) {
+			continue;
+		}
+
+		rc = pipe_read_locked(pipe, iov[i].base, iov[i].len, end,
+				      &key, &need_resched);
+		if (rc < 0) {
+			break;
+		}
+
+		total += (size_t)rc;
+		if ((size_t)rc < iov[i].len) {
+			/* short read: closed pipe or timeout */
+			rc = -EAGAIN;
+			break;
+		}
+	}
+
+	if ((rc >= 0) || ((rc == -EAGAIN) && (total != 0U))) {
+		rc = total;
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
@@ -323,6 +447,42 @@ int z_vrfy_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 }
 #include <zephyr/syscalls/k_pipe_write_mrsh.c>
 
+int z_vrfy_k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			size_t iovcnt, k_timeout_t timeout)
+{
+	struct k_pipe_iovec kiov[K_PIPE_IOV_MAX];
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_VERIFY_MSG(iovcnt <= K_PIPE_IOV_MAX,
+				    "too many iovec segments %zu", iovcnt));
+	/* snapshot the vector so it can't change under us */
+	K_OOPS(k_usermode_from_copy(kiov, iov, iovcnt * sizeof(kiov[0])));
+	for (size_t i = 0; i < iovcnt; i++) {
+		K_OOPS(K_SYSCALL_MEMORY_WRITE(kiov[i].base, kiov[i].len));
+	}
+
+	return z_impl_k_pipe_readv(pipe, kiov, iovcnt, timeout);
+}
+#include <zephyr/syscalls/k_pipe_readv_mrsh.c>
+
+int z_vrfy_k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			 size_t iovcnt, k_timeout_t timeout)
+{
+	struct k_pipe_iovec kiov[K_PIPE_IOV_MAX];
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_VERIFY_MSG(iovcnt <= K_PIPE_IOV_MAX,
+				    "too many iovec segments %zu", iovcnt));
+	/* snapshot the vector so it can't change under us */
+	K_OOPS(k_usermode_from_copy(kiov, iov, iovcnt * sizeof(kiov[0])));
+	for (size_t i = 0; i < iovcnt; i++) {
+		K_OOPS(K_SYSCALL_MEMORY_READ(kiov[i].base, kiov[i].len));
+	}
+
+	return z_impl_k_pipe_writev(pipe, kiov, iovcnt, timeout);
+}
+#include <zephyr/syscalls/k_pipe_writev_mrsh.c>
+
 void z_vrfy_k_pipe_reset(struct k_pipe *pipe)
 {
 	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
@@ -35,10 +35,13 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+#ifdef CONFIG_POLL_SET
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
+#endif /* CONFIG_POLL_SET */
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -49,6 +52,7 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 	__ASSERT(obj != NULL, "must provide an object\n");
 
 	event->poller = NULL;
+	sys_dnode_init(&event->_node);
 	/* event->tag is left uninitialized: the user will set it if needed */
 	event->type = type;
 	event->state = K_POLL_STATE_NOT_READY;
@@ -113,8 +117,21 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 {
 	struct k_poll_event *pending;
 
+#ifdef CONFIG_POLL_SET
+	/* Poll-set pollers are not embedded in a thread, so there is
+	 * no priority to order by: just append.
+	 */
+	if (poller->mode == MODE_SET) {
+		sys_dlist_append(events, &event->_node);
+		return;
+	}
+#endif /* CONFIG_POLL_SET */
+
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
+#ifdef CONFIG_POLL_SET
+		(pending->poller->mode == MODE_SET) ||
+#endif
 		(z_sched_prio_cmp(poller_thread(pending->poller),
 							   poller_thread(poller)) > 0)) {
 		sys_dlist_append(events, &event->_node);
@@ -122,8 +139,12 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (
+#ifdef CONFIG_POLL_SET
+		    (pending->poller->mode != MODE_SET) &&
+#endif
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -441,6 +462,10 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+#ifdef CONFIG_POLL_SET
+		} else if (poller->mode == MODE_SET) {
+			retcode = signal_poll_set(event, state);
+#endif /* CONFIG_POLL_SET */
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -472,6 +497,150 @@ bool z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state)
 	return (poll_event != NULL);
 }
 
+#ifdef CONFIG_POLL_SET
+/* must be called with interrupts locked */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set,
+					      poller);
+	struct k_thread *thread;
+
+	ARG_UNUSED(state);
+
+	/* The object has already unlinked the event from its own
+	 * poll_events list; park it on the set's ready list until the
+	 * next k_poll_set_wait() hands it out.  set_event_ready() in
+	 * the caller records the state and drops the registration.
+	 */
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->delivered);
+	z_waitq_init(&set->wait_q);
+	set->poller.mode = MODE_SET;
+	set->poller.is_polling = false;
+}
+
+/* Arm one event on behalf of the set; poll lock must be held.  Ready
+ * conditions are delivered through the ready list rather than
+ * returned, exactly as if the object had signaled.
+ */
+static void poll_set_arm_locked(struct k_poll_set *set,
+				struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+	if (is_condition_met(event, &state)) {
+		event->poller = &set->poller;
+		(void)signal_poll_set(event, state);
+		set_event_ready(event, state);
+	} else {
+		register_event(event, &set->poller);
+	}
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if ((event->poller != NULL) || sys_dnode_is_linked(&event->_node)) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	poll_set_arm_locked(set, event);
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (event->poller == &set->poller) {
+		/* registered with the object */
+		clear_event_registration(event);
+	} else if (sys_dnode_is_linked(&event->_node)) {
+		/* sitting on the ready or delivered list */
+		sys_dlist_remove(&event->_node);
+		event->poller = NULL;
+	} else {
+		ret = -EINVAL;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int num_events, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	sys_dnode_t *node;
+	int n = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL ready array\n");
+	__ASSERT(num_events > 0, "<=0 events\n");
+
+	key = k_spin_lock(&lock);
+
+	/* Re-arm the events handed out by the previous wait: the only
+	 * per-wait registration cost is proportional to what was
+	 * actually delivered, not to the set size.
+	 */
+	while ((node = sys_dlist_get(&set->delivered)) != NULL) {
+		poll_set_arm_locked(set,
+				    CONTAINER_OF(node, struct k_poll_event, _node));
+	}
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		int rc;
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		if (rc != 0) {
+			return rc;
+		}
+		key = k_spin_lock(&lock);
+	}
+
+	while ((n < num_events) &&
+	       ((node = sys_dlist_get(&set->ready)) != NULL)) {
+		struct k_poll_event *event =
+			CONTAINER_OF(node, struct k_poll_event, _node);
+
+		sys_dlist_append(&set->delivered, &event->_node);
+		ready[n] = event;
+		n++;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return n;
+}
+#endif /* CONFIG_POLL_SET */
+
 void z_impl_k_poll_signal_init(struct k_poll_signal *sig)
 {
 	sys_dlist_init(&sig->poll_events);
@@ -55,11 +55,30 @@ void *z_queue_node_peek(sys_sfnode_t *node, bool needs_free)
 	return ret;
 }
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+/* Fold staged lock-free appends into data_q; queue->lock must be held */
+static void queue_drain_staged(struct k_queue *queue)
+{
+	struct mpsc_node *node;
+
+	while ((node = mpsc_pop(&queue->append_q)) != NULL) {
+		sys_sfnode_init((sys_sfnode_t *)node, 0x0);
+		sys_sflist_append(&queue->data_q, (sys_sfnode_t *)node);
+	}
+}
+#else
+#define queue_drain_staged(queue) do { } while (false)
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 void z_impl_k_queue_init(struct k_queue *queue)
 {
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
 	z_waitq_init(&queue->wait_q);
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	mpsc_init(&queue->append_q);
+	atomic_clear(&queue->waiters);
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -139,6 +158,8 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
+	queue_drain_staged(queue);
+
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
@@ -198,7 +219,37 @@ void k_queue_append(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, append, queue);
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	/* The item's reserved first word doubles as the mpsc link */
+	mpsc_push(&queue->append_q, (struct mpsc_node *)data);
+
+	/* Pushing before reading waiters pairs with the consumer
+	 * declaring itself a waiter (under the lock) before its final
+	 * drain: either we see the waiter here, or it sees our item.
+	 */
+	if (unlikely(atomic_get(&queue->waiters) != 0)) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+		struct k_thread *thread = NULL;
+
+		queue_drain_staged(queue);
+		if (!sys_sflist_is_empty(&queue->data_q)) {
+			thread = z_unpend_first_thread(&queue->wait_q);
+		}
+
+		if (thread != NULL) {
+			sys_sfnode_t *node =
+				sys_sflist_get_not_empty(&queue->data_q);
+
+			prepare_thread_to_run(thread,
+					      z_queue_node_peek(node, true));
+			z_reschedule(&queue->lock, key);
+		} else {
+			k_spin_unlock(&queue->lock, key);
+		}
+	}
+#else
 	(void)queue_insert(queue, NULL, data, false, true);
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append, queue);
 }
@@ -269,6 +320,24 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
 
+	/* Items staged by the lock-free k_queue_append() predate this
+	 * list; fold them in first (and serve them to any pending
+	 * consumers first) so they are not overtaken.
+	 */
+	queue_drain_staged(queue);
+
+	while (!sys_sflist_is_empty(&queue->data_q)) {
+		thread = z_unpend_first_thread(&queue->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+
+		resched = true;
+		prepare_thread_to_run(thread,
+				      z_queue_node_peek(sys_sflist_get_not_empty(
+							&queue->data_q), true));
+	}
+
 	if (head != NULL) {
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
@@ -339,11 +408,23 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	/* Declare ourselves a waiter before the final drain so the
+	 * append fast path (push, then read waiters) cannot slip an
+	 * item past us while we pend.
+	 */
+	atomic_inc(&queue->waiters);
+	queue_drain_staged(queue);
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
 		node = sys_sflist_get_not_empty(&queue->data_q);
 		data = z_queue_node_peek(node, true);
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+		atomic_dec(&queue->waiters);
+#endif
 		k_spin_unlock(&queue->lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, data);
@@ -354,6 +435,9 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, get, queue, timeout);
 
 	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+		atomic_dec(&queue->waiters);
+#endif
 		k_spin_unlock(&queue->lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, NULL);
@@ -362,6 +446,9 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	}
 
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	atomic_dec(&queue->waiters);
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
 		(ret != 0) ? NULL : _current->base.swap_data);
@@ -385,15 +472,25 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, unique_append, queue);
 
 	sys_sfnode_t *test;
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	/* Fold in staged lock-free appends: a duplicate may still be
+	 * sitting in the staging queue, and appending the same node
+	 * twice corrupts the list.
+	 */
+	queue_drain_staged(queue);
 
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
 		if (test == (sys_sfnode_t *) data) {
+			k_spin_unlock(&queue->lock, key);
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, unique_append, queue, false);
 
 			return false;
 		}
 	}
 
+	k_spin_unlock(&queue->lock, key);
+
 	k_queue_append(queue, data);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, unique_append, queue, true);
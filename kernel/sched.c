@@ -62,6 +62,12 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	/* Queue threads on their "home" CPU: the one they last ran
+	 * on.  Stealing in runq_best() migrates them when another CPU
+	 * would otherwise idle or run something lower priority.
+	 */
+	return &_kernel.cpus[thread->base.cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -70,7 +76,7 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
@@ -100,8 +106,70 @@ static ALWAYS_INLINE void runq_yield(void)
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* Compare our own queue head against the other CPUs' and
+	 * steal the overall winner.  All queues share _sched_spinlock
+	 * (held here), so peeking at a victim queue is safe, and the
+	 * caller dequeues the winner through thread_runq(), which
+	 * keeps resolving to the victim CPU until the thread actually
+	 * runs here and re-homes.
+	 */
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *t;
+
+		if (i == _current_cpu->id) {
+			continue;
+		}
+
+		/* Strict comparison: prefer our own queue head on
+		 * ties so threads don't bounce between CPUs.
+		 */
+		t = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if ((t != NULL) &&
+		    ((thread == NULL) || (z_sched_prio_cmp(t, thread) > 0))) {
+			thread = t;
+		}
+	}
+
+	return thread;
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+}
+
+#ifdef CONFIG_TIMESLICE_LAZY
+/* True when another runnable thread shares the priority of <thread>
+ * and may run on this CPU.  Probes <thread>'s own priority level
+ * rather than the queue's overall best: a higher priority thread
+ * queued for another CPU (pinned away, or parked on a remote per-CPU
+ * queue) must not hide an eligible equal priority peer, or the slice
+ * timer stays parked and the peer never rotates in.
+ * _sched_spinlock must be held.
+ */
+bool z_sched_has_priority_peer(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* Stealing in runq_best() can migrate a peer from any CPU's
+	 * queue, so probe them all.
+	 */
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (_priq_run_has_peer(&_kernel.cpus[i].ready_q.runq,
+				       thread)) {
+			return true;
+		}
+	}
+
+	return false;
+#else
+	return _priq_run_has_peer(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
+#endif /* CONFIG_TIMESLICE_LAZY */
 
 /* _current is never in the run queue until context switch on
  * SMP configurations, see z_requeue_current()
@@ -113,6 +181,21 @@ static inline bool should_queue_thread(struct k_thread *thread)
 
 static ALWAYS_INLINE void queue_thread(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_DEADLINE_BANDWIDTH
+	/* CBS-style enforcement: a thread that consumed its budget
+	 * re-enters the queue in deadline order one period later per
+	 * replenished budget, so other deadline threads and
+	 * lower-priority work keep their reserved share.  Done here,
+	 * before insertion, because prio_deadline must not change
+	 * while the thread sits in the queue.
+	 */
+	if ((thread->base.dl_budget != 0U) && (thread->base.dl_budget_left <= 0)) {
+		do {
+			thread->base.dl_budget_left += (int32_t)thread->base.dl_budget;
+			thread->base.prio_deadline += (int)thread->base.dl_period;
+		} while (thread->base.dl_budget_left <= 0);
+	}
+#endif /* CONFIG_SCHED_DEADLINE_BANDWIDTH */
 	z_mark_thread_as_queued(thread);
 	if (should_queue_thread(thread)) {
 		runq_add(thread);
@@ -357,10 +440,17 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+		z_sched_latency_mark(thread);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
 		queue_thread(thread);
 		update_cache(0);
 
 		flag_ipi(ipi_mask_create(thread));
+
+#ifdef CONFIG_TIMESLICE_LAZY
+		z_time_slice_arm(thread);
+#endif /* CONFIG_TIMESLICE_LAZY */
 	}
 }
 
@@ -622,6 +712,30 @@ void z_unpend_thread_no_timeout(struct k_thread *thread)
 	}
 }
 
+/* Move a pended thread from one wait queue onto another without
+ * waking it.  Its timeout, if any, stays armed and will wake it from
+ * the new queue.  The move only happens when the thread is still
+ * pended on @a from - callers peek their victim in an earlier lock
+ * section, and a timeout firing in between can wake it and let it
+ * pend on an unrelated object, which must not be stolen.  Returns
+ * whether the thread was requeued.
+ */
+bool z_requeue_pended(struct k_thread *thread, _wait_q_t *from,
+		      _wait_q_t *to)
+{
+	bool requeued = false;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		if (thread->base.pended_on == from) {
+			unpend_thread_no_timeout(thread);
+			add_to_waitq_locked(thread, to);
+			requeued = true;
+		}
+	}
+
+	return requeued;
+}
+
 void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
 {
 	K_SPINLOCK(&_sched_spinlock) {
@@ -746,6 +860,13 @@ bool z_thread_prio_set(struct k_thread *thread, int prio)
 			}
 
 			update_cache(1);
+
+#ifdef CONFIG_TIMESLICE_LAZY
+			/* The thread may have just become a peer of a
+			 * CPU's current thread at the new priority.
+			 */
+			z_time_slice_arm(thread);
+#endif /* CONFIG_TIMESLICE_LAZY */
 		} else if (z_is_thread_pending(thread)) {
 			/* Thread is pending, remove it from the waitq
 			 * and reinsert it with the new priority to avoid
@@ -1007,7 +1128,7 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
@@ -1080,6 +1201,67 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	z_impl_k_thread_absolute_deadline_set(tid, newdl);
 }
 
+#ifdef CONFIG_SCHED_DEADLINE_BANDWIDTH
+/* Total admitted utilization, scaled so BIT64(32) is 100% of one CPU.
+ * Protected by _sched_spinlock.
+ */
+static uint64_t dl_total_util;
+
+static uint64_t dl_util(uint32_t budget, uint32_t period)
+{
+	return ((uint64_t)budget << 32) / period;
+}
+
+int z_impl_k_thread_deadline_budget_set(k_tid_t tid, uint32_t budget,
+					uint32_t period)
+{
+	struct k_thread *thread = tid;
+	int ret = 0;
+
+	if (((budget != 0U) && (period == 0U)) || (budget > period)) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&_sched_spinlock) {
+		uint64_t new_total = dl_total_util;
+
+		if (thread->base.dl_budget != 0U) {
+			new_total -= dl_util(thread->base.dl_budget,
+					     thread->base.dl_period);
+		}
+		if (budget != 0U) {
+			new_total += dl_util(budget, period);
+		}
+
+		/* Admission control: never hand out more than one
+		 * CPU's worth of bandwidth.
+		 */
+		if (new_total > BIT64(32)) {
+			ret = -EBUSY;
+		} else {
+			dl_total_util = new_total;
+			thread->base.dl_budget = budget;
+			thread->base.dl_period = period;
+			thread->base.dl_budget_left = (int32_t)budget;
+		}
+	}
+
+	return ret;
+}
+
+/* Called (with _sched_spinlock held) when a thread dies, so its
+ * bandwidth returns to the admission pool.
+ */
+static void dl_release_bandwidth(struct k_thread *thread)
+{
+	if (thread->base.dl_budget != 0U) {
+		dl_total_util -= dl_util(thread->base.dl_budget,
+					 thread->base.dl_period);
+		thread->base.dl_budget = 0U;
+	}
+}
+#endif /* CONFIG_SCHED_DEADLINE_BANDWIDTH */
+
 #ifdef CONFIG_USERSPACE
 static inline void z_vrfy_k_thread_absolute_deadline_set(k_tid_t tid, int deadline)
 {
@@ -1103,6 +1285,21 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 	z_impl_k_thread_deadline_set((k_tid_t)thread, deadline);
 }
 #include <zephyr/syscalls/k_thread_deadline_set_mrsh.c>
+
+#ifdef CONFIG_SCHED_DEADLINE_BANDWIDTH
+static inline int z_vrfy_k_thread_deadline_budget_set(k_tid_t tid,
+						      uint32_t budget,
+						      uint32_t period)
+{
+	struct k_thread *thread = tid;
+
+	K_OOPS(K_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+
+	return z_impl_k_thread_deadline_budget_set((k_tid_t)thread, budget,
+						   period);
+}
+#include <zephyr/syscalls/k_thread_deadline_budget_set_mrsh.c>
+#endif /* CONFIG_SCHED_DEADLINE_BANDWIDTH */
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_SCHED_DEADLINE */
 
@@ -1330,6 +1527,10 @@ static ALWAYS_INLINE void halt_thread(struct k_thread *thread, uint8_t new_state
 			z_abort_thread_timeout(thread);
 			unpend_all(&thread->join_queue);
 
+#ifdef CONFIG_SCHED_DEADLINE_BANDWIDTH
+			dl_release_bandwidth(thread);
+#endif /* CONFIG_SCHED_DEADLINE_BANDWIDTH */
+
 			/* Edge case: aborting _current from within an
 			 * ISR that preempted it requires clearing the
 			 * _current pointer so the upcoming context
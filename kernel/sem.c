@@ -28,6 +28,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <string.h>
 
 /* We use a system-wide lock to synchronize semaphores, which has
  * unfortunate performance impact vs. using a per-object lock
@@ -38,8 +39,77 @@
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_SEM_FAST_PATH
+/* Consume one count if any is available.  Safe both under the lock
+ * and from the lock-free fast path: taking a published count never
+ * requires waking anybody.
+ */
+static inline bool sem_take_one(struct k_sem *sem)
+{
+	while (true) {
+		atomic_val_t count = atomic_get(&sem->count);
+
+		if (count == 0) {
+			return false;
+		}
+		if (atomic_cas(&sem->count, count, count - 1)) {
+			return true;
+		}
+	}
+}
+
+/* Publish one count, saturating at the limit */
+static inline bool sem_give_one(struct k_sem *sem)
+{
+	while (true) {
+		atomic_val_t count = atomic_get(&sem->count);
+
+		/* Unsigned compare: the limit may be K_SEM_MAX_LIMIT
+		 * (UINT_MAX), which is negative as an atomic_val_t on
+		 * 32 bit targets.
+		 */
+		if ((unsigned int)count >= sem->limit) {
+			return false;
+		}
+		if (atomic_cas(&sem->count, count, count + 1)) {
+			return true;
+		}
+	}
+}
+#endif /* CONFIG_SEM_FAST_PATH */
+
 #ifdef CONFIG_OBJ_CORE_SEM
 static struct k_obj_type obj_type_sem;
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+static int k_sem_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	struct k_sem *sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+
+	memcpy(stats, &sem->obj_core_stats, sizeof(sem->obj_core_stats));
+
+	return 0;
+}
+
+static int k_sem_stats_reset(struct k_obj_core *obj_core)
+{
+	struct k_sem *sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+
+	sem->obj_core_stats = (struct k_obj_core_sampled_stats){ };
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc sem_stats_desc = {
+	.raw_size = sizeof(struct k_obj_core_sampled_stats),
+	.query_size = sizeof(struct k_obj_core_sampled_stats),
+	.raw   = k_sem_stats_raw,
+	.query = k_sem_stats_raw,
+	.reset = k_sem_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
@@ -55,6 +125,9 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 	}
 
 	sem->count = initial_count;
+#ifdef CONFIG_SEM_FAST_PATH
+	atomic_clear(&sem->waiters);
+#endif /* CONFIG_SEM_FAST_PATH */
 	sem->limit = limit;
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
@@ -67,6 +140,10 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 #ifdef CONFIG_OBJ_CORE_SEM
 	k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->obj_core_stats,
+				  sizeof(struct k_obj_core_sampled_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 #endif /* CONFIG_OBJ_CORE_SEM */
 
 	return 0;
@@ -94,12 +171,59 @@ static inline bool handle_poll_events(struct k_sem *sem)
 
 void z_impl_k_sem_give(struct k_sem *sem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key;
 	struct k_thread *thread;
 	bool resched;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, give, sem);
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	if (k_obj_core_stats_sample()) {
+		sem->obj_core_stats.produced += K_OBJ_CORE_STATS_SAMPLE_WEIGHT;
+	}
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
+#if defined(CONFIG_SEM_FAST_PATH) && !defined(CONFIG_POLL)
+	if (likely(atomic_get(&sem->waiters) == 0)) {
+		if (!sem_give_one(sem)) {
+			/* saturated at the limit: nothing to do */
+			goto out;
+		}
+
+		/* Takers declare themselves in waiters before their
+		 * final count check, so re-reading it after the
+		 * publish closes the lost-wakeup window.
+		 */
+		if (likely(atomic_get(&sem->waiters) == 0)) {
+			goto out;
+		}
+
+		/* Raced with a new waiter which may have missed the
+		 * count we just published: reclaim it and hand it
+		 * over directly.  If it's been consumed already the
+		 * waiter is legitimately pending on a future give.
+		 */
+		key = k_spin_lock(&lock);
+		if (!sem_take_one(sem)) {
+			k_spin_unlock(&lock, key);
+			goto out;
+		}
+		thread = z_unpend_first_thread(&sem->wait_q);
+		if (unlikely(thread == NULL)) {
+			/* waiter already left (timeout or reset) */
+			(void)sem_give_one(sem);
+			k_spin_unlock(&lock, key);
+			goto out;
+		}
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		z_reschedule(&lock, key);
+		goto out;
+	}
+#endif /* CONFIG_SEM_FAST_PATH && !CONFIG_POLL */
+
+	key = k_spin_lock(&lock);
+
 	thread = z_unpend_first_thread(&sem->wait_q);
 
 	if (unlikely(thread != NULL)) {
@@ -107,7 +231,11 @@ void z_impl_k_sem_give(struct k_sem *sem)
 		z_ready_thread(thread);
 		resched = true;
 	} else {
+#ifdef CONFIG_SEM_FAST_PATH
+		(void)sem_give_one(sem);
+#else
 		sem->count += (sem->count != sem->limit) ? 1U : 0U;
+#endif /* CONFIG_SEM_FAST_PATH */
 		resched = handle_poll_events(sem);
 	}
 
@@ -117,6 +245,9 @@ void z_impl_k_sem_give(struct k_sem *sem)
 		k_spin_unlock(&lock, key);
 	}
 
+#if defined(CONFIG_SEM_FAST_PATH) && !defined(CONFIG_POLL)
+out:
+#endif
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, give, sem);
 }
 
@@ -136,18 +267,49 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
 
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	if (k_obj_core_stats_sample()) {
+		sem->obj_core_stats.consumed += K_OBJ_CORE_STATS_SAMPLE_WEIGHT;
+	}
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
+#ifdef CONFIG_SEM_FAST_PATH
+	if (likely(sem_take_one(sem))) {
+		ret = 0;
+		goto out;
+	}
+#endif /* CONFIG_SEM_FAST_PATH */
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
+#ifdef CONFIG_SEM_FAST_PATH
+	/* Declare ourselves a waiter before the final count check:
+	 * the give fast path re-reads waiters after publishing a
+	 * count, so one side is guaranteed to see the other.
+	 */
+	atomic_inc(&sem->waiters);
 
+	if (unlikely(sem_take_one(sem))) {
+		atomic_dec(&sem->waiters);
+		k_spin_unlock(&lock, key);
+		ret = 0;
+		goto out;
+	}
+#else
 	if (likely(sem->count > 0U)) {
 		sem->count--;
 		k_spin_unlock(&lock, key);
 		ret = 0;
 		goto out;
 	}
+#endif /* CONFIG_SEM_FAST_PATH */
 
 	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+#ifdef CONFIG_SEM_FAST_PATH
+		atomic_dec(&sem->waiters);
+#endif
 		k_spin_unlock(&lock, key);
 		ret = -EBUSY;
 		goto out;
@@ -156,6 +318,9 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
+#ifdef CONFIG_SEM_FAST_PATH
+	atomic_dec(&sem->waiters);
+#endif
 
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
@@ -178,7 +343,11 @@ void z_impl_k_sem_reset(struct k_sem *sem)
 		arch_thread_return_value_set(thread, -EAGAIN);
 		z_ready_thread(thread);
 	}
+#ifdef CONFIG_SEM_FAST_PATH
+	atomic_clear(&sem->count);
+#else
 	sem->count = 0;
+#endif /* CONFIG_SEM_FAST_PATH */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, reset, sem);
 
@@ -222,11 +391,18 @@ static int init_sem_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_sem, K_OBJ_TYPE_SEM_ID,
 			offsetof(struct k_sem, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	k_obj_type_stats_init(&obj_type_sem, &sem_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 
 	/* Initialize and link statically defined semaphores */
 
 	STRUCT_SECTION_FOREACH(k_sem, sem) {
 		k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+		k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->obj_core_stats,
+					  sizeof(struct k_obj_core_sampled_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 	}
 
 	return 0;
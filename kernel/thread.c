@@ -80,9 +80,18 @@ bool k_is_in_isr(void)
 EXPORT_SYMBOL(k_is_in_isr);
 
 #ifdef CONFIG_THREAD_CUSTOM_DATA
+
+#ifdef CONFIG_THREAD_CUSTOM_DATA_IN_TLS
+Z_THREAD_LOCAL void *z_thread_custom_data;
+#endif /* CONFIG_THREAD_CUSTOM_DATA_IN_TLS */
+
 void z_impl_k_thread_custom_data_set(void *value)
 {
+#ifdef CONFIG_THREAD_CUSTOM_DATA_IN_TLS
+	z_thread_custom_data = value;
+#else
 	_current->custom_data = value;
+#endif /* CONFIG_THREAD_CUSTOM_DATA_IN_TLS */
 }
 
 #ifdef CONFIG_USERSPACE
@@ -95,7 +104,11 @@ static inline void z_vrfy_k_thread_custom_data_set(void *data)
 
 void *z_impl_k_thread_custom_data_get(void)
 {
+#ifdef CONFIG_THREAD_CUSTOM_DATA_IN_TLS
+	return z_thread_custom_data;
+#else
 	return _current->custom_data;
+#endif /* CONFIG_THREAD_CUSTOM_DATA_IN_TLS */
 }
 
 #ifdef CONFIG_USERSPACE
@@ -493,6 +506,10 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 	 * that the thread can access, which includes TLS.
 	 */
 	new_thread->stack_info.start = (uintptr_t)stack_buf_start;
+#ifdef CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK
+	/* Thread objects may be reused; restart watermark tracking */
+	new_thread->stack_unused_cache = 0U;
+#endif
 	new_thread->stack_info.size = stack_buf_size;
 	new_thread->stack_info.delta = delta;
 
@@ -1067,6 +1084,66 @@ int z_vrfy_k_thread_runtime_stack_safety_unused_threshold_get(struct k_thread *t
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_THREAD_RUNTIME_STACK_SAFETY */
 
+#ifdef CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK
+/* Painted stack is consumed, never repainted, so the unused watermark
+ * only moves down: instead of walking the whole painted region from
+ * the bottom, descend from the previous watermark and stop at the
+ * first run of CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK_CONFIRM
+ * still-painted bytes. The confirmation run keeps a data byte that
+ * happens to equal the paint value from inflating the result.
+ */
+static int stack_space_get_incremental(const struct k_thread *thread, size_t *unused_ptr)
+{
+	const uint8_t *checked_stack = (const uint8_t *)thread->stack_info.start;
+	size_t size = thread->stack_info.size;
+	const uint8_t *stack_pointer = (const uint8_t *)&size;
+	size_t cached = ((struct k_thread *)thread)->stack_unused_cache;
+	size_t confirm = CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK_CONFIRM;
+	size_t j;
+
+	if ((stack_pointer > checked_stack) && (stack_pointer <= (checked_stack + size)) &&
+	    IS_ENABLED(CONFIG_NO_UNUSED_STACK_INSPECTION)) {
+		return -ENOTSUP;
+	}
+
+	if (IS_ENABLED(CONFIG_STACK_SENTINEL)) {
+		checked_stack += 4;
+		size -= 4;
+	}
+
+	j = MIN(cached, size);
+
+	while (j > 0) {
+		if (checked_stack[j - 1] != 0xaaU) {
+			j--;
+			continue;
+		}
+
+		/* Candidate boundary: require a run of painted bytes */
+		size_t w = MIN(j, confirm);
+		size_t k;
+
+		for (k = 0; k < w; k++) {
+			if (checked_stack[j - 1 - k] != 0xaaU) {
+				break;
+			}
+		}
+
+		if (k == w) {
+			break;
+		}
+
+		/* Jump below the unpainted byte found in the window */
+		j -= k + 1;
+	}
+
+	((struct k_thread *)thread)->stack_unused_cache = j;
+	*unused_ptr = j;
+
+	return 0;
+}
+#endif /* CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK */
+
 int z_impl_k_thread_stack_space_get(const struct k_thread *thread,
 				    size_t *unused_ptr)
 {
@@ -1076,8 +1153,25 @@ int z_impl_k_thread_stack_space_get(const struct k_thread *thread,
 	}
 #endif /* CONFIG_THREAD_STACK_MEM_MAPPED */
 
+#ifdef CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK
+	if (thread->stack_unused_cache != 0U) {
+		return stack_space_get_incremental(thread, unused_ptr);
+	}
+
+	{
+		int rv = z_stack_space_get((const uint8_t *)thread->stack_info.start,
+					   thread->stack_info.size, unused_ptr);
+
+		if (rv == 0) {
+			((struct k_thread *)thread)->stack_unused_cache = *unused_ptr;
+		}
+
+		return rv;
+	}
+#else
 	return z_stack_space_get((const uint8_t *)thread->stack_info.start,
 				 thread->stack_info.size, unused_ptr);
+#endif /* CONFIG_THREAD_STACK_INCREMENTAL_WATERMARK */
 }
 
 #ifdef CONFIG_USERSPACE
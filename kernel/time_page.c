@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/time_page.h>
+
+K_APPMEM_PARTITION_DEFINE(z_time_page_partition);
+
+K_APP_BMEM(z_time_page_partition) struct sys_time_page z_time_page;
+
+/* Called with the timeout lock held, so updates never nest; the odd
+ * sequence value keeps lock-free readers off the torn snapshot.
+ */
+void z_time_page_publish(uint64_t ticks)
+{
+	__atomic_store_n(&z_time_page.seq, z_time_page.seq + 1U, __ATOMIC_RELAXED);
+
+	/* Write fence: the odd sequence must be visible before any of
+	 * the snapshot stores below (a release *store* only orders the
+	 * accesses preceding it, not these).
+	 */
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	z_time_page.base_ticks = ticks;
+	z_time_page.base_cycles = k_cycle_get_32();
+
+	/* Release: the snapshot stores complete before the sequence
+	 * turns even again.
+	 */
+	__atomic_store_n(&z_time_page.seq, z_time_page.seq + 1U, __ATOMIC_RELEASE);
+}
@@ -5,18 +5,20 @@
  */
 
 #include <zephyr/kernel.h>
+#ifdef CONFIG_SYS_TIME_PAGE
+#include <zephyr/sys/time_page.h>
+#endif
 #include <zephyr/spinlock.h>
 #include <ksched.h>
 #include <timeout_q.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/llext/symbol.h>
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
  * shall it call any other subsystem while holding this lock.
@@ -26,6 +28,37 @@ static struct k_spinlock timeout_lock;
 /* Ticks left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
 
+#ifdef CONFIG_TIMEOUT_LOCKLESS_TICK_GET
+/* Sequence counter over (curr_tick, announce_remaining): odd while a
+ * writer (always under timeout_lock) is mid-update, so
+ * sys_clock_tick_get() can read without contending on the lock.
+ */
+static uint32_t tick_seq;
+
+/* Seqlock write side: the odd store is followed by a release fence so
+ * the data stores between BEGIN and END cannot become visible before
+ * it (a release *store* only orders what precedes it); the closing
+ * release store orders them before the sequence turns even.
+ */
+#define TICK_SEQ_BEGIN()						\
+	do {								\
+		__atomic_store_n(&tick_seq, tick_seq + 1U,		\
+				 __ATOMIC_RELAXED);			\
+		__atomic_thread_fence(__ATOMIC_RELEASE);		\
+	} while (false)
+#define TICK_SEQ_END() __atomic_store_n(&tick_seq, tick_seq + 1U, __ATOMIC_RELEASE)
+#else
+#define TICK_SEQ_BEGIN()
+#define TICK_SEQ_END()
+#endif /* CONFIG_TIMEOUT_LOCKLESS_TICK_GET */
+
+#ifdef CONFIG_TIMEOUT_BATCH_EXPIRY
+/* Expired timeouts detached per timeout_lock hold in
+ * sys_clock_announce(); bounds the stack cost of a batch.
+ */
+#define TIMEOUT_BATCH_COUNT 8
+#endif /* CONFIG_TIMEOUT_BATCH_EXPIRY */
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 unsigned int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -38,6 +71,441 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+static int32_t elapsed(void)
+{
+	/* While sys_clock_announce() is executing, new relative timeouts will be
+	 * scheduled relatively to the currently firing timeout's original tick
+	 * value (=curr_tick) rather than relative to the current
+	 * sys_clock_elapsed().
+	 *
+	 * This means that timeouts being scheduled from within timeout callbacks
+	 * will be scheduled at well-defined offsets from the currently firing
+	 * timeout.
+	 *
+	 * As a side effect, the same will happen if an ISR with higher priority
+	 * preempts a timeout callback and schedules a timeout.
+	 *
+	 * The distinction is implemented by looking at announce_remaining which
+	 * will be non-zero while sys_clock_announce() is executing and zero
+	 * otherwise.
+	 */
+	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+}
+
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+/* Hierarchical timer wheel.  Timeouts hang off one of four levels of
+ * 64 slots each, picked by their distance from curr_tick; the slot
+ * within a level is derived purely from the absolute expiry tick, so
+ * an entry never moves until the wheel "cascades" it into a lower
+ * level when the tick count reaches its slot.  Insert and cancel are
+ * O(1); the linear cost of the old sorted list becomes batched
+ * cascade work paid at most once per slot boundary.
+ *
+ * The dticks field of a queued timeout holds its absolute expiry
+ * tick, not a delta, which is why this backend requires
+ * CONFIG_TIMEOUT_64BIT.
+ */
+#define WHEEL_LEVEL_BITS 6U
+#define WHEEL_SLOTS	 64U
+#define WHEEL_SLOT_MASK	 (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS	 4
+
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static bool wheel_ready;
+
+/* One bit per slot, set on insert and cleared lazily when a scan
+ * finds the slot empty, so cancellation stays O(1) without knowing
+ * whether its slot just became empty.
+ */
+static uint64_t wheel_occupied[WHEEL_LEVELS];
+
+/* Absolute tick of the most recently programmed timer interrupt
+ * (UINT64_MAX when none).  Outside sys_clock_announce() it may only
+ * ever be moved earlier; the announce path recomputes it exactly.
+ */
+static uint64_t wheel_next_fire = UINT64_MAX;
+
+/* Ticks covered by levels 0..level together */
+static uint64_t wheel_level_span(int level)
+{
+	return BIT64((unsigned int)(level + 1) * WHEEL_LEVEL_BITS);
+}
+
+/* Queue a timeout whose dticks (absolute expiry) is already set.
+ * Returns the lower bound tick of the slot it landed in, which for
+ * level 0 is the exact expiry.
+ */
+static uint64_t wheel_insert(struct _timeout *to)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	uint64_t delta = (expiry > curr_tick) ? (expiry - curr_tick) : 0U;
+	unsigned int shift;
+	uint32_t slot;
+	int level = 0;
+
+	while ((level < (WHEEL_LEVELS - 1)) && (delta >= wheel_level_span(level))) {
+		level++;
+	}
+	shift = (unsigned int)level * WHEEL_LEVEL_BITS;
+
+	if (delta == 0U) {
+		/* Already due (e.g. the tick counter was warped under
+		 * us): park it in the current level 0 slot so the next
+		 * scan fires it immediately.
+		 */
+		slot = (uint32_t)(curr_tick & WHEEL_SLOT_MASK);
+	} else {
+		slot = (uint32_t)((expiry >> shift) & WHEEL_SLOT_MASK);
+	}
+
+	sys_dlist_append(&wheel[level][slot], &to->node);
+	wheel_occupied[level] |= BIT64(slot);
+
+	return (delta == 0U) ? curr_tick : ((expiry >> shift) << shift);
+}
+
+/* Distance, in slots going forward circularly, from pos to the first
+ * set bit of occ, or -1 when occ is empty.
+ */
+static int wheel_occ_dist(uint64_t occ, uint32_t pos)
+{
+	uint64_t at_or_after = occ & ~(BIT64(pos) - 1U);
+
+	if (at_or_after != 0U) {
+		return (int)(u64_count_trailing_zeros(at_or_after) - pos);
+	}
+	if (occ != 0U) {
+		return (int)(WHEEL_SLOTS - pos + u64_count_trailing_zeros(occ));
+	}
+	return -1;
+}
+
+/* Pull the entries of each upper level's current slot down into the
+ * lower levels.  Processed top down so entries landing in a lower
+ * level's current slot are handled by the same pass.  Must run
+ * whenever curr_tick has advanced, before scanning for the next
+ * event.  Entries more than a full wheel revolution out re-enter the
+ * top level and will cascade again on a later lap.
+ */
+static void wheel_cascade(void)
+{
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		unsigned int shift = (unsigned int)level * WHEEL_LEVEL_BITS;
+		uint32_t pos = (uint32_t)((curr_tick >> shift) & WHEEL_SLOT_MASK);
+		sys_dlist_t tmp;
+		sys_dnode_t *n;
+
+		if ((wheel_occupied[level] & BIT64(pos)) == 0U) {
+			continue;
+		}
+
+		wheel_occupied[level] &= ~BIT64(pos);
+
+		/* Drain before re-inserting: a top level entry more
+		 * than one revolution out goes right back into the
+		 * slot being drained.
+		 */
+		sys_dlist_init(&tmp);
+		while ((n = sys_dlist_get(&wheel[level][pos])) != NULL) {
+			sys_dlist_append(&tmp, n);
+		}
+		while ((n = sys_dlist_get(&tmp)) != NULL) {
+			(void)wheel_insert(CONTAINER_OF(n, struct _timeout, node));
+		}
+	}
+}
+
+/* Next tick at which something must happen: an exact level 0 expiry,
+ * or an upper level slot boundary where a cascade is due.  UINT64_MAX
+ * when the wheel is empty.  Reaps stale occupancy bits as it goes.
+ */
+static uint64_t wheel_next_event(void)
+{
+	uint64_t best = UINT64_MAX;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		unsigned int shift = (unsigned int)level * WHEEL_LEVEL_BITS;
+		uint32_t pos = (uint32_t)((curr_tick >> shift) & WHEEL_SLOT_MASK);
+		uint64_t occ = wheel_occupied[level];
+
+		for (;;) {
+			int d = wheel_occ_dist(occ, pos);
+			uint32_t slot;
+			uint64_t lb;
+
+			if (d < 0) {
+				break;
+			}
+
+			slot = (pos + (uint32_t)d) & WHEEL_SLOT_MASK;
+			if (sys_dlist_is_empty(&wheel[level][slot])) {
+				/* stale bit left by z_abort_timeout() */
+				wheel_occupied[level] &= ~BIT64(slot);
+				occ &= ~BIT64(slot);
+				continue;
+			}
+
+			if ((level > 0) && (d == 0)) {
+				/* An upper level's current slot only ever
+				 * holds entries at least one full
+				 * revolution out (either a cascade just
+				 * drained this slot and put them back, or
+				 * the insert wrapped a nearly-full-span
+				 * delta onto its own slot).  Their next
+				 * cascade is when this slot comes around
+				 * again, not now - reporting the current
+				 * boundary would make the announce loop
+				 * cascade in place forever.  Keep scanning
+				 * this level for a nearer slot.
+				 */
+				lb = ((curr_tick >> shift) +
+				      (uint64_t)WHEEL_SLOTS) << shift;
+				best = MIN(best, lb);
+				occ &= ~BIT64(slot);
+				continue;
+			}
+
+			lb = ((curr_tick >> shift) + (uint64_t)d) << shift;
+			best = MIN(best, MAX(lb, curr_tick));
+			break;
+		}
+	}
+
+	return best;
+}
+
+/* Relative ticks from now until the given absolute event tick, in the
+ * form sys_clock_set_timeout() expects.
+ */
+static int32_t wheel_timeout_ticks(uint64_t event, int32_t ticks_elapsed)
+{
+	int64_t delta;
+
+	if (event == UINT64_MAX) {
+		return SYS_CLOCK_MAX_WAIT;
+	}
+
+	delta = (int64_t)(event - curr_tick) - ticks_elapsed;
+	if (delta > (int64_t)INT_MAX) {
+		return SYS_CLOCK_MAX_WAIT;
+	}
+
+	return max(0, (int32_t)delta);
+}
+
+static int32_t next_timeout(int32_t ticks_elapsed)
+{
+	return wheel_timeout_ticks(wheel_next_event(), ticks_elapsed);
+}
+
+k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
+{
+	k_ticks_t ticks = 0;
+
+	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		return 0;
+	}
+
+#ifdef CONFIG_KERNEL_COHERENCE
+	__ASSERT_NO_MSG(sys_cache_is_mem_coherent(to));
+#endif /* CONFIG_KERNEL_COHERENCE */
+
+	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	to->fn = fn;
+
+	K_SPINLOCK(&timeout_lock) {
+		int32_t ticks_elapsed = 0;
+		bool has_elapsed = false;
+		uint64_t lb;
+
+		if (unlikely(!wheel_ready)) {
+			for (int l = 0; l < WHEEL_LEVELS; l++) {
+				for (uint32_t s = 0; s < WHEEL_SLOTS; s++) {
+					sys_dlist_init(&wheel[l][s]);
+				}
+			}
+			wheel_ready = true;
+		}
+
+		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
+			ticks_elapsed = elapsed();
+			has_elapsed = true;
+			to->dticks = (k_ticks_t)(curr_tick + timeout.ticks + 1 +
+						 ticks_elapsed);
+			ticks = to->dticks;
+		} else {
+			to->dticks = max(Z_TICK_ABS(timeout.ticks),
+					 (k_ticks_t)(curr_tick + 1));
+			ticks = timeout.ticks;
+		}
+
+		lb = wheel_insert(to);
+
+		if ((announce_remaining == 0) && (lb < wheel_next_fire)) {
+			if (!has_elapsed) {
+				/* In case of absolute timeout that is first to expire
+				 * elapsed need to be read from the system clock.
+				 */
+				ticks_elapsed = elapsed();
+			}
+			wheel_next_fire = lb;
+			sys_clock_set_timeout(wheel_timeout_ticks(lb, ticks_elapsed),
+					      false);
+		}
+	}
+
+	return ticks;
+}
+
+int z_abort_timeout(struct _timeout *to)
+{
+	int ret = -EINVAL;
+
+	K_SPINLOCK(&timeout_lock) {
+		if (sys_dnode_is_linked(&to->node)) {
+			uint64_t expiry = (uint64_t)to->dticks;
+
+			/* The slot's occupancy bit stays behind and is
+			 * reaped lazily by the next scan.
+			 */
+			sys_dlist_remove(&to->node);
+			to->dticks = TIMEOUT_DTICKS_ABORTED;
+			ret = 0;
+
+			/* Only a level 0 head can match wheel_next_fire
+			 * exactly; upper level entries hide behind their
+			 * slot boundary and removing one at worst costs a
+			 * spurious wakeup at that boundary.
+			 */
+			if ((announce_remaining == 0) && (expiry <= wheel_next_fire)) {
+				uint64_t event = wheel_next_event();
+
+				if (event != wheel_next_fire) {
+					wheel_next_fire = event;
+					sys_clock_set_timeout(
+						wheel_timeout_ticks(event, elapsed()),
+						false);
+				}
+			}
+		}
+	}
+
+	return ret;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return (k_ticks_t)((uint64_t)timeout->dticks - curr_tick);
+}
+
+void sys_clock_announce(int32_t ticks)
+{
+	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+
+	/* We release the lock around the callbacks below, so on SMP
+	 * systems someone might be already running the loop.  Don't
+	 * race (which will cause parallel execution of "sequential"
+	 * timeouts and confuse apps), just increment the tick count
+	 * and return.
+	 */
+	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
+		TICK_SEQ_BEGIN();
+		announce_remaining += ticks;
+		TICK_SEQ_END();
+		k_spin_unlock(&timeout_lock, key);
+		return;
+	}
+
+	TICK_SEQ_BEGIN();
+	announce_remaining = ticks;
+	TICK_SEQ_END();
+
+	for (;;) {
+		uint64_t event;
+		uint32_t slot;
+		sys_dnode_t *n;
+
+		wheel_cascade();
+		event = wheel_next_event();
+
+		if (event > (curr_tick + (uint64_t)announce_remaining)) {
+			break;
+		}
+
+		/* Advance to the event (a due level 0 slot, or an
+		 * upper level boundary whose cascade may expose one)
+		 * and fire whatever sits in the level 0 slot there, in
+		 * FIFO order.
+		 */
+		if (event > curr_tick) {
+			TICK_SEQ_BEGIN();
+			announce_remaining -= (int32_t)(event - curr_tick);
+			curr_tick = event;
+			TICK_SEQ_END();
+			wheel_cascade();
+		}
+
+		slot = (uint32_t)(curr_tick & WHEEL_SLOT_MASK);
+#ifdef CONFIG_TIMEOUT_BATCH_EXPIRY
+		while (true) {
+			struct _timeout *batch[TIMEOUT_BATCH_COUNT];
+			unsigned int count = 0;
+
+			while ((count < ARRAY_SIZE(batch)) &&
+			       ((n = sys_dlist_get(&wheel[0][slot])) != NULL)) {
+				batch[count] = CONTAINER_OF(n, struct _timeout, node);
+				batch[count]->dticks = 0;
+				count++;
+			}
+
+			if (count == 0) {
+				break;
+			}
+
+			k_spin_unlock(&timeout_lock, key);
+			for (unsigned int i = 0; i < count; i++) {
+				batch[i]->fn(batch[i]);
+			}
+			key = k_spin_lock(&timeout_lock);
+		}
+#else
+		while ((n = sys_dlist_get(&wheel[0][slot])) != NULL) {
+			struct _timeout *t =
+				CONTAINER_OF(n, struct _timeout, node);
+
+			t->dticks = 0;
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+#endif /* CONFIG_TIMEOUT_BATCH_EXPIRY */
+		wheel_occupied[0] &= ~BIT64(slot);
+	}
+
+	TICK_SEQ_BEGIN();
+	curr_tick += (uint64_t)announce_remaining;
+	announce_remaining = 0;
+	TICK_SEQ_END();
+	IF_ENABLED(CONFIG_SYS_TIME_PAGE, (z_time_page_publish(curr_tick);))
+
+	wheel_cascade();
+	wheel_next_fire = wheel_next_event();
+	sys_clock_set_timeout(wheel_timeout_ticks(wheel_next_fire, 0), false);
+
+	k_spin_unlock(&timeout_lock, key);
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice();
+#endif /* CONFIG_TIMESLICING */
+}
+
+#else /* !CONFIG_TIMEOUT_WHEEL */
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -61,27 +529,6 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
-{
-	/* While sys_clock_announce() is executing, new relative timeouts will be
-	 * scheduled relatively to the currently firing timeout's original tick
-	 * value (=curr_tick) rather than relative to the current
-	 * sys_clock_elapsed().
-	 *
-	 * This means that timeouts being scheduled from within timeout callbacks
-	 * will be scheduled at well-defined offsets from the currently firing
-	 * timeout.
-	 *
-	 * As a side effect, the same will happen if an ISR with higher priority
-	 * preempts a timeout callback and schedules a timeout.
-	 *
-	 * The distinction is implemented by looking at announce_remaining which
-	 * will be non-zero while sys_clock_announce() is executing and zero
-	 * otherwise.
-	 */
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
-}
-
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
 	struct _timeout *to = first();
@@ -191,45 +638,6 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	return ticks;
 }
 
-k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	K_SPINLOCK(&timeout_lock) {
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks = timeout_rem(timeout) - elapsed();
-		}
-	}
-
-	return ticks;
-}
-EXPORT_SYMBOL(z_timeout_remaining);
-
-k_ticks_t z_timeout_expires(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	K_SPINLOCK(&timeout_lock) {
-		ticks = curr_tick;
-		if (!z_is_inactive_timeout(timeout)) {
-			ticks += timeout_rem(timeout);
-		}
-	}
-
-	return ticks;
-}
-EXPORT_SYMBOL(z_timeout_expires);
-
-int32_t z_get_next_timeout_expiry(void)
-{
-	int32_t ret = (int32_t) K_TICKS_FOREVER;
-
-	K_SPINLOCK(&timeout_lock) {
-		ret = next_timeout(elapsed());
-	}
-	return ret;
-}
-
 void sys_clock_announce(int32_t ticks)
 {
 	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
@@ -241,36 +649,85 @@ void sys_clock_announce(int32_t ticks)
 	 * and return.
 	 */
 	if (IS_ENABLED(CONFIG_SMP) && (announce_remaining != 0)) {
+		TICK_SEQ_BEGIN();
 		announce_remaining += ticks;
+		TICK_SEQ_END();
 		k_spin_unlock(&timeout_lock, key);
 		return;
 	}
 
+	TICK_SEQ_BEGIN();
 	announce_remaining = ticks;
+	TICK_SEQ_END();
 
 	struct _timeout *t;
 
+#ifdef CONFIG_TIMEOUT_BATCH_EXPIRY
 	for (t = first();
 	     (t != NULL) && (t->dticks <= announce_remaining);
 	     t = first()) {
+		struct _timeout *batch[TIMEOUT_BATCH_COUNT];
+		unsigned int count = 0;
 		int dt = t->dticks;
 
+		TICK_SEQ_BEGIN();
 		curr_tick += dt;
+		TICK_SEQ_END();
+		IF_ENABLED(CONFIG_SYS_TIME_PAGE, (z_time_page_publish(curr_tick);))
+
+		/* Detach the whole run of timeouts sharing this
+		 * expiry tick (bounded by the batch array) under a
+		 * single lock hold, then fire them with the lock
+		 * dropped.
+		 */
+		do {
+			t->dticks = 0;
+			remove_timeout(t);
+			batch[count++] = t;
+			t = first();
+		} while ((t != NULL) && (t->dticks == 0) &&
+			 (count < ARRAY_SIZE(batch)));
+
+		k_spin_unlock(&timeout_lock, key);
+		for (unsigned int i = 0; i < count; i++) {
+			batch[i]->fn(batch[i]);
+		}
+		key = k_spin_lock(&timeout_lock);
+		TICK_SEQ_BEGIN();
+		announce_remaining -= dt;
+		TICK_SEQ_END();
+	}
+#else
+	for (t = first();
+	     (t != NULL) && (t->dticks <= announce_remaining);
+	     t = first()) {
+		int dt = t->dticks;
+
+		TICK_SEQ_BEGIN();
+		curr_tick += dt;
+		TICK_SEQ_END();
+		IF_ENABLED(CONFIG_SYS_TIME_PAGE, (z_time_page_publish(curr_tick);))
 		t->dticks = 0;
 		remove_timeout(t);
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
 		key = k_spin_lock(&timeout_lock);
+		TICK_SEQ_BEGIN();
 		announce_remaining -= dt;
+		TICK_SEQ_END();
 	}
+#endif /* CONFIG_TIMEOUT_BATCH_EXPIRY */
 
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
 
+	TICK_SEQ_BEGIN();
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
+	TICK_SEQ_END();
+	IF_ENABLED(CONFIG_SYS_TIME_PAGE, (z_time_page_publish(curr_tick);))
 
 	sys_clock_set_timeout(next_timeout(0), false);
 
@@ -281,13 +738,92 @@ void sys_clock_announce(int32_t ticks)
 #endif /* CONFIG_TIMESLICING */
 }
 
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	K_SPINLOCK(&timeout_lock) {
+		if (!z_is_inactive_timeout(timeout)) {
+			ticks = timeout_rem(timeout) - elapsed();
+		}
+	}
+
+	return ticks;
+}
+EXPORT_SYMBOL(z_timeout_remaining);
+
+k_ticks_t z_timeout_expires(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	K_SPINLOCK(&timeout_lock) {
+		ticks = curr_tick;
+		if (!z_is_inactive_timeout(timeout)) {
+			ticks += timeout_rem(timeout);
+		}
+	}
+
+	return ticks;
+}
+EXPORT_SYMBOL(z_timeout_expires);
+
+int32_t z_get_next_timeout_expiry(void)
+{
+	int32_t ret = (int32_t) K_TICKS_FOREVER;
+
+	K_SPINLOCK(&timeout_lock) {
+		ret = next_timeout(elapsed());
+	}
+	return ret;
+}
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
 
+#ifdef CONFIG_TIMEOUT_LOCKLESS_TICK_GET
+	uint32_t seq;
+	int remaining;
+
+	/* Writers only mutate under timeout_lock with the sequence odd,
+	 * so a stable even sequence brackets a consistent
+	 * (curr_tick, announce_remaining) pair and the lock is never
+	 * contended from here.
+	 */
+	while (true) {
+		seq = __atomic_load_n(&tick_seq, __ATOMIC_ACQUIRE);
+		if ((seq & 1U) != 0U) {
+			/* Update in flight: start over (a continue in a
+			 * do/while would re-test the exit condition and
+			 * leave with an uninitialized snapshot).
+			 */
+			continue;
+		}
+
+		t = curr_tick;
+		remaining = announce_remaining;
+
+		/* Read fence: the snapshot loads above must complete
+		 * before the validating re-load below.
+		 */
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		if (__atomic_load_n(&tick_seq, __ATOMIC_RELAXED) == seq) {
+			break;
+		}
+	}
+
+	if (remaining == 0) {
+		t += sys_clock_elapsed();
+	}
+#else
 	K_SPINLOCK(&timeout_lock) {
 		t = curr_tick + elapsed();
 	}
+#endif /* CONFIG_TIMEOUT_LOCKLESS_TICK_GET */
+
 	return t;
 }
 
@@ -353,7 +889,9 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+	TICK_SEQ_BEGIN();
 	curr_tick = tick;
+	TICK_SEQ_END();
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
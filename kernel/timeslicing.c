@@ -7,6 +7,7 @@
 #include <kswap.h>
 #include <ksched.h>
 #include <ipi.h>
+#include <timeout_q.h>
 
 static int slice_ticks = DIV_ROUND_UP(CONFIG_TIMESLICE_SIZE * Z_HZ_ticks, Z_HZ_ms);
 static int slice_max_prio = CONFIG_TIMESLICE_PRIORITY;
@@ -58,6 +59,15 @@ static int z_time_slice_size(struct k_thread *thread)
 	return 0;
 }
 
+static ALWAYS_INLINE bool thread_defines_time_slice_size(struct k_thread *thread)
+{
+#ifdef CONFIG_TIMESLICE_PER_THREAD
+	return (thread->base.slice_ticks != 0);
+#else  /* !CONFIG_TIMESLICE_PER_THREAD */
+	return false;
+#endif /* !CONFIG_TIMESLICE_PER_THREAD */
+}
+
 static void slice_timeout(struct _timeout *timeout)
 {
 	int cpu = ARRAY_INDEX(slice_timeouts, timeout);
@@ -77,6 +87,18 @@ void z_reset_time_slice(struct k_thread *thread)
 	int cpu = _current_cpu->id;
 	int slice_size = z_time_slice_size(thread);
 
+#ifdef CONFIG_TIMESLICE_LAZY
+	/* Don't arm the timer when nothing else at this priority is
+	 * runnable; z_time_slice_arm() re-arms when a peer shows up.
+	 * Threads with their own slice keep it: their expiry callback
+	 * must fire regardless of competition.
+	 */
+	if ((slice_size != 0) && !thread_defines_time_slice_size(thread) &&
+	    !z_sched_has_priority_peer(thread)) {
+		slice_size = 0;
+	}
+#endif /* CONFIG_TIMESLICE_LAZY */
+
 	z_abort_timeout(&slice_timeouts[cpu]);
 	slice_expired[cpu] = false;
 	if (slice_size != 0) {
@@ -85,14 +107,35 @@ void z_reset_time_slice(struct k_thread *thread)
 	}
 }
 
-static ALWAYS_INLINE bool thread_defines_time_slice_size(struct k_thread *thread)
+#ifdef CONFIG_TIMESLICE_LAZY
+/* Called (with _sched_spinlock held) when a thread is made ready:
+ * arm the slice timer of any CPU whose current thread now has a
+ * runnable peer at its priority.
+ */
+void z_time_slice_arm(struct k_thread *thread)
 {
-#ifdef CONFIG_TIMESLICE_PER_THREAD
-	return (thread->base.slice_ticks != 0);
-#else  /* !CONFIG_TIMESLICE_PER_THREAD */
-	return false;
-#endif /* !CONFIG_TIMESLICE_PER_THREAD */
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *curr = _kernel.cpus[i].current;
+
+		if ((curr == NULL) || z_is_idle_thread_object(curr) ||
+		    (z_sched_prio_cmp(curr, thread) != 0) ||
+		    !z_is_inactive_timeout(&slice_timeouts[i])) {
+			continue;
+		}
+
+		if (i == _current_cpu->id) {
+			z_reset_time_slice(curr);
+		} else {
+			/* The IPI lands in z_time_slice(), which
+			 * re-arms the remote CPU's timer.
+			 */
+			flag_ipi(IPI_CPU_MASK(i));
+		}
+	}
 }
+#endif /* CONFIG_TIMESLICE_LAZY */
 
 void k_sched_time_slice_set(int32_t slice, int prio)
 {
@@ -157,5 +200,14 @@ void z_time_slice(void)
 		}
 		z_reset_time_slice(curr);
 	}
+#ifdef CONFIG_TIMESLICE_LAZY
+	else if (z_is_inactive_timeout(&slice_timeouts[_current_cpu->id])) {
+		/* An IPI from z_time_slice_arm(): a peer of our
+		 * current thread became runnable while our slice
+		 * timer was parked, so re-arm it.
+		 */
+		z_reset_time_slice(curr);
+	}
+#endif /* CONFIG_TIMESLICE_LAZY */
 	k_spin_unlock(&_sched_spinlock, key);
 }
@@ -6,10 +6,13 @@
 
 #include <zephyr/kernel.h>
 
+#include <string.h>
+
 #include <zephyr/timing/timing.h>
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -32,6 +35,65 @@ static uint32_t usage_now(void)
 	return (now == 0) ? 1 : now;
 }
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+/* Per-CPU so the switch path can update them under nothing but the
+ * masked interrupts it already runs with; readers sum across CPUs and
+ * tolerate the (benign) races.
+ */
+static struct k_thread_latency_stats latency_stats[CONFIG_MP_MAX_NUM_CPUS];
+
+void z_sched_latency_mark(struct k_thread *thread)
+{
+	/* usage_now() never returns 0, so 0 can mean "no pending wakeup" */
+	thread->base.wakeup_cycle = usage_now();
+}
+
+static void sched_latency_record(struct k_thread *thread)
+{
+	uint32_t wakeup = thread->base.wakeup_cycle;
+
+	if (wakeup == 0U) {
+		return;
+	}
+	thread->base.wakeup_cycle = 0U;
+
+	uint32_t delta = usage_now() - wakeup;
+	struct k_thread_latency_stats *stats = &latency_stats[_current_cpu->id];
+	unsigned int bucket = (delta == 0U) ? 0U :
+		(31U - u32_count_leading_zeros(delta));
+
+	stats->buckets[bucket]++;
+	stats->num_samples++;
+	stats->total_cycles += delta;
+	if (delta > stats->max_cycles) {
+		stats->max_cycles = delta;
+	}
+}
+
+void k_thread_latency_stats_get(struct k_thread_latency_stats *stats)
+{
+	*stats = (struct k_thread_latency_stats){ 0 };
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		const struct k_thread_latency_stats *cpu_stats = &latency_stats[i];
+
+		for (size_t b = 0; b < ARRAY_SIZE(stats->buckets); b++) {
+			stats->buckets[b] += cpu_stats->buckets[b];
+		}
+		stats->num_samples += cpu_stats->num_samples;
+		stats->total_cycles += cpu_stats->total_cycles;
+		if (cpu_stats->max_cycles > stats->max_cycles) {
+			stats->max_cycles = cpu_stats->max_cycles;
+		}
+	}
+}
+
+void k_thread_latency_stats_reset(void)
+{
+	(void)memset(latency_stats, 0, sizeof(latency_stats));
+}
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
@@ -73,6 +135,10 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 
 void z_sched_usage_start(struct k_thread *thread)
 {
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	sched_latency_record(thread);
+#endif /* CONFIG_SCHED_LATENCY_STATS */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	k_spinlock_key_t  key;
 
@@ -107,6 +173,14 @@ void z_sched_usage_stop(void)
 	if (u0 != 0) {
 		uint32_t cycles = usage_now() - u0;
 
+#ifdef CONFIG_SCHED_DEADLINE_BANDWIDTH
+		/* Charged regardless of the per-thread track_usage
+		 * opt-out: the reservation contract must hold even
+		 * for threads that don't collect statistics.
+		 */
+		z_sched_budget_charge(cpu->current, cycles);
+#endif /* CONFIG_SCHED_DEADLINE_BANDWIDTH */
+
 		if (cpu->current->base.usage.track_usage) {
 			sched_thread_update_usage(cpu->current, cycles);
 		}
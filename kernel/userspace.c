@@ -169,6 +169,10 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct k_object kobj;
 	sys_dnode_t dobj_list;
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH
+	/* Node in the pointer-hash bucket used for O(1) lookup */
+	sys_dnode_t dobj_hash;
+#endif
 
 	/* The object itself */
 	void *data;
@@ -184,6 +188,40 @@ extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH
+/* Dynamic objects bucketed by object pointer, maintained alongside
+ * obj_list (which remains the iteration order) so lookups stop
+ * scaling with the number of dynamic objects.
+ */
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH_BUCKETS));
+
+static sys_dlist_t obj_hash[CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH_BUCKETS];
+static bool obj_hash_ready;
+
+static sys_dlist_t *obj_hash_bucket(const void *obj)
+{
+	uintptr_t v = (uintptr_t)obj >> 3;
+
+	/* Cheap multiplicative mix; buckets is a power of two */
+	v *= 0x9E3779B9UL;
+
+	return &obj_hash[(v >> 16) & (CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH_BUCKETS - 1U)];
+}
+
+/* Called under lists_lock */
+static void obj_hash_insert(struct dyn_obj *dyn)
+{
+	if (!obj_hash_ready) {
+		for (int i = 0; i < ARRAY_SIZE(obj_hash); i++) {
+			sys_dlist_init(&obj_hash[i]);
+		}
+		obj_hash_ready = true;
+	}
+
+	sys_dlist_append(obj_hash_bucket(dyn->kobj.name), &dyn->dobj_hash);
+}
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH */
+
 /*
  * TODO: Write some hash table code that will replace obj_list.
  */
@@ -234,6 +272,18 @@ static struct dyn_obj *dyn_object_find(const void *obj)
 	 */
 	key = k_spin_lock(&lists_lock);
 
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH
+	if (obj_hash_ready) {
+		SYS_DLIST_FOR_EACH_CONTAINER(obj_hash_bucket(obj), node, dobj_hash) {
+			if (node->kobj.name == obj) {
+				goto end;
+			}
+		}
+	}
+
+	/* No object found */
+	node = NULL;
+#else
 	SYS_DLIST_FOR_EACH_CONTAINER(&obj_list, node, dobj_list) {
 		if (node->kobj.name == obj) {
 			goto end;
@@ -242,6 +292,7 @@ static struct dyn_obj *dyn_object_find(const void *obj)
 
 	/* No object found */
 	node = NULL;
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH */
 
  end:
 	k_spin_unlock(&lists_lock, key);
@@ -376,6 +427,9 @@ static struct k_object *dynamic_object_create(enum k_objects otype, size_t align
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH
+	obj_hash_insert(dyn);
+#endif
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -470,6 +524,9 @@ void k_object_free(void *obj)
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
 		sys_dlist_remove(&dyn->dobj_list);
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH
+		sys_dlist_remove(&dyn->dobj_hash);
+#endif
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -602,6 +659,9 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 	}
 
 	sys_dlist_remove(&dyn->dobj_list);
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_HASH
+	sys_dlist_remove(&dyn->dobj_hash);
+#endif
 	k_free(dyn->data);
 	k_free(dyn);
 out:
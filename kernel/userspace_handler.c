@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
@@ -87,3 +89,49 @@ static inline void *z_vrfy_k_object_alloc_size(enum k_objects otype, size_t size
 	return z_impl_k_object_alloc_size(otype, size);
 }
 #include <zephyr/syscalls/k_object_alloc_size_mrsh.c>
+
+#ifdef CONFIG_SYSCALL_BATCH
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	/* Supervisor threads do not trap; a batch would be pure overhead */
+	return -ENOSYS;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	if ((count == 0U) || (count > CONFIG_SYSCALL_BATCH_MAX_CALLS)) {
+		return -EINVAL;
+	}
+
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(entries, count * sizeof(*entries)));
+
+	for (size_t i = 0; i < count; i++) {
+		/* Copy to kernel stack so the IDs and arguments that were
+		 * validated cannot be changed by another user thread
+		 * mid-dispatch.
+		 */
+		struct k_syscall_batch_entry entry;
+
+		(void)memcpy(&entry, &entries[i], sizeof(entry));
+
+		if ((entry.call_id >= K_SYSCALL_LIMIT) ||
+		    (entry.call_id == K_SYSCALL_K_SYSCALL_BATCH)) {
+			return -EINVAL;
+		}
+
+		/* Dispatch through the call's own verification handler with
+		 * our trap's stack frame, exactly as a separate trap would,
+		 * so every per-call check still runs.
+		 */
+		entries[i].ret = _k_syscall_table[entry.call_id](
+			entry.args[0], entry.args[1], entry.args[2], entry.args[3],
+			entry.args[4], entry.args[5], _current->syscall_frame);
+	}
+
+	return 0;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
+#endif /* CONFIG_SYSCALL_BATCH */
@@ -176,6 +176,69 @@ int k_work_busy_get(const struct k_work *work)
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_PRIORITY_BANDS
+/* The FIFO band list a work item belongs to on a given queue */
+static inline sys_slist_t *pending_list(struct k_work_q *queue,
+					struct k_work *work)
+{
+	return &queue->pending[MIN(work->prio, K_WORK_NUM_PRIO_BANDS - 1)];
+}
+
+static inline void pending_init(struct k_work_q *queue)
+{
+	for (int band = 0; band < K_WORK_NUM_PRIO_BANDS; band++) {
+		sys_slist_init(&queue->pending[band]);
+	}
+}
+
+/* Pop the oldest item of the highest-priority non-empty band */
+static inline sys_snode_t *pending_get(struct k_work_q *queue)
+{
+	for (int band = 0; band < K_WORK_NUM_PRIO_BANDS; band++) {
+		sys_snode_t *node = sys_slist_get(&queue->pending[band]);
+
+		if (node != NULL) {
+			return node;
+		}
+	}
+
+	return NULL;
+}
+
+static inline bool pending_is_empty(struct k_work_q *queue)
+{
+	for (int band = 0; band < K_WORK_NUM_PRIO_BANDS; band++) {
+		if (!sys_slist_is_empty(&queue->pending[band])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#else /* CONFIG_WORKQUEUE_PRIORITY_BANDS */
+static inline sys_slist_t *pending_list(struct k_work_q *queue,
+					struct k_work *work)
+{
+	ARG_UNUSED(work);
+	return &queue->pending;
+}
+
+static inline void pending_init(struct k_work_q *queue)
+{
+	sys_slist_init(&queue->pending);
+}
+
+static inline sys_snode_t *pending_get(struct k_work_q *queue)
+{
+	return sys_slist_get(&queue->pending);
+}
+
+static inline bool pending_is_empty(struct k_work_q *queue)
+{
+	return sys_slist_is_empty(&queue->pending);
+}
+#endif /* CONFIG_WORKQUEUE_PRIORITY_BANDS */
+
 /* Add a flusher work item to the queue.
  *
  * Invoked with work lock held.
@@ -187,6 +250,24 @@ int k_work_busy_get(const struct k_work *work)
  * queue
  * @param flusher an uninitialized/unused flusher object
  */
+/* True when the current thread animates the given queue, either as
+ * its single thread or as one of its pool workers.
+ */
+static inline bool queue_runs_current(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue->workers != NULL) {
+		for (uint16_t i = 0; i < queue->nworkers; i++) {
+			if (_current == &queue->workers[i]) {
+				return true;
+			}
+		}
+		return false;
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+	return _current == queue->thread_id;
+}
+
 static void queue_flusher_locked(struct k_work_q *queue,
 				 struct k_work *work,
 				 struct z_work_flusher *flusher)
@@ -194,10 +275,12 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	init_flusher(flusher);
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
-		sys_slist_insert(&queue->pending, &work->node,
+		/* the flusher follows the work within its band */
+		sys_slist_insert(pending_list(queue, work), &work->node,
 				 &flusher->work.node);
 	} else {
-		sys_slist_prepend(&queue->pending, &flusher->work.node);
+		sys_slist_prepend(pending_list(queue, &flusher->work),
+				  &flusher->work.node);
 	}
 }
 
@@ -212,7 +295,8 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
-		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
+		(void)sys_slist_find_and_remove(pending_list(queue, work),
+						&work->node);
 	}
 }
 
@@ -265,7 +349,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = queue_runs_current(queue) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -283,7 +367,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		sys_slist_append(pending_list(queue, work), &work->node);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -411,6 +495,45 @@ int k_work_submit_to_queue(struct k_work_q *queue,
 	return ret;
 }
 
+int k_work_submit_batch(struct k_work_q *queue, struct k_work **works,
+			size_t count)
+{
+	int ret = 0;
+	size_t queued = 0;
+
+	if (queue == NULL) {
+		queue = &k_sys_work_q;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < count; i++) {
+		struct k_work_q *q = queue;
+		int rc;
+
+		__ASSERT_NO_MSG(works[i] != NULL);
+		__ASSERT_NO_MSG(works[i]->handler != NULL);
+
+		rc = submit_to_queue_locked(works[i], &q);
+		if (rc < 0) {
+			ret = rc;
+			break;
+		}
+		if (rc > 0) {
+			queued++;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	/* One reschedule for the whole batch */
+	if (queued > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return (ret < 0) ? ret : (int)queued;
+}
+
 int k_work_submit(struct k_work *work)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, submit, work);
@@ -667,12 +790,15 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = pending_get(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#ifdef CONFIG_WORKQUEUE_POOL
+			queue->active++;
+#endif
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -690,7 +816,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (
+#ifdef CONFIG_WORKQUEUE_POOL
+			   /* other pool workers may still be busy */
+			   (queue->active == 0U) &&
+#endif
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -705,6 +836,17 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#ifdef CONFIG_WORKQUEUE_POOL
+			if ((queue->workers != NULL) && (queue->alive > 1U)) {
+				/* More pool workers must still observe
+				 * the stop: pass the notification on.
+				 */
+				queue->alive--;
+				(void)notify_queue_locked(queue);
+				k_spin_unlock(&lock, key);
+				return;
+			}
+#endif /* CONFIG_WORKQUEUE_POOL */
 			flags_set(&queue->flags, 0);
 			k_spin_unlock(&lock, key);
 			return;
@@ -755,7 +897,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#ifdef CONFIG_WORKQUEUE_POOL
+		queue->active--;
+		if (queue->active == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif /* CONFIG_WORKQUEUE_POOL */
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -801,7 +950,7 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	}
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
-	sys_slist_init(&queue->pending);
+	pending_init(queue);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
 	queue->thread_id = _current;
@@ -823,7 +972,7 @@ void k_work_queue_start(struct k_work_q *queue,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
 
-	sys_slist_init(&queue->pending);
+	pending_init(queue);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
 
@@ -863,6 +1012,57 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_queue_start_pool(struct k_work_q *queue, struct k_thread *workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     size_t nworkers, int prio,
+			     const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(workers);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG(nworkers > 0U);
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	uint32_t flags = K_WORK_QUEUE_STARTED;
+	uintptr_t ssz = K_THREAD_STACK_LEN(stack_size);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	pending_init(queue);
+	z_waitq_init(&queue->notifyq);
+	z_waitq_init(&queue->drainq);
+	queue->workers = workers;
+	queue->nworkers = (uint16_t)nworkers;
+	queue->alive = (uint16_t)nworkers;
+	queue->active = 0;
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+	flags_set(&queue->flags, flags);
+
+	for (size_t i = 0; i < nworkers; i++) {
+		(void)k_thread_create(&workers[i],
+				      (k_thread_stack_t *)&((char *)stacks)[ssz * i],
+				      stack_size, work_queue_main, queue,
+				      NULL, NULL, prio, 0, K_NO_WAIT);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(&workers[i], cfg->name);
+		}
+	}
+
+	/* Used for diagnostics and as a fallback identity; the
+	 * chained-submission and join logic inspects the worker array.
+	 */
+	queue->thread_id = &workers[0];
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -877,7 +1077,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || !pending_is_empty(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -943,6 +1143,21 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	notify_queue_locked(queue);
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue->workers != NULL) {
+		for (uint16_t i = 0; i < queue->nworkers; i++) {
+			if (k_thread_join(&queue->workers[i], timeout)) {
+				key = k_spin_lock(&lock);
+				flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+				k_spin_unlock(&lock, key);
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop,
+							       queue, timeout,
+							       -ETIMEDOUT);
+				return -ETIMEDOUT;
+			}
+		}
+	} else
+#endif /* CONFIG_WORKQUEUE_POOL */
 	if (k_thread_join(queue->thread_id, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
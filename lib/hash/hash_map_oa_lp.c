@@ -34,13 +34,13 @@ BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, n_buckets) ==
 BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, size) ==
 	     offsetof(struct sys_hashmap_data, size));
 
-static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
-						 bool used_ok, bool unused_ok, bool tombstone_ok)
+static struct oalp_entry *sys_hashmap_oa_lp_find_in(const struct sys_hashmap *map,
+						    struct oalp_entry *const buckets,
+						    size_t n_buckets, uint64_t key, bool used_ok,
+						    bool unused_ok, bool tombstone_ok)
 {
 	struct oalp_entry *entry = NULL;
-	const size_t n_buckets = map->data->n_buckets;
 	uint32_t hash = map->hash_func(&key, sizeof(key));
-	struct oalp_entry *const buckets = map->data->buckets;
 
 	for (size_t i = 0, j = hash; i < n_buckets; ++i, ++j) {
 		j &= (n_buckets - 1);
@@ -73,6 +73,89 @@ static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map,
 	return NULL;
 }
 
+static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
+						 bool used_ok, bool unused_ok, bool tombstone_ok)
+{
+	return sys_hashmap_oa_lp_find_in(map, map->data->buckets, map->data->n_buckets, key,
+					 used_ok, unused_ok, tombstone_ok);
+}
+
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+/* Look a key up in the old (draining) table. Returns NULL when no
+ * migration is in progress or the key is not there.
+ */
+static struct oalp_entry *oalp_find_old(const struct sys_hashmap *map, uint64_t key)
+{
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct oalp_entry *entry;
+
+	if (data->old_buckets == NULL) {
+		return NULL;
+	}
+
+	entry = sys_hashmap_oa_lp_find_in(map, data->old_buckets, data->old_n_buckets, key, true,
+					  true, false);
+	if (entry == NULL || entry->state != USED) {
+		return NULL;
+	}
+
+	return entry;
+}
+
+static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t key,
+					      uint64_t value, uint64_t *old_value);
+
+/* Move up to CONFIG_SYS_HASH_MAP_OA_LP_MIGRATE_BATCH old-table slots
+ * into the current table. Total size is invariant under migration, so
+ * the increments made by the raw insert are taken back.
+ */
+static void oalp_migrate_step(struct sys_hashmap *map)
+{
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct oalp_entry *old_buckets = data->old_buckets;
+	size_t budget = CONFIG_SYS_HASH_MAP_OA_LP_MIGRATE_BATCH;
+
+	if (old_buckets == NULL) {
+		return;
+	}
+
+	while (budget > 0 && data->migrate_pos < data->old_n_buckets) {
+		struct oalp_entry *entry = &old_buckets[data->migrate_pos];
+
+		if (entry->state == USED) {
+			(void)sys_hashmap_oa_lp_insert_no_rehash(map, entry->key, entry->value,
+								 NULL);
+			--data->size;
+			/* Retire the old copy so lookups and removals can
+			 * never find a duplicate; a tombstone keeps the old
+			 * table's probe chains intact.
+			 */
+			entry->state = TOMBSTONE;
+		}
+
+		++data->migrate_pos;
+		--budget;
+	}
+
+	if (data->migrate_pos == data->old_n_buckets) {
+		map->alloc_func(old_buckets, 0);
+		data->old_buckets = NULL;
+		data->old_n_buckets = 0;
+		data->migrate_pos = 0;
+	}
+}
+
+/* Complete an in-progress migration, e.g. before starting another */
+static void oalp_migrate_finish(struct sys_hashmap *map)
+{
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+
+	while (data->old_buckets != NULL) {
+		oalp_migrate_step(map);
+	}
+}
+#endif /* CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH */
+
 static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value,
 					      uint64_t *old_value)
 {
@@ -127,6 +210,11 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 		return -ENOSPC;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	/* Never keep more than one draining table */
+	oalp_migrate_finish(map);
+#endif
+
 	/* extract all entries from the hashmap */
 	old_size = data->size;
 	old_n_buckets = data->n_buckets;
@@ -142,6 +230,20 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 		memset(new_buckets, 0, new_n_buckets * sizeof(*new_buckets));
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	ARG_UNUSED(old_size);
+	ARG_UNUSED(entry);
+
+	/* Keep the old table and drain it a few slots per operation;
+	 * data->size keeps counting the entries in both tables.
+	 */
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+	data->n_tombstones = 0;
+	data->old_buckets = old_buckets;
+	data->old_n_buckets = old_n_buckets;
+	data->migrate_pos = 0;
+#else
 	data->size = 0;
 	data->buckets = new_buckets;
 	data->n_buckets = new_n_buckets;
@@ -158,6 +260,7 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 
 	/* free the old Hashmap */
 	map->alloc_func(old_buckets, 0);
+#endif /* CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH */
 
 	return 0;
 }
@@ -176,6 +279,45 @@ static void sys_hashmap_oa_lp_iter_next(struct sys_hashmap_iterator *it)
 		it->state = buckets;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct oalp_entry *old_buckets = data->old_buckets;
+
+	/* Scan the current table first, then the draining one */
+	if ((struct oalp_entry *)it->state >= buckets &&
+	    (struct oalp_entry *)it->state <= &buckets[map->data->n_buckets]) {
+		i = (struct oalp_entry *)it->state - buckets;
+
+		for (; i < map->data->n_buckets; ++i) {
+			entry = &buckets[i];
+			if (entry->state == USED) {
+				it->state = &buckets[i + 1];
+				it->key = entry->key;
+				it->value = entry->value;
+				++it->pos;
+				return;
+			}
+		}
+
+		__ASSERT(old_buckets != NULL,
+			 "Entire Hashmap traversed and no entry was found");
+		it->state = &old_buckets[data->migrate_pos];
+	}
+
+	i = (struct oalp_entry *)it->state - old_buckets;
+	__ASSERT(i < data->old_n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < data->old_n_buckets; ++i) {
+		entry = &old_buckets[i];
+		if (entry->state == USED) {
+			it->state = &old_buckets[i + 1];
+			it->key = entry->key;
+			it->value = entry->value;
+			++it->pos;
+			return;
+		}
+	}
+#else
 	i = (struct oalp_entry *)it->state - buckets;
 	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
 
@@ -189,6 +331,7 @@ static void sys_hashmap_oa_lp_iter_next(struct sys_hashmap_iterator *it)
 			return;
 		}
 	}
+#endif /* CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH */
 
 	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
 }
@@ -225,6 +368,24 @@ static void sys_hashmap_oa_lp_clear(struct sys_hashmap *map, sys_hashmap_callbac
 		data->buckets = NULL;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	if (data->old_buckets != NULL) {
+		struct oalp_entry *old_buckets = data->old_buckets;
+
+		for (size_t i = data->migrate_pos; cb != NULL && i < data->old_n_buckets; ++i) {
+			entry = &old_buckets[i];
+			if (entry->state == USED) {
+				cb(entry->key, entry->value, cookie);
+			}
+		}
+
+		map->alloc_func(data->old_buckets, 0);
+		data->old_buckets = NULL;
+		data->old_n_buckets = 0;
+		data->migrate_pos = 0;
+	}
+#endif
+
 	data->n_buckets = 0;
 	data->size = 0;
 	data->n_tombstones = 0;
@@ -235,12 +396,53 @@ static inline int sys_hashmap_oa_lp_insert(struct sys_hashmap *map, uint64_t key
 {
 	int ret;
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct oalp_entry *old_entry;
+	bool was_in_old = false;
+	uint64_t prev_value = 0;
+
+	oalp_migrate_step(map);
+
+	/* If the key still lives in the draining table, retire it there
+	 * so the fresh insert below cannot create a duplicate.
+	 */
+	old_entry = oalp_find_old(map, key);
+	if (old_entry != NULL) {
+		was_in_old = true;
+		prev_value = old_entry->value;
+		old_entry->state = TOMBSTONE;
+		--data->size;
+	}
+#endif
+
 	ret = sys_hashmap_oa_lp_rehash(map, true);
 	if (ret < 0) {
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+		if (was_in_old) {
+			/* Undo the retirement so the entry is not lost */
+			old_entry->state = USED;
+			++data->size;
+		}
+#endif
 		return ret;
 	}
 
-	return sys_hashmap_oa_lp_insert_no_rehash(map, key, value, old_value);
+	ret = sys_hashmap_oa_lp_insert_no_rehash(map, key, value, old_value);
+
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	if (was_in_old && ret == 1) {
+		/* From the caller's point of view this replaced an
+		 * existing entry.
+		 */
+		if (old_value != NULL) {
+			*old_value = prev_value;
+		}
+		ret = 0;
+	}
+#endif
+
+	return ret;
 }
 
 static bool sys_hashmap_oa_lp_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
@@ -248,6 +450,27 @@ static bool sys_hashmap_oa_lp_remove(struct sys_hashmap *map, uint64_t key, uint
 	struct oalp_entry *entry;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	oalp_migrate_step(map);
+
+	entry = oalp_find_old(map, key);
+	if (entry != NULL) {
+		if (value != NULL) {
+			*value = entry->value;
+		}
+
+		entry->state = TOMBSTONE;
+		--data->size;
+
+		/* Old-table tombstones die with the old table and do not
+		 * count towards the current table's compaction heuristics.
+		 */
+		(void)sys_hashmap_oa_lp_rehash(map, false);
+
+		return true;
+	}
+#endif
+
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
 	if (entry == NULL || entry->state == UNUSED) {
 		return false;
@@ -271,6 +494,17 @@ static bool sys_hashmap_oa_lp_get(const struct sys_hashmap *map, uint64_t key, u
 {
 	struct oalp_entry *entry;
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	entry = oalp_find_old(map, key);
+	if (entry != NULL) {
+		if (value != NULL) {
+			*value = entry->value;
+		}
+
+		return true;
+	}
+#endif
+
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
 	if (entry == NULL || entry->state == UNUSED) {
 		return false;
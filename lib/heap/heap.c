@@ -31,6 +31,62 @@ static void *chunk_mem(struct z_heap *h, chunkid_t c)
 	return ret;
 }
 
+
+#ifdef CONFIG_SYS_HEAP_RB_INDEX
+/* Red/black index over large free chunks: every free chunk whose size
+ * reaches the per-heap threshold also sits in h->free_tree, keyed by
+ * (size, chunkid), so best-fit lookup for big requests is O(log n)
+ * regardless of how fragmented the buckets get.  The node rides in
+ * the free chunk's payload just past the bucket list link fields; the
+ * size/chunkid copies make the comparator independent of the heap
+ * pointer.
+ */
+struct rb_free_node {
+	chunksz_t sz;
+	chunkid_t c;
+	struct rbnode node;
+};
+
+static inline struct rb_free_node *rb_free_node_of(struct z_heap *h, chunkid_t c)
+{
+	return (struct rb_free_node *)((chunkid_t *)chunk_mem(h, c) + 2);
+}
+
+static bool z_heap_rb_free_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct rb_free_node *fa = CONTAINER_OF(a, struct rb_free_node, node);
+	struct rb_free_node *fb = CONTAINER_OF(b, struct rb_free_node, node);
+
+	return (fa->sz == fb->sz) ? (fa->c < fb->c) : (fa->sz < fb->sz);
+}
+
+static inline bool rb_indexable(struct z_heap *h, chunkid_t c)
+{
+	return (h->rb_threshold != 0U) && (chunk_size(h, c) >= h->rb_threshold);
+}
+
+static void rb_index_add(struct z_heap *h, chunkid_t c)
+{
+	if (rb_indexable(h, c)) {
+		struct rb_free_node *fn = rb_free_node_of(h, c);
+
+		fn->sz = chunk_size(h, c);
+		fn->c = c;
+		rb_insert(&h->free_tree, &fn->node);
+	}
+}
+
+static void rb_index_remove(struct z_heap *h, chunkid_t c)
+{
+	if (rb_indexable(h, c)) {
+		rb_remove(&h->free_tree, &rb_free_node_of(h, c)->node);
+	}
+}
+#else
+#define rb_index_add(h, c) do { } while (false)
+#define rb_index_remove(h, c) do { } while (false)
+#endif /* CONFIG_SYS_HEAP_RB_INDEX */
+
 static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 {
 	struct z_heap_bucket *b = &h->buckets[bidx];
@@ -39,6 +95,8 @@ static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 	CHECK(b->next != 0);
 	CHECK(h->avail_buckets & BIT(bidx));
 
+	rb_index_remove(h, c);
+
 	if (next_free_chunk(h, c) == c) {
 		/* this is the last chunk */
 		h->avail_buckets &= ~BIT(bidx);
@@ -93,6 +151,8 @@ static void free_list_add_bidx(struct z_heap *h, chunkid_t c, int bidx)
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 #endif
+
+	rb_index_add(h, c);
 }
 
 static void free_list_add(struct z_heap *h, chunkid_t c)
@@ -184,7 +244,17 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+	/* Quick-listed chunks stay marked used and keep counting as
+	 * allocated (runtime stats, listeners and the validator all
+	 * stay consistent that way); the pop side symmetrically skips
+	 * the allocation accounting.
+	 */
+	if (quick_push(h, c)) {
+		return;
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +264,7 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -208,8 +279,117 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+
+/* Chunks retained per quick class before frees take the regular,
+ * coalescing path.
+ */
+#define QUICK_DEPTH 16U
+
+static inline int quick_class(struct z_heap *h, chunksz_t sz)
+{
+	unsigned int idx = sz - min_chunk_size(h);
+
+	return (idx < SYS_HEAP_QUICK_NUM_CLASSES) ? (int)idx : -1;
+}
+
+/* Exact-fit pop; the returned chunk is already sized and marked used */
+static chunkid_t quick_pop(struct z_heap *h, chunksz_t sz)
+{
+	int cls = quick_class(h, sz);
+	chunkid_t c;
+
+	if ((cls < 0) || (h->quick[cls] == 0U)) {
+		return 0;
+	}
+
+	c = h->quick[cls];
+	h->quick[cls] = *(chunkid_t *)chunk_mem(h, c);
+	h->quick_count[cls]--;
+
+	return c;
+}
+
+static bool quick_push(struct z_heap *h, chunkid_t c)
+{
+	int cls = quick_class(h, chunk_size(h, c));
+
+	if ((cls < 0) || (h->quick_count[cls] >= QUICK_DEPTH) ||
+	    solo_free_header(h, c)) {
+		return false;
+	}
+
+	*(chunkid_t *)chunk_mem(h, c) = h->quick[cls];
+	h->quick[cls] = c;
+	h->quick_count[cls]++;
+
+	return true;
+}
+
+/* Return every quick-listed chunk to the regular free lists (with
+ * coalescing); called when an allocation would otherwise fail.
+ */
+static void quick_flush(struct sys_heap *heap)
+{
+	struct z_heap *h = heap->heap;
+
+	for (int cls = 0; cls < SYS_HEAP_QUICK_NUM_CLASSES; cls++) {
+		while (h->quick[cls] != 0U) {
+			chunkid_t c = h->quick[cls];
+
+			h->quick[cls] = *(chunkid_t *)chunk_mem(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+			h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+#ifdef CONFIG_SYS_HEAP_LISTENER
+			heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap),
+						  chunk_mem(h, c),
+						  chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+		}
+		h->quick_count[cls] = 0U;
+	}
+}
+#endif /* CONFIG_SYS_HEAP_QUICK_CLASSES */
+
 static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 {
+#ifdef CONFIG_SYS_HEAP_RB_INDEX
+	if ((h->rb_threshold != 0U) && (sz >= h->rb_threshold)) {
+		/* Every free chunk able to satisfy this request is in
+		 * the index, so an ordered descent gives the best fit
+		 * in O(log n) and a miss is authoritative.
+		 */
+		struct rbnode *n = h->free_tree.root;
+		struct rbnode *best = NULL;
+
+		while (n != NULL) {
+			struct rb_free_node *fn =
+				CONTAINER_OF(n, struct rb_free_node, node);
+
+			if (fn->sz >= sz) {
+				best = n;
+				n = z_rb_child(n, 0U);
+			} else {
+				n = z_rb_child(n, 1U);
+			}
+		}
+
+		if (best != NULL) {
+			chunkid_t c = CONTAINER_OF(best, struct rb_free_node,
+						   node)->c;
+
+			free_list_remove(h, c);
+			return c;
+		}
+
+		return 0;
+	}
+#endif /* CONFIG_SYS_HEAP_RB_INDEX */
+
 	int bi = bucket_idx(h, sz);
 	struct z_heap_bucket *b = &h->buckets[bi];
 
@@ -270,8 +450,29 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes, 0);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c;
+
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+	/* Exact-fit fast path: no bucket scan, no split.  The chunk
+	 * remained accounted as allocated while cached, so the
+	 * stats/listener tail below must be skipped.
+	 */
+	c = quick_pop(h, chunk_sz);
+	if (c != 0U) {
+		mem = chunk_mem(h, c);
+		IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
+		return mem;
+	}
+#endif
 
+	c = alloc_chunk(h, chunk_sz);
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+	if (c == 0U) {
+		/* memory may be parked on the quick lists */
+		quick_flush(heap);
+		c = alloc_chunk(h, chunk_sz);
+	}
+#endif
 	if (c == 0U) {
 		return NULL;
 	}
@@ -343,6 +544,13 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes, align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+	if (c0 == 0) {
+		/* memory may be parked on the quick lists */
+		quick_flush(heap);
+		c0 = alloc_chunk(h, padded_sz);
+	}
+#endif
 	if (c0 == 0) {
 		return NULL;
 	}
@@ -522,6 +730,66 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	return ptr2;
 }
 
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+int sys_heap_prealloc(struct sys_heap *heap, size_t bytes, unsigned int count)
+{
+	void *chain = NULL;
+	void *mem;
+	int ret = 0;
+
+	/* Allocate the requested blocks, chain them through their
+	 * payloads, then free them all: the frees land on the quick
+	 * lists (up to the per-class depth), warming the class.
+	 */
+	for (unsigned int i = 0; i < count; i++) {
+		mem = sys_heap_alloc(heap, MAX(bytes, sizeof(void *)));
+		if (mem == NULL) {
+			ret = -ENOMEM;
+			break;
+		}
+		*(void **)mem = chain;
+		chain = mem;
+	}
+
+	while (chain != NULL) {
+		mem = chain;
+		chain = *(void **)mem;
+		sys_heap_free(heap, mem);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_SYS_HEAP_QUICK_CLASSES */
+
+#ifdef CONFIG_SYS_HEAP_RB_INDEX
+void sys_heap_rb_index_init(struct sys_heap *heap, size_t threshold_bytes)
+{
+	struct z_heap *h = heap->heap;
+
+	/* The index node must fit in the chunk payload behind the two
+	 * free list link fields.
+	 */
+	chunksz_t min_sz = chunksz(chunk_header_bytes(h) +
+				   2 * sizeof(chunkid_t) +
+				   sizeof(struct rb_free_node));
+
+	h->free_tree = (struct rbtree) {
+		.lessthan_fn = z_heap_rb_free_lessthan,
+	};
+	h->rb_threshold = MAX(bytes_to_chunksz(h, threshold_bytes, 0), min_sz);
+
+	/* Index the qualifying free chunks that already exist (for a
+	 * freshly initialized heap, that is the one big chunk).
+	 */
+	for (chunkid_t c = right_chunk(h, 0); c < h->end_chunk;
+	     c = right_chunk(h, c)) {
+		if (!chunk_used(h, c) && !solo_free_header(h, c)) {
+			rb_index_add(h, c);
+		}
+	}
+}
+#endif /* CONFIG_SYS_HEAP_RB_INDEX */
+
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
 	IF_ENABLED(CONFIG_MSAN, (__sanitizer_dtor_callback(mem, bytes)));
@@ -557,6 +825,21 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->max_allocated_bytes = 0;
 #endif
 
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+	for (int i = 0; i < SYS_HEAP_QUICK_NUM_CLASSES; i++) {
+		h->quick[i] = 0;
+		h->quick_count[i] = 0;
+	}
+#endif
+
+#ifdef CONFIG_SYS_HEAP_RB_INDEX
+	/* off until sys_heap_rb_index_init() opts this heap in */
+	h->rb_threshold = 0;
+	h->free_tree = (struct rbtree) {
+		.lessthan_fn = z_heap_rb_free_lessthan,
+	};
+#endif
+
 #if CONFIG_SYS_HEAP_ARRAY_SIZE
 	sys_heap_array_save(heap);
 #endif
@@ -6,6 +6,10 @@
 #ifndef ZEPHYR_INCLUDE_LIB_OS_HEAP_H_
 #define ZEPHYR_INCLUDE_LIB_OS_HEAP_H_
 
+#ifdef CONFIG_SYS_HEAP_RB_INDEX
+#include <zephyr/sys/rb.h>
+#endif
+
 /*
  * Internal heap APIs
  */
@@ -65,6 +69,13 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+/* Exact chunk-size quick lists cover min_chunk_size(h) through
+ * min_chunk_size(h) + SYS_HEAP_QUICK_NUM_CLASSES - 1 chunks.
+ */
+#define SYS_HEAP_QUICK_NUM_CLASSES 16
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +84,22 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_QUICK_CLASSES
+	/* Singly linked lists of recently freed chunks at exact chunk
+	 * sizes; entries stay marked "used" so coalescing ignores
+	 * them.  See quick_pop()/quick_push() in heap.c.
+	 */
+	chunkid_t quick[SYS_HEAP_QUICK_NUM_CLASSES];
+	uint8_t quick_count[SYS_HEAP_QUICK_NUM_CLASSES];
+#endif
+#ifdef CONFIG_SYS_HEAP_RB_INDEX
+	/* Index over free chunks of at least rb_threshold chunk
+	 * units; 0 disables the index for this heap.  See
+	 * rb_index_add()/rb_index_remove() in heap.c.
+	 */
+	struct rbtree free_tree;
+	chunksz_t rb_threshold;
 #endif
 	struct z_heap_bucket buckets[];
 };
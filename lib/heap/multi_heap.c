@@ -6,6 +6,7 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/multi_heap.h>
 #include <string.h>
+#include <limits.h>
 
 void sys_multi_heap_init(struct sys_multi_heap *heap, sys_multi_heap_fn_t choice_fn)
 {
@@ -41,6 +42,125 @@ void sys_multi_heap_add_heap(struct sys_multi_heap *mheap,
 	}
 }
 
+#ifdef CONFIG_SYS_MULTI_HEAP_POLICY
+
+/* Occupancy of a heap in percent, or 0 when stats are unavailable */
+static unsigned int heap_occupancy(struct sys_heap *heap)
+{
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	struct sys_memory_stats stats;
+	size_t total;
+
+	if (sys_heap_runtime_stats_get(heap, &stats) != 0) {
+		return 0;
+	}
+
+	total = stats.allocated_bytes + stats.free_bytes;
+	if (total == 0U) {
+		return 0;
+	}
+
+	return (unsigned int)((stats.allocated_bytes * 100U) / total);
+#else
+	ARG_UNUSED(heap);
+	return 0;
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+}
+
+static bool heap_eligible(const struct sys_multi_heap_policy_attrs *attrs,
+			  size_t bytes)
+{
+	if (attrs == NULL) {
+		return true;
+	}
+	if (bytes < attrs->size_min) {
+		return false;
+	}
+	if ((attrs->size_max != 0U) && (bytes > attrs->size_max)) {
+		return false;
+	}
+	return true;
+}
+
+/* Shared policy core: repeatedly pick the best eligible heap not yet
+ * tried (smallest key) and attempt the allocation, so a preferred but
+ * exhausted heap degrades to the next choice instead of failing.
+ */
+static void *policy_alloc(struct sys_multi_heap *mheap, size_t align,
+			  size_t bytes, bool balance)
+{
+	uint32_t tried = 0;
+
+	for (unsigned int round = 0; round < mheap->nheaps; round++) {
+		const struct sys_multi_heap_policy_attrs *attrs;
+		unsigned int best_key = UINT_MAX;
+		int best = -1;
+		void *mem;
+
+		for (unsigned int i = 0; i < mheap->nheaps; i++) {
+			unsigned int key;
+
+			if ((tried & BIT(i)) != 0U) {
+				continue;
+			}
+
+			attrs = mheap->heaps[i].user_data;
+			if (!heap_eligible(attrs, bytes)) {
+				tried |= BIT(i);
+				continue;
+			}
+
+			unsigned int occupancy = heap_occupancy(mheap->heaps[i].heap);
+
+			if ((attrs != NULL) && (attrs->max_percent != 0U) &&
+			    (occupancy >= attrs->max_percent)) {
+				tried |= BIT(i);
+				continue;
+			}
+
+			/* balanced: fill the emptiest heap; tiered:
+			 * fill the fastest tier first
+			 */
+			key = balance ? occupancy :
+				((attrs != NULL) ? attrs->tier : 0U);
+			if (key < best_key) {
+				best_key = key;
+				best = (int)i;
+			}
+		}
+
+		if (best < 0) {
+			break;
+		}
+		tried |= BIT(best);
+
+		mem = (align == 0U) ?
+			sys_heap_alloc(mheap->heaps[best].heap, bytes) :
+			sys_heap_aligned_alloc(mheap->heaps[best].heap,
+					       align, bytes);
+		if (mem != NULL) {
+			return mem;
+		}
+	}
+
+	return NULL;
+}
+
+void *sys_multi_heap_policy_tiered(struct sys_multi_heap *mheap, void *cfg,
+				   size_t align, size_t bytes)
+{
+	ARG_UNUSED(cfg);
+	return policy_alloc(mheap, align, bytes, false);
+}
+
+void *sys_multi_heap_policy_balanced(struct sys_multi_heap *mheap, void *cfg,
+				     size_t align, size_t bytes)
+{
+	ARG_UNUSED(cfg);
+	return policy_alloc(mheap, align, bytes, true);
+}
+#endif /* CONFIG_SYS_MULTI_HEAP_POLICY */
+
 void *sys_multi_heap_alloc(struct sys_multi_heap *mheap, void *cfg, size_t bytes)
 {
 	return mheap->choice(mheap, cfg, 0, bytes);
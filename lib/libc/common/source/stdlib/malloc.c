@@ -238,6 +238,11 @@ static int malloc_prepare(void)
 	return 0;
 }
 
+struct sys_heap *z_malloc_heap_get(void)
+{
+	return &z_malloc_heap;
+}
+
 void *realloc(void *ptr, size_t requested_size)
 {
 	malloc_lock();
@@ -241,6 +241,51 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+/* Per-CPU magazines of fully released buffers, linked through the
+ * node field and touched only with interrupts masked on the owning
+ * CPU, so the common alloc/free cycle skips the pool LIFO (and its
+ * lock) entirely.  Depth is capped: overflow returns to the LIFO so
+ * blocked allocators are never starved for more than a magazine's
+ * worth of buffers.  Pools with a custom destroy callback bypass the
+ * cache, their callback owns the buffer lifecycle.
+ */
+#define NET_BUF_CACHE_DEPTH 4U
+
+static struct net_buf *net_buf_cache_get(struct net_buf_pool *pool)
+{
+	unsigned int key = arch_irq_lock();
+	unsigned int cpu = arch_curr_cpu()->id;
+	struct net_buf *buf = pool->cpu_cache[cpu];
+
+	if (buf != NULL) {
+		pool->cpu_cache[cpu] = (struct net_buf *)buf->node.next;
+		pool->cpu_cache_count[cpu]--;
+	}
+	arch_irq_unlock(key);
+
+	return buf;
+}
+
+static bool net_buf_cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	unsigned int key = arch_irq_lock();
+	unsigned int cpu = arch_curr_cpu()->id;
+	bool cached = false;
+
+	if (pool->cpu_cache_count[cpu] < NET_BUF_CACHE_DEPTH) {
+		buf->node.next = (sys_snode_t *)pool->cpu_cache[cpu];
+		pool->cpu_cache[cpu] = buf;
+		pool->cpu_cache_count[cpu]++;
+		cached = true;
+	}
+	arch_irq_unlock(key);
+
+	return cached;
+}
+#endif /* CONFIG_NET_BUF_CPU_CACHE */
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -258,6 +303,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+	buf = net_buf_cache_get(pool);
+	if (buf != NULL) {
+		goto success;
+	}
+#endif
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -474,6 +526,12 @@ void net_buf_unref(struct net_buf *buf)
 		if (pool->destroy) {
 			pool->destroy(buf);
 		} else {
+#if defined(CONFIG_NET_BUF_CPU_CACHE)
+			if (net_buf_cache_put(pool, buf)) {
+				buf = frags;
+				continue;
+			}
+#endif
 			net_buf_destroy(buf);
 		}
 
@@ -481,6 +539,34 @@ void net_buf_unref(struct net_buf *buf)
 	}
 }
 
+int net_buf_alloc_bulk(struct net_buf_pool *pool, struct net_buf **bufs,
+		       size_t count, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		bufs[i] = net_buf_alloc(pool, timeout);
+		if (bufs[i] == NULL) {
+			net_buf_unref_bulk(bufs, i);
+			return -ENOMEM;
+		}
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	return 0;
+}
+
+void net_buf_unref_bulk(struct net_buf **bufs, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (bufs[i] != NULL) {
+			net_buf_unref(bufs[i]);
+			bufs[i] = NULL;
+		}
+	}
+}
+
 struct net_buf *net_buf_ref(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf);
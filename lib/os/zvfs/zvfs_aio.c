@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Meta Platforms
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/sys/zvfs_aio.h>
+
+static struct k_work_q zvfs_aio_q;
+static K_THREAD_STACK_DEFINE(zvfs_aio_stack, CONFIG_ZVFS_AIO_STACK_SIZE);
+
+static int zvfs_aio_init(void)
+{
+	struct k_work_queue_config cfg = { .name = "zvfs_aio" };
+
+	k_work_queue_start(&zvfs_aio_q, zvfs_aio_stack, K_THREAD_STACK_SIZEOF(zvfs_aio_stack),
+			   CONFIG_ZVFS_AIO_PRIORITY, &cfg);
+
+	return 0;
+}
+SYS_INIT(zvfs_aio_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+static void zvfs_aio_work_handler(struct k_work *work)
+{
+	struct zvfs_aio_req *req = CONTAINER_OF(work, struct zvfs_aio_req, work);
+	const size_t *from_offset = req->use_offset ? &req->offset : NULL;
+
+	if (req->is_write) {
+		req->result = zvfs_write(req->fd, req->buf, req->len, from_offset);
+	} else {
+		req->result = zvfs_read(req->fd, req->buf, req->len, from_offset);
+	}
+
+	/* errno is thread local to this worker; carry it to the submitter */
+	req->error = (req->result < 0) ? errno : 0;
+
+	k_poll_signal_raise(&req->signal, 0);
+}
+
+int zvfs_aio_submit(struct zvfs_aio_req *req)
+{
+	if ((req == NULL) || ((req->buf == NULL) && (req->len != 0U))) {
+		return -EINVAL;
+	}
+
+	if (k_work_is_pending(&req->work)) {
+		return -EBUSY;
+	}
+
+	req->result = 0;
+	req->error = 0;
+	k_work_init(&req->work, zvfs_aio_work_handler);
+	k_poll_signal_init(&req->signal);
+
+	return k_work_submit_to_queue(&zvfs_aio_q, &req->work) < 0 ? -EBUSY : 0;
+}
@@ -148,12 +148,27 @@ static int zvfs_eventfd_write_locked(struct zvfs_eventfd *efd, zvfs_eventfd_t *v
 	}
 
 	/* successful write */
+	zvfs_eventfd_t prev = efd->cnt;
+
 	efd->cnt = result;
 
 	if (efd->cnt == (UINT64_MAX - 1)) {
 		k_poll_signal_reset(&efd->write_sig);
 	}
 
+#if defined(CONFIG_ZVFS_EVENTFD_BATCH_WAKEUP)
+	/* The counter was already nonzero, so readers/pollers have a
+	 * pending signal: this write coalesces into it instead of
+	 * raising (and waking) again.  Consumers observe the summed
+	 * count exactly as before.
+	 */
+	if (prev != 0) {
+		return 0;
+	}
+#else
+	ARG_UNUSED(prev);
+#endif
+
 	k_poll_signal_raise(&efd->read_sig, 0);
 
 	return 0;
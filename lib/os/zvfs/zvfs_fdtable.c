@@ -345,6 +345,20 @@ static ssize_t zvfs_rw(int fd, void *buf, size_t sz, bool is_write, const size_t
 		return -1;
 	}
 
+	/* Pin the entry across the operation with the per-entry atomic
+	 * refcount: the lookup stays lock-free and a concurrent
+	 * close() can no longer release the object out from under the
+	 * I/O; the final unref below performs the deferred release
+	 * instead.  If close won the race before our reference, the
+	 * object is already gone and we bail out.
+	 */
+	(void)z_fd_ref(fd);
+	if (fdtable[fd].obj == NULL || fdtable[fd].vtable == NULL) {
+		z_fd_unref(fd);
+		errno = EBADF;
+		return -1;
+	}
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 
 	prw = supports_pread_pwrite(fdtable[fd].mode);
@@ -387,6 +401,8 @@ static ssize_t zvfs_rw(int fd, void *buf, size_t sz, bool is_write, const size_t
 unlock:
 	k_mutex_unlock(&fdtable[fd].lock);
 
+	z_fd_unref(fd);
+
 	return res;
 }
 
@@ -16,11 +16,46 @@
 
 #define SIGEV_MASK (SIGEV_NONE | SIGEV_SIGNAL | SIGEV_THREAD)
 
+#ifdef CONFIG_POSIX_MQUEUE_PRIORITIES
+#define MQ_PRIO_LEVELS 32
+
+/* The bucket bitmask is one 32-bit word */
+BUILD_ASSERT(CONFIG_POSIX_MQ_PRIO_MAX <= MQ_PRIO_LEVELS,
+	     "CONFIG_POSIX_MQ_PRIO_MAX must not exceed 32");
+
+/* Slot header preceding each message in the preallocated buffer */
+struct mq_slot {
+	sys_snode_t snode;
+	uint32_t prio;
+	uint32_t len;
+	/* message bytes follow */
+};
+
+#define MQ_SLOT_DATA(slot) ((char *)&(slot)[1])
+#define MQ_SLOT_SIZE(msg_size) (sizeof(struct mq_slot) + (msg_size))
+#endif /* CONFIG_POSIX_MQUEUE_PRIORITIES */
+
 typedef struct mqueue_object {
 	sys_snode_t snode;
 	char *mem_buffer;
 	char *mem_obj;
 	struct k_msgq queue;
+#ifdef CONFIG_POSIX_MQUEUE_PRIORITIES
+	/* Priority-bucketed storage replacing the FIFO ring: slots move
+	 * between the free list and one of 32 per-priority buckets,
+	 * with a bitmask giving O(1) highest-priority lookup. The two
+	 * semaphores carry the blocking semantics.
+	 */
+	struct k_spinlock lock;
+	struct k_sem free_slots;
+	struct k_sem used_msgs;
+	sys_slist_t free_list;
+	sys_slist_t buckets[MQ_PRIO_LEVELS];
+	uint32_t bucket_mask;
+	uint32_t max_msgs;
+	uint32_t msg_size;
+	uint32_t used;
+#endif
 	atomic_t ref_count;
 	char *name;
 	struct sigevent not;
@@ -39,9 +74,9 @@ sys_slist_t mq_list = SYS_SLIST_STATIC_INIT(&mq_list);
 
 static mqueue_object *find_in_list(const char *name);
 static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_len,
-			  k_timeout_t timeout);
+			  unsigned int msg_prio, k_timeout_t timeout);
 static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
-			   k_timeout_t timeout);
+			   unsigned int *msg_prio, k_timeout_t timeout);
 static void remove_notification(mqueue_object *msg_queue);
 static void remove_mq(mqueue_object *msg_queue);
 static void *mq_notify_thread(void *arg);
@@ -145,6 +180,32 @@ mqd_t mq_open(const char *name, int oflags, ...)
 
 		strcpy(msg_queue->name, name);
 
+#ifdef CONFIG_POSIX_MQUEUE_PRIORITIES
+		mq_buf_ptr = k_malloc(MQ_SLOT_SIZE(msg_size) * max_msgs);
+		if (mq_buf_ptr != NULL) {
+			(void)memset(mq_buf_ptr, 0, MQ_SLOT_SIZE(msg_size) * max_msgs);
+			msg_queue->mem_buffer = mq_buf_ptr;
+		} else {
+			goto free_mq_buffer;
+		}
+
+		(void)atomic_set(&msg_queue->ref_count, 1);
+
+		msg_queue->max_msgs = max_msgs;
+		msg_queue->msg_size = msg_size;
+		k_sem_init(&msg_queue->free_slots, max_msgs, max_msgs);
+		k_sem_init(&msg_queue->used_msgs, 0, max_msgs);
+		sys_slist_init(&msg_queue->free_list);
+		for (int i = 0; i < MQ_PRIO_LEVELS; i++) {
+			sys_slist_init(&msg_queue->buckets[i]);
+		}
+		for (uint32_t i = 0; i < max_msgs; i++) {
+			struct mq_slot *slot = (struct mq_slot *)(msg_queue->mem_buffer +
+								  i * MQ_SLOT_SIZE(msg_size));
+
+			sys_slist_append(&msg_queue->free_list, &slot->snode);
+		}
+#else
 		mq_buf_ptr = k_malloc(msg_size * max_msgs * sizeof(uint8_t));
 		if (mq_buf_ptr != NULL) {
 			(void)memset(mq_buf_ptr, 0,
@@ -158,6 +219,7 @@ mqd_t mq_open(const char *name, int oflags, ...)
 		/* initialize zephyr message queue */
 		k_msgq_init(&msg_queue->queue, msg_queue->mem_buffer, msg_size,
 			    max_msgs);
+#endif /* CONFIG_POSIX_MQUEUE_PRIORITIES */
 		k_sem_take(&mq_sem, K_FOREVER);
 		sys_slist_append(&mq_list, (sys_snode_t *)&(msg_queue->snode));
 		k_sem_give(&mq_sem);
@@ -243,7 +305,7 @@ int mq_send(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 
-	return send_message(mqd, msg_ptr, msg_len, K_FOREVER);
+	return send_message(mqd, msg_ptr, msg_len, msg_prio, K_FOREVER);
 }
 
 /**
@@ -263,7 +325,7 @@ int mq_timedsend(mqd_t mqdes, const char *msg_ptr, size_t msg_len,
 		return -1;
 	}
 
-	return send_message(mqd, msg_ptr, msg_len,
+	return send_message(mqd, msg_ptr, msg_len, msg_prio,
 			    K_MSEC(timespec_to_timeoutms(CLOCK_REALTIME, abstime)));
 }
 
@@ -279,7 +341,7 @@ int mq_receive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 {
 	mqueue_desc *mqd = (mqueue_desc *)mqdes;
 
-	return receive_message(mqd, msg_ptr, msg_len, K_FOREVER);
+	return receive_message(mqd, msg_ptr, msg_len, msg_prio, K_FOREVER);
 }
 
 /**
@@ -299,7 +361,7 @@ int mq_timedreceive(mqd_t mqdes, char *msg_ptr, size_t msg_len,
 		return -1;
 	}
 
-	return receive_message(mqd, msg_ptr, msg_len,
+	return receive_message(mqd, msg_ptr, msg_len, msg_prio,
 			       K_MSEC(timespec_to_timeoutms(CLOCK_REALTIME, abstime)));
 }
 
@@ -319,11 +381,19 @@ int mq_getattr(mqd_t mqdes, struct mq_attr *mqstat)
 	}
 
 	k_sem_take(&mq_sem, K_FOREVER);
+#ifdef CONFIG_POSIX_MQUEUE_PRIORITIES
+	ARG_UNUSED(attrs);
+	mqstat->mq_flags = mqd->flags;
+	mqstat->mq_maxmsg = mqd->mqueue->max_msgs;
+	mqstat->mq_msgsize = mqd->mqueue->msg_size;
+	mqstat->mq_curmsgs = mqd->mqueue->used;
+#else
 	k_msgq_get_attrs(&mqd->mqueue->queue, &attrs);
 	mqstat->mq_flags = mqd->flags;
 	mqstat->mq_maxmsg = attrs.max_msgs;
 	mqstat->mq_msgsize = attrs.msg_size;
 	mqstat->mq_curmsgs = attrs.used_msgs;
+#endif
 	k_sem_give(&mq_sem);
 	return 0;
 }
@@ -447,7 +517,7 @@ static mqueue_object *find_in_list(const char *name)
 }
 
 static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_len,
-			  k_timeout_t timeout)
+			  unsigned int msg_prio, k_timeout_t timeout)
 {
 	int32_t ret = -1;
 
@@ -460,6 +530,52 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 		timeout = K_NO_WAIT;
 	}
 
+#ifdef CONFIG_POSIX_MQUEUE_PRIORITIES
+	mqueue_object *msgq = mqd->mqueue;
+	struct mq_slot *slot;
+	sys_snode_t *node;
+	k_spinlock_key_t key;
+	bool was_empty;
+
+	if (msg_prio >= CONFIG_POSIX_MQ_PRIO_MAX) {
+		errno = EINVAL;
+		return ret;
+	}
+
+	if (msg_len > msgq->msg_size) {
+		errno = EMSGSIZE;
+		return ret;
+	}
+
+	if (k_sem_take(&msgq->free_slots, timeout) != 0) {
+		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
+		return ret;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+	node = sys_slist_get(&msgq->free_list);
+	__ASSERT_NO_MSG(node != NULL);
+	k_spin_unlock(&msgq->lock, key);
+
+	/* Copy outside the lock; the slot is exclusively ours */
+	slot = CONTAINER_OF(node, struct mq_slot, snode);
+	slot->prio = msg_prio;
+	slot->len = msg_len;
+	memcpy(MQ_SLOT_DATA(slot), msg_ptr, msg_len);
+
+	key = k_spin_lock(&msgq->lock);
+	was_empty = (msgq->used == 0U);
+	sys_slist_append(&msgq->buckets[msg_prio], &slot->snode);
+	msgq->bucket_mask |= BIT(msg_prio);
+	msgq->used++;
+	k_spin_unlock(&msgq->lock, key);
+
+	k_sem_give(&msgq->used_msgs);
+
+	if (was_empty) {
+#else
+	ARG_UNUSED(msg_prio);
+
 	if (msg_len >  mqd->mqueue->queue.msg_size) {
 		errno = EMSGSIZE;
 		return ret;
@@ -473,6 +589,7 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 	}
 
 	if (k_msgq_num_used_get(&mqd->mqueue->queue) - msgq_num > 0) {
+#endif /* CONFIG_POSIX_MQUEUE_PRIORITIES */
 		struct sigevent *sevp = &mqd->mqueue->not;
 
 		if (sevp->sigev_notify == SIGEV_NONE) {
@@ -495,7 +612,7 @@ static int32_t send_message(mqueue_desc *mqd, const char *msg_ptr, size_t msg_le
 }
 
 static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
-			     k_timeout_t timeout)
+			     unsigned int *msg_prio, k_timeout_t timeout)
 {
 	int ret = -1;
 
@@ -504,6 +621,55 @@ static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
 		return ret;
 	}
 
+#ifdef CONFIG_POSIX_MQUEUE_PRIORITIES
+	mqueue_object *msgq = mqd->mqueue;
+	struct mq_slot *slot;
+	sys_snode_t *node;
+	k_spinlock_key_t key;
+	unsigned int prio;
+
+	if (msg_len < msgq->msg_size) {
+		errno = EMSGSIZE;
+		return ret;
+	}
+
+	if ((mqd->flags & O_NONBLOCK) != 0U) {
+		timeout = K_NO_WAIT;
+	}
+
+	if (k_sem_take(&msgq->used_msgs, timeout) != 0) {
+		errno = K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? EAGAIN : ETIMEDOUT;
+		return ret;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+	__ASSERT_NO_MSG(msgq->bucket_mask != 0U);
+	/* Highest non-empty priority bucket in O(1) */
+	prio = 31U - (unsigned int)__builtin_clz(msgq->bucket_mask);
+	node = sys_slist_get(&msgq->buckets[prio]);
+	__ASSERT_NO_MSG(node != NULL);
+	if (sys_slist_is_empty(&msgq->buckets[prio])) {
+		msgq->bucket_mask &= ~BIT(prio);
+	}
+	msgq->used--;
+	k_spin_unlock(&msgq->lock, key);
+
+	/* Copy outside the lock; the slot is exclusively ours */
+	slot = CONTAINER_OF(node, struct mq_slot, snode);
+	memcpy(msg_ptr, MQ_SLOT_DATA(slot), slot->len);
+	ret = (int)slot->len;
+	if (msg_prio != NULL) {
+		*msg_prio = slot->prio;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+	sys_slist_append(&msgq->free_list, &slot->snode);
+	k_spin_unlock(&msgq->lock, key);
+
+	k_sem_give(&msgq->free_slots);
+#else
+	ARG_UNUSED(msg_prio);
+
 	if (msg_len < mqd->mqueue->queue.msg_size) {
 		errno = EMSGSIZE;
 		return ret;
@@ -518,6 +684,7 @@ static int32_t receive_message(mqueue_desc *mqd, char *msg_ptr, size_t msg_len,
 	} else {
 		ret = mqd->mqueue->queue.msg_size;
 	}
+#endif /* CONFIG_POSIX_MQUEUE_PRIORITIES */
 
 	return ret;
 }
@@ -94,15 +94,18 @@ struct k_mutex *to_posix_mutex(pthread_mutex_t *mu)
 		return NULL;
 	}
 
-	/* Record the associated posix_mutex in mu and mark as initialized */
-	*mu = mark_pthread_obj_initialized(bit);
-
-	/* Initialize the posix_mutex */
+	/* Initialize the posix_mutex before publishing the handle in mu,
+	 * so a concurrent lock taking the pool-lock-free path cannot
+	 * observe an associated but uninitialized mutex.
+	 */
 	m = &posix_mutex_pool[bit];
 
 	err = k_mutex_init(m);
 	__ASSERT_NO_MSG(err == 0);
 
+	/* Record the associated posix_mutex in mu and mark as initialized */
+	*mu = mark_pthread_obj_initialized(bit);
+
 	return m;
 }
 
@@ -115,20 +118,44 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 	struct k_mutex *m = NULL;
 	struct k_thread *owner = NULL;
 
-	SYS_SEM_LOCK(&lock) {
-		m = to_posix_mutex(mu);
+	if (*mu != PTHREAD_MUTEX_INITIALIZER) {
+		/* Hot path: the mutex is already associated. The type is
+		 * stable while the mutex exists, and owner/lock_count are
+		 * only meaningful when we are the owner - in which case
+		 * they can only be changed by ourselves - so the global
+		 * pool lock is not needed. It only serializes the lazy
+		 * association below.
+		 */
+		m = get_posix_mutex(*mu);
 		if (m == NULL) {
 			ret = EINVAL;
-			SYS_SEM_LOCK_BREAK;
+		} else {
+			LOG_DBG("Locking mutex %p with timeout %" PRIx64, m,
+				(int64_t)timeout.ticks);
+
+			ret = 0;
+			bit = posix_mutex_to_offset(m);
+			type = posix_mutex_type[bit];
+			owner = m->owner;
+			lock_count = m->lock_count;
 		}
+	} else {
+		SYS_SEM_LOCK(&lock) {
+			m = to_posix_mutex(mu);
+			if (m == NULL) {
+				ret = EINVAL;
+				SYS_SEM_LOCK_BREAK;
+			}
 
-		LOG_DBG("Locking mutex %p with timeout %" PRIx64, m, (int64_t)timeout.ticks);
+			LOG_DBG("Locking mutex %p with timeout %" PRIx64, m,
+				(int64_t)timeout.ticks);
 
-		ret = 0;
-		bit = posix_mutex_to_offset(m);
-		type = posix_mutex_type[bit];
-		owner = m->owner;
-		lock_count = m->lock_count;
+			ret = 0;
+			bit = posix_mutex_to_offset(m);
+			type = posix_mutex_type[bit];
+			owner = m->owner;
+			lock_count = m->lock_count;
+		}
 	}
 
 	if (ret != 0) {
@@ -45,6 +45,64 @@ static void setup_bundle_data(sys_bitarray_t *bitarray,
 	}
 }
 
+
+#ifdef CONFIG_SYS_BITARRAY_SUMMARY
+/* Summary invariant: a set summary bit implies the corresponding
+ * bundle is fully set (the converse may lag, clearing is always
+ * safe).  Bitarrays created without summary storage carry a NULL
+ * summary pointer and skip the maintenance entirely.
+ */
+static void summary_update_range(sys_bitarray_t *bitarray, size_t sidx,
+				 size_t eidx)
+{
+	if (bitarray->summary == NULL) {
+		return;
+	}
+
+	for (size_t idx = sidx; idx <= eidx; idx++) {
+		if (~bitarray->bundles[idx] == 0U) {
+			bitarray->summary[idx / 32U] |= BIT(idx % 32U);
+		} else {
+			bitarray->summary[idx / 32U] &= ~BIT(idx % 32U);
+		}
+	}
+}
+
+/* Starting at bit_idx, skip over bundles the summary marks fully set;
+ * whole summary words (32 fully set bundles) are skipped in one test.
+ */
+static size_t summary_skip_full(sys_bitarray_t *bitarray, size_t bit_idx)
+{
+	size_t idx = bit_idx / bundle_bitness(bitarray);
+
+	if (bitarray->summary == NULL) {
+		return bit_idx;
+	}
+
+	while (idx < bitarray->num_bundles) {
+		if (((idx % 32U) == 0U) &&
+		    (bitarray->summary[idx / 32U] == UINT32_MAX)) {
+			idx += 32U;
+			continue;
+		}
+		if ((bitarray->summary[idx / 32U] & BIT(idx % 32U)) == 0U) {
+			break;
+		}
+		idx++;
+	}
+
+	/* only ever move forward, and only to a bundle boundary */
+	if ((idx * bundle_bitness(bitarray)) > bit_idx) {
+		bit_idx = idx * bundle_bitness(bitarray);
+	}
+
+	return bit_idx;
+}
+#else
+#define summary_update_range(bitarray, sidx, eidx) do { } while (false)
+#define summary_skip_full(bitarray, bit_idx) (bit_idx)
+#endif /* CONFIG_SYS_BITARRAY_SUMMARY */
+
 /*
  * Find out if the bits in a region is all set or all clear.
  *
@@ -208,6 +266,8 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 			}
 		}
 	}
+
+	summary_update_range(bitarray, bd->sidx, bd->eidx);
 }
 
 int sys_bitarray_popcount_region(sys_bitarray_t *bitarray, size_t num_bits, size_t offset,
@@ -309,6 +369,8 @@ int sys_bitarray_xor(sys_bitarray_t *dst, sys_bitarray_t *other, size_t num_bits
 		}
 	}
 
+	summary_update_range(dst, bd.sidx, bd.eidx);
+
 	ret = 0;
 
 out:
@@ -337,6 +399,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] |= BIT(off);
+	summary_update_range(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -365,6 +428,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	summary_update_range(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -441,6 +505,7 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	}
 
 	bitarray->bundles[idx] |= BIT(off);
+	summary_update_range(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -480,6 +545,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	summary_update_range(bitarray, idx, idx);
 
 	ret = 0;
 
@@ -521,6 +587,7 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 			ret = -ENOSPC;
 		} else {
 			bitarray->bundles[0] |= BIT_MASK(num_bits) << off;
+			summary_update_range(bitarray, 0, 0);
 			*offset = off;
 			ret = 0;
 		}
@@ -563,10 +630,10 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 			break;
 		}
 
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
+		/* Fast-forward to the bit just after the mismatched
+		 * bit, then over any run of fully set bundles.
 		 */
-		bit_idx = mismatch + 1;
+		bit_idx = summary_skip_full(bitarray, mismatch + 1);
 	}
 
 out:
@@ -18,6 +18,9 @@
 
 #include <zephyr/data/json.h>
 
+/* field_name_len is a 7-bit field in struct json_obj_descr */
+#define JSON_MAX_FIELD_NAME_LEN 127
+
 struct json_obj_key_value {
 	const char *key;
 	size_t key_len;
@@ -90,12 +93,103 @@ static int peek(struct json_lexer *lex)
 	return chr;
 }
 
+#ifdef CONFIG_JSON_LIBRARY_SWAR_LEXER
+/* SWAR helpers: process four bytes per iteration in the lexer hot
+ * loops. swar_has_zero() has the usual semantics: non-zero when any
+ * byte of the word is zero.
+ */
+static inline uint32_t swar_has_zero(uint32_t v)
+{
+	return (v - 0x01010101U) & ~v & 0x80808080U;
+}
+
+/* Advance over string bytes that are neither '"', '\' nor NUL; the
+ * scalar loop keeps handling exactly those three, so accepted inputs
+ * are unchanged.
+ */
+static void swar_skip_string_plain(struct json_lexer *lex)
+{
+	while ((lex->end - lex->pos) >= (ptrdiff_t)sizeof(uint32_t)) {
+		uint32_t w;
+
+		memcpy(&w, lex->pos, sizeof(w));
+
+		if (swar_has_zero(w) != 0U ||
+		    swar_has_zero(w ^ 0x22222222U) != 0U || /* '"' */
+		    swar_has_zero(w ^ 0x5c5c5c5cU) != 0U) { /* '\' */
+			break;
+		}
+
+		lex->pos += sizeof(uint32_t);
+	}
+}
+
+/* Advance over whole words of ASCII space, the dominant whitespace in
+ * indented documents; mixed whitespace falls back to the scalar path.
+ */
+static void swar_skip_spaces(struct json_lexer *lex)
+{
+	while ((lex->end - lex->pos) >= (ptrdiff_t)sizeof(uint32_t)) {
+		uint32_t w;
+
+		memcpy(&w, lex->pos, sizeof(w));
+
+		if (w != 0x20202020U) {
+			break;
+		}
+
+		lex->pos += sizeof(uint32_t);
+	}
+}
+
+/* Advance over whole words of decimal digits */
+static void swar_skip_digits(struct json_lexer *lex)
+{
+	while ((lex->end - lex->pos) >= (ptrdiff_t)sizeof(uint32_t)) {
+		uint32_t w;
+		uint32_t x;
+
+		memcpy(&w, lex->pos, sizeof(w));
+
+		x = w ^ 0x30303030U;
+
+		/* Digits have a zero high nibble and a low nibble below
+		 * ten; the nibble additions cannot carry across bytes.
+		 */
+		if (((x & 0xf0f0f0f0U) != 0U) ||
+		    (((x + 0x06060606U) & 0x10101010U) != 0U)) {
+			break;
+		}
+
+		lex->pos += sizeof(uint32_t);
+	}
+}
+#else
+static inline void swar_skip_string_plain(struct json_lexer *lex)
+{
+	ARG_UNUSED(lex);
+}
+
+static inline void swar_skip_spaces(struct json_lexer *lex)
+{
+	ARG_UNUSED(lex);
+}
+
+static inline void swar_skip_digits(struct json_lexer *lex)
+{
+	ARG_UNUSED(lex);
+}
+#endif /* CONFIG_JSON_LIBRARY_SWAR_LEXER */
+
 static void *lexer_string(struct json_lexer *lex)
 {
 	ignore(lex);
 
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		swar_skip_string_plain(lex);
+		chr = next(lex);
 
 		if (chr == '\0') {
 			emit(lex, JSON_TOK_ERROR);
@@ -200,7 +294,10 @@ static void *lexer_null(struct json_lexer *lex)
 static void *lexer_number(struct json_lexer *lex)
 {
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		swar_skip_digits(lex);
+		chr = next(lex);
 
 		if (isdigit(chr) != 0 || chr == '.' || chr == 'e' || chr == '+' || chr == '-') {
 			continue;
@@ -282,6 +379,7 @@ static void *lexer_json(struct json_lexer *lex)
 			__fallthrough;
 		default:
 			if (isspace(chr) != 0) {
+				swar_skip_spaces(lex);
 				ignore(lex);
 				continue;
 			}
@@ -1294,22 +1392,35 @@ static int json_escape_internal(const char *str,
 				json_append_bytes_t append_bytes,
 				void *data)
 {
-	const char *cur;
+	const char *cur = str;
 	int ret = 0;
 
 	if (str == NULL) {
 		return ret;
 	}
 
-	for (cur = str; ret == 0 && *cur; cur++) {
-		char escaped = escape_as(*cur);
+	while (ret == 0 && *cur) {
+		/* Emit the longest run of characters needing no escaping
+		 * as a single append instead of one call per byte.
+		 */
+		const char *run = cur;
 
-		if (escaped) {
-			char bytes[2] = { '\\', escaped };
+		while (*cur && escape_as(*cur) == 0) {
+			cur++;
+		}
+
+		if (cur != run) {
+			ret = append_bytes(run, (size_t)(cur - run), data);
+			if (ret != 0) {
+				break;
+			}
+		}
+
+		if (*cur) {
+			char bytes[2] = { '\\', escape_as(*cur) };
 
 			ret = append_bytes(bytes, 2, data);
-		} else {
-			ret = append_bytes(cur, 1, data);
+			cur++;
 		}
 	}
 
@@ -1736,6 +1847,37 @@ static int encode(const struct json_obj_descr *descr, const void *val,
 	}
 }
 
+/* Emit the quoted field name and the following colon in one append
+ * when the name contains nothing that needs escaping, which is the
+ * case for essentially every descriptor; the field name length fits
+ * seven bits, bounding the stack buffer.
+ */
+static int field_name_encode(const struct json_obj_descr *descr,
+			     json_append_bytes_t append_bytes, void *data)
+{
+	char buf[1 + JSON_MAX_FIELD_NAME_LEN + 2];
+	size_t len = descr->field_name_len;
+	int ret;
+
+	for (size_t i = 0; i < len; i++) {
+		if (escape_as(descr->field_name[i]) != 0) {
+			ret = str_encode(descr->field_name, append_bytes, data);
+			if (ret < 0) {
+				return ret;
+			}
+
+			return append_bytes(":", 1, data);
+		}
+	}
+
+	buf[0] = '"';
+	memcpy(&buf[1], descr->field_name, len);
+	buf[1 + len] = '"';
+	buf[2 + len] = ':';
+
+	return append_bytes(buf, len + 3, data);
+}
+
 int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 		    const void *val, json_append_bytes_t append_bytes,
 		    void *data)
@@ -1749,12 +1891,7 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 	}
 
 	for (i = 0; i < descr_len; i++) {
-		ret = str_encode(descr[i].field_name, append_bytes, data);
-		if (ret < 0) {
-			return ret;
-		}
-
-		ret = append_bytes(":", 1, data);
+		ret = field_name_encode(&descr[i], append_bytes, data);
 		if (ret < 0) {
 			return ret;
 		}
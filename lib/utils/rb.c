@@ -225,6 +225,9 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 		tree->root = node;
 		tree->max_depth = 1;
 		set_color(node, BLACK);
+#ifdef CONFIG_RBTREE_CACHED_MIN
+		tree->min_node = node;
+#endif
 		return;
 	}
 
@@ -254,6 +257,12 @@ void rb_insert(struct rbtree *tree, struct rbnode *node)
 	/* We may have rotated up into the root! */
 	tree->root = stack[0];
 	CHECK(is_black(tree->root));
+
+#ifdef CONFIG_RBTREE_CACHED_MIN
+	if ((tree->min_node != NULL) && tree->lessthan_fn(node, tree->min_node)) {
+		tree->min_node = node;
+	}
+#endif
 }
 
 /* Called for a node N (at the top of the stack) which after a
@@ -372,6 +381,13 @@ static void fix_missing_black(struct rbnode **stack, int stacksz,
 void rb_remove(struct rbtree *tree, struct rbnode *node)
 {
 	struct rbnode *tmp;
+
+#ifdef CONFIG_RBTREE_CACHED_MIN
+	/* Invalidate lazily; the next rb_get_min() recomputes it */
+	if (tree->min_node == node) {
+		tree->min_node = NULL;
+	}
+#endif
 #ifdef CONFIG_MISRA_SANE
 	struct rbnode **stack = &tree->iter_stack[0];
 #else
@@ -604,3 +620,59 @@ struct rbnode *z_rb_foreach_next(struct rbtree *tree, struct _rb_foreach *f)
 	f->top--;
 	return (f->top >= 0) ? f->stack[f->top] : NULL;
 }
+
+/* Recursively links the middle element of a sorted slice as the
+ * subtree root. Nodes on the deepest level of the (generally
+ * incomplete) tree are colored red, everything else black, which
+ * keeps the black height uniform on every path.
+ */
+static struct rbnode *build_sorted_subtree(struct rbnode **nodes, size_t count,
+					   int depth, int red_depth)
+{
+	struct rbnode *node;
+	size_t mid;
+
+	if (count == 0U) {
+		return NULL;
+	}
+
+	mid = count / 2U;
+	node = nodes[mid];
+
+	set_child(node, 0U, NULL);
+	set_child(node, 1U, NULL);
+	set_color(node, (depth == red_depth) ? RED : BLACK);
+
+	set_child(node, 0U, build_sorted_subtree(nodes, mid, depth + 1, red_depth));
+	set_child(node, 1U, build_sorted_subtree(&nodes[mid + 1U], count - mid - 1U,
+						 depth + 1, red_depth));
+
+	return node;
+}
+
+void rb_build_sorted(struct rbtree *tree, struct rbnode **nodes, size_t count)
+{
+	int red_depth = -1;
+	size_t n = count;
+
+	/* Depth of the deepest level, which is the only one that may be
+	 * partially filled and therefore gets colored red.
+	 */
+	while (n != 0U) {
+		red_depth++;
+		n >>= 1;
+	}
+
+	tree->root = build_sorted_subtree(nodes, count, 0, red_depth);
+	tree->max_depth = (count == 0U) ? 0 : (red_depth + 1);
+
+	/* A single node lands on the "deepest" level and would come out
+	 * red; the root must always be black.
+	 */
+	if (tree->root != NULL) {
+		set_color(tree->root, BLACK);
+	}
+#ifdef CONFIG_RBTREE_CACHED_MIN
+	tree->min_node = (count == 0U) ? NULL : nodes[0];
+#endif
+}
@@ -241,3 +241,32 @@ bool timespec_normalize(struct timespec *ts)
 
 	return true;
 }
+
+void timeutil_mulshift_init(struct timeutil_mulshift *ms, uint32_t to_hz, uint32_t from_hz)
+{
+	/* to_hz * 2^32 always fits in 64 bits for 32-bit frequencies,
+	 * and the fixed 32-bit scale makes the split multiply in
+	 * timeutil_mulshift_convert() exact.
+	 */
+	ms->mult = (((uint64_t)to_hz << 32) + (from_hz / 2U)) / from_hz;
+}
+
+uint64_t timeutil_mulshift_convert(const struct timeutil_mulshift *ms, uint64_t t)
+{
+	uint32_t m_lo = (uint32_t)ms->mult;
+	uint32_t m_hi = (uint32_t)(ms->mult >> 32);
+	uint32_t t_lo = (uint32_t)t;
+	uint32_t t_hi = (uint32_t)(t >> 32);
+
+	/* (t * mult) >> 32 via four 32x32 partial products, none of
+	 * which can overflow 64 bits - mult itself exceeds 2^32 for
+	 * every up-conversion, so multiplying it by a 64-bit half of t
+	 * directly would.  Only the low word of t_lo * m_lo falls
+	 * entirely below the shift, so the sum is the exact floor of
+	 * the 96-bit product.
+	 */
+	return (((uint64_t)t_hi * m_hi) << 32) +
+	       ((uint64_t)t_hi * m_lo) +
+	       ((uint64_t)t_lo * m_hi) +
+	       (((uint64_t)t_lo * m_lo) >> 32);
+}
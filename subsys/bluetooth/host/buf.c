@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -115,6 +116,99 @@ NET_BUF_POOL_FIXED_DEFINE(hci_rx_pool, BT_BUF_RX_COUNT, BT_BUF_RX_SIZE,
 			  sizeof(struct bt_conn_rx), hci_rx_pool_destroy);
 #endif /* CONFIG_BT_HCI_ACL_FLOW_CONTROL */
 
+#if defined(CONFIG_BT_BUF_STATS)
+/* High watermark and free count come from the net_buf pool usage
+ * accounting (selected by CONFIG_BT_BUF_STATS); only exhaustion and
+ * wait tracking need to live here.
+ */
+static struct buf_pool_stat {
+	struct net_buf_pool *pool;
+	atomic_t exhaustions;
+	atomic_t total_wait_us;
+	atomic_t max_wait_us;
+} buf_pool_stats[] = {
+#if defined(CONFIG_BT_HCI_ACL_FLOW_CONTROL)
+	{ .pool = &evt_pool },
+	{ .pool = &acl_in_pool },
+#else
+	{ .pool = &hci_rx_pool },
+#endif
+	{ .pool = &sync_evt_pool },
+	{ .pool = &discardable_pool },
+};
+
+static struct buf_pool_stat *stat_for_pool(const struct net_buf_pool *pool)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(buf_pool_stats); i++) {
+		if (buf_pool_stats[i].pool == pool) {
+			return &buf_pool_stats[i];
+		}
+	}
+
+	__ASSERT_NO_MSG(false);
+	return &buf_pool_stats[0];
+}
+
+static struct net_buf *buf_alloc_tracked(struct net_buf_pool *pool, k_timeout_t timeout)
+{
+	struct net_buf *buf = net_buf_alloc(pool, K_NO_WAIT);
+
+	if (buf == NULL) {
+		struct buf_pool_stat *stat = stat_for_pool(pool);
+		uint32_t start;
+		uint32_t wait_us;
+
+		atomic_inc(&stat->exhaustions);
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return NULL;
+		}
+
+		start = k_cycle_get_32();
+		buf = net_buf_alloc(pool, timeout);
+		wait_us = k_cyc_to_us_near32(k_cycle_get_32() - start);
+
+		atomic_add(&stat->total_wait_us, wait_us);
+		/* benign race: a concurrent larger maximum only makes this
+		 * store a no-op worth of inaccuracy
+		 */
+		if (wait_us > (uint32_t)atomic_get(&stat->max_wait_us)) {
+			atomic_set(&stat->max_wait_us, wait_us);
+		}
+	}
+
+	return buf;
+}
+
+int bt_buf_stats_get(size_t index, struct bt_buf_pool_stats *stats)
+{
+	const struct buf_pool_stat *stat;
+	const struct net_buf_pool *pool;
+
+	if (index >= ARRAY_SIZE(buf_pool_stats)) {
+		return -ENOENT;
+	}
+
+	stat = &buf_pool_stats[index];
+	pool = stat->pool;
+
+	stats->name = pool->name;
+	stats->capacity = pool->buf_count;
+	stats->max_used = pool->max_used;
+	stats->free = (uint16_t)atomic_get(&pool->avail_count);
+	stats->exhaustions = (uint32_t)atomic_get(&stat->exhaustions);
+	stats->total_wait_us = (uint32_t)atomic_get(&stat->total_wait_us);
+	stats->max_wait_us = (uint32_t)atomic_get(&stat->max_wait_us);
+
+	return 0;
+}
+#else
+static inline struct net_buf *buf_alloc_tracked(struct net_buf_pool *pool, k_timeout_t timeout)
+{
+	return net_buf_alloc(pool, timeout);
+}
+#endif /* CONFIG_BT_BUF_STATS */
+
 struct net_buf *bt_buf_get_rx(enum bt_buf_type type, k_timeout_t timeout)
 {
 	struct net_buf *buf;
@@ -128,12 +222,12 @@ struct net_buf *bt_buf_get_rx(enum bt_buf_type type, k_timeout_t timeout)
 
 #if defined(CONFIG_BT_HCI_ACL_FLOW_CONTROL)
 	if (type == BT_BUF_EVT) {
-		buf = net_buf_alloc(&evt_pool, timeout);
+		buf = buf_alloc_tracked(&evt_pool, timeout);
 	} else {
-		buf = net_buf_alloc(&acl_in_pool, timeout);
+		buf = buf_alloc_tracked(&acl_in_pool, timeout);
 	}
 #else
-	buf = net_buf_alloc(&hci_rx_pool, timeout);
+	buf = buf_alloc_tracked(&hci_rx_pool, timeout);
 #endif
 	if (buf) {
 		net_buf_add_u8(buf, bt_buf_type_to_h4(type));
@@ -162,12 +256,12 @@ struct net_buf *bt_buf_get_evt(uint8_t evt, bool discardable,
 #endif /* CONFIG_BT_CONN || CONFIG_BT_ISO */
 	case BT_HCI_EVT_CMD_STATUS:
 	case BT_HCI_EVT_CMD_COMPLETE:
-		buf = net_buf_alloc(&sync_evt_pool, timeout);
+		buf = buf_alloc_tracked(&sync_evt_pool, timeout);
 		break;
 	default:
 		if (discardable) {
 			/* Discardable, decided in Host-side HCI Transport driver. */
-			buf = net_buf_alloc(&discardable_pool, timeout);
+			buf = buf_alloc_tracked(&discardable_pool, timeout);
 		} else {
 			return bt_buf_get_rx(BT_BUF_EVT, timeout);
 		}
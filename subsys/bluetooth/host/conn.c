@@ -64,7 +64,17 @@
 #define LOG_LEVEL CONFIG_BT_CONN_LOG_LEVEL
 LOG_MODULE_REGISTER(bt_conn);
 
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+/* Lock-free free-context pool: contexts are pushed back from the TX
+ * notify thread and connection cleanup, and popped by the single TX
+ * processor. The counter is incremented only after a fully linked
+ * push, so a non-zero count proves a pop can succeed.
+ */
+static struct mpsc free_tx = MPSC_INIT(free_tx);
+static atomic_t free_tx_avail;
+#else
 K_FIFO_DEFINE(free_tx);
+#endif
 
 #if defined(CONFIG_BT_CONN_TX_NOTIFY_WQ)
 static struct k_work_q conn_tx_workq;
@@ -207,7 +217,12 @@ static struct bt_conn_tx iso_tx[CONFIG_BT_ISO_TX_BUF_COUNT];
 int bt_conn_iso_init(void)
 {
 	for (size_t i = 0; i < ARRAY_SIZE(iso_tx); i++) {
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+		mpsc_push(&free_tx, &iso_tx[i].free_node);
+		atomic_inc(&free_tx_avail);
+#else
 		k_fifo_put(&free_tx, &iso_tx[i]);
+#endif
 	}
 
 	return 0;
@@ -275,7 +290,12 @@ static void tx_free(struct bt_conn_tx *tx)
 	LOG_DBG("%p", tx);
 	tx->cb = NULL;
 	tx->user_data = NULL;
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+	mpsc_push(&free_tx, &tx->free_node);
+	atomic_inc(&free_tx_avail);
+#else
 	k_fifo_put(&free_tx, tx);
+#endif
 }
 
 #if defined(CONFIG_BT_CONN_TX)
@@ -512,12 +532,35 @@ void bt_conn_recv(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 
 static bool dont_have_tx_context(struct bt_conn *conn)
 {
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+	return atomic_get(&free_tx_avail) == 0;
+#else
 	return k_fifo_is_empty(&free_tx);
+#endif
 }
 
 static struct bt_conn_tx *conn_tx_alloc(void)
 {
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+	struct bt_conn_tx *ret = NULL;
+	struct mpsc_node *node;
+
+	if (atomic_get(&free_tx_avail) != 0) {
+		/* A non-zero count guarantees a fully pushed node, but the
+		 * pop can transiently fail while another CPU is inside the
+		 * irq-locked window of mpsc_push(); that window is a few
+		 * instructions, so spin it out.
+		 */
+		do {
+			node = mpsc_pop(&free_tx);
+		} while (node == NULL);
+
+		atomic_dec(&free_tx_avail);
+		ret = CONTAINER_OF(node, struct bt_conn_tx, free_node);
+	}
+#else
 	struct bt_conn_tx *ret = k_fifo_get(&free_tx, K_NO_WAIT);
+#endif
 
 	LOG_DBG("%p", ret);
 
@@ -4426,10 +4469,17 @@ int bt_conn_init(void)
 {
 	int err, i;
 
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+	for (i = 0; i < ARRAY_SIZE(conn_tx); i++) {
+		mpsc_push(&free_tx, &conn_tx[i].free_node);
+		atomic_inc(&free_tx_avail);
+	}
+#else
 	k_fifo_init(&free_tx);
 	for (i = 0; i < ARRAY_SIZE(conn_tx); i++) {
 		k_fifo_put(&free_tx, &conn_tx[i]);
 	}
+#endif
 
 	bt_att_init();
 
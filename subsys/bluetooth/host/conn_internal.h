@@ -20,6 +20,9 @@
 #include <zephyr/kernel.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/sys/atomic.h>
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+#include <zephyr/sys/mpsc_lockfree.h>
+#endif
 #include <zephyr/sys/slist.h>
 #include <zephyr/sys/util_macro.h>
 #include <zephyr/sys_clock.h>
@@ -196,6 +199,11 @@ typedef void (*bt_conn_tx_cb_t)(struct bt_conn *conn, void *user_data, int err);
 struct bt_conn_tx {
 	sys_snode_t node;
 
+#if defined(CONFIG_BT_CONN_TX_LOCKFREE)
+	/* Link in the lock-free free-context pool */
+	struct mpsc_node free_node;
+#endif
+
 	bt_conn_tx_cb_t cb;
 	void *user_data;
 };
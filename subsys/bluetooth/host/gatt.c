@@ -65,6 +65,15 @@ LOG_MODULE_REGISTER(bt_gatt);
 
 static uint16_t last_static_handle;
 
+#if defined(CONFIG_BT_GATT_STATIC_ATTR_INDEX)
+/* attr_index[h - 1] is the static attribute with handle h. Filled once at
+ * initialization (static services never unregister) and left disabled when
+ * the static database does not fit the table.
+ */
+static const struct bt_gatt_attr *attr_index[CONFIG_BT_GATT_STATIC_ATTR_INDEX_SIZE];
+static bool attr_index_valid;
+#endif
+
 /* Persistent storage format for GATT CCC */
 struct ccc_store {
 	uint16_t handle;
@@ -886,11 +895,37 @@ static void db_hash_store(void)
 #endif	/* CONFIG_BT_SETTINGS */
 }
 
+#if defined(CONFIG_BT_GATT_DB_HASH_CHUNKED)
+/* Continuation state for chunked hash generation: the open CMAC
+ * operation and the next handle to hash. chunk_next == 0 means no
+ * chunked run is in progress.
+ */
+static struct gen_hash_state db_hash_chunk_state;
+static uint16_t db_hash_chunk_next;
+
+/* Bumped on every database mutation; a chunked run that observes a
+ * different value than it started with restarts from scratch instead
+ * of publishing a hash computed over a mix of old and new contents.
+ * The chunk state itself is only ever touched from the work handler.
+ */
+static atomic_t db_hash_db_gen;
+static uint32_t db_hash_chunk_gen;
+
+static void db_hash_chunk_abort(void);
+#endif
+
 static void db_hash_gen(void)
 {
 	uint8_t key[16] = {};
 	struct gen_hash_state state;
 
+#if defined(CONFIG_BT_GATT_DB_HASH_CHUNKED)
+	/* A synchronous generation supersedes any half-done chunked run;
+	 * drop its operation and key so they do not leak.
+	 */
+	db_hash_chunk_abort();
+#endif
+
 	if (db_hash_setup(&state, key) != 0) {
 		return;
 	}
@@ -917,14 +952,8 @@ static void db_hash_gen(void)
 
 static void sc_indicate(uint16_t start, uint16_t end);
 
-static void do_db_hash(void)
+static void db_hash_post(bool new_hash)
 {
-	bool new_hash = !atomic_test_bit(gatt_sc.flags, DB_HASH_VALID);
-
-	if (new_hash) {
-		db_hash_gen();
-	}
-
 #if defined(CONFIG_BT_SETTINGS)
 	bool hash_loaded_from_settings =
 		atomic_test_bit(gatt_sc.flags, DB_HASH_LOAD);
@@ -980,13 +1009,127 @@ static void do_db_hash(void)
 		set_all_change_unaware();
 		db_hash_store();
 	}
+#else
+	ARG_UNUSED(new_hash);
 #endif /* defined(CONFIG_BT_SETTINGS) */
 }
 
+static void do_db_hash(void)
+{
+	bool new_hash = !atomic_test_bit(gatt_sc.flags, DB_HASH_VALID);
+
+	if (new_hash) {
+		db_hash_gen();
+	}
+
+	db_hash_post(new_hash);
+}
+
+#if defined(CONFIG_BT_GATT_DB_HASH_CHUNKED)
+/* Number of handles hashed per work invocation. Each chunk runs briefly
+ * on the system workqueue and reschedules itself, so other queued work
+ * interleaves instead of waiting out the whole database.
+ */
+#define DB_HASH_CHUNK_HANDLES 64
+
+static uint16_t db_max_handle(void)
+{
+	uint16_t max_handle = last_static_handle;
+
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+	sys_snode_t *tail = sys_slist_peek_tail(&db);
+
+	if (tail != NULL) {
+		struct bt_gatt_service *last_svc =
+			CONTAINER_OF(tail, struct bt_gatt_service, node);
+
+		max_handle = MAX(max_handle,
+				 last_svc->attrs[last_svc->attr_count - 1].handle);
+	}
+#endif /* CONFIG_BT_GATT_DYNAMIC_DB */
+
+	return max_handle;
+}
+
+static void db_hash_chunk_abort(void)
+{
+	if (db_hash_chunk_next != 0U) {
+		(void)psa_mac_abort(&db_hash_chunk_state.operation);
+		(void)psa_destroy_key(db_hash_chunk_state.key);
+		db_hash_chunk_next = 0U;
+	}
+}
+
+static void db_hash_process(struct k_work *work)
+{
+	uint16_t max_handle;
+	uint16_t chunk_end;
+
+	if (atomic_test_bit(gatt_sc.flags, DB_HASH_VALID)) {
+		/* Hash already valid (e.g. generated synchronously by a
+		 * characteristic read); only the settings bookkeeping runs.
+		 */
+		db_hash_post(false);
+		return;
+	}
+
+	if ((db_hash_chunk_next != 0U) &&
+	    ((uint32_t)atomic_get(&db_hash_db_gen) != db_hash_chunk_gen)) {
+		/* Database changed under the partial run */
+		db_hash_chunk_abort();
+	}
+
+	if (db_hash_chunk_next == 0U) {
+		uint8_t key[16] = {};
+
+		db_hash_chunk_gen = (uint32_t)atomic_get(&db_hash_db_gen);
+
+		if (db_hash_setup(&db_hash_chunk_state, key) != 0) {
+			return;
+		}
+
+		db_hash_chunk_next = 0x0001;
+	}
+
+	max_handle = db_max_handle();
+	chunk_end = MIN(max_handle,
+			db_hash_chunk_next + (DB_HASH_CHUNK_HANDLES - 1));
+
+	bt_gatt_foreach_attr(db_hash_chunk_next, chunk_end, gen_hash_m,
+			     &db_hash_chunk_state);
+
+	if (chunk_end < max_handle) {
+		db_hash_chunk_next = chunk_end + 1U;
+		k_work_reschedule(&db_hash.work, K_NO_WAIT);
+		return;
+	}
+
+	db_hash_chunk_next = 0U;
+
+	if (db_hash_finish(&db_hash_chunk_state) != 0) {
+		return;
+	}
+
+	if ((uint32_t)atomic_get(&db_hash_db_gen) != db_hash_chunk_gen) {
+		/* The last chunk raced a database change: discard the
+		 * result and start over.
+		 */
+		k_work_reschedule(&db_hash.work, K_NO_WAIT);
+		return;
+	}
+
+	/* See db_hash_gen() for the endianness rationale */
+	sys_mem_swap(db_hash.hash, sizeof(db_hash.hash));
+	atomic_set_bit(gatt_sc.flags, DB_HASH_VALID);
+
+	db_hash_post(true);
+}
+#else
 static void db_hash_process(struct k_work *work)
 {
 	do_db_hash();
 }
+#endif /* CONFIG_BT_GATT_DB_HASH_CHUNKED */
 
 static ssize_t db_hash_read(struct bt_conn *conn,
 			    const struct bt_gatt_attr *attr,
@@ -1543,6 +1686,20 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+#if defined(CONFIG_BT_GATT_STATIC_ATTR_INDEX)
+	if (last_static_handle <= ARRAY_SIZE(attr_index)) {
+		uint16_t handle = 0;
+
+		STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
+			for (size_t i = 0; i < svc->attr_count; i++) {
+				attr_index[handle++] = &svc->attrs[i];
+			}
+		}
+
+		attr_index_valid = true;
+	}
+#endif
 }
 
 void bt_gatt_init(void)
@@ -1559,7 +1716,7 @@ void bt_gatt_init(void)
 	/* Submit work to Generate initial hash as there could be static
 	 * services already in the database.
 	 */
-	if (IS_ENABLED(CONFIG_BT_LONG_WQ)) {
+	if (IS_ENABLED(CONFIG_BT_LONG_WQ) && !IS_ENABLED(CONFIG_BT_GATT_DB_HASH_CHUNKED)) {
 		bt_long_wq_schedule(&db_hash.work, DB_HASH_TIMEOUT);
 	} else {
 		k_work_schedule(&db_hash.work, DB_HASH_TIMEOUT);
@@ -1647,7 +1804,11 @@ static void db_changed(void)
 
 	atomic_clear_bit(gatt_sc.flags, DB_HASH_VALID);
 
-	if (IS_ENABLED(CONFIG_BT_LONG_WQ)) {
+#if defined(CONFIG_BT_GATT_DB_HASH_CHUNKED)
+	atomic_inc(&db_hash_db_gen);
+#endif
+
+	if (IS_ENABLED(CONFIG_BT_LONG_WQ) && !IS_ENABLED(CONFIG_BT_GATT_DB_HASH_CHUNKED)) {
 		bt_long_wq_reschedule(&db_hash.work, DB_HASH_TIMEOUT);
 	} else {
 		k_work_reschedule(&db_hash.work, DB_HASH_TIMEOUT);
@@ -1908,6 +2069,54 @@ static uint8_t get_service_handles(const struct bt_gatt_attr *attr,
 	return BT_GATT_ITER_CONTINUE;
 }
 
+#if defined(CONFIG_BT_GATT_ATTR_HANDLE_CACHE)
+/* Lazily filled attr -> handle map for static service attributes, whose
+ * handle is otherwise recomputed by walking every registered static service
+ * on each lookup - once per bt_gatt_notify() on the notification path.
+ * Entries are write-once (static attributes never unregister): the handle
+ * is stored before the pointer is published, so a reader that observes a
+ * matching pointer always reads the handle that belongs to it. Colliding
+ * attributes simply keep using the full lookup.
+ */
+static struct {
+	atomic_ptr_t attr;
+	uint16_t handle;
+} handle_cache[CONFIG_BT_GATT_ATTR_HANDLE_CACHE_SIZE];
+
+static inline size_t handle_cache_pos(const struct bt_gatt_attr *attr)
+{
+	return ((uintptr_t)attr / sizeof(struct bt_gatt_attr)) % ARRAY_SIZE(handle_cache);
+}
+
+static uint16_t handle_cache_lookup(const struct bt_gatt_attr *attr)
+{
+	size_t pos = handle_cache_pos(attr);
+
+	if (atomic_ptr_get(&handle_cache[pos].attr) == (void *)attr) {
+		return handle_cache[pos].handle;
+	}
+
+	return 0;
+}
+
+static struct k_spinlock handle_cache_lock;
+
+static void handle_cache_store(const struct bt_gatt_attr *attr, uint16_t handle)
+{
+	size_t pos = handle_cache_pos(attr);
+
+	/* Serialize writers so a losing store cannot pair its handle with
+	 * the winning attribute pointer; this is the cache-miss path only.
+	 */
+	K_SPINLOCK(&handle_cache_lock) {
+		if (atomic_ptr_get(&handle_cache[pos].attr) == NULL) {
+			handle_cache[pos].handle = handle;
+			atomic_ptr_set(&handle_cache[pos].attr, (void *)attr);
+		}
+	}
+}
+#endif /* CONFIG_BT_GATT_ATTR_HANDLE_CACHE */
+
 uint16_t bt_gatt_attr_get_handle(const struct bt_gatt_attr *attr)
 {
 	uint16_t handle = 1;
@@ -1920,6 +2129,15 @@ uint16_t bt_gatt_attr_get_handle(const struct bt_gatt_attr *attr)
 		return attr->handle;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_HANDLE_CACHE)
+	handle = handle_cache_lookup(attr);
+	if (handle) {
+		return handle;
+	}
+
+	handle = 1;
+#endif
+
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
 		/* Skip ahead if start is not within service attributes array */
 		if ((attr < &static_svc->attrs[0]) ||
@@ -1930,6 +2148,8 @@ uint16_t bt_gatt_attr_get_handle(const struct bt_gatt_attr *attr)
 
 		for (size_t i = 0; i < static_svc->attr_count; i++, handle++) {
 			if (attr == &static_svc->attrs[i]) {
+				IF_ENABLED(CONFIG_BT_GATT_ATTR_HANDLE_CACHE,
+					   (handle_cache_store(attr, handle);))
 				return handle;
 			}
 		}
@@ -2120,6 +2340,25 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
+#if defined(CONFIG_BT_GATT_STATIC_ATTR_INDEX)
+		if (attr_index_valid) {
+			uint16_t end = MIN(end_handle, last_static_handle);
+
+			/* Start directly at the requested handle instead of
+			 * walking every static service up to it.
+			 */
+			for (handle = MAX(start_handle, 1); handle <= end; handle++) {
+				if (gatt_foreach_iter(attr_index[handle - 1],
+						      handle, start_handle,
+						      end_handle, uuid,
+						      attr_data, &num_matches,
+						      func, user_data) ==
+				    BT_GATT_ITER_STOP) {
+					return;
+				}
+			}
+		} else {
+#endif
 		STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
 			/* Skip ahead if start is not within service handles */
 			if (handle + static_svc->attr_count < start_handle) {
@@ -2138,6 +2377,9 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 				}
 			}
 		}
+#if defined(CONFIG_BT_GATT_STATIC_ATTR_INDEX)
+		}
+#endif
 	}
 
 	/* Iterate over dynamic db */
@@ -196,16 +196,46 @@ struct event_handler {
 	void (*handler)(struct net_buf *buf);
 };
 
+#if defined(CONFIG_BT_HCI_EVT_DIRECT_DISPATCH)
+/* The handler tables become sparse arrays indexed directly by event
+ * (or LE meta sub-event) code, so dispatch is a constant-time lookup
+ * instead of a scan over every registered handler.
+ */
+#define EVENT_HANDLER(_evt, _handler, _min_len) \
+[_evt] = { \
+	.event = _evt, \
+	.handler = _handler, \
+	.min_len = _min_len, \
+}
+#else
 #define EVENT_HANDLER(_evt, _handler, _min_len) \
 { \
 	.event = _evt, \
 	.handler = _handler, \
 	.min_len = _min_len, \
 }
+#endif /* CONFIG_BT_HCI_EVT_DIRECT_DISPATCH */
 
 static int handle_event_common(uint8_t event, struct net_buf *buf,
 			       const struct event_handler *handlers, size_t num_handlers)
 {
+#if defined(CONFIG_BT_HCI_EVT_DIRECT_DISPATCH)
+	const struct event_handler *handler;
+
+	if ((event >= num_handlers) || (handlers[event].handler == NULL)) {
+		return -EOPNOTSUPP;
+	}
+
+	handler = &handlers[event];
+
+	if (buf->len < handler->min_len) {
+		LOG_ERR("Too small (%u bytes) event 0x%02x", buf->len, event);
+		return -EINVAL;
+	}
+
+	handler->handler(buf);
+	return 0;
+#else
 	size_t i;
 
 	for (i = 0; i < num_handlers; i++) {
@@ -225,6 +255,7 @@ static int handle_event_common(uint8_t event, struct net_buf *buf,
 	}
 
 	return -EOPNOTSUPP;
+#endif /* CONFIG_BT_HCI_EVT_DIRECT_DISPATCH */
 }
 
 static void handle_event(uint8_t event, struct net_buf *buf, const struct event_handler *handlers,
@@ -658,6 +689,8 @@ static void hci_num_completed_packets(struct net_buf *buf)
 			continue;
 		}
 
+		bool completed = false;
+
 		while (count--) {
 			sys_snode_t *node;
 
@@ -680,7 +713,14 @@ static void hci_num_completed_packets(struct net_buf *buf)
 			__ASSERT_NO_MSG(atomic_get(&conn->in_ll));
 			atomic_dec(&conn->in_ll);
 
-			/* TX context free + callback happens in there */
+			completed = true;
+		}
+
+		/* TX context free + callbacks happen in there. One pass
+		 * drains everything moved above, so notify once per handle
+		 * instead of once per completed packet.
+		 */
+		if (completed) {
 			bt_conn_tx_notify(conn, false);
 		}
 
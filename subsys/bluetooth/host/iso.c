@@ -1000,6 +1000,128 @@ int bt_iso_chan_send_ts(struct bt_iso_chan *chan, struct net_buf *buf, uint16_t
 	return conn_iso_send(iso_conn, buf, BT_ISO_TS_PRESENT);
 }
 
+#if defined(CONFIG_BT_ISO_TX_PACER)
+static uint32_t iso_chan_tx_interval(const struct bt_iso_chan *chan)
+{
+	const struct bt_iso_info *info = &chan->iso->iso.info;
+
+	switch (info->type) {
+#if defined(CONFIG_BT_ISO_UNICAST)
+	case BT_ISO_CHAN_TYPE_CENTRAL:
+		return info->unicast.central.sdu_interval;
+	case BT_ISO_CHAN_TYPE_PERIPHERAL:
+		return info->unicast.peripheral.sdu_interval;
+#endif /* CONFIG_BT_ISO_UNICAST */
+#if defined(CONFIG_BT_ISO_BROADCASTER)
+	case BT_ISO_CHAN_TYPE_BROADCASTER:
+		return info->broadcaster.sdu_interval;
+#endif /* CONFIG_BT_ISO_BROADCASTER */
+	default:
+		return BT_ISO_SDU_INTERVAL_UNKNOWN;
+	}
+}
+
+static void iso_pacer_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_iso_tx_pacer *pacer = CONTAINER_OF(dwork, struct bt_iso_tx_pacer, work);
+	struct net_buf *buf;
+	int err;
+
+	buf = k_fifo_get(&pacer->fifo, K_NO_WAIT);
+	if (buf == NULL) {
+		/* Going idle: this point is only reached one full interval
+		 * after the last transmission, so an immediate restart
+		 * cannot violate the pacing. Re-check the queue after
+		 * clearing the flag to close the race with a concurrent
+		 * deposit that saw the pacer still active.
+		 */
+		atomic_clear(&pacer->active);
+
+		if (!k_fifo_is_empty(&pacer->fifo) &&
+		    (atomic_set(&pacer->active, 1) == 0)) {
+			(void)k_work_schedule(&pacer->work, K_NO_WAIT);
+		}
+
+		return;
+	}
+
+	/* Rearm before sending so a concurrent deposit cannot slip in an
+	 * immediate execution between the send and the rearm.
+	 */
+	(void)k_work_schedule(&pacer->work, K_USEC(pacer->interval_us));
+
+	err = bt_iso_chan_send(pacer->chan, buf, pacer->seq_num);
+	if (err != 0) {
+		LOG_WRN("Paced send on chan %p failed (err %d), dropping SDU", pacer->chan, err);
+		net_buf_unref(buf);
+	}
+
+	pacer->seq_num++;
+}
+
+int bt_iso_chan_pacer_init(struct bt_iso_chan *chan, struct bt_iso_tx_pacer *pacer)
+{
+	uint32_t interval;
+
+	CHECKIF(chan == NULL || pacer == NULL) {
+		return -EINVAL;
+	}
+
+	if (chan->state != BT_ISO_STATE_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	if (!chan->iso->iso.info.can_send) {
+		return -EINVAL;
+	}
+
+	interval = iso_chan_tx_interval(chan);
+	if (interval == BT_ISO_SDU_INTERVAL_UNKNOWN) {
+		return -EINVAL;
+	}
+
+	k_fifo_init(&pacer->fifo);
+	k_work_init_delayable(&pacer->work, iso_pacer_work);
+	pacer->chan = chan;
+	atomic_clear(&pacer->active);
+	pacer->interval_us = interval;
+	pacer->seq_num = 0U;
+
+	return 0;
+}
+
+int bt_iso_chan_send_paced(struct bt_iso_tx_pacer *pacer, struct net_buf *buf)
+{
+	CHECKIF(pacer == NULL || buf == NULL) {
+		return -EINVAL;
+	}
+
+	k_fifo_put(&pacer->fifo, buf);
+
+	/* Kick the pacer only when it is idle; an idle pacer has not sent
+	 * for at least one interval, so firing immediately keeps the pace.
+	 */
+	if (atomic_set(&pacer->active, 1) == 0) {
+		(void)k_work_schedule(&pacer->work, K_NO_WAIT);
+	}
+
+	return 0;
+}
+
+void bt_iso_chan_pacer_flush(struct bt_iso_tx_pacer *pacer)
+{
+	struct net_buf *buf;
+
+	(void)k_work_cancel_delayable(&pacer->work);
+	atomic_clear(&pacer->active);
+
+	while ((buf = k_fifo_get(&pacer->fifo, K_NO_WAIT)) != NULL) {
+		net_buf_unref(buf);
+	}
+}
+#endif /* CONFIG_BT_ISO_TX_PACER */
+
 #if defined(CONFIG_BT_ISO_CENTRAL) || defined(CONFIG_BT_ISO_BROADCASTER)
 static bool valid_chan_io_qos(const struct bt_iso_chan_io_qos *io_qos, bool is_tx,
 			      bool is_broadcast, bool advanced)
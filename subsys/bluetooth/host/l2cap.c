@@ -2555,6 +2555,7 @@ int bt_l2cap_chan_recv_complete(struct bt_l2cap_chan *chan, struct net_buf *buf)
 	return 0;
 }
 
+#if !defined(CONFIG_BT_L2CAP_RX_SEG_CHAIN)
 static struct net_buf *l2cap_alloc_frag(k_timeout_t timeout, void *user_data)
 {
 	struct bt_l2cap_le_chan *chan = user_data;
@@ -2569,6 +2570,7 @@ static struct net_buf *l2cap_alloc_frag(k_timeout_t timeout, void *user_data)
 
 	return frag;
 }
+#endif /* !CONFIG_BT_L2CAP_RX_SEG_CHAIN */
 
 static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 				   struct net_buf *buf, uint16_t seg)
@@ -2602,7 +2604,11 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 	uint16_t len;
 	uint16_t seg = 0U;
 
+#if defined(CONFIG_BT_L2CAP_RX_SEG_CHAIN)
+	len = (uint16_t)net_buf_frags_len(chan->_sdu);
+#else
 	len = chan->_sdu->len;
+#endif
 	if (len) {
 		memcpy(&seg, net_buf_user_data(chan->_sdu), sizeof(seg));
 	}
@@ -2619,6 +2625,14 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 
 	LOG_DBG("chan %p seg %d len %u", chan, seg, buf->len);
 
+#if defined(CONFIG_BT_L2CAP_RX_SEG_CHAIN)
+	/* Chain a reference to the PDU buffer instead of copying its payload
+	 * into the SDU buffer. The fragment keeps the RX buffer alive until
+	 * the application releases the SDU.
+	 */
+	net_buf_frag_add(chan->_sdu, net_buf_ref(buf));
+	len += buf->len;
+#else
 	/* Append received segment to SDU */
 	len = net_buf_append_bytes(chan->_sdu, buf->len, buf->data, K_NO_WAIT,
 				   l2cap_alloc_frag, chan);
@@ -2628,7 +2642,10 @@ static void l2cap_chan_le_recv_seg(struct bt_l2cap_le_chan *chan,
 		return;
 	}
 
-	if (chan->_sdu->len < chan->_sdu_len) {
+	len = chan->_sdu->len;
+#endif /* CONFIG_BT_L2CAP_RX_SEG_CHAIN */
+
+	if (len < chan->_sdu_len) {
 		/* Give more credits if remote has run out of them, this
 		 * should only happen if the remote cannot fully utilize the
 		 * MPS for some reason.
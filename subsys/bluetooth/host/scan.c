@@ -619,6 +619,100 @@ static uint8_t get_adv_props_legacy(uint8_t evt_type)
 	}
 }
 
+#if defined(CONFIG_BT_SCAN_FILTER)
+struct scan_filter_ad_ctx {
+	const struct bt_le_scan_filter *filter;
+	bool type_found;
+	bool uuid_found;
+};
+
+static bool scan_filter_ad_cb(struct bt_data *data, void *user_data)
+{
+	struct scan_filter_ad_ctx *ctx = user_data;
+	const struct bt_le_scan_filter *filter = ctx->filter;
+
+	if ((filter->ad_type != 0U) && (data->type == filter->ad_type)) {
+		ctx->type_found = true;
+	}
+
+	if (filter->uuid16 != 0U) {
+		if ((data->type == BT_DATA_UUID16_ALL) || (data->type == BT_DATA_UUID16_SOME)) {
+			for (uint8_t i = 0U; (i + 1U) < data->data_len; i += 2U) {
+				if (sys_get_le16(&data->data[i]) == filter->uuid16) {
+					ctx->uuid_found = true;
+					break;
+				}
+			}
+		} else if ((data->type == BT_DATA_SVC_DATA16) && (data->data_len >= 2U) &&
+			   (sys_get_le16(data->data) == filter->uuid16)) {
+			ctx->uuid_found = true;
+		}
+	}
+
+	/* Stop parsing as soon as every enabled criterion matched */
+	return ((filter->ad_type != 0U) && !ctx->type_found) ||
+	       ((filter->uuid16 != 0U) && !ctx->uuid_found);
+}
+
+static bool scan_filter_match(struct bt_le_scan_filter *filter, const bt_addr_le_t *addr,
+			      const struct bt_le_scan_recv_info *info,
+			      struct net_buf_simple *buf, uint16_t len)
+{
+	if ((filter->rssi_min != 0) && (info->rssi < filter->rssi_min)) {
+		return false;
+	}
+
+	if ((filter->ad_type != 0U) || (filter->uuid16 != 0U)) {
+		struct scan_filter_ad_ctx ctx = {
+			.filter = filter,
+		};
+		struct net_buf_simple_state state;
+
+		net_buf_simple_save(buf, &state);
+		buf->len = len;
+		bt_data_parse(buf, scan_filter_ad_cb, &ctx);
+		net_buf_simple_restore(buf, &state);
+
+		if (((filter->ad_type != 0U) && !ctx.type_found) ||
+		    ((filter->uuid16 != 0U) && !ctx.uuid_found)) {
+			return false;
+		}
+	}
+
+	/* Deduplicate last so only reports passing the cheaper checks
+	 * consume cache slots.
+	 */
+	if (filter->dedup_ttl_ms != 0U) {
+		uint32_t now = k_uptime_get_32();
+		size_t victim = 0U;
+		uint32_t victim_expire = UINT32_MAX;
+
+		for (size_t i = 0U; i < ARRAY_SIZE(filter->_dedup); i++) {
+			if ((filter->_dedup[i].expire != 0U) &&
+			    !bt_addr_le_cmp(&filter->_dedup[i].addr, addr)) {
+				if ((int32_t)(filter->_dedup[i].expire - now) > 0) {
+					return false;
+				}
+
+				victim = i;
+				victim_expire = 0U;
+				break;
+			}
+
+			if (filter->_dedup[i].expire < victim_expire) {
+				victim = i;
+				victim_expire = filter->_dedup[i].expire;
+			}
+		}
+
+		bt_addr_le_copy(&filter->_dedup[victim].addr, addr);
+		filter->_dedup[victim].expire = MAX(now + filter->dedup_ttl_ms, 1U);
+	}
+
+	return true;
+}
+#endif /* CONFIG_BT_SCAN_FILTER */
+
 static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 			struct net_buf_simple *buf, uint16_t len)
 {
@@ -665,6 +759,12 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&scan_cbs, listener, next, node) {
 		if (listener->recv) {
+#if defined(CONFIG_BT_SCAN_FILTER)
+			if ((listener->filter != NULL) &&
+			    !scan_filter_match(listener->filter, &id_addr, info, buf, len)) {
+				continue;
+			}
+#endif
 			net_buf_simple_save(buf, &state);
 
 			buf->len = len;
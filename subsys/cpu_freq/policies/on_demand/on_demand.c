@@ -12,6 +12,11 @@
 
 LOG_MODULE_REGISTER(cpu_freq_policy_on_demand, CONFIG_CPU_FREQ_LOG_LEVEL);
 
+/* Transition latency telemetry, readable via cpu_freq_on_demand_stats_get() */
+static uint32_t transition_count;
+static uint32_t transition_cycles_last;
+static uint32_t transition_cycles_max;
+
 const struct pstate *soc_pstates[] = {
 	DT_FOREACH_CHILD_STATUS_OKAY_SEP(DT_PATH(performance_states), PSTATE_DT_GET, (,))
 };
@@ -65,23 +70,40 @@ int cpu_freq_policy_select_pstate(const struct pstate **pstate_out)
 
 	LOG_DBG("CPU%d Load: %d%%", cpu_id, cpu_load);
 
-	for (int i = 0; i < soc_pstates_count; i++) {
-		const struct pstate *state = soc_pstates[i];
+	size_t idx = soc_pstates_count - 1;
+
+	for (size_t i = 0; i < soc_pstates_count; i++) {
+		if (cpu_load >= soc_pstates[i]->load_threshold) {
+			idx = i;
+			break;
+		}
+	}
 
-		if (cpu_load >= state->load_threshold) {
-			*pstate_out = state;
-			LOG_DBG("On-Demand Policy: Selected P-state "
-				"%d with load_threshold=%d%%", i,
-				state->load_threshold);
-			return 0;
+#if CONFIG_CPU_FREQ_ON_DEMAND_DOWN_SAMPLES > 1
+	/* Hysteresis: step toward lower performance only after the load
+	 * has voted for it over consecutive intervals; step up
+	 * immediately so bursts get their clocks without delay.
+	 */
+	static uint8_t down_votes[CONFIG_MP_MAX_NUM_CPUS];
+	static size_t last_idx[CONFIG_MP_MAX_NUM_CPUS];
+
+	if (idx > last_idx[cpu_id]) {
+		down_votes[cpu_id]++;
+		if (down_votes[cpu_id] < CONFIG_CPU_FREQ_ON_DEMAND_DOWN_SAMPLES) {
+			idx = last_idx[cpu_id];
+		} else {
+			down_votes[cpu_id] = 0;
 		}
+	} else {
+		down_votes[cpu_id] = 0;
 	}
 
-	/* No threshold matched: select the last P-state (lowest performance) */
-	*pstate_out = soc_pstates[soc_pstates_count - 1];
-	LOG_DBG("On-Demand Policy: No threshold matched for CPU load %d%%;"
-		"selecting last P-state (load_threshold=%d%%)",
-		cpu_load, soc_pstates[soc_pstates_count - 1]->load_threshold);
+	last_idx[cpu_id] = idx;
+#endif /* CONFIG_CPU_FREQ_ON_DEMAND_DOWN_SAMPLES > 1 */
+
+	*pstate_out = soc_pstates[idx];
+	LOG_DBG("On-Demand Policy: Selected P-state %u with load_threshold=%d%%",
+		(unsigned int)idx, soc_pstates[idx]->load_threshold);
 
 	return 0;
 }
@@ -122,7 +144,16 @@ const struct pstate *cpu_freq_policy_pstate_set(const struct pstate *state)
 	k_spin_unlock(&lock, key);
 #endif
 
-	rv = cpu_freq_pstate_set(state);
+	{
+		uint32_t start = k_cycle_get_32();
+
+		rv = cpu_freq_pstate_set(state);
+
+		transition_cycles_last = k_cycle_get_32() - start;
+		transition_cycles_max = MAX(transition_cycles_max, transition_cycles_last);
+		transition_count++;
+	}
+
 	if (rv != 0) {
 		LOG_ERR("Failed to set P-state: %d", rv);
 		return NULL;
@@ -130,3 +161,16 @@ const struct pstate *cpu_freq_policy_pstate_set(const struct pstate *state)
 
 	return state;
 }
+
+void cpu_freq_on_demand_stats_get(uint32_t *count, uint32_t *last_cycles, uint32_t *max_cycles)
+{
+	if (count != NULL) {
+		*count = transition_count;
+	}
+	if (last_cycles != NULL) {
+		*last_cycles = transition_cycles_last;
+	}
+	if (max_cycles != NULL) {
+		*max_cycles = transition_cycles_max;
+	}
+}
@@ -11,7 +11,7 @@ uint32_t __weak crc32_ieee(const uint8_t *data, size_t len)
 	return crc32_ieee_update(0x0, data, len);
 }
 
-uint32_t __weak crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+uint32_t z_crc32_ieee_sw_update(uint32_t crc, const uint8_t *data, size_t len)
 {
 	/* crc table generated from polynomial 0xedb88320 */
 	static const uint32_t table[16] = {
@@ -31,3 +31,8 @@ uint32_t __weak crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
 
 	return (~crc);
 }
+
+uint32_t __weak crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	return z_crc32_ieee_sw_update(crc, data, len);
+}
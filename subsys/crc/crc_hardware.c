@@ -17,6 +17,13 @@ LOG_MODULE_REGISTER(crc, CONFIG_CRC_LOG_LEVEL);
 
 static const struct device *const crc_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_crc));
 
+/* Software fallbacks for buffers too small to amortize the device
+ * round-trip (see CONFIG_CRC_HW_MIN_LEN).
+ */
+uint32_t z_crc32_ieee_sw_update(uint32_t crc, const uint8_t *data, size_t len);
+uint32_t z_crc32_c_sw(uint32_t crc, const uint8_t *data, size_t len, bool first_pkt,
+		      bool last_pkt);
+
 static int crc_operation(const struct device *const dev, struct crc_ctx *ctx, const uint8_t *src,
 			 size_t len)
 {
@@ -306,6 +313,10 @@ uint32_t crc32_c(uint32_t crc, const uint8_t *buf, size_t len, bool first_pkt, b
 {
 	int ret;
 
+	if (len < CONFIG_CRC_HW_MIN_LEN) {
+		return z_crc32_c_sw(crc, buf, len, first_pkt, last_pkt);
+	}
+
 	if (first_pkt) {
 		crc = CRC32_C_INIT_VAL;
 	}
@@ -332,6 +343,10 @@ uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *buf, size_t len)
 {
 	int ret;
 
+	if (len < CONFIG_CRC_HW_MIN_LEN) {
+		return z_crc32_ieee_sw_update(crc, buf, len);
+	}
+
 	crc = ~crc;
 
 	struct crc_ctx ctx = {
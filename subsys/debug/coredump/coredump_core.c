@@ -152,6 +152,35 @@ static void process_coredump_dev_memory(const struct device *dev)
 
 void process_memory_region_list(struct k_thread *current)
 {
+	/* Regions are written most-valuable first, so a dump truncated by
+	 * a slow backend (or cut short by the watchdog) still contains
+	 * what a debugger needs: the faulting thread and interrupt stack,
+	 * then the other threads, and the bulk linker RAM regions last.
+	 */
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS
+	/*
+	 * Content of _kernel.threads not being modified during dump
+	 * capture so no need to lock z_thread_monitor_lock.
+	 */
+	struct k_thread *thread;
+
+	if (current != NULL) {
+		dump_thread(current, true);
+	}
+
+	/* Also add interrupt stack, in case error occurred in an interrupt */
+	char *irq_stack = _kernel.cpus[0].irq_stack;
+	uintptr_t start_addr = POINTER_TO_UINT(irq_stack) - CONFIG_ISR_STACK_SIZE;
+
+	coredump_memory_dump(start_addr, POINTER_TO_UINT(irq_stack));
+
+	for (thread = _kernel.threads; thread; thread = thread->next_thread) {
+		if (thread != current) {
+			dump_thread(thread, false);
+		}
+	}
+#endif /* CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS */
+
 #ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_LINKER_RAM
 	unsigned int idx = 0;
 
@@ -169,24 +198,6 @@ void process_memory_region_list(struct k_thread *current)
 	}
 #endif
 
-#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS
-	/*
-	 * Content of _kernel.threads not being modified during dump
-	 * capture so no need to lock z_thread_monitor_lock.
-	 */
-	struct k_thread *thread;
-
-	for (thread = _kernel.threads; thread; thread = thread->next_thread) {
-		dump_thread(thread, thread == current);
-	}
-
-	/* Also add interrupt stack, in case error occurred in an interrupt */
-	char *irq_stack = _kernel.cpus[0].irq_stack;
-	uintptr_t start_addr = POINTER_TO_UINT(irq_stack) - CONFIG_ISR_STACK_SIZE;
-
-	coredump_memory_dump(start_addr, POINTER_TO_UINT(irq_stack));
-#endif /* CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS */
-
 #if defined(CONFIG_COREDUMP_DEVICE)
 #define MY_FN(inst) process_coredump_dev_memory(DEVICE_DT_INST_GET(inst));
 	DT_INST_FOREACH_STATUS_OKAY(MY_FN)
@@ -90,6 +90,62 @@ int disk_access_status(const char *pdrv)
 	return rc;
 }
 
+#if defined(CONFIG_DISK_ACCESS_SECTOR_CACHE)
+/* Single hot-sector cache: FAT cluster-chain walks re-read the same
+ * FAT sector once per cluster, turning one media transfer into
+ * dozens.  Caching the last single-sector read serves those repeats
+ * from RAM; writes to the cached sector invalidate it.
+ */
+static struct {
+	struct k_mutex lock;
+	const struct disk_info *disk;
+	uint32_t sector;
+	bool valid;
+	uint8_t data[CONFIG_DISK_ACCESS_SECTOR_CACHE_SIZE];
+} sector_cache = {
+	.lock = Z_MUTEX_INITIALIZER(sector_cache.lock),
+};
+
+static bool sector_cache_get(const struct disk_info *disk, uint8_t *buf,
+			     uint32_t sector)
+{
+	bool hit;
+
+	k_mutex_lock(&sector_cache.lock, K_FOREVER);
+	hit = sector_cache.valid && (sector_cache.disk == disk) &&
+	      (sector_cache.sector == sector);
+	if (hit) {
+		memcpy(buf, sector_cache.data, sizeof(sector_cache.data));
+	}
+	k_mutex_unlock(&sector_cache.lock);
+
+	return hit;
+}
+
+static void sector_cache_put(const struct disk_info *disk, const uint8_t *buf,
+			     uint32_t sector)
+{
+	k_mutex_lock(&sector_cache.lock, K_FOREVER);
+	sector_cache.disk = disk;
+	sector_cache.sector = sector;
+	memcpy(sector_cache.data, buf, sizeof(sector_cache.data));
+	sector_cache.valid = true;
+	k_mutex_unlock(&sector_cache.lock);
+}
+
+static void sector_cache_invalidate(const struct disk_info *disk,
+				    uint32_t start, uint32_t count)
+{
+	k_mutex_lock(&sector_cache.lock, K_FOREVER);
+	if (sector_cache.valid && (sector_cache.disk == disk) &&
+	    (sector_cache.sector >= start) &&
+	    (sector_cache.sector < (start + count))) {
+		sector_cache.valid = false;
+	}
+	k_mutex_unlock(&sector_cache.lock);
+}
+#endif /* CONFIG_DISK_ACCESS_SECTOR_CACHE */
+
 int disk_access_read(const char *pdrv, uint8_t *data_buf,
 		     uint32_t start_sector, uint32_t num_sector)
 {
@@ -98,6 +154,26 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#if defined(CONFIG_DISK_ACCESS_SECTOR_CACHE)
+		uint32_t ssize = 0;
+
+		if ((num_sector == 1U) &&
+		    (disk->ops->ioctl != NULL) &&
+		    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+				      &ssize) == 0) &&
+		    (ssize == CONFIG_DISK_ACCESS_SECTOR_CACHE_SIZE)) {
+			if (sector_cache_get(disk, data_buf, start_sector)) {
+				return 0;
+			}
+
+			rc = disk->ops->read(disk, data_buf, start_sector, 1);
+			if (rc == 0) {
+				sector_cache_put(disk, data_buf, start_sector);
+			}
+
+			return rc;
+		}
+#endif /* CONFIG_DISK_ACCESS_SECTOR_CACHE */
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
 	}
 
@@ -113,6 +189,9 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+#if defined(CONFIG_DISK_ACCESS_SECTOR_CACHE)
+		sector_cache_invalidate(disk, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -155,6 +234,13 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->ioctl != NULL)) {
+#if defined(CONFIG_DISK_ACCESS_SECTOR_CACHE)
+		if ((cmd == DISK_IOCTL_CTRL_INIT) ||
+		    (cmd == DISK_IOCTL_CTRL_DEINIT)) {
+			/* media may change across (de)init cycles */
+			sector_cache_invalidate(disk, 0, UINT32_MAX);
+		}
+#endif
 		switch (cmd) {
 		case DISK_IOCTL_CTRL_INIT:
 			if (disk->refcnt == 0U) {
@@ -49,6 +49,13 @@ struct char_framebuffer {
 	/** Resolution of a framebuffer in pixels in Y direction */
 	uint16_t y_res;
 
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+	/** First damaged pixel row since the last finalize */
+	uint16_t damage_y0;
+	/** One past the last damaged pixel row; y0 >= y1 means clean */
+	uint16_t damage_y1;
+#endif
+
 	/** Number of pixels per tile, typically 8 */
 	uint8_t ppt;
 
@@ -99,6 +106,49 @@ static inline uint8_t get_glyph_byte(uint8_t *glyph_ptr, const struct cfb_font *
  * Draw the monochrome character in the monochrome tiled framebuffer,
  * a byte is interpreted as 8 pixels ordered vertically among each other.
  */
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+/* Only the row span matters: partial flushes transfer full-width row
+ * bands, which is the natural unit of both tiled and row-major
+ * monochrome layouts.
+ */
+static void fb_damage_rows(const struct char_framebuffer *cfb, int32_t y0, int32_t y1)
+{
+	struct char_framebuffer *fb = (struct char_framebuffer *)cfb;
+
+	y0 = CLAMP(y0, 0, (int32_t)fb->y_res);
+	y1 = CLAMP(y1, 0, (int32_t)fb->y_res);
+
+	if (y0 >= y1) {
+		return;
+	}
+
+	if (fb->damage_y0 >= fb->damage_y1) {
+		fb->damage_y0 = (uint16_t)y0;
+		fb->damage_y1 = (uint16_t)y1;
+	} else {
+		fb->damage_y0 = MIN(fb->damage_y0, (uint16_t)y0);
+		fb->damage_y1 = MAX(fb->damage_y1, (uint16_t)y1);
+	}
+}
+
+static void fb_damage_all(const struct char_framebuffer *cfb)
+{
+	fb_damage_rows(cfb, 0, ((struct char_framebuffer *)cfb)->y_res);
+}
+
+static void fb_damage_reset(const struct char_framebuffer *cfb)
+{
+	struct char_framebuffer *fb = (struct char_framebuffer *)cfb;
+
+	fb->damage_y0 = UINT16_MAX;
+	fb->damage_y1 = 0;
+}
+#else
+#define fb_damage_rows(fb, y0, y1) (void)(fb)
+#define fb_damage_all(fb) (void)(fb)
+#define fb_damage_reset(fb) (void)(fb)
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING */
+
 static uint8_t draw_char_vtmono(const struct char_framebuffer *fb,
 				uint8_t c, uint16_t x, uint16_t y,
 				bool draw_bg)
@@ -351,6 +401,7 @@ static int draw_text(const struct device *dev, const char *const str, int16_t x,
 	}
 
 	const size_t len = strlen(str);
+	const int16_t y_start = y;
 
 	for (size_t i = 0; i < len; i++) {
 		if ((x + fptr->width > fb->x_res) && wrap) {
@@ -363,6 +414,9 @@ static int draw_text(const struct device *dev, const char *const str, int16_t x,
 			x += fb->kerning + draw_char_htmono(fb, str[i], x, y, wrap);
 		}
 	}
+
+	fb_damage_rows(fb, y_start, (int32_t)y + fptr->height);
+
 	return 0;
 }
 
@@ -371,6 +425,7 @@ int cfb_draw_point(const struct device *dev, const struct cfb_position *pos)
 	struct char_framebuffer *fb = &char_fb;
 
 	draw_point(fb, pos->x, pos->y);
+	fb_damage_rows(fb, pos->y, pos->y + 1);
 
 	return 0;
 }
@@ -381,6 +436,7 @@ int cfb_draw_line(const struct device *dev, const struct cfb_position *start,
 	struct char_framebuffer *fb = &char_fb;
 
 	draw_line(fb, start->x, start->y, end->x, end->y);
+	fb_damage_rows(fb, MIN(start->y, end->y), MAX(start->y, end->y) + 1);
 
 	return 0;
 }
@@ -394,6 +450,7 @@ int cfb_draw_rect(const struct device *dev, const struct cfb_position *start,
 	draw_line(fb, end->x, start->y, end->x, end->y);
 	draw_line(fb, end->x, end->y, start->x, end->y);
 	draw_line(fb, start->x, end->y, start->x, start->y);
+	fb_damage_rows(fb, MIN(start->y, end->y), MAX(start->y, end->y) + 1);
 
 	return 0;
 }
@@ -425,6 +482,8 @@ int cfb_draw_circle(const struct device *dev, const struct cfb_position *center,
 		x++;
 	}
 
+	fb_damage_rows(fb, (int32_t)center->y - radius, (int32_t)center->y + radius + 1);
+
 	return 0;
 }
 
@@ -450,6 +509,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 		return -EINVAL;
 	}
 
+	fb_damage_rows(fb, y, (int32_t)y + height);
+
 	if ((fb->screen_info & SCREEN_INFO_MONO_VTILED)) {
 		if (x > fb->x_res) {
 			x = fb->x_res;
@@ -543,6 +604,7 @@ int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	fb_damage_all(fb);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -556,6 +618,7 @@ int cfb_framebuffer_invert(const struct device *dev)
 	struct char_framebuffer *fb = &char_fb;
 
 	fb->inverted = !fb->inverted;
+	fb_damage_all(fb);
 
 	return 0;
 }
@@ -572,21 +635,65 @@ int cfb_framebuffer_finalize(const struct device *dev)
 		return -ENODEV;
 	}
 
+	uint16_t y0 = 0;
+	uint16_t height = fb->y_res;
+	const uint8_t *buf = fb->buf;
+	size_t buf_size = fb->size;
+
+#ifdef CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING
+	if (fb->damage_y0 >= fb->damage_y1) {
+		/* Nothing changed since the last transfer */
+		return 0;
+	}
+
+	/* Transfer only the damaged full-width row band. Tiled layouts
+	 * require tile-aligned rows; row-major layouts need byte-aligned
+	 * width, which x_res already satisfies for the supported formats.
+	 */
+	if ((fb->screen_info & SCREEN_INFO_MONO_VTILED) != 0) {
+		y0 = ROUND_DOWN(fb->damage_y0, fb->ppt);
+		height = ROUND_UP(fb->damage_y1, fb->ppt) - y0;
+		buf = fb->buf + (y0 / fb->ppt) * fb->x_res;
+		buf_size = (height / fb->ppt) * fb->x_res;
+	} else {
+		y0 = fb->damage_y0;
+		height = fb->damage_y1 - y0;
+		buf = fb->buf + y0 * (fb->x_res / 8U);
+		buf_size = height * (fb->x_res / 8U);
+	}
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_DAMAGE_TRACKING */
+
 	struct display_buffer_descriptor desc = {
-		.buf_size = fb->size,
+		.buf_size = buf_size,
 		.width = fb->x_res,
-		.height = fb->y_res,
+		.height = height,
 		.pitch = fb->x_res,
 	};
 
 	if ((fb->pixel_format == PIXEL_FORMAT_MONO10) == fb->inverted) {
 		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
+		err = api->write(dev, 0, y0, &desc, buf);
 		cfb_invert(fb);
-		return err;
+	} else {
+		err = api->write(dev, 0, y0, &desc, buf);
 	}
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+	if (err == 0) {
+		fb_damage_reset(fb);
+	}
+
+	return err;
+}
+
+int cfb_framebuffer_invalidate(const struct device *dev)
+{
+	const struct char_framebuffer *fb = &char_fb;
+
+	ARG_UNUSED(dev);
+
+	fb_damage_all(fb);
+
+	return 0;
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -694,6 +801,8 @@ int cfb_framebuffer_init(const struct device *dev)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	/* First finalize transfers the whole (cleared) frame */
+	fb_damage_all(fb);
 
 	return 0;
 }
@@ -86,9 +86,22 @@ int fcb_erase_sector(const struct fcb *fcbp, const struct flash_sector *sector)
 		return -EIO;
 	}
 
+#ifdef CONFIG_FCB_STATS
+	((struct fcb *)fcbp)->f_erase_cnt++;
+#endif
+
 	return 0;
 }
 
+#ifdef CONFIG_FCB_STATS
+void fcb_stats_get(struct fcb *fcbp, uint32_t *erase_cnt,
+		   uint32_t *append_bytes)
+{
+	*erase_cnt = fcbp->f_erase_cnt;
+	*append_bytes = fcbp->f_append_bytes;
+}
+#endif
+
 int fcb_init(int f_area_id, struct fcb *fcbp)
 {
 	struct flash_sector *sector;
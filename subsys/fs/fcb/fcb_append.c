@@ -138,3 +138,46 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	}
 	return 0;
 }
+
+int fcb_append_batch(struct fcb *fcbp, const struct fcb_batch_entry *entries,
+		     size_t cnt)
+{
+	int rc = 0;
+
+	/* One lock acquisition for the whole burst; the element
+	 * format (and per-entry CRC) is unchanged so readers are
+	 * unaffected.
+	 */
+	rc = k_mutex_lock(&fcbp->f_mtx, K_FOREVER);
+	if (rc != 0) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < cnt; i++) {
+		struct fcb_entry loc;
+
+		rc = fcb_append(fcbp, entries[i].len, &loc);
+		if (rc != 0) {
+			break;
+		}
+
+		rc = fcb_flash_write(fcbp, loc.fe_sector, loc.fe_data_off,
+				     entries[i].data, entries[i].len);
+		if (rc != 0) {
+			break;
+		}
+
+		rc = fcb_append_finish(fcbp, &loc);
+		if (rc != 0) {
+			break;
+		}
+
+#ifdef CONFIG_FCB_STATS
+		fcbp->f_append_bytes += entries[i].len;
+#endif
+	}
+
+	(void)k_mutex_unlock(&fcbp->f_mtx);
+
+	return rc;
+}
@@ -173,13 +173,110 @@ static int errno_to_lfs(int error)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
+#if defined(CONFIG_FS_LITTLEFS_FLASH_READ_CACHE)
+/* Small direct-mapped read cache between littlefs and flash_map.
+ * Directory-heavy workloads re-read the same metadata regions
+ * constantly; serving them from RAM avoids repeated flash transfers.
+ * Lines are tagged with the flash area so multiple mounts can share
+ * the cache, and writes/erases invalidate overlapping lines.
+ */
+#define READ_CACHE_LINE_SIZE CONFIG_FS_LITTLEFS_FLASH_READ_CACHE_LINE_SIZE
+#define READ_CACHE_LINES CONFIG_FS_LITTLEFS_FLASH_READ_CACHE_LINES
+
+static struct read_cache_line {
+	const struct flash_area *fa;
+	size_t offset;
+	bool valid;
+	uint8_t data[READ_CACHE_LINE_SIZE];
+} read_cache[READ_CACHE_LINES];
+
+static K_MUTEX_DEFINE(read_cache_lock);
+
+static inline struct read_cache_line *read_cache_line_of(
+	const struct flash_area *fa, size_t aligned_off)
+{
+	size_t idx = (aligned_off / READ_CACHE_LINE_SIZE) % READ_CACHE_LINES;
+
+	ARG_UNUSED(fa);
+	return &read_cache[idx];
+}
+
+static int read_cache_read(const struct flash_area *fa, size_t offset,
+			   uint8_t *buffer, size_t size)
+{
+	int rc = 0;
+
+	k_mutex_lock(&read_cache_lock, K_FOREVER);
+
+	while (size > 0 && rc == 0) {
+		size_t aligned = ROUND_DOWN(offset, READ_CACHE_LINE_SIZE);
+		size_t line_off = offset - aligned;
+		size_t chunk = MIN(size, READ_CACHE_LINE_SIZE - line_off);
+		struct read_cache_line *line = read_cache_line_of(fa, aligned);
+
+		if ((aligned + READ_CACHE_LINE_SIZE) > fa->fa_size) {
+			/* tail of the area: don't read past it */
+			rc = flash_area_read(fa, offset, buffer, chunk);
+			buffer += chunk;
+			offset += chunk;
+			size -= chunk;
+			continue;
+		}
+
+		if (!line->valid || (line->fa != fa) ||
+		    (line->offset != aligned)) {
+			rc = flash_area_read(fa, aligned, line->data,
+					     READ_CACHE_LINE_SIZE);
+			if (rc != 0) {
+				line->valid = false;
+				break;
+			}
+			line->fa = fa;
+			line->offset = aligned;
+			line->valid = true;
+		}
+
+		memcpy(buffer, &line->data[line_off], chunk);
+		buffer += chunk;
+		offset += chunk;
+		size -= chunk;
+	}
+
+	k_mutex_unlock(&read_cache_lock);
+
+	return rc;
+}
+
+static void read_cache_invalidate(const struct flash_area *fa, size_t offset,
+				  size_t size)
+{
+	k_mutex_lock(&read_cache_lock, K_FOREVER);
+
+	for (int i = 0; i < READ_CACHE_LINES; i++) {
+		struct read_cache_line *line = &read_cache[i];
+
+		if (line->valid && (line->fa == fa) &&
+		    (line->offset < (offset + size)) &&
+		    ((line->offset + READ_CACHE_LINE_SIZE) > offset)) {
+			line->valid = false;
+		}
+	}
+
+	k_mutex_unlock(&read_cache_lock);
+}
+#endif /* CONFIG_FS_LITTLEFS_FLASH_READ_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#if defined(CONFIG_FS_LITTLEFS_FLASH_READ_CACHE)
+	int rc = read_cache_read(fa, offset, buffer, size);
+#else
 	int rc = flash_area_read(fa, offset, buffer, size);
+#endif
 
 	return errno_to_lfs(rc);
 }
@@ -192,11 +289,20 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+#if defined(CONFIG_FS_LITTLEFS_FLASH_READ_CACHE)
+	read_cache_invalidate(fa, offset, size);
+#endif
+
 	return errno_to_lfs(rc);
 }
 
 static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 {
+#if defined(CONFIG_FS_LITTLEFS_FLASH_READ_CACHE)
+	read_cache_invalidate(c->context, block * c->block_size,
+			      c->block_size);
+#endif
+
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
 
@@ -22,6 +22,19 @@ static int nvs_ate_valid(struct nvs_fs *fs, uint16_t entry_addr,
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_STATS
+static struct nvs_lookup_cache_stats lookup_cache_stats;
+
+void nvs_lookup_cache_stats_get(struct nvs_lookup_cache_stats *stats)
+{
+	*stats = lookup_cache_stats;
+}
+
+#define NVS_CACHE_STAT_INC(field) (lookup_cache_stats.field++)
+#else
+#define NVS_CACHE_STAT_INC(field) do { } while (false)
+#endif /* CONFIG_NVS_LOOKUP_CACHE_STATS */
+
 static inline size_t nvs_lookup_cache_pos(uint16_t id)
 {
 	uint16_t hash;
@@ -1006,6 +1019,12 @@ int nvs_clear(struct nvs_fs *fs)
 
 int nvs_mount(struct nvs_fs *fs)
 {
+#if defined(CONFIG_NVS_WRITE_CACHE)
+	for (int i = 0; i < CONFIG_NVS_WRITE_CACHE_SLOTS; i++) {
+		fs->wcache[i].len = NVS_WCACHE_FREE;
+	}
+	k_work_init_delayable(&fs->wcache_flush, nvs_wcache_flush_work);
+#endif
 	int rc;
 	struct flash_pages_info info;
 	size_t write_block_size;
@@ -1069,7 +1088,8 @@ int nvs_mount(struct nvs_fs *fs)
 	return 0;
 }
 
-ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+static ssize_t nvs_write_flash(struct nvs_fs *fs, uint16_t id, const void *data,
+			       size_t len)
 {
 	int rc, gc_count;
 	size_t ate_size, data_size;
@@ -1102,8 +1122,10 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		NVS_CACHE_STAT_INC(empty);
 		goto no_cached_entry;
 	}
+	NVS_CACHE_STAT_INC(probes);
 #else
 	wlk_addr = fs->ate_wra;
 #endif
@@ -1211,6 +1233,135 @@ end:
 	return rc;
 }
 
+
+#if defined(CONFIG_NVS_WRITE_CACHE)
+/* Write-behind cache: bursts of nvs_write() coalesce in RAM (multiple
+ * writes to one id collapse to the latest value) and reach flash in
+ * one batch, either on nvs_commit(), when the cache fills, or when
+ * the auto-flush timer expires.  Reads are served write-back
+ * consistent.  The window between write and flush is volatile, which
+ * is the deal this cache offers.
+ */
+#define NVS_WCACHE_FREE UINT16_MAX
+#define NVS_WCACHE_DELETE (UINT16_MAX - 1)
+
+static int nvs_wcache_flush_locked(struct nvs_fs *fs)
+{
+	int rc = 0;
+
+	for (int i = 0; i < CONFIG_NVS_WRITE_CACHE_SLOTS; i++) {
+		struct nvs_wcache_entry *entry = &fs->wcache[i];
+		ssize_t wrc;
+
+		if (entry->len == NVS_WCACHE_FREE) {
+			continue;
+		}
+
+		if (entry->len == NVS_WCACHE_DELETE) {
+			wrc = nvs_write_flash(fs, entry->id, NULL, 0);
+		} else {
+			wrc = nvs_write_flash(fs, entry->id, entry->data,
+					      entry->len);
+		}
+		if (wrc < 0) {
+			rc = (int)wrc;
+		}
+
+		entry->len = NVS_WCACHE_FREE;
+	}
+
+	return rc;
+}
+
+int nvs_commit(struct nvs_fs *fs)
+{
+	int rc;
+
+	if (!fs->ready) {
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	rc = nvs_wcache_flush_locked(fs);
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return rc;
+}
+
+static void nvs_wcache_flush_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nvs_fs *fs = CONTAINER_OF(dwork, struct nvs_fs, wcache_flush);
+
+	(void)nvs_commit(fs);
+}
+
+static struct nvs_wcache_entry *nvs_wcache_slot(struct nvs_fs *fs, uint16_t id)
+{
+	struct nvs_wcache_entry *free_slot = NULL;
+
+	for (int i = 0; i < CONFIG_NVS_WRITE_CACHE_SLOTS; i++) {
+		struct nvs_wcache_entry *entry = &fs->wcache[i];
+
+		if (entry->len == NVS_WCACHE_FREE) {
+			if (free_slot == NULL) {
+				free_slot = entry;
+			}
+		} else if (entry->id == id) {
+			return entry;
+		}
+	}
+
+	return free_slot;
+}
+
+ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	struct nvs_wcache_entry *entry;
+	ssize_t rc = (ssize_t)len;
+
+	if (!fs->ready) {
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	if (len > CONFIG_NVS_WRITE_CACHE_DATA_SIZE) {
+		/* oversized: flush so ordering holds, then go direct */
+		(void)nvs_wcache_flush_locked(fs);
+		rc = nvs_write_flash(fs, id, data, len);
+		goto out;
+	}
+
+	entry = nvs_wcache_slot(fs, id);
+	if (entry == NULL) {
+		(void)nvs_wcache_flush_locked(fs);
+		entry = nvs_wcache_slot(fs, id);
+	}
+
+	entry->id = id;
+	entry->len = (uint16_t)len;
+	if (len > 0) {
+		memcpy(entry->data, data, len);
+	} else {
+		entry->len = NVS_WCACHE_DELETE;
+	}
+
+	k_work_schedule(&fs->wcache_flush,
+			K_MSEC(CONFIG_NVS_WRITE_CACHE_TIMEOUT_MS));
+out:
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return rc;
+}
+#else /* CONFIG_NVS_WRITE_CACHE */
+
+ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	return nvs_write_flash(fs, id, data, len);
+}
+#endif /* CONFIG_NVS_WRITE_CACHE */
+
 int nvs_delete(struct nvs_fs *fs, uint16_t id)
 {
 	return nvs_write(fs, id, NULL, 0);
@@ -1245,6 +1396,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		NVS_CACHE_STAT_INC(empty);
 		rc = -ENOENT;
 		goto err;
 	}
@@ -1316,6 +1468,28 @@ ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len)
 {
 	int rc;
 
+#if defined(CONFIG_NVS_WRITE_CACHE)
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	for (int i = 0; i < CONFIG_NVS_WRITE_CACHE_SLOTS; i++) {
+		struct nvs_wcache_entry *entry = &fs->wcache[i];
+
+		if ((entry->len == NVS_WCACHE_FREE) || (entry->id != id)) {
+			continue;
+		}
+
+		if (entry->len == NVS_WCACHE_DELETE) {
+			k_mutex_unlock(&fs->nvs_lock);
+			return -ENOENT;
+		}
+
+		rc = MIN(len, entry->len);
+		memcpy(data, entry->data, rc);
+		k_mutex_unlock(&fs->nvs_lock);
+		return entry->len;
+	}
+	k_mutex_unlock(&fs->nvs_lock);
+#endif /* CONFIG_NVS_WRITE_CACHE */
+
 	rc = nvs_read_hist(fs, id, data, len, 0);
 	return rc;
 }
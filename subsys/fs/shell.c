@@ -826,6 +826,122 @@ static int cmd_erase_write_test(const struct shell *sh, size_t argc, char **argv
 }
 #endif
 
+#ifdef CONFIG_FILE_SYSTEM_SHELL_BENCH
+#define BENCH_MAX_SAMPLES 256
+
+static uint32_t bench_samples[BENCH_MAX_SAMPLES];
+
+static int bench_cmp_u32(const void *a, const void *b)
+{
+	uint32_t ua = *(const uint32_t *)a;
+	uint32_t ub = *(const uint32_t *)b;
+
+	return (ua > ub) - (ua < ub);
+}
+
+static void bench_report(const struct shell *sh, const char *phase,
+			 size_t nsamples, size_t block_size, uint64_t total_us)
+{
+	uint64_t bytes = (uint64_t)nsamples * block_size;
+
+	qsort(bench_samples, nsamples, sizeof(uint32_t), bench_cmp_u32);
+
+	shell_print(sh, "%s: %zu x %zu B in %llu us (%llu kB/s)",
+		    phase, nsamples, block_size, total_us,
+		    (total_us > 0) ? (bytes * 1000U) / total_us : 0);
+	shell_print(sh, "  latency us: p50=%u p99=%u max=%u",
+		    bench_samples[nsamples / 2],
+		    bench_samples[(nsamples * 99) / 100],
+		    bench_samples[nsamples - 1]);
+}
+
+/* fs bench <path> <block_size> <count> [sync]
+ * Sequential write then sequential read of count blocks, per-op
+ * latency sampled with the cycle counter.
+ */
+static int cmd_bench(const struct shell *sh, size_t argc, char **argv)
+{
+	char path[MAX_PATH_LEN];
+	struct fs_file_t file;
+	uint8_t blk[CONFIG_FILE_SYSTEM_SHELL_BUFFER_SIZE];
+	size_t block_size, count;
+	bool sync_mode = (argc > 4) && (strcmp(argv[4], "sync") == 0);
+	uint64_t total_us;
+	int err;
+
+	create_abs_path(argv[1], path, sizeof(path));
+	block_size = strtoul(argv[2], NULL, 0);
+	count = strtoul(argv[3], NULL, 0);
+
+	if ((block_size == 0) || (block_size > sizeof(blk)) ||
+	    (count == 0) || (count > BENCH_MAX_SAMPLES)) {
+		shell_error(sh,
+			    "block_size must be 1..%zu, count 1..%d",
+			    sizeof(blk), BENCH_MAX_SAMPLES);
+		return -EINVAL;
+	}
+
+	fs_file_t_init(&file);
+	err = fs_open(&file, path, FS_O_CREATE | FS_O_RDWR);
+	if (err != 0) {
+		shell_error(sh, "Failed to open %s (%d)", path, err);
+		return -EIO;
+	}
+
+	/* sequential write */
+	total_us = 0;
+	for (size_t i = 0; i < count; i++) {
+		uint32_t t0 = k_cycle_get_32();
+		uint32_t dt;
+
+		err = fs_write(&file, blk, block_size);
+		if (sync_mode && (err >= 0)) {
+			err = fs_sync(&file);
+		}
+		dt = k_cyc_to_us_near32(k_cycle_get_32() - t0);
+		if (err < 0) {
+			shell_error(sh, "write failed (%d)", err);
+			goto out;
+		}
+
+		bench_samples[i] = dt;
+		total_us += dt;
+	}
+	bench_report(sh, sync_mode ? "seq write+sync" : "seq write",
+		     count, block_size, total_us);
+
+	/* sequential read back */
+	err = fs_seek(&file, 0, FS_SEEK_SET);
+	if (err != 0) {
+		goto out;
+	}
+
+	total_us = 0;
+	for (size_t i = 0; i < count; i++) {
+		uint32_t t0 = k_cycle_get_32();
+		uint32_t dt;
+
+		err = fs_read(&file, blk, block_size);
+		dt = k_cyc_to_us_near32(k_cycle_get_32() - t0);
+		if (err < 0) {
+			shell_error(sh, "read failed (%d)", err);
+			goto out;
+		}
+
+		bench_samples[i] = dt;
+		total_us += dt;
+	}
+	bench_report(sh, "seq read", count, block_size, total_us);
+
+	err = 0;
+out:
+	fs_close(&file);
+	(void)fs_unlink(path);
+
+	return err;
+}
+#endif /* CONFIG_FILE_SYSTEM_SHELL_BENCH */
+
 #ifdef CONFIG_FILE_SYSTEM_SHELL_MOUNT_COMMAND
 
 static char *mntpt_prepare(char *mntpt)
@@ -932,6 +1048,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_fs,
 	SHELL_CMD_ARG(write, NULL, "Write file", cmd_write, 3, 255),
 #ifdef CONFIG_FILE_SYSTEM_SHELL_TEST_COMMANDS
 	SHELL_CMD_ARG(read_test, NULL, "Read file test", cmd_read_test, 2, 2),
+#ifdef CONFIG_FILE_SYSTEM_SHELL_BENCH
+	SHELL_CMD_ARG(bench, NULL,
+		      "Benchmark: bench <path> <block_size> <count> [sync]",
+		      cmd_bench, 4, 1),
+#endif
 	SHELL_CMD_ARG(erase_write_test, NULL, "Erase/write file test", cmd_erase_write_test, 3, 3),
 #endif
 	SHELL_SUBCMD_SET_END
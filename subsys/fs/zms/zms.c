@@ -11,6 +11,9 @@
 #include <inttypes.h>
 #include <zephyr/fs/zms.h>
 #include <zephyr/sys/crc.h>
+#ifdef CONFIG_ZMS_CRC_HW
+#include <zephyr/drivers/crc.h>
+#endif
 #include "zms_priv.h"
 #ifdef CONFIG_ZMS_LOOKUP_CACHE_FOR_SETTINGS
 #include <settings/settings_zms.h>
@@ -147,6 +150,94 @@ static void zms_lookup_cache_invalidate(struct zms_fs *fs, uint32_t sector)
 
 #endif /* CONFIG_ZMS_LOOKUP_CACHE */
 
+#ifdef CONFIG_ZMS_SECTOR_BLOOM
+
+static inline uint32_t zms_sector_bloom_mask(zms_id_t id)
+{
+	uint32_t hash = (uint32_t)id;
+
+#ifdef CONFIG_ZMS_ID_64BIT
+	hash ^= (uint32_t)(id >> 32);
+#endif
+	/* 32-bit integer hash function found by https://github.com/skeeto/hash-prospector. */
+	hash ^= hash >> 16;
+	hash *= 0x7feb352dU;
+	hash ^= hash >> 15;
+	hash *= 0x846ca68bU;
+	hash ^= hash >> 16;
+
+	/* two bits out of 32: ~1.2% false positive rate per ID in a sector
+	 * holding a handful of distinct IDs
+	 */
+	return BIT(hash & 0x1f) | BIT((hash >> 5) & 0x1f);
+}
+
+static inline void zms_sector_bloom_add(struct zms_fs *fs, uint64_t addr, zms_id_t id)
+{
+	if (fs->sector_bloom_enabled) {
+		fs->sector_bloom[SECTOR_NUM(addr)] |= zms_sector_bloom_mask(id);
+	}
+}
+
+static inline void zms_sector_bloom_clear(struct zms_fs *fs, uint32_t sector)
+{
+	if (fs->sector_bloom_enabled) {
+		fs->sector_bloom[sector] = 0;
+	}
+}
+
+static inline bool zms_sector_bloom_may_contain(struct zms_fs *fs, uint64_t addr, zms_id_t id)
+{
+	uint32_t mask;
+
+	if (!fs->sector_bloom_enabled) {
+		return true;
+	}
+
+	mask = zms_sector_bloom_mask(id);
+
+	return (fs->sector_bloom[SECTOR_NUM(addr)] & mask) == mask;
+}
+
+static int zms_sector_bloom_rebuild(struct zms_fs *fs)
+{
+	int rc;
+	uint64_t addr;
+	uint64_t ate_addr;
+	struct zms_ate ate;
+
+	memset(fs->sector_bloom, 0, sizeof(fs->sector_bloom));
+	fs->sector_bloom_enabled = (fs->sector_count <= CONFIG_ZMS_SECTOR_BLOOM_MAX_SECTORS);
+	if (!fs->sector_bloom_enabled) {
+		return 0;
+	}
+
+	/* Mark every ATE reachable by the walk without checking its cycle
+	 * validity: marking a stale entry only adds a false positive, while
+	 * missing a live one would make lookups skip its sector.
+	 */
+	addr = fs->ate_wra;
+	while (true) {
+		ate_addr = addr;
+		rc = zms_prev_ate(fs, &addr, &ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (ate.id != ZMS_HEAD_ID) {
+			zms_sector_bloom_add(fs, ate_addr, ate.id);
+		}
+
+		if (addr == fs->ate_wra) {
+			break;
+		}
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_ZMS_SECTOR_BLOOM */
+
 /* Helper to compute offset given the address */
 static inline off_t zms_addr_to_offset(struct zms_fs *fs, uint64_t addr)
 {
@@ -254,6 +345,11 @@ static int zms_flash_ate_wrt(struct zms_fs *fs, const struct zms_ate *entry)
 	if (entry->id != ZMS_HEAD_ID) {
 		fs->lookup_cache[zms_lookup_cache_pos(entry->id)] = fs->ate_wra;
 	}
+#endif
+#ifdef CONFIG_ZMS_SECTOR_BLOOM
+	if (entry->id != ZMS_HEAD_ID) {
+		zms_sector_bloom_add(fs, fs->ate_wra, entry->id);
+	}
 #endif
 	fs->ate_wra -= zms_al_size(fs, sizeof(struct zms_ate));
 end:
@@ -388,6 +484,9 @@ static int zms_flash_erase_sector(struct zms_fs *fs, uint64_t addr)
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	zms_lookup_cache_invalidate(fs, SECTOR_NUM(addr));
+#endif
+#ifdef CONFIG_ZMS_SECTOR_BLOOM
+	zms_sector_bloom_clear(fs, SECTOR_NUM(addr));
 #endif
 	rc = flash_erase(fs->flash_device, offset, fs->sector_size);
 
@@ -557,6 +656,35 @@ static int zms_validate_closed_sector(struct zms_fs *fs, uint64_t addr, struct z
 	return 0;
 }
 
+#ifdef CONFIG_ZMS_DATA_CRC
+#ifdef CONFIG_ZMS_CRC_HW
+static uint32_t zms_data_crc32(const void *data, size_t len)
+{
+	static const struct device *const crc_hw_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_crc));
+	struct crc_ctx ctx = {
+		.type = CRC32_IEEE,
+		.polynomial = CRC32_IEEE_POLY,
+		.seed = CRC32_IEEE_INIT_VAL,
+		.reversed = CRC_FLAG_REVERSE_INPUT | CRC_FLAG_REVERSE_OUTPUT,
+	};
+
+	if (device_is_ready(crc_hw_dev) && (crc_begin(crc_hw_dev, &ctx) == 0) &&
+	    (crc_update(crc_hw_dev, &ctx, data, len) == 0) &&
+	    (crc_finish(crc_hw_dev, &ctx) == 0)) {
+		return (uint32_t)ctx.result;
+	}
+
+	/* engine not ready or busy: fall back to the software table */
+	return crc32_ieee(data, len);
+}
+#else
+static inline uint32_t zms_data_crc32(const void *data, size_t len)
+{
+	return crc32_ieee(data, len);
+}
+#endif /* CONFIG_ZMS_CRC_HW */
+#endif /* CONFIG_ZMS_DATA_CRC */
+
 /* store an entry in flash */
 static int zms_flash_write_entry(struct zms_fs *fs, zms_id_t id, const void *data, size_t len)
 {
@@ -573,7 +701,7 @@ static int zms_flash_write_entry(struct zms_fs *fs, zms_id_t id, const void *dat
 	if (len > ZMS_DATA_IN_ATE_SIZE) {
 #ifdef CONFIG_ZMS_DATA_CRC
 		/* only compute CRC if data is to be stored outside of entry */
-		entry.data_crc = crc32_ieee(data, len);
+		entry.data_crc = zms_data_crc32(data, len);
 #endif
 		entry.offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
 	} else if ((len > 0) && (len <= ZMS_DATA_IN_ATE_SIZE)) {
@@ -936,6 +1064,19 @@ static int zms_find_ate_with_id(struct zms_fs *fs, zms_id_t id, uint64_t start_a
 	wlk_addr = start_addr;
 
 	do {
+#ifdef CONFIG_ZMS_SECTOR_BLOOM
+		/* Jump straight to the last ATE of the current sector when its
+		 * filter proves the ID cannot be stored there. The sector that
+		 * holds end_addr is excluded so the walk terminator cannot be
+		 * overshot.
+		 */
+		if ((SECTOR_NUM(wlk_addr) != SECTOR_NUM(end_addr)) &&
+		    (SECTOR_OFFSET(wlk_addr) < (fs->sector_size - 3 * fs->ate_size)) &&
+		    !zms_sector_bloom_may_contain(fs, wlk_addr, id)) {
+			wlk_addr = (wlk_addr & ADDR_SECT_MASK) +
+				   (fs->sector_size - 3 * fs->ate_size);
+		}
+#endif
 		wlk_prev_addr = wlk_addr;
 		rc = zms_prev_ate(fs, &wlk_addr, &wlk_ate);
 		if (rc) {
@@ -1447,6 +1588,11 @@ end:
 	if (!rc) {
 		rc = zms_lookup_cache_rebuild(fs);
 	}
+#endif
+#ifdef CONFIG_ZMS_SECTOR_BLOOM
+	if (!rc) {
+		rc = zms_sector_bloom_rebuild(fs);
+	}
 #endif
 	/* If the sector is empty add a gc done ate to avoid having insufficient
 	 * space when doing gc.
@@ -1774,7 +1920,7 @@ ssize_t zms_read_hist(struct zms_fs *fs, zms_id_t id, void *data, size_t len, ui
 #ifdef CONFIG_ZMS_DATA_CRC
 		/* Do not compute CRC for partial reads as CRC won't match */
 		if (len >= wlk_ate.len) {
-			computed_data_crc = crc32_ieee(data, wlk_ate.len);
+			computed_data_crc = zms_data_crc32(data, wlk_ate.len);
 			if (computed_data_crc != wlk_ate.data_crc) {
 				LOG_ERR("Invalid data CRC: ATE_CRC=0x%08X, "
 					"computed_data_crc=0x%08X",
@@ -16,6 +16,11 @@ LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
 K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 	      CONFIG_INPUT_QUEUE_MAX_MSGS, 4);
 
+#ifdef CONFIG_INPUT_EVENT_COALESCE
+static struct input_event pending_evts[CONFIG_INPUT_EVENT_COALESCE_MAX_EVENTS];
+static uint8_t pending_count;
+#endif
+
 #endif
 
 static void input_process(struct input_event *evt)
@@ -33,6 +38,11 @@ bool input_queue_empty(void)
 	if (k_msgq_num_used_get(&input_msgq) > 0) {
 		return false;
 	}
+#ifdef CONFIG_INPUT_EVENT_COALESCE
+	if (pending_count > 0) {
+		return false;
+	}
+#endif
 #endif
 	return true;
 }
@@ -73,6 +83,84 @@ int input_report(const struct device *dev,
 
 #ifdef CONFIG_INPUT_MODE_THREAD
 
+#ifdef CONFIG_INPUT_EVENT_COALESCE
+
+static void input_flush_pending(void)
+{
+	for (uint8_t i = 0; i < pending_count; i++) {
+		input_process(&pending_evts[i]);
+	}
+
+	pending_count = 0;
+}
+
+/* Merge a movement event into the pending frame: relative values
+ * accumulate, absolute values keep only the newest. Key and other
+ * edge-triggered events are never merged - a press and release pair
+ * must reach the processors as two events. Dispatch order within the
+ * frame follows first occurrence of each code.
+ */
+static void input_coalesce(const struct input_event *evt)
+{
+	if (evt->type == INPUT_EV_REL || evt->type == INPUT_EV_ABS) {
+		for (uint8_t i = 0; i < pending_count; i++) {
+			struct input_event *p = &pending_evts[i];
+
+			if (p->dev == evt->dev && p->type == evt->type &&
+			    p->code == evt->code) {
+				if (evt->type == INPUT_EV_REL) {
+					p->value += evt->value;
+				} else {
+					p->value = evt->value;
+				}
+				p->sync = evt->sync;
+				return;
+			}
+		}
+	}
+
+	if (pending_count == ARRAY_SIZE(pending_evts)) {
+		input_flush_pending();
+	}
+
+	pending_evts[pending_count++] = *evt;
+}
+
+static void input_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct input_event evt;
+	int ret;
+
+	while (true) {
+		ret = k_msgq_get(&input_msgq, &evt,
+				 pending_count > 0 ? K_NO_WAIT : K_FOREVER);
+		if (ret) {
+			if (pending_count > 0) {
+				/* Queue drained: deliver what we have, never
+				 * hold events back waiting for more.
+				 */
+				input_flush_pending();
+				continue;
+			}
+			LOG_ERR("k_msgq_get error: %d", ret);
+			continue;
+		}
+
+		input_coalesce(&evt);
+
+		if (evt.sync) {
+			/* Frame boundary */
+			input_flush_pending();
+		}
+	}
+}
+
+#else /* CONFIG_INPUT_EVENT_COALESCE */
+
 static void input_thread(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1);
@@ -93,6 +181,8 @@ static void input_thread(void *p1, void *p2, void *p3)
 	}
 }
 
+#endif /* CONFIG_INPUT_EVENT_COALESCE */
+
 #define INPUT_THREAD_PRIORITY \
 	COND_CODE_1(CONFIG_INPUT_THREAD_PRIORITY_OVERRIDE, \
 		    (CONFIG_INPUT_THREAD_PRIORITY), (K_LOWEST_APPLICATION_THREAD_PRIO))
@@ -188,6 +188,12 @@ struct backend_data {
 					 */
 	struct k_work ep_bound_work;	/* Work item for bounding processing. */
 	struct k_sem block_wait_sem;	/* Semaphore for waiting for free blocks. */
+#endif
+#if CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS > 0
+	atomic_t tx_blocks_used;	/* TX blocks currently allocated, to
+					 * enforce the reservation for
+					 * high-priority endpoints.
+					 */
 #endif
 	struct ept_data ept[NUM_EPT];	/* Array of registered endpoints. */
 	uint8_t ept_map[NUM_EPT];	/* Array that maps endpoint address to index. */
@@ -318,6 +324,30 @@ static int buffer_to_index_validate(const struct channel_config *ch_conf,
 	return block_index;
 }
 
+#if CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS > 0
+/* Soft reservation: normal-priority allocations must leave the
+ * configured number of blocks free for high-priority endpoints. The
+ * check and the bitmap allocation are not atomic together, so two
+ * racing normal allocations may momentarily dip into the reserve,
+ * which only delays (never starves) the next high-priority send.
+ */
+static bool tx_reserve_would_be_violated(struct backend_data *dev_data,
+					 size_t num_blocks, bool high_prio)
+{
+	const struct icbmsg_config *conf = dev_data->conf;
+	size_t limit;
+
+	if (high_prio ||
+	    (conf->tx.block_count <= CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS)) {
+		return false;
+	}
+
+	limit = conf->tx.block_count - CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS;
+
+	return ((size_t)atomic_get(&dev_data->tx_blocks_used) + num_blocks) > limit;
+}
+#endif /* CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS > 0 */
+
 /**
  * Allocate buffer for transmission
  *
@@ -334,7 +364,7 @@ static int buffer_to_index_validate(const struct channel_config *ch_conf,
  * @retval -EAGAIN	If timeout occurred.
  */
 static int alloc_tx_buffer(struct backend_data *dev_data, uint32_t *size,
-			   uint8_t **buffer, k_timeout_t timeout)
+			   uint8_t **buffer, k_timeout_t timeout, bool high_prio)
 {
 	const struct icbmsg_config *conf = dev_data->conf;
 	size_t total_size = *size + BLOCK_HEADER_SIZE;
@@ -350,9 +380,16 @@ static int alloc_tx_buffer(struct backend_data *dev_data, uint32_t *size,
 
 #ifdef CONFIG_MULTITHREADING
 	do {
-		/* Try to allocate specified number of blocks. */
-		r = sys_bitarray_alloc(conf->tx_usage_bitmap, num_blocks,
-				       &tx_block_index);
+#if CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS > 0
+		if (tx_reserve_would_be_violated(dev_data, num_blocks, high_prio)) {
+			r = -ENOSPC;
+		} else
+#endif
+		{
+			/* Try to allocate specified number of blocks. */
+			r = sys_bitarray_alloc(conf->tx_usage_bitmap, num_blocks,
+					       &tx_block_index);
+		}
 		if (r == -ENOSPC && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			/* Wait for releasing if there is no enough space and exit loop
 			 * on timeout.
@@ -375,8 +412,15 @@ static int alloc_tx_buffer(struct backend_data *dev_data, uint32_t *size,
 		k_sem_give(&dev_data->block_wait_sem);
 	}
 #else
-	/* Try to allocate specified number of blocks. */
-	r = sys_bitarray_alloc(conf->tx_usage_bitmap, num_blocks, &tx_block_index);
+#if CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS > 0
+	if (tx_reserve_would_be_violated(dev_data, num_blocks, high_prio)) {
+		r = -ENOSPC;
+	} else
+#endif
+	{
+		/* Try to allocate specified number of blocks. */
+		r = sys_bitarray_alloc(conf->tx_usage_bitmap, num_blocks, &tx_block_index);
+	}
 #endif
 
 	if (r < 0) {
@@ -416,6 +460,9 @@ static int alloc_tx_buffer(struct backend_data *dev_data, uint32_t *size,
 	block = block_from_index(&conf->tx, tx_block_index);
 	block->header.size = *size;
 	*buffer = block->data;
+#if CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS > 0
+	atomic_add(&dev_data->tx_blocks_used, num_blocks);
+#endif
 	return tx_block_index;
 }
 
@@ -477,6 +524,10 @@ static int release_tx_blocks(struct backend_data *dev_data, size_t tx_block_inde
 			return r;
 		}
 
+#if CONFIG_IPC_SERVICE_BACKEND_ICBMSG_PRIO_BLOCKS > 0
+		atomic_sub(&dev_data->tx_blocks_used, num_blocks);
+#endif
+
 #ifdef CONFIG_MULTITHREADING
 		/* Wake up all waiting threads. */
 		k_sem_give(&dev_data->block_wait_sem);
@@ -702,7 +753,7 @@ static int send_bound_message(struct backend_data *dev_data, struct ept_data *ep
 
 	msg_len = strlen(ept->cfg->name) + 1;
 	alloc_size = msg_len;
-	r = alloc_tx_buffer(dev_data, &alloc_size, &buffer, K_FOREVER);
+	r = alloc_tx_buffer(dev_data, &alloc_size, &buffer, K_FOREVER, true);
 	if (r >= 0) {
 		strcpy(buffer, ept->cfg->name);
 		r = send_block(dev_data, MSG_BOUND, ept->addr, r, msg_len);
@@ -1061,7 +1112,8 @@ static int send(const struct device *instance, void *token, const void *msg, siz
 
 	/* Allocate the buffer. */
 	alloc_size = len;
-	r = alloc_tx_buffer(dev_data, &alloc_size, &buffer, K_NO_WAIT);
+	r = alloc_tx_buffer(dev_data, &alloc_size, &buffer, K_NO_WAIT,
+			    ept->cfg->prio > 0);
 	if (r < 0) {
 		return r;
 	}
@@ -1171,9 +1223,11 @@ static int get_tx_buffer(const struct device *instance, void *token, void **data
 			 uint32_t *user_len, k_timeout_t wait)
 {
 	struct backend_data *dev_data = instance->data;
+	struct ept_data *ept = token;
 	int r;
 
-	r = alloc_tx_buffer(dev_data, user_len, (uint8_t **)data, wait);
+	r = alloc_tx_buffer(dev_data, user_len, (uint8_t **)data, wait,
+			    ept->cfg->prio > 0);
 	if (r < 0) {
 		return r;
 	}
@@ -1225,9 +1279,15 @@ static int hold_rx_buffer(const struct device *instance, void *token, void *data
 	int rx_block_index;
 	uint8_t *buffer = data;
 
-	/* Calculate block index and set associated bit. */
+	/* Calculate block index and set associated bit. The pointer comes
+	 * from the user, so reject anything outside the RX region instead
+	 * of only asserting on it.
+	 */
 	rx_block_index = buffer_to_index_validate(&conf->rx, buffer, NULL);
-	__ASSERT_NO_MSG(rx_block_index >= 0);
+	if (rx_block_index < 0) {
+		return rx_block_index;
+	}
+
 	return sys_bitarray_set_bit(conf->rx_hold_bitmap, rx_block_index);
 }
 
@@ -332,6 +332,21 @@ static bool callback_process(struct icmsg_data_t *dev_data)
 }
 
 #ifdef CONFIG_MULTITHREADING
+#if defined(CONFIG_IPC_SERVICE_ICMSG_LAZY_NOTIFY)
+/* One doorbell per burst: every icmsg_send() submits this work item,
+ * but submissions while it is still queued are no-ops, so all
+ * messages packed into the buffer before it runs share one mbox
+ * signal. The receiver drains the whole buffer per doorbell, so no
+ * message is left unsignalled.
+ */
+static void notify_process(struct k_work *item)
+{
+	struct icmsg_data_t *dev_data = CONTAINER_OF(item, struct icmsg_data_t, notify_work);
+
+	(void)mbox_send_dt(&dev_data->cfg->mbox_tx, NULL);
+}
+#endif /* CONFIG_IPC_SERVICE_ICMSG_LAZY_NOTIFY */
+
 static void workq_callback_process(struct k_work *item)
 {
 	bool rerun;
@@ -367,6 +382,9 @@ static int mbox_init(const struct icmsg_config_t *conf,
 
 #ifdef CONFIG_MULTITHREADING
 	k_work_init(&dev_data->mbox_work, workq_callback_process);
+#if defined(CONFIG_IPC_SERVICE_ICMSG_LAZY_NOTIFY)
+	k_work_init(&dev_data->notify_work, notify_process);
+#endif
 #endif
 
 	err = mbox_register_callback_dt(&conf->mbox_rx, mbox_callback, dev_data);
@@ -538,10 +556,17 @@ int icmsg_send(const struct icmsg_config_t *conf,
 
 	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
 
+#if defined(CONFIG_IPC_SERVICE_ICMSG_LAZY_NOTIFY)
+	ret = k_work_submit_to_queue(workq, &dev_data->notify_work);
+	if (ret < 0) {
+		return ret;
+	}
+#else
 	ret = mbox_send_dt(&conf->mbox_tx, NULL);
 	if (ret) {
 		return ret;
 	}
+#endif
 
 	return sent_bytes;
 }
@@ -229,6 +229,35 @@ int llext_unload(struct llext **ext)
 		return ret;
 	}
 
+#ifdef CONFIG_LLEXT_RELOAD_CACHE
+	/* Keep the fully linked image resident at zero use count: its
+	 * memory stays in place, so every relocation - including
+	 * absolute references into its own regions - remains valid and
+	 * the next llext_load() of the same name revives it without
+	 * parsing or linking. llext_purge() performs the real teardown.
+	 */
+	*ext = NULL;
+	k_mutex_unlock(&llext_lock);
+	LOG_DBG("Extension %s cached for reload", tmp->name);
+
+	return 0;
+}
+
+int llext_purge(struct llext **ext)
+{
+	__ASSERT(*ext, "Expected non-null extension");
+	struct llext *tmp = *ext;
+
+	k_mutex_lock(&llext_lock, K_FOREVER);
+
+	if (tmp->use_count != 0) {
+		unsigned int ret = tmp->use_count;
+
+		k_mutex_unlock(&llext_lock);
+		return ret;
+	}
+#endif /* CONFIG_LLEXT_RELOAD_CACHE */
+
 	/* FIXME: protect the global list */
 	sys_slist_find_and_remove(&llext_list, &tmp->llext_list);
 
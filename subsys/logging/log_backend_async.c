@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Asynchronous log backend wrapper.
+ *
+ * Decouples a slow backend (e.g. filesystem) from the shared log
+ * processing thread: messages are copied into a per-backend
+ * mpsc_pbuf and the wrapped backend consumes them from its own
+ * thread at its own priority, so it no longer delays fast backends
+ * that share the main processing loop.  On panic the queue is
+ * drained synchronously and further messages pass straight through.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_async.h>
+#include <zephyr/logging/log_msg.h>
+#include <string.h>
+
+static void async_thread(void *p1, void *p2, void *p3)
+{
+	struct log_backend_async_ctx *ctx = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		union log_msg_generic *msg;
+
+		k_sem_take(&ctx->sem, K_FOREVER);
+
+		while ((msg = (union log_msg_generic *)
+				mpsc_pbuf_claim(&ctx->pbuf)) != NULL) {
+			ctx->real_api->process(ctx->backend, msg);
+			mpsc_pbuf_free(&ctx->pbuf, &msg->buf);
+		}
+	}
+}
+
+void log_backend_async_process(const struct log_backend *const backend,
+			       union log_msg_generic *msg)
+{
+	struct log_backend_async_ctx *ctx = backend->cb->ctx;
+	uint32_t wlen = log_msg_generic_get_wlen(&msg->buf);
+	union mpsc_pbuf_generic *copy;
+
+	if (ctx->panic) {
+		/* queueing is pointless once the system is dying */
+		ctx->real_api->process(backend, msg);
+		return;
+	}
+
+	copy = mpsc_pbuf_alloc(&ctx->pbuf, wlen, K_NO_WAIT);
+	if (copy == NULL) {
+		/* backend-local drop: the slow consumer is behind */
+		ctx->dropped++;
+		return;
+	}
+
+	memcpy((void *)copy, (void *)msg, wlen * sizeof(uint32_t));
+	/* the source packet is claimed while we are called: scrub its
+	 * buffer-ownership bits so the copy starts clean in ours
+	 */
+	copy->hdr.busy = 0;
+	mpsc_pbuf_commit(&ctx->pbuf, copy);
+	k_sem_give(&ctx->sem);
+}
+
+void log_backend_async_dropped(const struct log_backend *const backend,
+			       uint32_t cnt)
+{
+	struct log_backend_async_ctx *ctx = backend->cb->ctx;
+
+	if (ctx->real_api->dropped != NULL) {
+		ctx->real_api->dropped(backend, cnt + ctx->dropped);
+		ctx->dropped = 0;
+	}
+}
+
+void log_backend_async_panic(const struct log_backend *const backend)
+{
+	struct log_backend_async_ctx *ctx = backend->cb->ctx;
+	union log_msg_generic *msg;
+
+	ctx->panic = true;
+
+	/* drain whatever is queued, synchronously */
+	while ((msg = (union log_msg_generic *)
+			mpsc_pbuf_claim(&ctx->pbuf)) != NULL) {
+		ctx->real_api->process(ctx->backend, msg);
+		mpsc_pbuf_free(&ctx->pbuf, &msg->buf);
+	}
+
+	if (ctx->real_api->panic != NULL) {
+		ctx->real_api->panic(backend);
+	}
+}
+
+void log_backend_async_init(const struct log_backend *const backend)
+{
+	struct log_backend_async_ctx *ctx = backend->cb->ctx;
+	struct mpsc_pbuf_buffer_config cfg = {
+		.buf = ctx->buf,
+		.size = ctx->buf_wlen,
+		.get_wlen = log_msg_generic_get_wlen,
+		.flags = 0,
+	};
+	k_tid_t tid;
+
+	ctx->backend = backend;
+	mpsc_pbuf_init(&ctx->pbuf, &cfg);
+	k_sem_init(&ctx->sem, 0, K_SEM_MAX_LIMIT);
+
+	tid = k_thread_create(&ctx->thread, ctx->stack, ctx->stack_size,
+			      async_thread, ctx, NULL, NULL,
+			      ctx->prio, 0, K_NO_WAIT);
+	k_thread_name_set(tid, "log_async");
+
+	if (ctx->real_api->init != NULL) {
+		ctx->real_api->init(backend);
+	}
+}
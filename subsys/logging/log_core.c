@@ -130,6 +130,12 @@ static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
 static void z_log_notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			      const union mpsc_pbuf_generic *item);
 
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+#define Z_LOG_EXTRA_CPU_BUFS (CONFIG_MP_MAX_NUM_CPUS - 1)
+#define Z_LOG_CPU_BUF_PTR(i, _) &cpu_log_buffer_##i
+#define Z_LOG_CPU_BUF32_PTR(i, _) cpu_buf32_##i
+#endif
+
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
 	.buf = (uint32_t *)buf32,
 	.size = ARRAY_SIZE(buf32),
@@ -142,6 +148,34 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+/* CPU 0 keeps the main log_buffer; the other CPUs get their own
+ * claim buffers registered in the same iterable sections the
+ * multidomain links use, so the existing timestamp-merging consumer
+ * (z_log_msg_claim_oldest()) interleaves them back into global
+ * order.  Producers then CAS against a CPU-local buffer instead of
+ * all stampeding on one.
+ */
+#define CPU_LOG_BUF_DEFINE(i, _)                                               \
+	static uint32_t __noinit cpu_buf32_##i                                 \
+		[CONFIG_LOG_BUFFER_SIZE / sizeof(int)];                        \
+	static STRUCT_SECTION_ITERABLE(log_msg_ptr, cpu_log_msg_ptr_##i);      \
+	static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf,                \
+						 mpsc_pbuf_buffer,             \
+						 cpu_log_buffer_##i)
+
+LISTIFY(Z_LOG_EXTRA_CPU_BUFS, CPU_LOG_BUF_DEFINE, (;), _);
+
+static struct mpsc_pbuf_buffer * const cpu_log_buffers[Z_LOG_EXTRA_CPU_BUFS] = {
+	LISTIFY(Z_LOG_EXTRA_CPU_BUFS, Z_LOG_CPU_BUF_PTR, (,), _)
+};
+
+static uint32_t * const cpu_log_bufs32[Z_LOG_EXTRA_CPU_BUFS] = {
+	LISTIFY(Z_LOG_EXTRA_CPU_BUFS, Z_LOG_CPU_BUF32_PTR, (,), _)
+};
+#endif /* CONFIG_LOG_PER_CPU_BUFFERS */
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -651,6 +685,16 @@ void z_log_msg_init(void)
 #ifdef CONFIG_MPSC_PBUF
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
+
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+	for (int i = 0; i < Z_LOG_EXTRA_CPU_BUFS; i++) {
+		struct mpsc_pbuf_buffer_config cfg = mpsc_config;
+
+		cfg.buf = cpu_log_bufs32[i];
+		cfg.size = CONFIG_LOG_BUFFER_SIZE / sizeof(int);
+		mpsc_pbuf_init(cpu_log_buffers[i], &cfg);
+	}
+#endif
 #endif
 }
 
@@ -667,9 +711,38 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 			: K_MSEC(CONFIG_LOG_BLOCK_IN_THREAD_TIMEOUT_MS));
 }
 
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+static struct mpsc_pbuf_buffer *cpu_log_buffer_get(void)
+{
+	unsigned int cpu = arch_curr_cpu()->id;
+
+	return (cpu == 0) ? &log_buffer : cpu_log_buffers[cpu - 1];
+}
+
+/* Resolve the buffer a packet was allocated from by address range */
+static struct mpsc_pbuf_buffer *z_log_msg_buffer_of(struct log_msg *msg)
+{
+	uintptr_t addr = (uintptr_t)msg;
+
+	for (int i = 0; i < Z_LOG_EXTRA_CPU_BUFS; i++) {
+		uintptr_t start = (uintptr_t)cpu_log_bufs32[i];
+
+		if ((addr >= start) && (addr < (start + CONFIG_LOG_BUFFER_SIZE))) {
+			return cpu_log_buffers[i];
+		}
+	}
+
+	return &log_buffer;
+}
+#endif
+
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+	return msg_alloc(cpu_log_buffer_get(), wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -701,7 +774,17 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#if defined(CONFIG_LOG_PER_CPU_BUFFERS)
+	/* commit to the buffer the message was claimed from; a
+	 * migration between alloc and commit is impossible for ISRs
+	 * and harmless for threads since every buffer accepts any
+	 * producer (they are MPSC), but the packet header belongs to
+	 * its buffer, so resolve via the packet address range.
+	 */
+	msg_commit(z_log_msg_buffer_of(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -788,7 +871,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+	     IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) && len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -118,15 +118,32 @@ static uint32_t get_source_offset(const struct log_link *link,
 	return offset;
 }
 
+/* Filter offsets of remote domains never change after link
+ * initialization, so the per-message lookup memoizes them instead of
+ * re-summing the source counts of every preceding domain each time.
+ */
+#define SOURCE_OFFSET_CACHE_SIZE 16
+static uint32_t source_offset_cache[SOURCE_OFFSET_CACHE_SIZE];
+static uint16_t source_offset_cache_valid;
+
 uint32_t *z_log_link_get_dynamic_filter(uint8_t domain_id, uint32_t source_id)
 {
 	uint8_t rel_domain_id;
 	const struct log_link *link = get_link_domain(domain_id, &rel_domain_id);
-	uint32_t source_offset = 0;
+	uint32_t source_offset;
 
 	__ASSERT_NO_MSG(link != NULL);
 
-	source_offset = get_source_offset(link, rel_domain_id);
+	if ((domain_id < SOURCE_OFFSET_CACHE_SIZE) &&
+	    (source_offset_cache_valid & BIT(domain_id))) {
+		source_offset = source_offset_cache[domain_id];
+	} else {
+		source_offset = get_source_offset(link, rel_domain_id);
+		if (domain_id < SOURCE_OFFSET_CACHE_SIZE) {
+			source_offset_cache[domain_id] = source_offset;
+			source_offset_cache_valid |= BIT(domain_id);
+		}
+	}
 
 	return &link->ctrl_blk->filters[source_offset + source_id];
 }
@@ -598,6 +615,7 @@ void z_log_links_initiate(void)
 	int err;
 
 	cache_init();
+	source_offset_cache_valid = 0;
 
 	STRUCT_SECTION_FOREACH(log_link, link) {
 #ifdef CONFIG_MPSC_PBUF
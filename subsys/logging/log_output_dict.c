@@ -55,4 +55,5 @@ void log_dict_output_dropped_process(const struct log_output *output, uint32_t c
 
 	log_output_write(output->func, (uint8_t *)&msg, sizeof(msg),
 			 (void *)output->control_block->ctx);
+	log_output_flush(output);
 }
@@ -242,7 +242,9 @@ static int fs_mgmt_upload_download_finish_check(void)
  */
 static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 {
+#if !defined(CONFIG_MCUMGR_GRP_FS_DL_DIRECT_READ)
 	uint8_t file_data[MCUMGR_GRP_FS_DL_CHUNK_SIZE];
+#endif
 	char path[CONFIG_MCUMGR_GRP_FS_PATH_LEN + 1];
 	uint64_t off = ULLONG_MAX;
 	ssize_t bytes_read = 0;
@@ -355,6 +357,50 @@ static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 	 * length.
 	 */
 
+#if defined(CONFIG_MCUMGR_GRP_FS_DL_DIRECT_READ)
+	/* Encode the fixed fields, then read the chunk from the file
+	 * straight into the response buffer as the content of an
+	 * incrementally encoded byte string. Room is reserved for the
+	 * fields that follow the data.
+	 */
+	ok = fs_mgmt_file_rsp(zse, MGMT_ERR_EOK, off)				&&
+	     zcbor_tstr_put_lit(zse, "data")					&&
+	     zcbor_bstr_start_encode(zse);
+
+	if (ok) {
+		size_t space = (size_t)(zse->payload_end - zse->payload);
+		size_t reserved = 24;
+		size_t to_read = MCUMGR_GRP_FS_DL_CHUNK_SIZE;
+
+		if (space <= reserved) {
+			to_read = 0;
+		} else {
+			to_read = MIN(to_read, space - reserved);
+		}
+
+		bytes_read = fs_read(&fs_mgmt_ctxt.file, zse->payload_mut, to_read);
+
+		if (bytes_read < 0) {
+			/* The response is partially encoded; returning an
+			 * error makes the SMP layer reset the buffer and
+			 * build a clean error response.
+			 */
+			(void)fs_mgmt_cleanup();
+			k_sem_give(&fs_mgmt_ctxt.lock_sem);
+			return MGMT_ERR_EUNKNOWN;
+		}
+
+		zse->payload += bytes_read;
+		ok = zcbor_bstr_end_encode(zse, NULL);
+	}
+
+	/* Increment offset */
+	fs_mgmt_ctxt.off += bytes_read;
+
+	ok = ok &&
+	     ((off != 0)							||
+		(zcbor_tstr_put_lit(zse, "len") && zcbor_uint64_put(zse, fs_mgmt_ctxt.len)));
+#else
 	/* Read the requested chunk from the file. */
 	bytes_read = fs_read(&fs_mgmt_ctxt.file, file_data, MCUMGR_GRP_FS_DL_CHUNK_SIZE);
 
@@ -373,6 +419,7 @@ static int fs_mgmt_file_download(struct smp_streamer *ctxt)
 	     zcbor_bstr_encode_ptr(zse, file_data, bytes_read)			&&
 	     ((off != 0)							||
 		(zcbor_tstr_put_lit(zse, "len") && zcbor_uint64_put(zse, fs_mgmt_ctxt.len)));
+#endif /* CONFIG_MCUMGR_GRP_FS_DL_DIRECT_READ */
 
 	/* Closing errors can be ignored on downloads */
 	(void)fs_mgmt_upload_download_finish_check();
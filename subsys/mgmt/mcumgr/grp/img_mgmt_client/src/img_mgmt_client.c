@@ -39,6 +39,8 @@ static struct mcumgr_image_state *image_info;
 static struct mcumgr_image_upload *image_upload_buf;
 
 static K_SEM_DEFINE(mcumgr_img_client_grp_sem, 0, 1);
+/* Number of upload requests currently waiting for a response */
+static atomic_t upload_in_flight;
 static K_MUTEX_DEFINE(mcumgr_img_client_grp_mutex);
 
 static const char smp_images_str[] = "images";
@@ -214,6 +216,7 @@ static int image_upload_res_fn(struct net_buf *nb, void *user_data)
 end:
 	/* Set status for Upload request handler */
 	rc = image_upload_buf->status;
+	atomic_dec(&upload_in_flight);
 	k_sem_give(user_data);
 	return rc;
 }
@@ -334,9 +337,10 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 	struct net_buf *nb;
 	const uint8_t *write_ptr;
 	int rc;
+	int session_rc = MGMT_ERR_EOK;
 	uint32_t map_count;
 	bool ok;
-	size_t write_length, max_data_length, offset_before_send, request_length, wrote_length;
+	size_t write_length, max_data_length, send_offset, request_length, wrote_length;
 	zcbor_state_t zse[CONFIG_MCUMGR_SMP_CBOR_MAX_DECODING_LEVELS + 2];
 
 	k_mutex_lock(&mcumgr_img_client_grp_mutex, K_FOREVER);
@@ -345,6 +349,14 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 
 	request_length = length;
 	wrote_length = 0;
+	/* All previous requests are drained before returning, so the
+	 * acknowledged offset is also where this call's data starts.
+	 */
+	send_offset = client->upload.offset;
+	atomic_clear(&upload_in_flight);
+	k_sem_reset(&mcumgr_img_client_grp_sem);
+	image_upload_buf->status = MGMT_ERR_EINVAL;
+	image_upload_buf->image_upload_offset = SIZE_MAX;
 	/* Calculate max data length based on
 	 * net_buf size - (SMP header + CBOR message_len + 16-bit CRC + 16-bit length)
 	 */
@@ -357,6 +369,34 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 	}
 
 	while (request_length != wrote_length) {
+		/* Sliding window: keep up to the configured number of
+		 * requests in flight. The SMP client layer matches the
+		 * responses by sequence number, and this transport
+		 * delivers them in order, so each response advances
+		 * upload.offset monotonically.
+		 */
+		while (atomic_get(&upload_in_flight) >=
+		       CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_SIZE) {
+			k_sem_take(&mcumgr_img_client_grp_sem, K_FOREVER);
+
+			if (image_upload_buf->status) {
+				LOG_ERR("Upload Fail: %d", image_upload_buf->status);
+				/* Keep the first failure: responses still in
+				 * flight may report success and overwrite the
+				 * shared status during the drain below.
+				 */
+				session_rc = image_upload_buf->status;
+				goto drain;
+			}
+
+			if (active_client->upload.offset > send_offset) {
+				/* Offset further than expected which
+				 * indicates an upload session resume
+				 */
+				goto drain;
+			}
+		}
+
 		write_ptr = data + wrote_length;
 		write_length = request_length - wrote_length;
 		if (write_length > max_data_length) {
@@ -367,13 +407,13 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 					       IMG_MGMT_ID_UPLOAD, MGMT_OP_WRITE,
 					       SMP_MCUMGR_VERSION_1);
 		if (!nb) {
-			image_upload_buf->status = MGMT_ERR_ENOMEM;
-			goto end;
+			session_rc = MGMT_ERR_ENOMEM;
+			goto drain;
 		}
 
 		zcbor_new_encode_state(zse, ARRAY_SIZE(zse), nb->data + nb->len,
 				       net_buf_tailroom(nb), 0);
-		if (active_client->upload.offset) {
+		if (send_offset) {
 			map_count = 6;
 		} else if (active_client->upload.hash_initialized) {
 			map_count = 12;
@@ -387,9 +427,9 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 		     zcbor_tstr_put_lit(zse, "data") &&
 		     zcbor_bstr_encode_ptr(zse, write_ptr, write_length) &&
 		     zcbor_tstr_put_lit(zse, "off") &&
-		     zcbor_size_put(zse, active_client->upload.offset);
+		     zcbor_size_put(zse, send_offset);
 		/* Write Len and configured hash when offset is zero */
-		if (ok && !active_client->upload.offset) {
+		if (ok && !send_offset) {
 			ok = zcbor_tstr_put_lit(zse, "len") &&
 			     zcbor_size_put(zse, active_client->upload.image_size);
 			if (ok && active_client->upload.hash_initialized) {
@@ -406,42 +446,38 @@ int img_mgmt_client_upload(struct img_mgmt_client *client, const uint8_t *data,
 		if (!ok) {
 			LOG_ERR("Failed to encode Image Upload packet");
 			smp_packet_free(nb);
-			image_upload_buf->status = MGMT_ERR_ENOMEM;
-			goto end;
+			session_rc = MGMT_ERR_ENOMEM;
+			goto drain;
 		}
 
-		offset_before_send = active_client->upload.offset;
 		nb->len = zse->payload - nb->data;
-		k_sem_reset(&mcumgr_img_client_grp_sem);
-
-		image_upload_buf->status = MGMT_ERR_EINVAL;
-		image_upload_buf->image_upload_offset = SIZE_MAX;
 
+		atomic_inc(&upload_in_flight);
 		rc = smp_client_send_cmd(active_client->smp_client, nb, image_upload_res_fn,
 					 &mcumgr_img_client_grp_sem,
 					 CONFIG_MCUMGR_GRP_IMG_FLASH_OPERATION_TIMEOUT);
 		if (rc) {
 			LOG_ERR("Failed to send SMP Upload init packet, err: %d", rc);
+			atomic_dec(&upload_in_flight);
 			smp_packet_free(nb);
-			image_upload_buf->status = rc;
-			goto end;
-
-		}
-		k_sem_take(&mcumgr_img_client_grp_sem, K_FOREVER);
-		if (image_upload_buf->status) {
-			LOG_ERR("Upload Fail: %d", image_upload_buf->status);
-			goto end;
-		}
-
-		if (offset_before_send + write_length < active_client->upload.offset) {
-			/* Offset further than expected which indicate upload session resume */
-			goto end;
+			session_rc = rc;
+			goto drain;
 		}
 
+		send_offset += write_length;
 		wrote_length += write_length;
 	}
-end:
-	rc = image_upload_buf->status;
+
+drain:
+	/* Wait out every response still in flight; the callback updates
+	 * status and the acknowledged offset as each one arrives.
+	 */
+	while (atomic_get(&upload_in_flight) > 0) {
+		k_sem_take(&mcumgr_img_client_grp_sem, K_FOREVER);
+	}
+
+	rc = (session_rc != MGMT_ERR_EOK) ? session_rc : image_upload_buf->status;
+	image_upload_buf->status = rc;
 	active_client = NULL;
 	image_upload_buf = NULL;
 	k_mutex_unlock(&mcumgr_img_client_grp_mutex);
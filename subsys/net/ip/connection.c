@@ -58,6 +58,43 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
+#ifdef CONFIG_NET_CONN_DEMUX_CACHE
+#define NET_CONN_FULLY_SPEC						\
+	(NET_CONN_REMOTE_ADDR_SET | NET_CONN_LOCAL_ADDR_SET |		\
+	 NET_CONN_REMOTE_PORT_SPEC | NET_CONN_LOCAL_PORT_SPEC)
+
+/* Last fully-specified unicast match, keyed by the packet 4-tuple.
+ * Guarded by conn_lock.  An exact 4-tuple match always carries the
+ * maximum rank, so serving it from the cache cannot change which
+ * connection wins; addresses are revalidated against the cached
+ * connection on every hit.
+ */
+static struct {
+	struct net_conn *conn;
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t proto;
+	uint8_t family;
+	uint32_t hits;
+	uint32_t misses;
+} demux_cache;
+
+static void demux_cache_invalidate(struct net_conn *conn)
+{
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	if (demux_cache.conn == conn) {
+		demux_cache.conn = NULL;
+	}
+	k_mutex_unlock(&conn_lock);
+}
+
+void net_conn_cache_stats_get(uint32_t *hits, uint32_t *misses)
+{
+	*hits = demux_cache.hits;
+	*misses = demux_cache.misses;
+}
+#endif /* CONFIG_NET_CONN_DEMUX_CACHE */
+
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
@@ -461,6 +498,10 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	NET_DBG("Connection handler %p removed", conn);
 
+#ifdef CONFIG_NET_CONN_DEMUX_CACHE
+	demux_cache_invalidate(conn);
+#endif
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 	k_mutex_unlock(&conn_lock);
@@ -478,6 +519,10 @@ int net_conn_update(struct net_conn_handle *handle,
 		    const struct net_sockaddr *local_addr,
 		    uint16_t local_port)
 {
+#ifdef CONFIG_NET_CONN_DEMUX_CACHE
+	/* endpoints may change under us */
+	demux_cache_invalidate((struct net_conn *)handle);
+#endif
 	struct net_conn *conn = (struct net_conn *)handle;
 	int ret;
 
@@ -909,6 +954,24 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+#ifdef CONFIG_NET_CONN_DEMUX_CACHE
+	conn = demux_cache.conn;
+	if ((conn != NULL) && !is_mcast_pkt && !is_bcast_pkt &&
+	    (demux_cache.proto == proto) &&
+	    (demux_cache.family == pkt_family) &&
+	    (demux_cache.src_port == src_port) &&
+	    (demux_cache.dst_port == dst_port) &&
+	    ((conn->flags & NET_CONN_FULLY_SPEC) == NET_CONN_FULLY_SPEC) &&
+	    (conn->proto == proto) && is_iface_matching(conn, pkt) &&
+	    conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true) &&
+	    conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+		demux_cache.hits++;
+		best_match = conn;
+		goto deliver;
+	}
+	demux_cache.misses++;
+#endif /* CONFIG_NET_CONN_DEMUX_CACHE */
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (!is_iface_matching(conn, pkt)) {
@@ -1023,6 +1086,19 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	} /* loop end */
 
+#ifdef CONFIG_NET_CONN_DEMUX_CACHE
+	if ((best_match != NULL) && !is_mcast_pkt && !is_bcast_pkt &&
+	    ((best_match->flags & NET_CONN_FULLY_SPEC) == NET_CONN_FULLY_SPEC)) {
+		demux_cache.conn = best_match;
+		demux_cache.proto = proto;
+		demux_cache.family = pkt_family;
+		demux_cache.src_port = src_port;
+		demux_cache.dst_port = dst_port;
+	}
+
+deliver:
+#endif /* CONFIG_NET_CONN_DEMUX_CACHE */
+
 	if (best_match != NULL) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -152,6 +152,18 @@ static inline int net_conn_register(uint16_t proto, enum net_sock_type type,
  */
 #if defined(CONFIG_NET_NATIVE)
 int net_conn_unregister(struct net_conn_handle *handle);
+
+#ifdef CONFIG_NET_CONN_DEMUX_CACHE
+/**
+ * @brief Read the demux cache hit/miss counters.
+ *
+ * @param hits Filled with the number of packets served by the cached
+ *        last-hit connection.
+ * @param misses Filled with the number of packets that walked the
+ *        connection list.
+ */
+void net_conn_cache_stats_get(uint32_t *hits, uint32_t *misses);
+#endif /* CONFIG_NET_CONN_DEMUX_CACHE */
 #else
 static inline int net_conn_unregister(struct net_conn_handle *handle)
 {
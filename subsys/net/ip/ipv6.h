@@ -269,6 +269,16 @@ void net_ipv6_nbr_lock(void);
  */
 void net_ipv6_nbr_unlock(void);
 
+#if defined(CONFIG_NET_IPV6_DST_CACHE)
+/**
+ * @brief Invalidate the IPv6 destination cache.
+ *
+ * Called whenever neighbor or routing state changes so cached
+ * route/neighbor resolutions are re-established on next use.
+ */
+void net_ipv6_dst_cache_invalidate(void);
+#endif
+
 /**
  * @brief Look for a neighbor from it's address on an iface
  *
@@ -135,6 +135,69 @@ static inline struct net_nbr *get_nbr(int idx)
 	return &net_neighbor_pool[idx].nbr;
 }
 
+
+#if defined(CONFIG_NET_IPV6_DST_CACHE)
+/* Small destination cache: maps a destination address straight to the
+ * egress interface and resolved link-layer address, skipping the
+ * route and neighbor lookups for steady-state TX.  Entries are only
+ * created for REACHABLE neighbors and the whole cache is invalidated
+ * by generation bump whenever the neighbor or routing state changes,
+ * so neighbor unreachability detection keeps working: once a neighbor
+ * leaves REACHABLE the slow path (and its NUD hooks) runs again.
+ * Accessed under the neighbor table lock.
+ */
+struct ipv6_dst_cache_entry {
+	struct net_in6_addr dst;
+	struct net_if *iface;
+	struct net_linkaddr lladdr;
+	uint32_t generation;
+	bool used;
+};
+
+static struct ipv6_dst_cache_entry dst_cache[CONFIG_NET_IPV6_DST_CACHE_COUNT];
+static atomic_t dst_cache_generation;
+static int dst_cache_next;
+
+void net_ipv6_dst_cache_invalidate(void)
+{
+	atomic_inc(&dst_cache_generation);
+}
+
+static bool dst_cache_get(struct net_in6_addr *dst, struct net_pkt *pkt)
+{
+	uint32_t generation = (uint32_t)atomic_get(&dst_cache_generation);
+
+	for (int i = 0; i < CONFIG_NET_IPV6_DST_CACHE_COUNT; i++) {
+		struct ipv6_dst_cache_entry *entry = &dst_cache[i];
+
+		if (entry->used && (entry->generation == generation) &&
+		    net_ipv6_addr_cmp(&entry->dst, dst)) {
+			net_pkt_set_iface(pkt, entry->iface);
+			(void)net_linkaddr_set(net_pkt_lladdr_dst(pkt),
+					       entry->lladdr.addr,
+					       entry->lladdr.len);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void dst_cache_put(struct net_in6_addr *dst, struct net_if *iface,
+			  struct net_linkaddr *lladdr)
+{
+	struct ipv6_dst_cache_entry *entry = &dst_cache[dst_cache_next];
+
+	dst_cache_next = (dst_cache_next + 1) % CONFIG_NET_IPV6_DST_CACHE_COUNT;
+
+	net_ipaddr_copy(&entry->dst, dst);
+	entry->iface = iface;
+	(void)net_linkaddr_set(&entry->lladdr, lladdr->addr, lladdr->len);
+	entry->generation = (uint32_t)atomic_get(&dst_cache_generation);
+	entry->used = true;
+}
+#endif /* CONFIG_NET_IPV6_DST_CACHE */
+
 static void ipv6_nbr_set_state(struct net_nbr *nbr,
 			       enum net_ipv6_nbr_state new_state)
 {
@@ -149,6 +212,12 @@ static void ipv6_nbr_set_state(struct net_nbr *nbr,
 
 	net_ipv6_nbr_data(nbr)->state = new_state;
 
+#if defined(CONFIG_NET_IPV6_DST_CACHE)
+	if (new_state != NET_IPV6_NBR_STATE_REACHABLE) {
+		net_ipv6_dst_cache_invalidate();
+	}
+#endif
+
 	if (net_ipv6_nbr_data(nbr)->state == NET_IPV6_NBR_STATE_STALE) {
 		if (stale_counter + 1 != UINT32_MAX) {
 			net_ipv6_nbr_data(nbr)->stale_counter = stale_counter++;
@@ -295,6 +364,9 @@ static inline void nbr_clear_ns_pending(struct net_ipv6_nbr_data *data)
 
 static inline void nbr_free(struct net_nbr *nbr)
 {
+#if defined(CONFIG_NET_IPV6_DST_CACHE)
+	net_ipv6_dst_cache_invalidate();
+#endif
 	NET_DBG("nbr %p", nbr);
 
 	nbr_clear_ns_pending(net_ipv6_nbr_data(nbr));
@@ -923,6 +995,15 @@ use_interface_mtu:
 		return NET_OK;
 	}
 
+#if defined(CONFIG_NET_IPV6_DST_CACHE)
+	net_ipv6_nbr_lock();
+	if (dst_cache_get(&dst_ip, pkt)) {
+		net_ipv6_nbr_unlock();
+		return NET_OK;
+	}
+	net_ipv6_nbr_unlock();
+#endif /* CONFIG_NET_IPV6_DST_CACHE */
+
 	if (net_if_ipv6_addr_onlink(&iface, &dst_ip)) {
 		nexthop = &dst_ip;
 		net_pkt_set_iface(pkt, iface);
@@ -1011,6 +1092,13 @@ try_send:
 		NET_DBG("Neighbor %p addr %s", nbr,
 			net_sprint_ll_addr(lladdr->addr, lladdr->len));
 
+#if defined(CONFIG_NET_IPV6_DST_CACHE)
+		if (net_ipv6_nbr_data(nbr)->state ==
+		    NET_IPV6_NBR_STATE_REACHABLE) {
+			dst_cache_put(&dst_ip, iface, lladdr);
+		}
+#endif
+
 		/* Start the NUD if we are in STALE state.
 		 * See RFC 4861 ch 7.3.3 for details.
 		 */
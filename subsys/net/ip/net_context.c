@@ -1359,6 +1359,11 @@ int net_context_connect(struct net_context *context,
 			k_timeout_t timeout,
 			void *user_data)
 {
+#if defined(CONFIG_NET_UDP_TX_TEMPLATE)
+	/* the endpoints (and so the header image) are changing */
+	context->tx_template.valid = false;
+#endif
+
 	struct net_sockaddr *laddr = NULL;
 	struct net_sockaddr local_addr __unused;
 	uint16_t lport, rport;
@@ -2382,6 +2387,147 @@ static void set_pkt_hoplimit(struct net_pkt *pkt, const struct net_msghdr *msg_h
 	}
 }
 
+
+#if defined(CONFIG_NET_CONTEXT_SG_TX)
+/* Fragment descriptors for zero-copy scatter-gather sends: the data
+ * pointer of each net_buf is set to the caller's iovec element, so
+ * nothing is assembled or copied.  Only used when TX is synchronous
+ * (no TX queue), which guarantees the driver is done with the user
+ * memory by the time the send call returns.
+ */
+NET_BUF_POOL_DEFINE(sg_tx_pool, CONFIG_NET_CONTEXT_SG_TX_COUNT, 0, 0, NULL);
+
+static bool context_sg_tx_usable(struct net_context *context,
+				 const struct net_msghdr *msghdr)
+{
+	return (CONFIG_NET_TC_TX_COUNT == 0) && (msghdr != NULL) &&
+	       (net_context_get_proto(context) == NET_IPPROTO_UDP);
+}
+
+static int context_append_iovec_frags(struct net_pkt *pkt,
+				      const struct net_msghdr *msghdr)
+{
+	for (int i = 0; i < msghdr->msg_iovlen; i++) {
+		struct net_buf *frag;
+
+		if (msghdr->msg_iov[i].iov_len == 0) {
+			continue;
+		}
+
+		frag = net_buf_alloc_with_data(&sg_tx_pool,
+					       msghdr->msg_iov[i].iov_base,
+					       msghdr->msg_iov[i].iov_len,
+					       PKT_WAIT_TIME);
+		if (frag == NULL) {
+			return -ENOBUFS;
+		}
+
+		net_pkt_append_buffer(pkt, frag);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NET_CONTEXT_SG_TX */
+
+#if defined(CONFIG_NET_UDP_TX_TEMPLATE)
+/* RFC 1624 eqn. 3 incremental checksum update for one halfword.
+ * Operands are in network byte order; one's complement arithmetic is
+ * byte-order agnostic as long as all operands agree.
+ */
+static uint16_t chksum_patch16(uint16_t sum, uint16_t old16, uint16_t new16)
+{
+	uint32_t acc = (uint16_t)~sum + (uint16_t)~old16 + new16;
+
+	acc = (acc & 0xffffU) + (acc >> 16);
+	acc = (acc & 0xffffU) + (acc >> 16);
+
+	return (uint16_t)~acc;
+}
+
+/* Capture the finalized IPv4+UDP header as a template for subsequent
+ * sends on this connected context.  Only headers whose UDP checksum
+ * field ended up zero (checksum disabled or offloaded to hardware)
+ * can be replayed: a nonzero checksum covers the payload.
+ */
+static void udp_template_capture(struct net_context *context,
+				 net_sa_family_t family,
+				 struct net_pkt *pkt, size_t len,
+				 bool sendto, const struct net_msghdr *msghdr)
+{
+	struct net_pkt_cursor backup;
+	uint8_t *hdr = context->tx_template.hdr;
+
+	if ((family != NET_AF_INET) || sendto || (msghdr != NULL) ||
+	    (len > UINT16_MAX - NET_IPV4UDPH_LEN)) {
+		return;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+
+	/* a failed read below must not leave a half-written image valid */
+	context->tx_template.valid = false;
+
+	if (net_pkt_read(pkt, hdr, NET_IPV4UDPH_LEN) == 0) {
+		uint16_t udp_chksum;
+
+		memcpy(&udp_chksum, &hdr[NET_IPV4H_LEN + 6], sizeof(udp_chksum));
+
+		context->tx_template.valid = (udp_chksum == 0U) &&
+			((hdr[0] & 0x0fU) == (NET_IPV4H_LEN / 4U));
+	}
+
+	net_pkt_cursor_restore(pkt, &backup);
+}
+
+/* Replay the captured header with only the length fields (and the
+ * IPv4 header checksum, incrementally) patched, then append the
+ * payload; the whole header build and checksum pass is skipped.
+ */
+static int context_apply_udp_template(struct net_context *context,
+				      struct net_pkt *pkt,
+				      const void *buf, size_t len)
+{
+	uint8_t hdr[NET_IPV4UDPH_LEN];
+	uint16_t old16, new16, sum;
+	int ret;
+
+	memcpy(hdr, context->tx_template.hdr, sizeof(hdr));
+
+	/* IPv4 total length */
+	memcpy(&old16, &hdr[2], sizeof(old16));
+	new16 = net_htons(NET_IPV4UDPH_LEN + len);
+	memcpy(&hdr[2], &new16, sizeof(new16));
+
+	/* IPv4 header checksum, unless the hardware fills it in */
+	memcpy(&sum, &hdr[10], sizeof(sum));
+	if (sum != 0U) {
+		sum = chksum_patch16(sum, old16, new16);
+		memcpy(&hdr[10], &sum, sizeof(sum));
+	}
+
+	/* UDP length */
+	new16 = net_htons(NET_UDPH_LEN + len);
+	memcpy(&hdr[NET_IPV4H_LEN + 4], &new16, sizeof(new16));
+
+	ret = net_pkt_write(pkt, hdr, sizeof(hdr));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = net_pkt_write(pkt, buf, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, NET_IPV4H_LEN);
+	net_pkt_set_ipv4_opts_len(pkt, 0);
+	net_pkt_cursor_init(pkt);
+
+	return 0;
+}
+#endif /* CONFIG_NET_UDP_TX_TEMPLATE */
+
 static int context_sendto(struct net_context *context,
 			  const void *buf,
 			  size_t len,
@@ -2688,7 +2834,13 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
+#if defined(CONFIG_NET_CONTEXT_SG_TX)
+	pkt = context_alloc_pkt(context, family,
+				context_sg_tx_usable(context, msghdr) ? 0 : len,
+				PKT_WAIT_TIME);
+#else
 	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+#endif
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2696,7 +2848,11 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (
+#if defined(CONFIG_NET_CONTEXT_SG_TX)
+	    !context_sg_tx_usable(context, msghdr) &&
+#endif
+	    (tmp_len < len)) {
 		if (net_context_get_type(context) == NET_SOCK_DGRAM ||
 		    net_context_get_type(context) == NET_SOCK_RAW) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2761,15 +2917,61 @@ skip_alloc:
 		ret = net_try_send_data(pkt, timeout);
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == NET_IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
-		if (ret < 0) {
-			goto fail;
+#if defined(CONFIG_NET_CONTEXT_SG_TX)
+		if (context_sg_tx_usable(context, msghdr)) {
+			/* headers only; payload rides as external
+			 * fragments referencing the caller's iovecs
+			 */
+			ret = context_setup_udp_packet(context, family, pkt,
+						       NULL, 0, NULL,
+						       dst_addr, addrlen);
+			if (ret < 0) {
+				goto fail;
+			}
+
+			ret = context_append_iovec_frags(pkt, msghdr);
+			if (ret < 0) {
+				goto fail;
+			}
+
+			net_pkt_cursor_init(pkt);
+			context_finalize_packet(context, family, pkt);
+
+			ret = net_try_send_data(pkt, timeout);
+			goto udp_sent;
 		}
+#endif /* CONFIG_NET_CONTEXT_SG_TX */
+#if defined(CONFIG_NET_UDP_TX_TEMPLATE)
+		if (context->tx_template.valid && (family == NET_AF_INET) &&
+		    !sendto && (msghdr == NULL) && (buf != NULL) &&
+		    (len <= UINT16_MAX - NET_IPV4UDPH_LEN)) {
+			ret = context_apply_udp_template(context, pkt, buf, len);
+			if (ret < 0) {
+				goto fail;
+			}
+		} else
+#endif /* CONFIG_NET_UDP_TX_TEMPLATE */
+		{
+			ret = context_setup_udp_packet(context, family, pkt, buf,
+						       len, msghdr,
+						       dst_addr, addrlen);
+			if (ret < 0) {
+				goto fail;
+			}
 
-		context_finalize_packet(context, family, pkt);
+			context_finalize_packet(context, family, pkt);
+
+#if defined(CONFIG_NET_UDP_TX_TEMPLATE)
+			udp_template_capture(context, family, pkt, len,
+					     sendto, msghdr);
+#endif
+		}
 
 		ret = net_try_send_data(pkt, timeout);
+#if defined(CONFIG_NET_CONTEXT_SG_TX)
+udp_sent:
+		;
+#endif
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == NET_IPPROTO_TCP) {
 
@@ -66,6 +66,9 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "tcp_internal.h"
 
 #include "net_stats.h"
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+#include <zephyr/sys/hash_function.h>
+#endif
 
 #if defined(CONFIG_NET_NATIVE)
 static inline enum net_verdict process_data(struct net_pkt *pkt)
@@ -517,11 +520,75 @@ void net_process_rx_packet(struct net_pkt *pkt)
 	net_rx(net_pkt_iface(pkt), pkt);
 }
 
+
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+/* Steer received frames to RX queues by flow identity instead of
+ * priority, so independent flows spread across the RX threads while
+ * packets of one flow stay ordered on one queue.  The identity is
+ * the L3 addresses plus protocol and L4 ports when the frame parses
+ * as IPv4/IPv6 over Ethernet; anything else hashes the MAC addresses
+ * so per-source ordering is still preserved.
+ */
+static uint8_t rx_flow_tc(struct net_pkt *pkt)
+{
+	struct net_pkt_cursor backup;
+	uint8_t hdr[62];
+	uint8_t key[40];
+	size_t keylen = 0;
+	size_t rd = MIN(sizeof(hdr), net_pkt_get_len(pkt));
+	uint16_t etype;
+	int ret;
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+	ret = net_pkt_read(pkt, hdr, rd);
+	net_pkt_cursor_restore(pkt, &backup);
+
+	if ((ret != 0) || (rd < 14U)) {
+		return 0;
+	}
+
+	etype = (hdr[12] << 8) | hdr[13];
+
+	if ((etype == NET_ETH_PTYPE_IP) && (rd >= 34U)) {
+		uint8_t ihl = (hdr[14] & 0x0fU) * 4U;
+		size_t ports = 14U + ihl;
+
+		memcpy(&key[keylen], &hdr[26], 8);	/* addresses */
+		keylen += 8;
+		key[keylen++] = hdr[23];		/* protocol */
+		if (((hdr[23] == NET_IPPROTO_TCP) ||
+		     (hdr[23] == NET_IPPROTO_UDP)) && (rd >= (ports + 4U))) {
+			memcpy(&key[keylen], &hdr[ports], 4);
+			keylen += 4;
+		}
+	} else if ((etype == NET_ETH_PTYPE_IPV6) && (rd >= 54U)) {
+		memcpy(&key[keylen], &hdr[22], 32);	/* addresses */
+		keylen += 32;
+		key[keylen++] = hdr[20];		/* next header */
+		if (((hdr[20] == NET_IPPROTO_TCP) ||
+		     (hdr[20] == NET_IPPROTO_UDP)) && (rd >= 58U)) {
+			memcpy(&key[keylen], &hdr[54], 4);
+			keylen += 4;
+		}
+	} else {
+		memcpy(key, hdr, 12);			/* MAC addresses */
+		keylen = 12;
+	}
+
+	return (uint8_t)(sys_hash32(key, keylen) % NET_TC_RX_COUNT);
+}
+#endif /* CONFIG_NET_RX_FLOW_STEERING */
+
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 {
 	size_t len = net_pkt_get_len(pkt);
 	uint8_t prio = net_pkt_priority(pkt);
+#if defined(CONFIG_NET_RX_FLOW_STEERING)
+	uint8_t tc = rx_flow_tc(pkt);
+#else
 	uint8_t tc = net_rx_priority2tc(prio);
+#endif
 
 #if NET_TC_RX_COUNT > 1
 	NET_DBG("TC %d with prio %d pkt %p", tc, prio, pkt);
@@ -545,8 +612,164 @@ drop:
 	return;
 }
 
+
+#if defined(CONFIG_NET_LRO)
+/* Software large-receive-offload stage between the drivers and the IP
+ * input: consecutive in-order IPv4/TCP segments of one flow are
+ * chained into a single large packet that makes one pass through the
+ * stack.  Headers come from the first segment (with the ACK and
+ * window fields refreshed from the newest one); merging is limited to
+ * option-less segments with nothing but ACK/PSH set, and only on
+ * interfaces whose hardware verified the RX checksums, since the
+ * merged packet's checksums are no longer valid.
+ */
+#define LRO_ETH_IP_TCP 54
+#define LRO_TH_ACK 0x10
+#define LRO_TH_PSH 0x08
+
+static struct {
+	struct k_spinlock lock;
+	struct net_pkt *agg;
+	struct net_if *iface;
+	uint32_t next_seq;
+	uint16_t agg_len;	/* aggregated IPv4 total length */
+	uint8_t key[12];	/* addresses + ports */
+	struct k_work_delayable flush_work;
+	bool initialized;
+} lro;
+
+/* lro.lock must be held */
+static void lro_flush_locked(void)
+{
+	struct net_pkt *pkt = lro.agg;
+	uint8_t *hdr;
+	uint16_t tot_len;
+
+	if (pkt == NULL) {
+		return;
+	}
+	lro.agg = NULL;
+
+	hdr = pkt->buffer->data;
+	tot_len = net_htons(lro.agg_len);
+	memcpy(&hdr[16], &tot_len, sizeof(tot_len));
+
+	net_queue_rx(lro.iface, pkt);
+}
+
+static void lro_flush_work(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	K_SPINLOCK(&lro.lock) {
+		lro_flush_locked();
+	}
+}
+
+/* Returns true when the packet was consumed (merged or held) */
+static bool lro_input(struct net_if *iface, struct net_pkt *pkt)
+{
+	struct net_buf *frag = pkt->buffer;
+	uint8_t *hdr;
+	uint16_t tot_len;
+	uint16_t plen;
+	uint32_t seq;
+	uint8_t flags;
+	bool consumed = false;
+
+	K_SPINLOCK(&lro.lock) {
+		if (!lro.initialized) {
+			k_work_init_delayable(&lro.flush_work, lro_flush_work);
+			lro.initialized = true;
+		}
+	}
+
+	if ((frag == NULL) || (frag->len < LRO_ETH_IP_TCP) ||
+	    net_if_need_calc_rx_checksum(iface, NET_IF_CHECKSUM_IPV4_TCP)) {
+		goto flush_pass;
+	}
+
+	hdr = frag->data;
+
+	memcpy(&tot_len, &hdr[16], sizeof(tot_len));
+	tot_len = net_ntohs(tot_len);
+	flags = hdr[47];
+
+	if ((((hdr[12] << 8) | hdr[13]) != NET_ETH_PTYPE_IP) ||
+	    (hdr[14] != 0x45U) ||			/* IPv4, no options */
+	    ((hdr[20] & 0x3fU) != 0U || hdr[21] != 0U) || /* no fragments */
+	    (hdr[23] != NET_IPPROTO_TCP) ||
+	    ((hdr[46] >> 4) != 5U) ||			/* no TCP options */
+	    ((flags & (uint8_t)~(LRO_TH_ACK | LRO_TH_PSH)) != 0U) ||
+	    (tot_len <= 40U)) {
+		goto flush_pass;
+	}
+
+	plen = tot_len - 40U;
+	seq = ((uint32_t)hdr[38] << 24) | ((uint32_t)hdr[39] << 16) |
+	      ((uint32_t)hdr[40] << 8) | hdr[41];
+
+	K_SPINLOCK(&lro.lock) {
+		if ((lro.agg != NULL) &&
+		    ((iface != lro.iface) ||
+		     (memcmp(lro.key, &hdr[26], sizeof(lro.key)) != 0) ||
+		     (seq != lro.next_seq) ||
+		     ((uint32_t)lro.agg_len + plen > CONFIG_NET_LRO_MAX_LEN))) {
+			lro_flush_locked();
+		}
+
+		if (lro.agg == NULL) {
+			if ((flags & LRO_TH_PSH) != 0U) {
+				/* deliver immediately, nothing to gain */
+				K_SPINLOCK_BREAK;
+			}
+
+			lro.agg = pkt;
+			lro.iface = iface;
+			memcpy(lro.key, &hdr[26], sizeof(lro.key));
+			lro.next_seq = seq + plen;
+			lro.agg_len = tot_len;
+			net_pkt_set_chksum_done(pkt, true);
+			k_work_reschedule(&lro.flush_work,
+					  K_MSEC(CONFIG_NET_LRO_FLUSH_TIMEOUT_MS));
+			consumed = true;
+		} else {
+			uint8_t *agg_hdr = lro.agg->buffer->data;
+
+			/* freshen peer feedback from the newest segment */
+			memcpy(&agg_hdr[42], &hdr[42], 4);	/* ack */
+			memcpy(&agg_hdr[48], &hdr[48], 2);	/* window */
+
+			net_buf_pull(frag, LRO_ETH_IP_TCP);
+			net_pkt_append_buffer(lro.agg, frag);
+			pkt->buffer = NULL;
+			net_pkt_unref(pkt);
+
+			lro.agg_len += plen;
+			lro.next_seq += plen;
+			consumed = true;
+
+			if ((flags & LRO_TH_PSH) != 0U) {
+				agg_hdr[47] |= LRO_TH_PSH;
+				lro_flush_locked();
+			}
+		}
+	}
+
+	return consumed;
+
+flush_pass:
+	K_SPINLOCK(&lro.lock) {
+		lro_flush_locked();
+	}
+
+	return false;
+}
+#endif /* CONFIG_NET_LRO */
+
 /* Called by driver when a packet has been received */
 int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+
 {
 	int ret;
 #if defined(CONFIG_NET_DSA) && !defined(CONFIG_NET_DSA_DEPRECATED)
@@ -594,6 +817,12 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 		net_stats_update_filter_rx_drop(net_pkt_iface(pkt));
 		net_pkt_unref(pkt);
 	} else {
+#if defined(CONFIG_NET_LRO)
+		if (lro_input(iface, pkt)) {
+			ret = 0;
+			goto err;
+		}
+#endif
 		net_queue_rx(iface, pkt);
 	}
 
@@ -368,7 +368,23 @@ void net_if_try_queue_tx(struct net_if *iface, struct net_pkt *pkt, k_timeout_t
 		net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
 		net_if_tx(net_pkt_iface(pkt), pkt);
 	} else {
+#if CONFIG_NET_TC_TX_BYTE_LIMIT > 0
+		/* Queue byte limit: refuse to buffer more than the
+		 * configured number of bytes ahead of the driver, so
+		 * congestion surfaces as an immediate drop (and upper
+		 * layer backoff) instead of unbounded queue latency.
+		 */
+		if ((atomic_get(&iface->tx_bytes_queued) + (atomic_val_t)len) >
+		    CONFIG_NET_TC_TX_BYTE_LIMIT) {
+			goto drop;
+		}
+
+		atomic_add(&iface->tx_bytes_queued, (atomic_val_t)len);
+#endif
 		if (net_tc_try_submit_to_tx_queue(tc, pkt, timeout) != NET_OK) {
+#if CONFIG_NET_TC_TX_BYTE_LIMIT > 0
+			atomic_sub(&iface->tx_bytes_queued, (atomic_val_t)len);
+#endif
 			goto drop;
 		}
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
@@ -64,6 +64,9 @@ K_MSGQ_DEFINE(event_msgq, sizeof(struct mgmt_event_entry),
 static struct k_work_q *mgmt_work_q = COND_CODE_1(CONFIG_NET_MGMT_EVENT_SYSTEM_WORKQUEUE,
 	(&k_sys_work_q), (&mgmt_work_q_obj));
 
+/* Events lost to queue overflow since boot */
+static atomic_t mgmt_events_dropped;
+
 static void mgmt_event_work_handler(struct k_work *work);
 static K_WORK_DEFINE(mgmt_work, mgmt_event_work_handler);
 
@@ -97,13 +100,28 @@ static inline void mgmt_push_event(uint64_t mgmt_event, struct net_if *iface,
 	new_event.event = mgmt_event;
 	new_event.iface = iface;
 
+#if defined(CONFIG_NET_MGMT_EVENT_QUEUE_DROP_OLDEST)
+	/* Never block the notifier: under an event storm the newest
+	 * state is the interesting one, so make room by discarding the
+	 * oldest queued event and account for the loss.
+	 */
+	while (k_msgq_put(&event_msgq, &new_event, K_NO_WAIT) != 0) {
+		struct mgmt_event_entry discarded;
+
+		if (k_msgq_get(&event_msgq, &discarded, K_NO_WAIT) == 0) {
+			atomic_inc(&mgmt_events_dropped);
+		}
+	}
+#else
 	if (k_msgq_put(&event_msgq, &new_event,
 		K_MSEC(CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT)) != 0) {
+		atomic_inc(&mgmt_events_dropped);
 		NET_WARN("Failure to push event (0x%" PRIx64 "), "
 			 "try increasing the 'CONFIG_NET_MGMT_EVENT_QUEUE_SIZE' "
 			 "or 'CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT' options.",
 			 mgmt_event);
 	}
+#endif /* CONFIG_NET_MGMT_EVENT_QUEUE_DROP_OLDEST */
 
 	(void)k_mutex_unlock(&net_mgmt_event_lock);
 
@@ -126,8 +144,18 @@ static void mgmt_event_work_handler(struct k_work *work)
 	}
 }
 
+uint32_t net_mgmt_event_queue_dropped(void)
+{
+	return (uint32_t)atomic_get(&mgmt_events_dropped);
+}
+
 #else
 
+uint32_t net_mgmt_event_queue_dropped(void)
+{
+	return 0;
+}
+
 static inline void mgmt_push_event(uint64_t event, struct net_if *iface,
 				   const void *info, size_t length)
 {
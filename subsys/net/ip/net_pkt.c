@@ -1763,6 +1763,33 @@ void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer)
 	}
 }
 
+#if defined(CONFIG_NET_PKT_DRIVER_BUF)
+struct net_pkt *net_pkt_rx_alloc_on_buf(struct net_if *iface,
+					struct net_buf *buffer,
+					k_timeout_t timeout)
+{
+	struct net_pkt *pkt;
+
+	NET_ASSERT(buffer != NULL);
+
+	/* Only the packet descriptor comes from the stack pool; the
+	 * data buffer chain stays the one the driver's DMA engine
+	 * filled.  The packet takes over the driver's reference: when
+	 * the stack is done, the buffer returns to the driver's pool
+	 * and its destroy callback can put it straight back into the
+	 * RX ring.
+	 */
+	pkt = net_pkt_rx_alloc_on_iface(iface, timeout);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	net_pkt_append_buffer(pkt, buffer);
+
+	return pkt;
+}
+#endif /* CONFIG_NET_PKT_DRIVER_BUF */
+
 void net_pkt_cursor_init(struct net_pkt *pkt)
 {
 	pkt->cursor.buf = pkt->buffer;
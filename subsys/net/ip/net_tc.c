@@ -303,6 +303,23 @@ static void tc_tx_handler(void *p1, void *p2, void *p3)
 		k_sem_give(fifo_slot);
 #endif
 
+#if CONFIG_NET_TC_TX_BYTE_LIMIT > 0
+		/* The packet left the queue: return its bytes to the
+		 * interface's queue byte budget before handing it to the
+		 * driver, which is where time is spent from here on.
+		 */
+		atomic_sub(&net_pkt_iface(pkt)->tx_bytes_queued,
+			   (atomic_val_t)net_pkt_get_len(pkt));
+#endif
+
+#if defined(CONFIG_NET_PKT_TX_MORE)
+		/* xmit_more style hint: the driver may chain this
+		 * frame's DMA descriptor and defer the doorbell, as
+		 * another packet is already queued right behind.
+		 */
+		net_pkt_set_tx_more(pkt, !k_fifo_is_empty(fifo));
+#endif
+
 		net_process_tx_packet(pkt);
 	}
 }
@@ -421,6 +438,11 @@ void net_tc_rx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_RX_QUEUE_PIN)
+		/* spread the RX queues across the CPUs, one each */
+		(void)k_thread_cpu_pin(tid, i % arch_num_cpus());
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -321,6 +321,13 @@ static inline bool route_preference_is_lower(uint8_t old, uint8_t new)
 	return new < old;
 }
 
+#if defined(CONFIG_NET_IPV6_DST_CACHE)
+extern void net_ipv6_dst_cache_invalidate(void);
+#define dst_cache_invalidate() net_ipv6_dst_cache_invalidate()
+#else
+#define dst_cache_invalidate() do { } while (false)
+#endif
+
 struct net_route_entry *net_route_add(struct net_if *iface,
 				      struct net_in6_addr *addr,
 				      uint8_t prefix_len,
@@ -330,6 +337,8 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 {
 	struct net_linkaddr *nexthop_lladdr;
 	struct net_nbr *nbr, *nbr_nexthop, *tmp;
+
+	dst_cache_invalidate();
 	struct net_route_nexthop *nexthop_route;
 	struct net_route_entry *route = NULL;
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
@@ -471,6 +480,8 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 exit:
 	net_ipv6_nbr_unlock();
+	dst_cache_invalidate();
+
 	return route;
 }
 
@@ -552,6 +563,8 @@ void net_route_update_lifetime(struct net_route_entry *route, uint32_t lifetime)
 
 int net_route_del(struct net_route_entry *route)
 {
+	dst_cache_invalidate();
+
 	struct net_nbr *nbr;
 	struct net_route_nexthop *nexthop_route;
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
@@ -607,6 +620,8 @@ int net_route_del(struct net_route_entry *route)
 
 	nbr_free(nbr);
 
+	dst_cache_invalidate();
+
 	net_ipv6_nbr_unlock();
 	return 0;
 }
@@ -77,6 +77,64 @@ K_MEM_SLAB_DEFINE_STATIC(tcp_conns_slab, sizeof(struct tcp),
 				CONFIG_NET_MAX_CONTEXTS, 4);
 
 static struct k_work_q tcp_work_q;
+
+#if defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+#define TCP_TIMER_NEVER_TICK UINT64_MAX
+
+static void tcp_conn_timer_rearm(struct tcp *conn)
+{
+	uint64_t earliest = TCP_TIMER_NEVER_TICK;
+
+	for (int i = 0; i < TCP_CONN_TIMER_COUNT; i++) {
+		if (conn->timer_deadline[i].tick < earliest) {
+			earliest = conn->timer_deadline[i].tick;
+		}
+	}
+
+	if (earliest == TCP_TIMER_NEVER_TICK) {
+		(void)k_work_cancel_delayable(&conn->conn_timer);
+	} else {
+		k_timepoint_t tp = { .tick = earliest };
+
+		(void)k_work_reschedule_for_queue(&tcp_work_q, &conn->conn_timer,
+						  sys_timepoint_timeout(tp));
+	}
+}
+
+static void tcp_conn_timer_schedule(struct tcp *conn, enum tcp_conn_timer_id id,
+				    k_timeout_t timeout, bool resched)
+{
+	if (!resched && (conn->timer_deadline[id].tick != TCP_TIMER_NEVER_TICK)) {
+		return;
+	}
+
+	conn->timer_deadline[id] = sys_timepoint_calc(timeout);
+	tcp_conn_timer_rearm(conn);
+}
+
+static void tcp_conn_timer_cancel(struct tcp *conn, enum tcp_conn_timer_id id)
+{
+	conn->timer_deadline[id].tick = TCP_TIMER_NEVER_TICK;
+	tcp_conn_timer_rearm(conn);
+}
+
+#define tcp_timer_reschedule(conn, id, timeout) \
+	tcp_conn_timer_schedule(conn, id, timeout, true)
+#define tcp_timer_schedule(conn, id, timeout) \
+	tcp_conn_timer_schedule(conn, id, timeout, false)
+#define tcp_timer_cancel(conn, id) tcp_conn_timer_cancel(conn, id)
+#define tcp_timer_is_pending(conn, id) \
+	((conn)->timer_deadline[id].tick != TCP_TIMER_NEVER_TICK)
+#else /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+#define tcp_timer_reschedule(conn, id, timeout) \
+	((void)k_work_reschedule_for_queue(&tcp_work_q, &(conn)->id, timeout))
+#define tcp_timer_schedule(conn, id, timeout) \
+	((void)k_work_schedule_for_queue(&tcp_work_q, &(conn)->id, timeout))
+#define tcp_timer_cancel(conn, id) ((void)k_work_cancel_delayable(&(conn)->id))
+#define tcp_timer_is_pending(conn, id) \
+	k_work_delayable_is_pending(&(conn)->id)
+#endif /* CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+
 static K_KERNEL_STACK_DEFINE(work_q_stack, CONFIG_NET_TCP_WORKQ_STACK_SIZE);
 
 static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt);
@@ -616,7 +674,9 @@ static void keep_alive_timer_init(struct tcp *conn)
 	conn->keep_cnt = CONFIG_NET_TCP_KEEPCNT_DEFAULT;
 	NET_DBG("[%p] keepalive timer init idle = %d, interval = %d, cnt = %d",
 		conn, conn->keep_idle, conn->keep_intvl, conn->keep_cnt);
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
 	k_work_init_delayable(&conn->keepalive_timer, tcp_send_keepalive_probe);
+#endif
 }
 
 static void keep_alive_param_copy(struct tcp *to, struct tcp *from)
@@ -634,13 +694,12 @@ static void keep_alive_timer_restart(struct tcp *conn)
 	}
 
 	conn->keep_cur = 0;
-	k_work_reschedule_for_queue(&tcp_work_q, &conn->keepalive_timer,
-				    K_SECONDS(conn->keep_idle));
+	tcp_timer_reschedule(conn, keepalive_timer, K_SECONDS(conn->keep_idle));
 }
 
 static void keep_alive_timer_stop(struct tcp *conn)
 {
-	k_work_cancel_delayable(&conn->keepalive_timer);
+	tcp_timer_cancel(conn, keepalive_timer);
 }
 
 static int set_tcp_keep_alive(struct tcp *conn, const void *value, size_t len)
@@ -895,10 +954,14 @@ static void tcp_conn_release(struct k_work *work)
 		}
 	}
 
+#if defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+	(void)k_work_cancel_delayable(&conn->conn_timer);
+#else
 	(void)k_work_cancel_delayable(&conn->timewait_timer);
 	(void)k_work_cancel_delayable(&conn->fin_timer);
 	(void)k_work_cancel_delayable(&conn->persist_timer);
 	(void)k_work_cancel_delayable(&conn->ack_timer);
+#endif /* CONFIG_NET_TCP_CONSOLIDATED_TIMER */
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
 	keep_alive_timer_stop(conn);
@@ -1222,7 +1285,7 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 	if (((short_win_before && !short_win_after) ||
 	     tcp_need_window_update(conn)) &&
 	    conn->state == TCP_ESTABLISHED) {
-		k_work_cancel_delayable(&conn->ack_timer);
+		tcp_timer_cancel(conn, ack_timer);
 		tcp_out(conn, ACK);
 	}
 
@@ -2012,10 +2075,8 @@ static void tcp_resend_data(struct k_work *work)
 	}
 }
 
-static void tcp_timewait_timeout(struct k_work *work)
+static void tcp_timewait_handle(struct tcp *conn)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, timewait_timer);
 
 	/* no need to acquire the conn->lock as there is nothing scheduled here */
 	NET_DBG("[%p] %s", conn, tcp_conn_state(conn, NULL));
@@ -2023,6 +2084,15 @@ static void tcp_timewait_timeout(struct k_work *work)
 	(void)tcp_conn_close(conn, -ETIMEDOUT);
 }
 
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+static void tcp_timewait_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+	tcp_timewait_handle(CONTAINER_OF(dwork, struct tcp, timewait_timer));
+}
+#endif /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+
 static void tcp_establish_timeout(struct tcp *conn)
 {
 	NET_DBG("[%p] Did not receive %s in %dms", conn, "ACK", ACK_TIMEOUT_MS);
@@ -2031,11 +2101,8 @@ static void tcp_establish_timeout(struct tcp *conn)
 	(void)tcp_conn_close(conn, -ETIMEDOUT);
 }
 
-static void tcp_fin_timeout(struct k_work *work)
+static void tcp_fin_handle(struct tcp *conn)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, fin_timer);
-
 	/* no need to acquire the conn->lock as there is nothing scheduled here */
 	if (conn->state == TCP_SYN_RECEIVED) {
 		tcp_establish_timeout(conn);
@@ -2048,48 +2115,59 @@ static void tcp_fin_timeout(struct k_work *work)
 	(void)tcp_conn_close(conn, -ETIMEDOUT);
 }
 
-static void tcp_last_ack_timeout(struct k_work *work)
+static void tcp_last_ack_handle(struct tcp *conn)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, fin_timer);
-
 	NET_DBG("[%p] Did not receive %s in %dms", conn, "last ACK", LAST_ACK_TIMEOUT_MS);
 	NET_DBG("[%p] %s", conn, tcp_conn_state(conn, NULL));
 
 	(void)tcp_conn_close(conn, -ETIMEDOUT);
 }
 
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+static void tcp_fin_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+	tcp_fin_handle(CONTAINER_OF(dwork, struct tcp, fin_timer));
+}
+
+static void tcp_last_ack_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+	tcp_last_ack_handle(CONTAINER_OF(dwork, struct tcp, fin_timer));
+}
+#endif /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+
 static void tcp_setup_last_ack_timer(struct tcp *conn)
 {
 	/* Just in case the last ack is lost, install a timer that will
 	 * close the connection in that case. Use the fin_timer for that
 	 * as the fin handling cannot be done in this passive close state.
-	 * Instead of default tcp_fin_timeout() function, have a separate
-	 * function to catch this last ack case.
+	 * With the consolidated timer the dispatcher selects the last-ack
+	 * handler from the LAST_ACK state instead of re-pointing the work
+	 * item.
 	 */
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
 	k_work_init_delayable(&conn->fin_timer, tcp_last_ack_timeout);
+#endif
 
 	NET_DBG("[%p] TCP connection in %s close, not disposing yet (waiting %dms)",
 		conn, "passive", LAST_ACK_TIMEOUT_MS);
 
-	k_work_reschedule_for_queue(&tcp_work_q,
-				    &conn->fin_timer,
-				    LAST_ACK_TIMEOUT);
+	tcp_timer_reschedule(conn, fin_timer, LAST_ACK_TIMEOUT);
 }
 
 static void tcp_cancel_last_ack_timer(struct tcp *conn)
 {
 	NET_DBG("[%p] Cancel last ack timer", conn);
 
-	k_work_cancel_delayable(&conn->fin_timer);
+	tcp_timer_cancel(conn, fin_timer);
 }
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
-static void tcp_send_keepalive_probe(struct k_work *work)
+static void tcp_keepalive_handle(struct tcp *conn)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, keepalive_timer);
-
 	if (conn->state != TCP_ESTABLISHED) {
 		NET_DBG("[%p] TCP connection not established", conn);
 		return;
@@ -2109,18 +2187,23 @@ static void tcp_send_keepalive_probe(struct k_work *work)
 	}
 
 	NET_DBG("[%p] keepalive probe", conn);
-	k_work_reschedule_for_queue(&tcp_work_q, &conn->keepalive_timer,
-				    K_SECONDS(conn->keep_intvl));
+	tcp_timer_reschedule(conn, keepalive_timer, K_SECONDS(conn->keep_intvl));
 
 	(void)tcp_out_ext(conn, ACK, NULL, conn->seq + conn->unacked_len - 1);
 }
-#endif /* CONFIG_NET_TCP_KEEPALIVE */
 
-static void tcp_send_zwp(struct k_work *work)
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+static void tcp_send_keepalive_probe(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, persist_timer);
 
+	tcp_keepalive_handle(CONTAINER_OF(dwork, struct tcp, keepalive_timer));
+}
+#endif /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+#endif /* CONFIG_NET_TCP_KEEPALIVE */
+
+static void tcp_zwp_handle(struct tcp *conn)
+{
 	k_mutex_lock(&conn->lock, K_FOREVER);
 
 	(void)tcp_out_ext(conn, ACK, NULL, conn->seq + conn->unacked_len - 1);
@@ -2140,25 +2223,109 @@ static void tcp_send_zwp(struct k_work *work)
 			timeout = ZWP_MAX_DELAY_MS;
 		}
 
-		(void)k_work_reschedule_for_queue(
-			&tcp_work_q, &conn->persist_timer, K_MSEC(timeout));
+		tcp_timer_reschedule(conn, persist_timer, K_MSEC(timeout));
 	}
 
 	k_mutex_unlock(&conn->lock);
 }
 
-static void tcp_send_ack(struct k_work *work)
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+static void tcp_send_zwp(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, ack_timer);
 
+	tcp_zwp_handle(CONTAINER_OF(dwork, struct tcp, persist_timer));
+}
+#endif /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+
+static void tcp_ack_handle(struct tcp *conn)
+{
 	k_mutex_lock(&conn->lock, K_FOREVER);
 
+#if CONFIG_NET_TCP_ACK_EVERY_N > 1
+	conn->rcv_segs_since_ack = 0;
+#endif
 	tcp_out(conn, ACK);
 
 	k_mutex_unlock(&conn->lock);
 }
 
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+static void tcp_send_ack(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+
+	tcp_ack_handle(CONTAINER_OF(dwork, struct tcp, ack_timer));
+}
+#endif /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+
+#if defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+/* Earliest-deadline dispatcher: fire the most overdue logical timer,
+ * re-arm for whatever remains, and let an immediate re-run handle
+ * simultaneous expiries.  Exactly one handler runs per invocation so
+ * a handler that closes the connection (cancelling the work item)
+ * leaves nothing behind to touch freed memory.
+ */
+static void tcp_conn_timer_expired(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, conn_timer);
+	int expired = -1;
+	uint64_t best = TCP_TIMER_NEVER_TICK;
+
+	/* The deadline bookkeeping is covered by the connection lock
+	 * like the rest of the connection state; the handler itself
+	 * is invoked without it and takes it as needed.
+	 */
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	for (int i = 0; i < TCP_CONN_TIMER_COUNT; i++) {
+		if ((conn->timer_deadline[i].tick != TCP_TIMER_NEVER_TICK) &&
+		    sys_timepoint_expired(conn->timer_deadline[i]) &&
+		    (conn->timer_deadline[i].tick < best)) {
+			best = conn->timer_deadline[i].tick;
+			expired = i;
+		}
+	}
+
+	if (expired < 0) {
+		tcp_conn_timer_rearm(conn);
+		k_mutex_unlock(&conn->lock);
+		return;
+	}
+
+	conn->timer_deadline[expired].tick = TCP_TIMER_NEVER_TICK;
+	tcp_conn_timer_rearm(conn);
+	k_mutex_unlock(&conn->lock);
+
+	switch (expired) {
+	case ack_timer:
+		tcp_ack_handle(conn);
+		break;
+	case persist_timer:
+		tcp_zwp_handle(conn);
+		break;
+	case timewait_timer:
+		tcp_timewait_handle(conn);
+		break;
+#if defined(CONFIG_NET_TCP_KEEPALIVE)
+	case keepalive_timer:
+		tcp_keepalive_handle(conn);
+		break;
+#endif
+	case fin_timer:
+		if (conn->state == TCP_LAST_ACK) {
+			tcp_last_ack_handle(conn);
+		} else {
+			tcp_fin_handle(conn);
+		}
+		break;
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+
 static void tcp_conn_ref(struct tcp *conn)
 {
 	int ref_count = atomic_inc(&conn->ref_count) + 1;
@@ -2214,12 +2381,21 @@ static struct tcp *tcp_conn_alloc(void)
 	sys_slist_init(&conn->send_queue);
 
 	k_work_init_delayable(&conn->send_timer, tcp_send_process);
+#if defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+	k_work_init_delayable(&conn->conn_timer, tcp_conn_timer_expired);
+	for (int i = 0; i < TCP_CONN_TIMER_COUNT; i++) {
+		conn->timer_deadline[i].tick = TCP_TIMER_NEVER_TICK;
+	}
+#else
 	k_work_init_delayable(&conn->timewait_timer, tcp_timewait_timeout);
 	k_work_init_delayable(&conn->fin_timer, tcp_fin_timeout);
+#endif /* CONFIG_NET_TCP_CONSOLIDATED_TIMER */
 	k_work_init_delayable(&conn->send_data_timer, tcp_resend_data);
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#endif /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -2634,10 +2810,9 @@ static int32_t tcp_compute_new_length(struct tcp *conn, struct tcphdr *hdr, size
 static enum tcp_state tcp_enter_time_wait(struct tcp *conn)
 {
 	/* Entering TIME-WAIT, so cancel the timer and start the TIME-WAIT timer */
-	k_work_cancel_delayable(&conn->fin_timer);
-	k_work_reschedule_for_queue(
-		&tcp_work_q, &conn->timewait_timer,
-		K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+	tcp_timer_cancel(conn, fin_timer);
+	tcp_timer_reschedule(conn, timewait_timer,
+			     K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
 	return TCP_TIME_WAIT;
 }
 
@@ -2830,10 +3005,21 @@ static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 	 * as described in RFC 813.
 	 */
 	if (tcp_short_window(conn) || !psh) {
-		k_work_schedule_for_queue(&tcp_work_q, &conn->ack_timer,
-					  ACK_DELAY);
+		tcp_timer_schedule(conn, ack_timer, ACK_DELAY);
 	} else {
-		k_work_cancel_delayable(&conn->ack_timer);
+#if CONFIG_NET_TCP_ACK_EVERY_N > 1
+		/* Bulk transfers push every segment: batch them into
+		 * one cumulative ACK per N segments, with the delayed
+		 * ACK timer as the fallback for the tail.
+		 */
+		conn->rcv_segs_since_ack++;
+		if (conn->rcv_segs_since_ack < CONFIG_NET_TCP_ACK_EVERY_N) {
+			tcp_timer_schedule(conn, ack_timer, ACK_DELAY);
+			return ret;
+		}
+		conn->rcv_segs_since_ack = 0;
+#endif
+		tcp_timer_cancel(conn, ack_timer);
 		tcp_out(conn, ACK);
 	}
 
@@ -3066,13 +3252,13 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	}
 
 	if (conn->send_win == 0) {
-		if (!k_work_delayable_is_pending(&conn->persist_timer)) {
+		if (!tcp_timer_is_pending(conn, persist_timer)) {
 			conn->zwp_retries = 0;
-			(void)k_work_reschedule_for_queue(&tcp_work_q, &conn->persist_timer,
-							  K_MSEC(TCP_RTO_MS));
+			tcp_timer_reschedule(conn, persist_timer,
+					     K_MSEC(TCP_RTO_MS));
 		}
 	} else {
-		(void)k_work_cancel_delayable(&conn->persist_timer);
+		tcp_timer_cancel(conn, persist_timer);
 	}
 
 	if (tcp_window_full(conn)) {
@@ -3105,9 +3291,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			/* Close the connection if we do not receive ACK on time.
 			 */
-			k_work_reschedule_for_queue(&tcp_work_q,
-						    &conn->establish_timer,
-						    ACK_TIMEOUT);
+			tcp_timer_reschedule(conn, establish_timer, ACK_TIMEOUT);
 			verdict = NET_OK;
 		} else {
 			k_mutex_unlock(&conn->lock);
@@ -3125,7 +3309,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				keep_alive_param_copy(conn, conn->accepted_conn);
 			}
 
-			k_work_cancel_delayable(&conn->establish_timer);
+			tcp_timer_cancel(conn, establish_timer);
 			k_work_cancel_delayable(&conn->send_data_timer);
 			tcp_conn_ref(conn);
 			net_context_set_state(conn->context,
@@ -3362,9 +3546,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				} else {
 					/* Otherwise, wait for FIN in TCP_FIN_WAIT_1 */
 					next = TCP_FIN_WAIT_1;
-					k_work_reschedule_for_queue(&tcp_work_q,
-								    &conn->fin_timer,
-								    FIN_TIMEOUT);
+					tcp_timer_reschedule(conn, fin_timer,
+							     FIN_TIMEOUT);
 				}
 
 				tcp_out(conn, FIN | ACK);
@@ -3734,9 +3917,7 @@ int net_tcp_put(struct net_context *context, bool force_close)
 			NET_DBG("[%p] TCP connection in %s close, "
 				"not disposing yet (waiting %dms)",
 				conn, "active", tcp_max_timeout_ms);
-			k_work_reschedule_for_queue(&tcp_work_q,
-							&conn->fin_timer,
-							FIN_TIMEOUT);
+			tcp_timer_reschedule(conn, fin_timer, FIN_TIMEOUT);
 
 			tcp_out(conn, FIN | ACK);
 			conn_seq(conn, + 1);
@@ -3803,6 +3984,51 @@ int net_tcp_update_recv_wnd(struct net_context *context, int32_t delta)
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+static void tcp_zc_destroy(struct net_buf *buf);
+
+/* Zero-copy TX: the application's buffer enters the retransmission
+ * queue as an external-data fragment instead of being copied.  The
+ * fragment is released -- firing the registered completion callback
+ * -- only once every byte it covers has been acknowledged and
+ * trimmed from the queue, which is exactly when the application may
+ * reuse the memory.  The copy into the outgoing wire packet remains,
+ * as retransmission requires the queue to stay intact.
+ */
+NET_BUF_POOL_DEFINE(tcp_zc_pool, CONFIG_NET_TCP_ZEROCOPY_TX_COUNT, 0,
+		    sizeof(struct net_context *), tcp_zc_destroy);
+
+static void tcp_zc_destroy(struct net_buf *buf)
+{
+	struct net_context *context = *(struct net_context **)buf->user_data;
+
+	if ((context != NULL) && (context->zc_complete_cb != NULL)) {
+		context->zc_complete_cb(context, buf->__buf, buf->size,
+					context->zc_user_data);
+	}
+
+	net_buf_destroy(buf);
+}
+
+static int tcp_pkt_append_external(struct tcp *conn,
+				   struct net_context *context,
+				   const uint8_t *data, size_t len)
+{
+	struct net_buf *buf;
+
+	buf = net_buf_alloc_with_data(&tcp_zc_pool, (void *)data, len,
+				      TCP_PKT_ALLOC_TIMEOUT);
+	if (buf == NULL) {
+		return -ENOBUFS;
+	}
+
+	*(struct net_context **)buf->user_data = context;
+	net_pkt_append_buffer(&conn->send_data, buf);
+
+	return 0;
+}
+#endif /* CONFIG_NET_TCP_ZEROCOPY_TX */
+
 int net_tcp_queue(struct net_context *context, const void *data, size_t len,
 		  const struct net_msghdr *msg)
 {
@@ -3863,7 +4089,14 @@ int net_tcp_queue(struct net_context *context, const void *data, size_t len,
 			}
 		}
 	} else {
-		ret = tcp_pkt_append(&conn->send_data, data, len);
+#if defined(CONFIG_NET_TCP_ZEROCOPY_TX)
+		if ((context->zc_complete_cb != NULL) && (len > 0)) {
+			ret = tcp_pkt_append_external(conn, context, data, len);
+		} else
+#endif
+		{
+			ret = tcp_pkt_append(&conn->send_data, data, len);
+		}
 		if (ret < 0) {
 			goto out;
 		}
@@ -255,6 +255,22 @@ struct tcp_collision_avoidance_reno {
 struct tcp;
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
+#if defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+/* Logical timers multiplexed onto the single per-connection
+ * delayable.  The enumerator names deliberately match the historical
+ * field names so call sites read identically in both modes.
+ */
+enum tcp_conn_timer_id {
+	ack_timer,
+	persist_timer,
+	timewait_timer,
+	keepalive_timer,
+	fin_timer,
+	establish_timer = fin_timer,
+	TCP_CONN_TIMER_COUNT
+};
+#endif /* CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+
 struct tcp { /* TCP connection */
 	sys_snode_t next;
 	struct net_context *context;
@@ -289,14 +305,28 @@ struct tcp { /* TCP connection */
 	struct k_work_delayable send_timer;
 	struct k_work_delayable recv_queue_timer;
 	struct k_work_delayable send_data_timer;
+#if defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
+	/* One delayable multiplexing the ack/persist/timewait/
+	 * keepalive/fin timers with earliest-deadline dispatch; the
+	 * per-timer deadlines use UINT64_MAX ticks as "disarmed".
+	 */
+	struct k_work_delayable conn_timer;
+	k_timepoint_t timer_deadline[TCP_CONN_TIMER_COUNT];
+#else
 	struct k_work_delayable timewait_timer;
 	struct k_work_delayable persist_timer;
 	struct k_work_delayable ack_timer;
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	struct k_work_delayable keepalive_timer;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
+#endif /* CONFIG_NET_TCP_CONSOLIDATED_TIMER */
+#if CONFIG_NET_TCP_ACK_EVERY_N > 1
+	/* in-order data segments received since the last ACK we sent */
+	uint8_t rcv_segs_since_ack;
+#endif
 	struct k_work conn_release;
 
+#if !defined(CONFIG_NET_TCP_CONSOLIDATED_TIMER)
 	union {
 		/* Because FIN and establish timers are never happening
 		 * at the same time, share the timer between them to
@@ -305,6 +335,7 @@ struct tcp { /* TCP connection */
 		struct k_work_delayable fin_timer;
 		struct k_work_delayable establish_timer;
 	};
+#endif /* !CONFIG_NET_TCP_CONSOLIDATED_TIMER */
 	union tcp_endpoint src;
 	union tcp_endpoint dst;
 #if defined(CONFIG_NET_TCP_IPV6_ND_REACHABILITY_HINT)
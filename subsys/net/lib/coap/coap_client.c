@@ -978,6 +978,19 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 						 coap_client_default_block_size(),
 						 0);
 			internal_req->offset = 0;
+		} else if (internal_req->recv_blk_ctx.current == 0) {
+			/* First response of a transfer the application
+			 * started mid-resource (a ranged fetch created with
+			 * coap_client_option_block2()): seed the context at
+			 * the requested block so offsets stay absolute.
+			 */
+			coap_block_transfer_init(&internal_req->recv_blk_ctx,
+						 coap_client_default_block_size(),
+						 0);
+			internal_req->recv_blk_ctx.current =
+				block_num *
+				coap_block_size_to_bytes(GET_BLOCK_SIZE(block_option));
+			internal_req->offset = internal_req->recv_blk_ctx.current;
 		}
 
 		ret = coap_update_from_block(response, &internal_req->recv_blk_ctx);
@@ -1212,6 +1225,34 @@ struct coap_client_option coap_client_option_initial_block2(void)
 	return block2;
 }
 
+/* RFC 7959: the block number is a 20-bit unsigned integer */
+#define COAP_BLOCK_NUM_MAX 0xFFFFFU
+
+struct coap_client_option coap_client_option_block2(uint32_t block_num)
+{
+	struct coap_client_option block2 = {
+		.code = COAP_OPTION_BLOCK2,
+	};
+	uint32_t value = (MIN(block_num, COAP_BLOCK_NUM_MAX) << 4) |
+			 coap_bytes_to_block_size(CONFIG_COAP_CLIENT_BLOCK_SIZE);
+
+	if (value > 0xFFFF) {
+		block2.len = 3;
+		block2.value[0] = (uint8_t)(value >> 16);
+		block2.value[1] = (uint8_t)(value >> 8);
+		block2.value[2] = (uint8_t)value;
+	} else if (value > 0xFF) {
+		block2.len = 2;
+		block2.value[0] = (uint8_t)(value >> 8);
+		block2.value[1] = (uint8_t)value;
+	} else {
+		block2.len = 1;
+		block2.value[0] = (uint8_t)value;
+	}
+
+	return block2;
+}
+
 bool coap_client_has_ongoing_exchange(struct coap_client *client)
 {
 	if (client == NULL) {
@@ -12,6 +12,13 @@ LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
 
+static struct dns_cache_stats cache_stats;
+
+void dns_cache_stats_get(struct dns_cache_stats *stats)
+{
+	*stats = cache_stats;
+}
+
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
@@ -67,11 +74,56 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 	cache->entries[index_to_replace].data = *addrinfo;
 	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
 	cache->entries[index_to_replace].in_use = true;
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+	cache->entries[index_to_replace].negative = false;
+
+	/* a fresh positive answer supersedes any live negative entry */
+	for (size_t i = 0; i < cache->size; i++) {
+		if ((i != index_to_replace) && cache->entries[i].in_use &&
+		    cache->entries[i].negative &&
+		    (strcmp(cache->entries[i].query, query) == 0) &&
+		    (cache->entries[i].data.ai_family == addrinfo->ai_family)) {
+			cache->entries[i].in_use = false;
+		}
+	}
+#endif
+
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+int dns_cache_add_negative(struct dns_cache *cache, char const *query,
+			   enum dns_query_type type, uint32_t ttl)
+{
+	struct dns_addrinfo info = { 0 };
+	int ret;
+
+	info.ai_family = (type == DNS_QUERY_TYPE_A) ? NET_AF_INET : NET_AF_INET6;
+
+	ret = dns_cache_add(cache, query, &info, ttl);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	/* flag the entry we just stored */
+	for (size_t i = 0; i < cache->size; i++) {
+		if (cache->entries[i].in_use &&
+		    (strcmp(cache->entries[i].query, query) == 0) &&
+		    (cache->entries[i].data.ai_family == info.ai_family) &&
+		    (cache->entries[i].data.ai_addrlen == 0)) {
+			cache->entries[i].negative = true;
+		}
+	}
 
 	k_mutex_unlock(cache->lock);
 
 	return 0;
 }
+#endif /* CONFIG_DNS_RESOLVER_CACHE_NEGATIVE */
 
 int dns_cache_remove(struct dns_cache *cache, char const *query)
 {
@@ -140,6 +192,14 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		if (cache->entries[i].data.ai_family != family) {
 			continue;
 		}
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+		if (cache->entries[i].negative) {
+			NET_DBG("Negative entry for \"%s\"", query);
+			cache_stats.negative_hits++;
+			k_mutex_unlock(cache->lock);
+			return -ENXIO;
+		}
+#endif
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
@@ -158,7 +218,11 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 
 	if (found == 0) {
 		NET_DBG("Could not find \"%s\"", query);
+		cache_stats.misses++;
+	} else {
+		cache_stats.hits++;
 	}
+
 	return found;
 }
 
@@ -23,6 +23,17 @@ struct dns_cache_entry {
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
 	bool in_use;
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+	/* Entry records a failed resolution (e.g. NXDOMAIN) */
+	bool negative;
+#endif
+};
+
+/** DNS cache hit/miss statistics */
+struct dns_cache_stats {
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t negative_hits;
 };
 
 struct dns_cache {
@@ -55,6 +66,29 @@ struct dns_cache {
  */
 int dns_cache_flush(struct dns_cache *cache);
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+/**
+ * @brief Caches a failed resolution so repeated lookups of a
+ * non-existing name fail fast until the negative TTL expires.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which failed to resolve.
+ * @param type Query type (A or AAAA) that failed.
+ * @param ttl Negative time to live in seconds.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query,
+			   enum dns_query_type type, uint32_t ttl);
+#endif
+
+/**
+ * @brief Read the cache hit/miss counters.
+ *
+ * @param stats Filled with the counters accumulated since boot.
+ */
+void dns_cache_stats_get(struct dns_cache_stats *stats);
+
 /**
  * @brief Adds a new entry to the dns cache removing the one closest to expiry
  * if no free space is available.
@@ -356,6 +356,14 @@ quit:
 		goto free_buf;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+	if (ret == DNS_EAI_FAIL) {
+		(void)dns_cache_add_negative(&dns_cache, ctx->queries[i].query,
+					     ctx->queries[i].query_type,
+					     CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL);
+	}
+#endif
+
 	invoke_query_callback(ret, NULL, &ctx->queries[i]);
 
 	/* Marks the end of the results */
@@ -1921,6 +1929,16 @@ try_resolve:
 
 			return 0;
 		}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE_NEGATIVE)
+		if (ret == -ENXIO) {
+			/* Cached negative result: fail fast instead of
+			 * asking the servers again.
+			 */
+			cb(DNS_EAI_FAIL, NULL, user_data);
+			return 0;
+		}
+#endif
 	}
 #else
 	ARG_UNUSED(use_cache);
@@ -2132,6 +2150,14 @@ try_resolve:
 			continue;
 		}
 
+		if (IS_ENABLED(CONFIG_DNS_RESOLVER_PARALLEL_QUERIES)) {
+			/* Race the query against every configured server;
+			 * the first answer wins and later ones find the
+			 * query slot already released and are dropped.
+			 */
+			continue;
+		}
+
 		/* Do one concurrent query only for each name resolve.
 		 * TODO: Change the i (query index) to do multiple concurrent
 		 *       to each server.
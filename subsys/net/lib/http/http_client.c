@@ -481,10 +481,90 @@ static int http_report_progress(struct http_request *req)
 	return 0;
 }
 
-static int http_wait_data(int sock, struct http_request *req, const k_timepoint_t req_end_timepoint)
+/* Run the parser over the bytes accumulated in the receive buffer and
+ * update the response bookkeeping.  @a offset holds the number of
+ * unparsed bytes in the buffer on entry and on exit (leftovers are
+ * moved to the front of the buffer).  @a received is the size of the
+ * latest read; zero indicates EOF to the parser.
+ */
+static int http_process_data(struct http_request *req, size_t *offset,
+			     int received)
 {
-	int total_received = 0;
-	size_t offset = 0, processed = 0;
+	size_t processed;
+	int ret;
+
+	/* Initialize the data length with the received data length. */
+	req->internal.response.data_len = *offset;
+
+	/* In case of EOF on a socket, indicate this by passing
+	 * 0 length to the parser.
+	 */
+	processed = http_parser_execute(
+		&req->internal.parser, &req->internal.parser_settings,
+		req->internal.response.recv_buf, received > 0 ? *offset : 0);
+
+	if (processed > *offset) {
+		LOG_ERR("HTTP parser error, too much data consumed");
+		return -EBADMSG;
+	}
+
+	if (req->internal.parser.http_errno != HPE_OK) {
+		LOG_ERR("HTTP parsing error, %d",
+			req->internal.parser.http_errno);
+		return -EBADMSG;
+	}
+
+	/* Update the response data length with the actually
+	 * processed bytes.
+	 */
+	req->internal.response.data_len = processed;
+	*offset -= processed;
+
+	if (*offset >= req->internal.response.recv_buf_len) {
+		/* This means the parser did not consume any data
+		 * and we can't fit any more in the buffer.
+		 */
+		LOG_ERR("HTTP RX buffer full, cannot proceed");
+		return -ENOMEM;
+	}
+
+	if (req->internal.response.message_complete) {
+		http_report_complete(req);
+	} else {
+		ret = http_report_progress(req);
+		if (ret < 0) {
+			LOG_DBG("Connection aborted by the application (%d)",
+				ret);
+			return -ECONNABORTED;
+		}
+
+		/* Re-use the result buffer and start to fill it again */
+		req->internal.response.data_len = 0;
+		req->internal.response.body_frag_start = NULL;
+		req->internal.response.body_frag_len = 0;
+	}
+
+	if (*offset > 0) {
+		/* In case there are any unprocessed data left,
+		 * move them to the front of the buffer.
+		 */
+		memmove(req->internal.response.recv_buf,
+			req->internal.response.recv_buf + processed,
+			*offset);
+	}
+
+	return 0;
+}
+
+/* @a prefill bytes already sitting unparsed at the front of the receive
+ * buffer (a pipelined response tail) are parsed before reading from the
+ * socket.
+ */
+static int http_wait_data(int sock, struct http_request *req,
+			  const k_timepoint_t req_end_timepoint, size_t prefill)
+{
+	int total_received = (int)prefill;
+	size_t offset = prefill;
 	int received, ret;
 	struct zsock_pollfd fds[1];
 	int nfds = 1;
@@ -492,7 +572,16 @@ static int http_wait_data(int sock, struct http_request *req, const k_timepoint_
 	fds[0].fd = sock;
 	fds[0].events = ZSOCK_POLLIN;
 
-	do {
+	if (offset > 0) {
+		ret = http_process_data(req, &offset, (int)prefill);
+		if (ret == -ECONNABORTED) {
+			return ret;
+		} else if (ret < 0) {
+			goto error;
+		}
+	}
+
+	while (!req->internal.response.message_complete) {
 		k_ticks_t req_timeout_ticks =
 			sys_timepoint_timeout(req_end_timepoint).ticks;
 		int req_timeout_ms = k_ticks_to_ms_floor32(req_timeout_ticks);
@@ -532,74 +621,17 @@ static int http_wait_data(int sock, struct http_request *req, const k_timepoint_
 			total_received += received;
 			offset += received;
 
-			/* Initialize the data length with the received data length. */
-			req->internal.response.data_len = offset;
-
-			/* In case of EOF on a socket, indicate this by passing
-			 * 0 length to the parser.
-			 */
-			processed = http_parser_execute(
-				&req->internal.parser, &req->internal.parser_settings,
-				req->internal.response.recv_buf, received > 0 ? offset : 0);
-
-			if (processed > offset) {
-				LOG_ERR("HTTP parser error, too much data consumed");
-				ret = -EBADMSG;
-				goto error;
-			}
-
-			if (req->internal.parser.http_errno != HPE_OK) {
-				LOG_ERR("HTTP parsing error, %d",
-					req->internal.parser.http_errno);
-				ret = -EBADMSG;
-				goto error;
-			}
-
-			/* Update the response data length with the actually
-			 * processed bytes.
-			 */
-			req->internal.response.data_len = processed;
-			offset -= processed;
-
-			if (offset >= req->internal.response.recv_buf_len) {
-				/* This means the parser did not consume any data
-				 * and we can't fit any more in the buffer.
-				 */
-				LOG_ERR("HTTP RX buffer full, cannot proceed");
-				ret = -ENOMEM;
+			ret = http_process_data(req, &offset, received);
+			if (ret == -ECONNABORTED) {
+				return ret;
+			} else if (ret < 0) {
 				goto error;
 			}
-
-			if (req->internal.response.message_complete) {
-				http_report_complete(req);
-			} else {
-				ret = http_report_progress(req);
-				if (ret < 0) {
-					LOG_DBG("Connection aborted by the application (%d)",
-						ret);
-					return -ECONNABORTED;
-				}
-
-				/* Re-use the result buffer and start to fill it again */
-				req->internal.response.data_len = 0;
-				req->internal.response.body_frag_start = NULL;
-				req->internal.response.body_frag_len = 0;
-			}
-
-			if (offset > 0) {
-				/* In case there are any unprocessed data left,
-				 * move them to the front of the buffer.
-				 */
-				memmove(req->internal.response.recv_buf,
-					req->internal.response.recv_buf + processed,
-					offset);
-			}
 		} else if (fds[0].revents & ZSOCK_POLLHUP) {
 			/* Connection closed */
 			goto closed;
 		}
-
-	} while (!req->internal.response.message_complete);
+	}
 
 	/* If there's still some data left in the buffer after HTTP processing,
 	 * reflect this in data_len variable.
@@ -629,23 +661,20 @@ error:
 	return ret;
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+/* Assemble and send one request; response state is initialized but
+ * nothing is read back yet.
+ */
+static int http_client_send_req(int sock, struct http_request *req,
+				const k_timepoint_t req_end_timepoint,
+				void *user_data)
 {
 	/* Utilize the network usage by sending data in bigger blocks */
 	char send_buf[MAX_SEND_BUF_LEN];
 	const size_t send_buf_max_len = sizeof(send_buf);
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
-	int ret, total_recv, i;
+	int ret, i;
 	const char *method;
-	k_timeout_t req_timeout = (timeout == SYS_FOREVER_MS) ? K_FOREVER : K_MSEC(timeout);
-	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
-
-	if (sock < 0 || req == NULL || req->response == NULL ||
-	    req->recv_buf == NULL || req->recv_buf_len == 0) {
-		return -EINVAL;
-	}
 
 	memset(&req->internal.response, 0, sizeof(req->internal.response));
 
@@ -820,21 +849,104 @@ int http_client_req(int sock, struct http_request *req,
 
 	NET_DBG("Sent %d bytes", total_sent);
 
+	return total_sent;
+
+out:
+	return ret;
+}
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	int total_sent, total_recv;
+	k_timeout_t req_timeout = (timeout == SYS_FOREVER_MS) ? K_FOREVER : K_MSEC(timeout);
+	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
+
+	if (sock < 0 || req == NULL || req->response == NULL ||
+	    req->recv_buf == NULL || req->recv_buf_len == 0) {
+		return -EINVAL;
+	}
+
+	total_sent = http_client_send_req(sock, req, req_end_timepoint, user_data);
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
 	http_client_init_parser(&req->internal.parser,
 				&req->internal.parser_settings);
 
 	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req, req_end_timepoint);
+	total_recv = http_wait_data(sock, req, req_end_timepoint, 0);
 	if (total_recv < 0) {
 		NET_DBG("Wait data failure (%d)", total_recv);
-		ret = total_recv;
-		goto out;
+		return total_recv;
 	}
 
 	NET_DBG("Received %d bytes", total_recv);
 
 	return total_sent;
+}
 
-out:
-	return ret;
+#if defined(CONFIG_HTTP_CLIENT_PIPELINING)
+int http_client_pipeline(int sock, struct http_request **reqs, size_t num_reqs,
+			 int32_t timeout, void *user_data)
+{
+	k_timeout_t req_timeout = (timeout == SYS_FOREVER_MS) ? K_FOREVER : K_MSEC(timeout);
+	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
+	int total_sent = 0;
+	size_t prefill = 0;
+	size_t i;
+	int ret;
+
+	if (sock < 0 || reqs == NULL || num_reqs == 0) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < num_reqs; i++) {
+		if (reqs[i] == NULL || reqs[i]->response == NULL ||
+		    reqs[i]->recv_buf == NULL || reqs[i]->recv_buf_len == 0) {
+			return -EINVAL;
+		}
+	}
+
+	/* Send every request back to back, then read the responses in
+	 * order.  The server sees the whole burst within one round trip
+	 * instead of a request per response turnaround.
+	 */
+	for (i = 0; i < num_reqs; i++) {
+		ret = http_client_send_req(sock, reqs[i], req_end_timepoint,
+					   user_data);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total_sent += ret;
+	}
+
+	for (i = 0; i < num_reqs; i++) {
+		http_client_init_parser(&reqs[i]->internal.parser,
+					&reqs[i]->internal.parser_settings);
+
+		ret = http_wait_data(sock, reqs[i], req_end_timepoint, prefill);
+		if (ret < 0) {
+			NET_DBG("Wait data failure (%d)", ret);
+			return ret;
+		}
+
+		/* Bytes past this response belong to the next one */
+		prefill = reqs[i]->data_len;
+		if ((prefill > 0) && (i + 1 < num_reqs)) {
+			if (prefill > reqs[i + 1]->recv_buf_len) {
+				/* The response tail does not fit */
+				return -ENOMEM;
+			}
+
+			/* memmove: requests commonly share one buffer */
+			memmove(reqs[i + 1]->recv_buf, reqs[i]->recv_buf,
+				prefill);
+		}
+	}
+
+	return total_sent;
 }
+#endif /* CONFIG_HTTP_CLIENT_PIPELINING */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_http_pool, CONFIG_NET_HTTP_LOG_LEVEL);
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/client.h>
+#include <zephyr/net/socket.h>
+
+/* The pool stores established (possibly TLS) connections keyed by
+ * host and port.  Socket setup stays with the application - address
+ * resolution, TLS tags and socket options are use-case specific - the
+ * pool only keeps the result alive between bursts of requests.
+ */
+struct http_pool_entry {
+	char host[CONFIG_HTTP_CLIENT_POOL_HOST_LEN];
+	uint16_t port;
+	int sock;
+	bool in_use;
+	bool busy;
+};
+
+static struct http_pool_entry pool[CONFIG_HTTP_CLIENT_POOL_SIZE];
+static K_MUTEX_DEFINE(pool_lock);
+
+static struct http_pool_entry *pool_find(const char *host, uint16_t port)
+{
+	for (int i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (pool[i].in_use && (pool[i].port == port) &&
+		    (strcmp(pool[i].host, host) == 0)) {
+			return &pool[i];
+		}
+	}
+
+	return NULL;
+}
+
+int http_client_pool_get(const char *host, uint16_t port)
+{
+	struct http_pool_entry *entry;
+	int sock = -ENOENT;
+
+	if (host == NULL) {
+		return -EINVAL;
+	}
+
+	(void)k_mutex_lock(&pool_lock, K_FOREVER);
+
+	entry = pool_find(host, port);
+	if ((entry != NULL) && !entry->busy) {
+		entry->busy = true;
+		sock = entry->sock;
+	}
+
+	k_mutex_unlock(&pool_lock);
+
+	return sock;
+}
+
+int http_client_pool_add(const char *host, uint16_t port, int sock)
+{
+	struct http_pool_entry *entry = NULL;
+	int ret = 0;
+
+	if ((host == NULL) || (sock < 0) ||
+	    (strlen(host) >= CONFIG_HTTP_CLIENT_POOL_HOST_LEN)) {
+		return -EINVAL;
+	}
+
+	(void)k_mutex_lock(&pool_lock, K_FOREVER);
+
+	if (pool_find(host, port) != NULL) {
+		ret = -EALREADY;
+		goto out;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (!pool[i].in_use) {
+			entry = &pool[i];
+			break;
+		}
+
+		/* Prefer evicting an idle connection over failing */
+		if ((entry == NULL) && !pool[i].busy) {
+			entry = &pool[i];
+		}
+	}
+
+	if (entry == NULL) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	if (entry->in_use) {
+		(void)zsock_close(entry->sock);
+	}
+
+	strcpy(entry->host, host);
+	entry->port = port;
+	entry->sock = sock;
+	entry->in_use = true;
+	entry->busy = true;
+
+out:
+	k_mutex_unlock(&pool_lock);
+
+	return ret;
+}
+
+void http_client_pool_release(int sock, bool keep)
+{
+	(void)k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (pool[i].in_use && (pool[i].sock == sock)) {
+			if (keep) {
+				pool[i].busy = false;
+			} else {
+				(void)zsock_close(pool[i].sock);
+				pool[i].in_use = false;
+				pool[i].busy = false;
+			}
+			break;
+		}
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
+
+void http_client_pool_purge(void)
+{
+	(void)k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(pool); i++) {
+		if (pool[i].in_use && !pool[i].busy) {
+			(void)zsock_close(pool[i].sock);
+			pool[i].in_use = false;
+		}
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
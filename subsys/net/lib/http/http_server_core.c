@@ -584,7 +584,28 @@ static int http_server_run(struct http_server_ctx *ctx)
 			goto closing;
 		}
 
+#if defined(CONFIG_HTTP_SERVER_FAIR_SCHEDULING)
+		/* Rotate the client service order every poll cycle so a
+		 * client kept busy by large responses stops being
+		 * served ahead of everyone with a higher fd slot: each
+		 * ready client gets the first turn in round-robin.
+		 */
+		static int rr_offset;
+		int nclients = ARRAY_SIZE(ctx->fds) - ctx->listen_fds;
+		int k;
+
+		rr_offset++;
+
+		for (k = 1; k < ARRAY_SIZE(ctx->fds); k++) {
+			if ((k < ctx->listen_fds) || (nclients <= 0)) {
+				i = k;
+			} else {
+				i = ctx->listen_fds +
+				    ((k - ctx->listen_fds + rr_offset) % nclients);
+			}
+#else
 		for (i = 1; i < ARRAY_SIZE(ctx->fds); i++) {
+#endif /* CONFIG_HTTP_SERVER_FAIR_SCHEDULING */
 			if (ctx->fds[i].fd < 0) {
 				continue;
 			}
@@ -544,6 +544,14 @@ static int handle_http2_static_fs_resource(struct http_resource_detail_static_fs
 			LOG_DBG("Cannot write to socket (%d)", ret);
 			goto out;
 		}
+
+		if (IS_ENABLED(CONFIG_HTTP_SERVER_FAIR_SCHEDULING) &&
+		    (remaining > 0)) {
+			/* bound how long a large download monopolizes
+			 * the server thread's priority level
+			 */
+			k_yield();
+		}
 	}
 
 	client->current_stream->end_stream_sent = true;
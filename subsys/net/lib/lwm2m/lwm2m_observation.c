@@ -323,6 +323,47 @@ static bool lwm2m_observer_path_compare(const struct lwm2m_obj_path *o_p,
 	return true;
 }
 
+#if defined(CONFIG_LWM2M_OBSERVE_FAST_MATCH)
+static uint32_t observe_token_hash(const uint8_t *token, uint8_t tkl)
+{
+	uint32_t hash = tkl;
+	uint8_t i;
+
+	for (i = 0; i < tkl; i++) {
+		hash = (hash * 31U) + token[i];
+	}
+
+	return hash;
+}
+
+static uint32_t observe_obj_bloom_bit(uint16_t obj_id)
+{
+	/* Multiplicative mix so consecutive object IDs spread over the
+	 * 32 filter bits.
+	 */
+	return BIT(((uint32_t)obj_id * 2654435761U) >> 27);
+}
+
+static void observe_fast_match_update(struct observe_node *obs)
+{
+	struct lwm2m_obj_path_list *entry;
+
+	obs->obj_bloom = 0U;
+	SYS_SLIST_FOR_EACH_CONTAINER(&obs->path_list, entry, node) {
+		if (entry->path.level < LWM2M_PATH_LEVEL_OBJECT) {
+			/* Root path observation matches any object */
+			obs->obj_bloom = UINT32_MAX;
+			break;
+		}
+		obs->obj_bloom |= observe_obj_bloom_bit(entry->path.obj_id);
+	}
+
+	obs->token_hash = observe_token_hash(obs->token, obs->tkl);
+}
+#else
+#define observe_fast_match_update(obs)
+#endif /* CONFIG_LWM2M_OBSERVE_FAST_MATCH */
+
 static bool lwm2m_notify_observer_list(sys_slist_t *path_list, const struct lwm2m_obj_path *path)
 {
 	struct lwm2m_obj_path_list *o_p;
@@ -637,9 +678,19 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 		return 0;
 	}
 
+#if defined(CONFIG_LWM2M_OBSERVE_FAST_MATCH)
+	uint32_t bloom_bit = observe_obj_bloom_bit(path->obj_id);
+#endif
+
 	/* look for observers which match our resource */
 	for (i = 0; i < lwm2m_sock_nfds(); ++i) {
 		SYS_SLIST_FOR_EACH_CONTAINER(&sock_ctx[i]->observer, obs, node) {
+#if defined(CONFIG_LWM2M_OBSERVE_FAST_MATCH)
+			if ((obs->obj_bloom & bloom_bit) == 0U) {
+				/* No observed path can name this object */
+				continue;
+			}
+#endif
 			if (lwm2m_notify_observer_list(&obs->path_list, path)) {
 				/* update the event time for this observer */
 				ret = engine_observe_attribute_list_get(&obs->path_list, &obs_attrs,
@@ -752,6 +803,7 @@ static void engine_observe_node_init(struct observe_node *obs, const uint8_t *to
 	obs->active_notify = NULL;
 	obs->format = format;
 	obs->counter = OBSERVE_COUNTER_START;
+	observe_fast_match_update(obs);
 	sys_slist_append(&ctx->observer, &obs->node);
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&obs->path_list, tmp, node) {
@@ -841,6 +893,9 @@ struct observe_node *engine_observe_node_discover(sys_slist_t *observe_node_list
 {
 	struct observe_node *obs;
 	int obs_list_size, path_list_size = 0;
+#if defined(CONFIG_LWM2M_OBSERVE_FAST_MATCH)
+	uint32_t token_hash = token ? observe_token_hash(token, tkl) : 0U;
+#endif
 
 	if (lwm2m_path_list) {
 		path_list_size = engine_path_list_size(lwm2m_path_list);
@@ -866,6 +921,13 @@ struct observe_node *engine_observe_node_discover(sys_slist_t *observe_node_list
 			}
 		}
 
+#if defined(CONFIG_LWM2M_OBSERVE_FAST_MATCH)
+		if (token && (tkl == obs->tkl) && (obs->token_hash != token_hash)) {
+			/* Token cannot match */
+			*prev_node = &obs->node;
+			continue;
+		}
+#endif
 		if (token && memcmp(obs->token, token, tkl)) {
 			/* Token not match */
 			*prev_node = &obs->node;
@@ -906,6 +968,7 @@ static int engine_add_observer(struct lwm2m_message *msg, const uint8_t *token,
 	if (obs) {
 		memcpy(obs->token, token, tkl);
 		obs->tkl = tkl;
+		observe_fast_match_update(obs);
 
 		/* Cancel ongoing notification */
 		if (obs->active_notify != NULL) {
@@ -999,6 +1062,7 @@ static int engine_add_composite_observer(struct lwm2m_message *msg, const uint8_
 	if (obs) {
 		memcpy(obs->token, token, tkl);
 		obs->tkl = tkl;
+		observe_fast_match_update(obs);
 
 		/* Cancel ongoing notification */
 		if (obs->active_notify != NULL) {
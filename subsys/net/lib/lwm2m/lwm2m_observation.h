@@ -20,6 +20,10 @@ struct observe_node {
 	int64_t last_timestamp;	             /* Timestamp from last Notify */
 	struct lwm2m_message *active_notify; /* Currently active notification */
 	uint32_t counter;
+#if defined(CONFIG_LWM2M_OBSERVE_FAST_MATCH)
+	uint32_t obj_bloom;                  /* Bloom filter of observed object IDs */
+	uint32_t token_hash;                 /* Hash over (token, tkl) */
+#endif
 	uint16_t format;
 	uint8_t tkl;
 	bool resource_update : 1;            /* Resource is updated */
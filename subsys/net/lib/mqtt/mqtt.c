@@ -293,6 +293,73 @@ static int verify_tx_state(const struct mqtt_client *client)
 	return 0;
 }
 
+int mqtt_publish_vec(struct mqtt_client *client, const struct mqtt_publish_param *param,
+		     const struct net_iovec *payload, size_t payload_count)
+{
+	int err_code;
+	struct buf_ctx packet;
+	struct net_iovec io_vector[1 + MQTT_PUBLISH_MAX_IOVEC];
+	struct net_msghdr msg;
+	size_t total_len = 0;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+	NULL_PARAM_CHECK(payload);
+
+	if ((payload_count == 0) || (payload_count > MQTT_PUBLISH_MAX_IOVEC)) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < payload_count; i++) {
+		io_vector[1 + i] = payload[i];
+		total_len += payload[i].iov_len;
+	}
+
+	/* The encoded remaining length is derived from this field, so the
+	 * fragments must add up to it.
+	 */
+	if (total_len != param->message.payload.len) {
+		return -EINVAL;
+	}
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Topic size 0x%08x, "
+		 "Data size 0x%08x (%u fragments)", client, client->internal.state,
+		 param->message.topic.topic.size,
+		 param->message.payload.len, (unsigned int)payload_count);
+
+	mqtt_mutex_lock(client);
+
+	tx_buf_init(client, &packet);
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	err_code = publish_encode(client, param, &packet);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	io_vector[0].iov_base = packet.cur;
+	io_vector[0].iov_len = packet.end - packet.cur;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 1 + payload_count;
+
+	err_code = client_write_msg(client, &msg);
+
+error:
+	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
+			 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param)
 {
@@ -42,6 +42,11 @@ int prometheus_collector_register_metric(struct prometheus_collector *collector,
 
 	k_mutex_unlock(&collector->lock);
 
+#if defined(CONFIG_PROMETHEUS_PRERENDER)
+	/* Exhaustion only costs the fast path; the metric still scrapes */
+	(void)prometheus_metric_prerender(metric);
+#endif /* CONFIG_PROMETHEUS_PRERENDER */
+
 	return 0;
 }
 
@@ -24,6 +24,147 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_formatter, CONFIG_PROMETHEUS_LOG_LEVEL);
 
+#if defined(CONFIG_PROMETHEUS_PRERENDER)
+/* Arena holding the stable exposition text (HELP/TYPE lines and sample
+ * prefixes), rendered once at metric registration so a scrape only
+ * formats the values.
+ */
+static char render_arena[CONFIG_PROMETHEUS_PRERENDER_BUF_SIZE];
+static size_t render_arena_used;
+static K_MUTEX_DEFINE(render_arena_lock);
+
+static const char *metric_type_str(const struct prometheus_metric *metric)
+{
+	switch (metric->type) {
+	case PROMETHEUS_COUNTER:
+		return "counter";
+	case PROMETHEUS_GAUGE:
+		return "gauge";
+	case PROMETHEUS_HISTOGRAM:
+		return "histogram";
+	case PROMETHEUS_SUMMARY:
+		return "summary";
+	default:
+		return "untyped";
+	}
+}
+
+/* Append formatted text to the arena, returning its start or NULL when
+ * the arena is exhausted.
+ */
+static const char *render_arena_append(const char *format, ...)
+{
+	char *start = &render_arena[render_arena_used];
+	size_t avail = sizeof(render_arena) - render_arena_used;
+	va_list args;
+	int len;
+
+	va_start(args, format);
+	len = vsnprintf(start, avail, format, args);
+	va_end(args);
+
+	if ((len < 0) || ((size_t)len >= avail)) {
+		return NULL;
+	}
+
+	/* Keep the terminating NUL: sample prefixes are walked by it */
+	render_arena_used += len + 1;
+
+	return start;
+}
+
+int prometheus_metric_prerender(struct prometheus_metric *metric)
+{
+	size_t used_before;
+	const char *head;
+
+	if (metric->render_head != NULL) {
+		/* Re-registration; the stable text is already rendered */
+		return 0;
+	}
+
+	(void)k_mutex_lock(&render_arena_lock, K_FOREVER);
+	used_before = render_arena_used;
+
+	if (metric->description[0] != '\0') {
+		head = render_arena_append("# HELP %s %s\n# TYPE %s %s\n",
+					   metric->name, metric->description,
+					   metric->name,
+					   metric_type_str(metric));
+	} else {
+		head = render_arena_append("# TYPE %s %s\n", metric->name,
+					   metric_type_str(metric));
+	}
+
+	if (head == NULL) {
+		goto no_room;
+	}
+
+	metric->render_head_len = strlen(head);
+
+	/* Sample prefixes cover the simple value-per-label types; the
+	 * histogram and summary bodies keep the generic formatting after
+	 * the pre-rendered head.
+	 */
+	if ((metric->type == PROMETHEUS_COUNTER ||
+	     metric->type == PROMETHEUS_GAUGE) &&
+	    (metric->num_labels > 0)) {
+		const char *sample = NULL;
+		const char *part;
+
+		for (int i = 0; i < metric->num_labels; i++) {
+			part = render_arena_append("%s{%s=\"%s\"} ",
+						   metric->name,
+						   metric->labels[i].key,
+						   metric->labels[i].value);
+			if (part == NULL) {
+				goto no_room;
+			}
+
+			if (sample == NULL) {
+				sample = part;
+			}
+		}
+
+		metric->render_sample = sample;
+	}
+
+	metric->render_head = head;
+
+	k_mutex_unlock(&render_arena_lock);
+
+	return 0;
+
+no_room:
+	/* Scrapes fall back to formatting this metric in full */
+	render_arena_used = used_before;
+	metric->render_head = NULL;
+	metric->render_sample = NULL;
+
+	k_mutex_unlock(&render_arena_lock);
+
+	LOG_WRN("Prerender arena exhausted for %s", metric->name);
+
+	return -ENOMEM;
+}
+
+/* Append raw pre-rendered text to the output buffer */
+static int write_raw_to_buffer(char *buffer, size_t buffer_size,
+			       const char *str, size_t str_len)
+{
+	size_t len = strlen(buffer);
+
+	if ((len + str_len + 1) > buffer_size) {
+		return -ENOMEM;
+	}
+
+	memcpy(buffer + len, str, str_len);
+	buffer[len + str_len] = '\0';
+
+	return 0;
+}
+#endif /* CONFIG_PROMETHEUS_PRERENDER */
+
 static int write_metric_to_buffer(char *buffer, size_t buffer_size, const char *format, ...)
 {
 	/* helper function to write formatted metric to buffer */
@@ -50,9 +191,25 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 				 size_t buffer_size, int *written)
 {
 	int ret = 0;
+	bool prerendered = false;
+
+#if defined(CONFIG_PROMETHEUS_PRERENDER)
+	if (metric->render_head != NULL) {
+		ret = write_raw_to_buffer(buffer + *written,
+					  buffer_size - *written,
+					  metric->render_head,
+					  metric->render_head_len);
+		if (ret < 0) {
+			LOG_ERR("Error writing to buffer");
+			goto out;
+		}
+
+		prerendered = true;
+	}
+#endif /* CONFIG_PROMETHEUS_PRERENDER */
 
 	/* write HELP line if available */
-	if (metric->description[0] != '\0') {
+	if (!prerendered && metric->description[0] != '\0') {
 		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
 					     "# HELP %s %s\n", metric->name,
 					     metric->description);
@@ -63,6 +220,10 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 	}
 
 	/* write TYPE line */
+	if (prerendered) {
+		goto body;
+	}
+
 	switch (metric->type) {
 	case PROMETHEUS_COUNTER:
 		ret = write_metric_to_buffer(buffer + *written, buffer_size - *written,
@@ -115,6 +276,7 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 		break;
 	}
 
+body:
 	/* write metric-specific fields */
 	switch (metric->type) {
 	case PROMETHEUS_COUNTER: {
@@ -123,6 +285,35 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		LOG_DBG("counter->value: %llu", counter->value);
 
+#if defined(CONFIG_PROMETHEUS_PRERENDER)
+		if (prerendered && (metric->render_sample != NULL)) {
+			const char *prefix = metric->render_sample;
+
+			for (int i = 0; i < metric->num_labels; ++i) {
+				size_t prefix_len = strlen(prefix);
+
+				ret = write_raw_to_buffer(buffer + *written,
+							  buffer_size - *written,
+							  prefix, prefix_len);
+				if (ret == 0) {
+					ret = write_metric_to_buffer(
+						buffer + *written,
+						buffer_size - *written,
+						"%llu\n", counter->value);
+				}
+
+				if (ret < 0) {
+					LOG_ERR("Error writing counter");
+					goto out;
+				}
+
+				prefix += prefix_len + 1;
+			}
+
+			break;
+		}
+#endif /* CONFIG_PROMETHEUS_PRERENDER */
+
 		for (int i = 0; i < metric->num_labels; ++i) {
 			ret = write_metric_to_buffer(
 				buffer + *written, buffer_size - *written,
@@ -143,6 +334,35 @@ int prometheus_format_one_metric(struct prometheus_metric *metric, char *buffer,
 
 		LOG_DBG("gauge->value: %f", gauge->value);
 
+#if defined(CONFIG_PROMETHEUS_PRERENDER)
+		if (prerendered && (metric->render_sample != NULL)) {
+			const char *prefix = metric->render_sample;
+
+			for (int i = 0; i < metric->num_labels; ++i) {
+				size_t prefix_len = strlen(prefix);
+
+				ret = write_raw_to_buffer(buffer + *written,
+							  buffer_size - *written,
+							  prefix, prefix_len);
+				if (ret == 0) {
+					ret = write_metric_to_buffer(
+						buffer + *written,
+						buffer_size - *written,
+						"%f\n", gauge->value);
+				}
+
+				if (ret < 0) {
+					LOG_ERR("Error writing gauge");
+					goto out;
+				}
+
+				prefix += prefix_len + 1;
+			}
+
+			break;
+		}
+#endif /* CONFIG_PROMETHEUS_PRERENDER */
+
 		for (int i = 0; i < metric->num_labels; ++i) {
 			ret = write_metric_to_buffer(
 				buffer + *written, buffer_size - *written,
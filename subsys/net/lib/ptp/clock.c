@@ -507,6 +507,125 @@ int ptp_clock_management_msg_process(struct ptp_port *port, struct ptp_msg *msg)
 	return state_decision_required;
 }
 
+#if defined(CONFIG_PTP_OFFSET_FILTER)
+/* Deviation floor added to the MAD-based rejection bound so that a
+ * quiet network with near-zero dispersion does not reject the ordinary
+ * measurement noise.
+ */
+#define PTP_FILTER_OUTLIER_FLOOR_NS 100
+
+struct ptp_sample_window {
+	int64_t	 samples[CONFIG_PTP_OFFSET_FILTER_SAMPLES];
+	uint8_t	 count;
+	uint8_t	 pos;
+	uint32_t stat_count;
+	double	 stat_mean;
+	double	 stat_m2;	/* Welford's sum of squared deviations */
+};
+
+static struct ptp_sample_window offset_window;
+static struct ptp_sample_window delay_window;
+
+static void ptp_window_reset(struct ptp_sample_window *window)
+{
+	memset(window, 0, sizeof(*window));
+}
+
+static void ptp_window_push(struct ptp_sample_window *window, int64_t sample)
+{
+	double delta;
+
+	window->samples[window->pos] = sample;
+	window->pos = (window->pos + 1U) % CONFIG_PTP_OFFSET_FILTER_SAMPLES;
+	if (window->count < CONFIG_PTP_OFFSET_FILTER_SAMPLES) {
+		window->count++;
+	}
+
+	window->stat_count++;
+	delta = (double)sample - window->stat_mean;
+	window->stat_mean += delta / window->stat_count;
+	window->stat_m2 += delta * ((double)sample - window->stat_mean);
+}
+
+static int64_t ptp_window_median(const struct ptp_sample_window *window)
+{
+	/* Static scratch: the servo only ever runs on the PTP thread */
+	static int64_t sorted[CONFIG_PTP_OFFSET_FILTER_SAMPLES];
+	int64_t key;
+	uint8_t i;
+	int8_t j;
+
+	memcpy(sorted, window->samples, window->count * sizeof(sorted[0]));
+
+	for (i = 1; i < window->count; i++) {
+		key = sorted[i];
+		for (j = i - 1; (j >= 0) && (sorted[j] > key); j--) {
+			sorted[j + 1] = sorted[j];
+		}
+		sorted[j + 1] = key;
+	}
+
+	return sorted[window->count / 2U];
+}
+
+/* Median absolute deviation of the window from the given median. */
+static int64_t ptp_window_mad(const struct ptp_sample_window *window, int64_t median)
+{
+	static struct ptp_sample_window deviations;
+	uint8_t i;
+
+	deviations.count = window->count;
+
+	for (i = 0; i < window->count; i++) {
+		deviations.samples[i] = window->samples[i] > median ?
+					window->samples[i] - median :
+					median - window->samples[i];
+	}
+
+	return ptp_window_median(&deviations);
+}
+
+static bool ptp_offset_is_outlier(int64_t offset)
+{
+	int64_t median, mad, deviation;
+
+	if (offset_window.count < 3U) {
+		return false;
+	}
+
+	median = ptp_window_median(&offset_window);
+	mad = ptp_window_mad(&offset_window, median);
+	deviation = offset > median ? offset - median : median - offset;
+
+	return deviation > ((3LL * mad) + PTP_FILTER_OUTLIER_FLOOR_NS);
+}
+
+static int ptp_window_variance(const struct ptp_sample_window *window, double *variance)
+{
+	if (window->stat_count < 2U) {
+		return -ENODATA;
+	}
+
+	*variance = window->stat_m2 / (window->stat_count - 1U);
+
+	return 0;
+}
+
+int ptp_clock_servo_stats(double *offset_variance, double *delay_variance)
+{
+	int ret = 0;
+
+	if (offset_variance != NULL) {
+		ret = ptp_window_variance(&offset_window, offset_variance);
+	}
+	if ((ret == 0) && (delay_variance != NULL)) {
+		ret = ptp_window_variance(&delay_window, delay_variance);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_PTP_OFFSET_FILTER */
+
 static double ptp_servo_pi(int64_t nanosecond_diff)
 {
 	double kp = 0.7;
@@ -558,12 +677,31 @@ void ptp_clock_synchronize(uint64_t ingress, uint64_t egress)
 
 		ptp_clock_set(ptp_clk.phc, &current);
 		LOG_WRN("Set clock time: %"PRIu64".%09u", current.second, current.nanosecond);
+#if defined(CONFIG_PTP_OFFSET_FILTER)
+		/* Samples taken before the step are meaningless now. */
+		ptp_window_reset(&offset_window);
+		ptp_window_reset(&delay_window);
+#endif /* CONFIG_PTP_OFFSET_FILTER */
 		return;
 	}
 
 	LOG_DBG("Offset %lldns", offset);
 	ptp_clk.current_ds.offset_from_tt = clock_ns_to_timeinterval(offset);
 
+#if defined(CONFIG_PTP_OFFSET_FILTER)
+	/* The sample enters the window even when rejected below: a
+	 * genuine persistent offset change then shifts the median within
+	 * half a window and measurements are accepted again, instead of
+	 * being locked out forever.
+	 */
+	ptp_window_push(&offset_window, offset);
+
+	if (ptp_offset_is_outlier(offset)) {
+		LOG_DBG("Rejected outlier offset %lldns", offset);
+		return;
+	}
+#endif /* CONFIG_PTP_OFFSET_FILTER */
+
 	ppb = ptp_servo_pi(-offset);
 	ptp_clock_rate_adjust(ptp_clk.phc, 1.0 + (ppb / 1000000000.0));
 }
@@ -583,6 +721,12 @@ void ptp_clock_delay(uint64_t egress, uint64_t ingress)
 		 (int64_t)(ptp_clk.timestamp.t4 - ptp_clk.timestamp.t1)) /
 		2LL;
 
+#if defined(CONFIG_PTP_OFFSET_FILTER)
+	/* Smooth queuing-induced delay spikes with the window median */
+	ptp_window_push(&delay_window, delay);
+	delay = ptp_window_median(&delay_window);
+#endif /* CONFIG_PTP_OFFSET_FILTER */
+
 	LOG_DBG("Delay %lldns", delay);
 	ptp_clk.current_ds.mean_delay = clock_ns_to_timeinterval(delay);
 }
@@ -125,6 +125,18 @@ void ptp_clock_synchronize(uint64_t ingress, uint64_t egress);
  * @param[in] ingress Timestamp of the message reception on the remote node in nanoseconds.
  */
 void ptp_clock_delay(uint64_t egress, uint64_t ingress);
+
+#if defined(CONFIG_PTP_OFFSET_FILTER)
+/**
+ * @brief Function querying the servo's offset and delay variance statistics.
+ *
+ * @param[out] offset_variance Variance of the measured offsets in ns^2, may be NULL.
+ * @param[out] delay_variance Variance of the measured path delays in ns^2, may be NULL.
+ *
+ * @return 0 on success, -ENODATA if too few samples have been gathered.
+ */
+int ptp_clock_servo_stats(double *offset_variance, double *delay_variance);
+#endif /* CONFIG_PTP_OFFSET_FILTER */
 /**
  * @brief Function for getting list of PTP Ports for the PTP Clock instance.
  *
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_sntp, CONFIG_SNTP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/sntp.h>
+#include <zephyr/random/random.h>
+
+/* A single persistent client instance: one socket, one poll timer.
+ * Protocol time is tracked in microseconds since the epoch together
+ * with the local uptime it was valid at, so time can be extrapolated
+ * between polls without a network round trip.
+ */
+static struct sntp_ctx service_ctx;
+static struct k_work_delayable poll_work;
+static sntp_service_cb_t service_cb;
+static void *service_user_data;
+static bool service_running;
+
+/* Guards the sync state below: the handler runs on the socket service
+ * thread while sntp_service_time_get() may be called from anywhere.
+ */
+static struct k_spinlock lock;
+static struct sntp_time last_time;
+static int64_t last_uptime_us;
+static int64_t last_ntp_us;
+static int32_t drift_ppb;
+
+static void sntp_service_handler(struct net_socket_service_event *pev);
+
+NET_SOCKET_SERVICE_SYNC_DEFINE_STATIC(sntp_service, sntp_service_handler, 1);
+
+static int64_t sntp_time_to_us(const struct sntp_time *ts)
+{
+#if defined(CONFIG_SNTP_UNCERTAINTY)
+	/* fraction holds microseconds */
+	return (int64_t)(ts->seconds * USEC_PER_SEC + ts->fraction);
+#else
+	/* fraction holds the NTP 32-bit fractional second */
+	return (int64_t)(ts->seconds * USEC_PER_SEC +
+			 (((uint64_t)ts->fraction * USEC_PER_SEC) >> 32));
+#endif /* CONFIG_SNTP_UNCERTAINTY */
+}
+
+static void sntp_service_handler(struct net_socket_service_event *pev)
+{
+	int64_t now_us = k_ticks_to_us_near64(k_uptime_ticks());
+	struct sntp_time ts;
+	int ret;
+
+	ret = sntp_read_async(pev, &ts);
+	if (ret < 0) {
+		LOG_DBG("Failed to read SNTP response (%d)", ret);
+		return;
+	}
+
+	int64_t ntp_us = sntp_time_to_us(&ts);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (last_uptime_us > 0) {
+		int64_t interval_us = now_us - last_uptime_us;
+
+		if (interval_us > 0) {
+			int64_t excess_us = (ntp_us - last_ntp_us) - interval_us;
+			int32_t sample_ppb =
+				(int32_t)((excess_us * (int64_t)NSEC_PER_SEC) /
+					  interval_us);
+
+			/* Smooth with an EWMA so one jittery poll does
+			 * not swing the estimate.
+			 */
+			drift_ppb += (sample_ppb - drift_ppb) / 4;
+		}
+	}
+
+	last_time = ts;
+	last_uptime_us = now_us;
+	last_ntp_us = ntp_us;
+
+	k_spin_unlock(&lock, key);
+
+	LOG_DBG("SNTP sync at uptime %lld us, drift %d ppb", now_us, drift_ppb);
+
+	if (service_cb != NULL) {
+		service_cb(&ts, drift_ppb, service_user_data);
+	}
+}
+
+static void sntp_service_schedule(void)
+{
+	uint32_t base_ms = CONFIG_SNTP_SERVICE_POLL_INTERVAL * MSEC_PER_SEC;
+	uint32_t span_ms = base_ms / 8U;
+	int32_t jitter_ms = (int32_t)(sys_rand32_get() % ((2U * span_ms) + 1U)) -
+			    (int32_t)span_ms;
+
+	/* +/- 12.5 % jitter keeps a fleet of devices from polling the
+	 * server in lockstep.
+	 */
+	k_work_reschedule(&poll_work, K_MSEC(base_ms + jitter_ms));
+}
+
+static void sntp_service_poll(struct k_work *work)
+{
+	int ret;
+
+	ARG_UNUSED(work);
+
+	ret = sntp_send_async(&service_ctx);
+	if (ret < 0) {
+		LOG_DBG("Failed to send SNTP query (%d)", ret);
+	}
+
+	sntp_service_schedule();
+}
+
+int sntp_service_start(struct net_sockaddr *addr, net_socklen_t addr_len,
+		       sntp_service_cb_t cb, void *user_data)
+{
+	int ret;
+
+	if (service_running) {
+		return -EALREADY;
+	}
+
+	ret = sntp_init_async(&service_ctx, addr, addr_len, &sntp_service);
+	if (ret < 0) {
+		return ret;
+	}
+
+	service_cb = cb;
+	service_user_data = user_data;
+	last_uptime_us = 0;
+	last_ntp_us = 0;
+	drift_ppb = 0;
+	service_running = true;
+
+	k_work_init_delayable(&poll_work, sntp_service_poll);
+	k_work_reschedule(&poll_work, K_NO_WAIT);
+
+	return 0;
+}
+
+int sntp_service_stop(void)
+{
+	if (!service_running) {
+		return -EALREADY;
+	}
+
+	(void)k_work_cancel_delayable(&poll_work);
+	sntp_close_async(&sntp_service);
+	service_running = false;
+
+	return 0;
+}
+
+int sntp_service_time_get(struct sntp_time *ts)
+{
+	int64_t now_us, elapsed_us, estimate_us;
+	k_spinlock_key_t key;
+
+	if (ts == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (last_uptime_us == 0) {
+		k_spin_unlock(&lock, key);
+		return -ENODATA;
+	}
+
+	now_us = k_ticks_to_us_near64(k_uptime_ticks());
+	elapsed_us = now_us - last_uptime_us;
+	estimate_us = last_ntp_us + elapsed_us +
+		      ((elapsed_us * drift_ppb) / (int64_t)NSEC_PER_SEC);
+
+#if defined(CONFIG_SNTP_UNCERTAINTY)
+	uint32_t last_uncertainty_us = last_time.uncertainty_us;
+#endif /* CONFIG_SNTP_UNCERTAINTY */
+
+	k_spin_unlock(&lock, key);
+
+	ts->seconds = (uint64_t)estimate_us / USEC_PER_SEC;
+#if defined(CONFIG_SNTP_UNCERTAINTY)
+	ts->fraction = (uint32_t)((uint64_t)estimate_us % USEC_PER_SEC);
+	ts->uptime_us = now_us;
+	ts->uncertainty_us = last_uncertainty_us;
+#else
+	ts->fraction = (uint32_t)(((((uint64_t)estimate_us % USEC_PER_SEC)
+				    << 32) / USEC_PER_SEC));
+#endif /* CONFIG_SNTP_UNCERTAINTY */
+
+	return 0;
+}
+
+int32_t sntp_service_drift_ppb(void)
+{
+	return drift_ppb;
+}
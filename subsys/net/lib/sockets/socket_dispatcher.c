@@ -64,6 +64,8 @@ static int sock_dispatch_socket(struct dispatcher_context *ctx,
 				      (const struct fd_op_vtable **)&vtable,
 				      NULL);
 	if (obj == NULL) {
+		/* don't leak the freshly created implementation socket */
+		zsock_close(new_fd);
 		return -1;
 	}
 
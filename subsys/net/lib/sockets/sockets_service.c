@@ -30,6 +30,11 @@ STRUCT_SECTION_END_EXTERN(net_socket_service_desc);
 
 static struct service {
 	struct zsock_pollfd events[CONFIG_ZVFS_POLL_MAX];
+	/* Owning service of each events[] slot, rebuilt on restart,
+	 * so dispatch is O(1) per ready socket instead of a scan over
+	 * every registered service and descriptor.
+	 */
+	struct net_socket_service_desc *owner[CONFIG_ZVFS_POLL_MAX];
 	int count;
 } ctx;
 
@@ -99,14 +104,27 @@ out:
 }
 
 static struct net_socket_service_desc *find_svc_and_event(
+	int slot,
 	struct zsock_pollfd *pev,
 	struct net_socket_service_event **event)
 {
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int i = 0; i < svc->pev_len; i++) {
-			if (svc->pev[i].event.fd == pev->fd) {
-				*event = &svc->pev[i];
-				return svc;
+	struct net_socket_service_desc *svc = ctx.owner[slot];
+
+	if (svc != NULL) {
+		*event = &svc->pev[slot - get_idx(svc)];
+		if ((*event)->event.fd == pev->fd) {
+			return svc;
+		}
+	}
+
+	/* Slot map stale (concurrent re-registration): fall back to
+	 * the exhaustive search.
+	 */
+	STRUCT_SECTION_FOREACH(net_socket_service_desc, fallback) {
+		for (int i = 0; i < fallback->pev_len; i++) {
+			if (fallback->pev[i].event.fd == pev->fd) {
+				*event = &fallback->pev[i];
+				return fallback;
 			}
 		}
 	}
@@ -145,12 +163,12 @@ static int call_work(struct zsock_pollfd *pev, struct net_socket_service_event *
 	return ret;
 }
 
-static int trigger_work(struct zsock_pollfd *pev)
+static int trigger_work(int slot, struct zsock_pollfd *pev)
 {
 	struct net_socket_service_event *event;
 	struct net_socket_service_desc *svc;
 
-	svc = find_svc_and_event(pev, &event);
+	svc = find_svc_and_event(slot, pev, &event);
 	if (svc == NULL) {
 		return -ENOENT;
 	}
@@ -222,10 +240,13 @@ restart:
 
 	k_mutex_lock(&lock, K_FOREVER);
 
-	/* Copy individual events to the big array */
+	/* Copy individual events to the big array and rebuild the
+	 * slot-to-service map used for O(1) dispatch.
+	 */
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
 		for (int j = 0; j < svc->pev_len; j++) {
 			ctx.events[get_idx(svc) + j] = svc->pev[j].event;
+			ctx.owner[get_idx(svc) + j] = svc;
 		}
 	}
 
@@ -251,7 +272,7 @@ restart:
 			}
 
 			if (ctx.events[i].revents > 0) {
-				ret = trigger_work(&ctx.events[i]);
+				ret = trigger_work(i, &ctx.events[i]);
 				if (ret < 0) {
 					NET_DBG("Triggering work failed (%d)", ret);
 					goto restart;
@@ -175,6 +175,21 @@ struct tls_session_context {
 };
 
 /** TLS context information. */
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE) && defined(MBEDTLS_X509_CRT_PARSE_C)
+/* One parsed CA bundle shared across sockets.  The chain is read-only
+ * once populated, so any number of mbedTLS configs can point at it
+ * concurrently; the entry is kept populated at zero references so a
+ * reconnect hits the cache instead of re-parsing.
+ */
+struct tls_cert_cache_entry {
+	mbedtls_x509_crt chain;
+	uint32_t hash;
+	uint16_t refcount;
+	bool in_use;
+	bool populated;
+};
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE */
+
 __net_socket struct tls_context {
 	/** Underlying TCP/UDP socket. */
 	int sock;
@@ -211,6 +226,17 @@ __net_socket struct tls_context {
 	/* Indicates whether socket is in error state at TLS/DTLS level. */
 	int error;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_TX)
+	/* Asynchronous record encryption: queued send chunks handed
+	 * to the TLS work thread, which serializes per-context writes
+	 * in submission order.
+	 */
+	struct k_work async_tx_work;
+	struct k_fifo async_tx_queue;
+	atomic_t async_tx_bytes;
+	int async_tx_err;
+#endif /* CONFIG_NET_SOCKETS_TLS_ASYNC_TX */
+
 	/* TLS socket mutex lock. */
 	struct k_mutex *lock;
 
@@ -279,6 +305,16 @@ __net_socket struct tls_context {
 	/** mbedTLS structure for CA chain. */
 	mbedtls_x509_crt ca_chain;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE)
+	/** Shared parsed CA chain cache entry, NULL when the private
+	 * ca_chain above is used instead.
+	 */
+	struct tls_cert_cache_entry *ca_cache;
+
+	/** The cache entry was already populated; skip CA parsing. */
+	bool ca_cache_hit;
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE */
+
 	/** mbedTLS structure for own certificate. */
 	mbedtls_x509_crt own_cert;
 
@@ -313,6 +349,15 @@ static mbedtls_ssl_cache_context server_cache;
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_TX)
+static void tls_async_tx_init(struct tls_context *ctx);
+static void tls_async_tx_flush(struct tls_context *ctx);
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE) && defined(MBEDTLS_X509_CRT_PARSE_C)
+static void cert_cache_release(struct tls_cert_cache_entry *entry, bool invalidate);
+#endif
+
 /* Arbitrary delay value to wait if mbedTLS reports it cannot proceed for
  * reasons other than TX/RX block.
  */
@@ -558,6 +603,10 @@ static struct tls_context *tls_alloc(void)
 			sys_slist_init(&tls->sessions);
 			sys_slist_append(&tls->sessions, &tls->active_session->node);
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_TX)
+			tls_async_tx_init(tls);
+#endif
+
 			NET_DBG("Allocated TLS context, %p", tls);
 			break;
 		}
@@ -581,6 +630,10 @@ static struct tls_context *tls_alloc(void)
 		mbedtls_x509_crt_init(&tls->ca_chain);
 		mbedtls_x509_crt_init(&tls->own_cert);
 		mbedtls_pk_init(&tls->priv_key);
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE)
+		tls->ca_cache = NULL;
+		tls->ca_cache_hit = false;
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE */
 #endif
 
 #if defined(CONFIG_MBEDTLS_DEBUG)
@@ -639,6 +692,13 @@ static int tls_release(struct tls_context *tls)
 #endif
 	mbedtls_ssl_config_free(&tls->config);
 #if defined(MBEDTLS_X509_CRT_PARSE_C)
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE)
+	if (tls->ca_cache != NULL) {
+		cert_cache_release(tls->ca_cache, false);
+		tls->ca_cache = NULL;
+		tls->ca_cache_hit = false;
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE */
 	mbedtls_x509_crt_free(&tls->ca_chain);
 	mbedtls_x509_crt_free(&tls->own_cert);
 	mbedtls_pk_free(&tls->priv_key);
@@ -1354,12 +1414,151 @@ static bool crt_is_pem(const unsigned char *buf, size_t buflen)
 }
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE) && defined(MBEDTLS_X509_CRT_PARSE_C)
+static struct tls_cert_cache_entry cert_cache[CONFIG_NET_SOCKETS_TLS_CERT_CACHE_SIZE];
+static K_MUTEX_DEFINE(cert_cache_lock);
+
+/* FNV-1a over the raw stored credential contents */
+static uint32_t cert_cache_hash(uint32_t hash, const void *buf, size_t len)
+{
+	const uint8_t *bytes = buf;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ bytes[i]) * 0x01000193U;
+	}
+
+	return hash;
+}
+
+/* Hash all CA certificates reachable from the context's sec_tags.
+ * Must be called with the credential store locked.
+ */
+static uint32_t cert_cache_bundle_hash(struct tls_context *tls, bool *any_ca)
+{
+	struct tls_credential *cred;
+	uint32_t hash = 0x811c9dc5U;
+	int i;
+
+	*any_ca = false;
+
+	for (i = 0; i < tls->options.sec_tag_list.sec_tag_count; i++) {
+		cred = NULL;
+		while ((cred = credential_next_get(
+				tls->options.sec_tag_list.sec_tags[i],
+				cred)) != NULL) {
+			if (cred->type != TLS_CREDENTIAL_CA_CERTIFICATE) {
+				continue;
+			}
+
+			*any_ca = true;
+			hash = cert_cache_hash(hash, cred->buf, cred->len);
+		}
+	}
+
+	return hash;
+}
+
+/* Take a reference on the cache entry for the given bundle hash,
+ * reusing a populated entry or reserving a slot for the caller to
+ * populate.  Returns NULL when every slot is held by live contexts;
+ * the caller then parses into its private chain as before.
+ */
+static struct tls_cert_cache_entry *cert_cache_acquire(uint32_t hash, bool *hit)
+{
+	struct tls_cert_cache_entry *victim = NULL;
+	struct tls_cert_cache_entry *entry;
+	int i;
+
+	*hit = false;
+
+	(void)k_mutex_lock(&cert_cache_lock, K_FOREVER);
+
+	for (i = 0; i < ARRAY_SIZE(cert_cache); i++) {
+		entry = &cert_cache[i];
+
+		if (entry->in_use && entry->populated && entry->hash == hash) {
+			entry->refcount++;
+			*hit = true;
+			k_mutex_unlock(&cert_cache_lock);
+			return entry;
+		}
+
+		if (!entry->in_use) {
+			victim = victim != NULL && !victim->in_use ?
+				 victim : entry;
+		} else if ((victim == NULL) && (entry->refcount == 0U)) {
+			victim = entry;
+		}
+	}
+
+	if (victim == NULL) {
+		k_mutex_unlock(&cert_cache_lock);
+		return NULL;
+	}
+
+	if (victim->in_use) {
+		mbedtls_x509_crt_free(&victim->chain);
+	}
+
+	mbedtls_x509_crt_init(&victim->chain);
+	victim->hash = hash;
+	victim->refcount = 1U;
+	victim->in_use = true;
+	victim->populated = false;
+
+	k_mutex_unlock(&cert_cache_lock);
+
+	return victim;
+}
+
+static void cert_cache_release(struct tls_cert_cache_entry *entry, bool invalidate)
+{
+	(void)k_mutex_lock(&cert_cache_lock, K_FOREVER);
+
+	entry->refcount--;
+
+	/* Keep populated zero-reference entries cached for the next
+	 * connection; only a failed populate is torn down.
+	 */
+	if (invalidate && (entry->refcount == 0U)) {
+		mbedtls_x509_crt_free(&entry->chain);
+		entry->in_use = false;
+		entry->populated = false;
+	}
+
+	k_mutex_unlock(&cert_cache_lock);
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE && MBEDTLS_X509_CRT_PARSE_C */
+
 static int tls_add_ca_certificate(struct tls_context *tls,
 				  struct tls_credential *ca_cert)
 {
 #if defined(MBEDTLS_X509_CRT_PARSE_C)
 	int err;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE)
+	if (tls->ca_cache != NULL) {
+		if (tls->ca_cache_hit) {
+			/* Bundle already parsed by an earlier context */
+			return 0;
+		}
+
+		/* A cached chain outlives this socket and possibly the
+		 * stored credential, so it must own its memory: always
+		 * use the copying parser, never the der_nocopy one.
+		 */
+		err = mbedtls_x509_crt_parse(&tls->ca_cache->chain,
+					     ca_cert->buf, ca_cert->len);
+		if (err != 0) {
+			NET_ERR("Failed to parse CA certificate, err: -0x%x",
+				-err);
+			return -EINVAL;
+		}
+
+		return 0;
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE */
+
 	if (tls->options.cert_nocopy == ZSOCK_TLS_CERT_NOCOPY_NONE ||
 	    crt_is_pem(ca_cert->buf, ca_cert->len)) {
 		err = mbedtls_x509_crt_parse(&tls->ca_chain, ca_cert->buf,
@@ -1384,7 +1583,15 @@ static int tls_add_ca_certificate(struct tls_context *tls,
 static void tls_set_ca_chain(struct tls_context *tls)
 {
 #if defined(MBEDTLS_X509_CRT_PARSE_C)
-	mbedtls_ssl_conf_ca_chain(&tls->config, &tls->ca_chain, NULL);
+	mbedtls_x509_crt *chain = &tls->ca_chain;
+
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE)
+	if (tls->ca_cache != NULL) {
+		chain = &tls->ca_cache->chain;
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE */
+
+	mbedtls_ssl_conf_ca_chain(&tls->config, chain, NULL);
 	mbedtls_ssl_conf_cert_profile(&tls->config,
 				      &mbedtls_x509_crt_profile_default);
 #endif /* MBEDTLS_X509_CRT_PARSE_C */
@@ -1516,6 +1723,23 @@ static int tls_mbedtls_set_credentials(struct tls_context *tls)
 
 	credentials_lock();
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE) && defined(MBEDTLS_X509_CRT_PARSE_C)
+	bool any_ca;
+	uint32_t bundle_hash = cert_cache_bundle_hash(tls, &any_ca);
+
+	if (tls->ca_cache != NULL) {
+		/* Repeated credential setup on the same context */
+		cert_cache_release(tls->ca_cache, false);
+		tls->ca_cache = NULL;
+		tls->ca_cache_hit = false;
+	}
+
+	if (any_ca) {
+		tls->ca_cache = cert_cache_acquire(bundle_hash,
+						   &tls->ca_cache_hit);
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE && MBEDTLS_X509_CRT_PARSE_C */
+
 	for (i = 0; i < tls->options.sec_tag_list.sec_tag_count; i++) {
 		tag = tls->options.sec_tag_list.sec_tags[i];
 		cred = NULL;
@@ -1545,6 +1769,21 @@ static int tls_mbedtls_set_credentials(struct tls_context *tls)
 exit:
 	credentials_unlock();
 
+#if defined(CONFIG_NET_SOCKETS_TLS_CERT_CACHE) && defined(MBEDTLS_X509_CRT_PARSE_C)
+	if (tls->ca_cache != NULL) {
+		if (err == 0) {
+			/* Publish a freshly parsed bundle for reuse */
+			(void)k_mutex_lock(&cert_cache_lock, K_FOREVER);
+			tls->ca_cache->populated = true;
+			k_mutex_unlock(&cert_cache_lock);
+		} else {
+			cert_cache_release(tls->ca_cache, true);
+			tls->ca_cache = NULL;
+			tls->ca_cache_hit = false;
+		}
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_CERT_CACHE && MBEDTLS_X509_CRT_PARSE_C */
+
 	if (err == 0) {
 		if (ca_cert_present) {
 			tls_set_ca_chain(tls);
@@ -2819,6 +3058,11 @@ int ztls_close_ctx(struct tls_context *ctx, int sock)
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_TX)
+	/* drain queued records before the close notify */
+	tls_async_tx_flush(ctx);
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->sessions, session_ctx, node) {
 		(void)mbedtls_ssl_close_notify(&session_ctx->ssl);
 	}
@@ -2984,6 +3228,145 @@ error:
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_TX)
+/* Dedicated work queue so record encryption never runs on (and never
+ * blocks) the sending thread; a single thread keeps per-context
+ * completion strictly in submission order.
+ */
+static ssize_t send_tls(struct tls_context *ctx, const void *buf,
+			size_t len, int flags);
+
+static struct k_work_q tls_tx_work_q;
+static K_KERNEL_STACK_DEFINE(tls_tx_stack,
+			     CONFIG_NET_SOCKETS_TLS_ASYNC_TX_STACK_SIZE);
+static bool tls_tx_work_q_started;
+
+struct tls_async_chunk {
+	void *fifo_reserved;
+	size_t len;
+	uint8_t data[];
+};
+
+static void tls_async_tx_work(struct k_work *work)
+{
+	struct tls_context *ctx =
+		CONTAINER_OF(work, struct tls_context, async_tx_work);
+	struct tls_async_chunk *chunk;
+
+	while ((chunk = k_fifo_get(&ctx->async_tx_queue, K_NO_WAIT)) != NULL) {
+		size_t off = 0;
+
+		k_mutex_lock(ctx->lock, K_FOREVER);
+
+		if (!ctx->is_used) {
+			/* closed under us; context storage is static
+			 * so the lock stays valid, but the session is
+			 * gone: just drop the chunk
+			 */
+			k_mutex_unlock(ctx->lock);
+			atomic_sub(&ctx->async_tx_bytes, chunk->len);
+			k_free(chunk);
+			continue;
+		}
+
+		while ((off < chunk->len) && (ctx->async_tx_err == 0) &&
+		       (ctx->error == 0)) {
+			ssize_t out = send_tls(ctx, &chunk->data[off],
+					       chunk->len - off, 0);
+
+			if (out > 0) {
+				off += out;
+				continue;
+			}
+
+			if (errno == EAGAIN) {
+				/* flow controlled: let the socket
+				 * drain, writes stay in order because
+				 * only this thread consumes the queue
+				 */
+				k_mutex_unlock(ctx->lock);
+				k_msleep(1);
+				k_mutex_lock(ctx->lock, K_FOREVER);
+				continue;
+			}
+
+			ctx->async_tx_err = errno;
+			break;
+		}
+
+		k_mutex_unlock(ctx->lock);
+
+		atomic_sub(&ctx->async_tx_bytes, chunk->len);
+		k_free(chunk);
+	}
+}
+
+static ssize_t tls_async_tx_submit(struct tls_context *ctx, const void *buf,
+				   size_t len)
+{
+	struct tls_async_chunk *chunk;
+
+	if (ctx->async_tx_err != 0) {
+		errno = ctx->async_tx_err;
+		ctx->async_tx_err = 0;
+		return -1;
+	}
+
+	if ((atomic_get(&ctx->async_tx_bytes) + len) >
+	    CONFIG_NET_SOCKETS_TLS_ASYNC_TX_MAX_BYTES) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	chunk = k_malloc(sizeof(*chunk) + len);
+	if (chunk == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	chunk->len = len;
+	memcpy(chunk->data, buf, len);
+
+	atomic_add(&ctx->async_tx_bytes, len);
+	k_fifo_put(&ctx->async_tx_queue, chunk);
+	k_work_submit_to_queue(&tls_tx_work_q, &ctx->async_tx_work);
+
+	return (ssize_t)len;
+}
+
+static void tls_async_tx_init(struct tls_context *ctx)
+{
+	if (!tls_tx_work_q_started) {
+		k_work_queue_start(&tls_tx_work_q, tls_tx_stack,
+				   K_KERNEL_STACK_SIZEOF(tls_tx_stack),
+				   CONFIG_NET_SOCKETS_TLS_ASYNC_TX_PRIO, NULL);
+		k_thread_name_set(&tls_tx_work_q.thread, "tls_tx");
+		tls_tx_work_q_started = true;
+	}
+
+	k_work_init(&ctx->async_tx_work, tls_async_tx_work);
+	k_fifo_init(&ctx->async_tx_queue);
+	atomic_clear(&ctx->async_tx_bytes);
+	ctx->async_tx_err = 0;
+}
+
+static void tls_async_tx_flush(struct tls_context *ctx)
+{
+	struct tls_async_chunk *chunk;
+
+	/* The caller holds the socket lock, so the worker cannot make
+	 * progress while we wait: cancel and drop whatever is still
+	 * queued (close without lingering), the close notify follows.
+	 */
+	(void)k_work_cancel(&ctx->async_tx_work);
+
+	while ((chunk = k_fifo_get(&ctx->async_tx_queue, K_NO_WAIT)) != NULL) {
+		atomic_sub(&ctx->async_tx_bytes, chunk->len);
+		k_free(chunk);
+	}
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_ASYNC_TX */
+
 static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 			size_t len, int flags)
 {
@@ -3167,6 +3550,14 @@ ssize_t ztls_sendto_ctx(struct tls_context *ctx, const void *buf, size_t len,
 
 	/* TLS */
 	if (ctx->type == NET_SOCK_STREAM) {
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_TX)
+		if (is_handshake_complete(ctx->active_session)) {
+			/* record encryption happens on the TLS work
+			 * thread, in submission order
+			 */
+			return tls_async_tx_submit(ctx, buf, len);
+		}
+#endif
 		return send_tls(ctx, buf, len, flags);
 	}
 
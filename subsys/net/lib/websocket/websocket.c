@@ -661,6 +661,49 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* XOR the payload with the 4-byte masking key, word-at-a-time.  The
+ * key is laid out in memory order and rotated to the payload's offset
+ * within the message, so the bulk of the buffer is processed with
+ * 32-bit loads and stores regardless of endianness or where in the
+ * message this span starts.
+ */
+static void websocket_mask_payload(uint8_t *payload, size_t len,
+				   uint32_t masking_value, size_t mask_offset)
+{
+	const uint8_t key[4] = {
+		masking_value >> 24, masking_value >> 16,
+		masking_value >> 8, masking_value,
+	};
+	size_t i = 0;
+
+	/* Byte steps until the payload pointer is word aligned */
+	while ((i < len) && !IS_ALIGNED(&payload[i], sizeof(uint32_t))) {
+		payload[i] ^= key[(mask_offset + i) % sizeof(key)];
+		i++;
+	}
+
+	if ((len - i) >= sizeof(uint32_t)) {
+		uint8_t rotated[4];
+		uint32_t mask_word;
+		uint32_t word;
+
+		for (size_t j = 0; j < sizeof(rotated); j++) {
+			rotated[j] = key[(mask_offset + i + j) % sizeof(key)];
+		}
+		memcpy(&mask_word, rotated, sizeof(mask_word));
+
+		for (; (len - i) >= sizeof(uint32_t); i += sizeof(uint32_t)) {
+			memcpy(&word, &payload[i], sizeof(word));
+			word ^= mask_word;
+			memcpy(&payload[i], &word, sizeof(word));
+		}
+	}
+
+	for (; i < len; i++) {
+		payload[i] ^= key[(mask_offset + i) % sizeof(key)];
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -730,8 +773,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -746,10 +787,8 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 			}
 
 			memcpy(data_to_send, payload, payload_len);
-
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+			websocket_mask_payload(data_to_send, payload_len,
+					       ctx->masking_value, 0);
 		}
 	}
 
@@ -947,6 +986,66 @@ static int timeout_to_ms(k_timeout_t *timeout)
 
 #endif /* !defined(CONFIG_NET_TEST) */
 
+/* Fill the context's receive buffer from the underlying socket (or the
+ * test input).  Returns the number of bytes now in the buffer, -EAGAIN
+ * on timeout or -ENOTCONN when the peer closed the connection.
+ */
+static int websocket_fill_recv_buf(int ws_sock, struct websocket_context *ctx,
+				   k_timepoint_t end)
+{
+	int ret;
+
+#if defined(CONFIG_NET_TEST)
+	struct test_data *test_data = zvfs_get_fd_obj(ws_sock, NULL, 0);
+	size_t input_len;
+
+	if (test_data == NULL) {
+		return -EBADF;
+	}
+
+	input_len = MIN(ctx->recv_buf.size,
+			test_data->input_len - test_data->input_pos);
+
+	if (input_len > 0) {
+		memcpy(ctx->recv_buf.buf,
+		       &test_data->input_buf[test_data->input_pos], input_len);
+		test_data->input_pos += input_len;
+		ret = input_len;
+	} else {
+		/* emulate timeout */
+		ret = -EAGAIN;
+	}
+#else
+	k_timeout_t tout = sys_timepoint_timeout(end);
+
+	ARG_UNUSED(ws_sock);
+
+	ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
+	if (ret == 0) {
+		ret = zsock_recv(ctx->real_sock, ctx->recv_buf.buf,
+				 ctx->recv_buf.size, ZSOCK_MSG_DONTWAIT);
+		if (ret < 0) {
+			ret = -errno;
+		}
+	}
+#endif /* CONFIG_NET_TEST */
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret == 0) {
+		/* Socket closed */
+		return -ENOTCONN;
+	}
+
+	ctx->recv_buf.count = ret;
+
+	NET_DBG("[%p] Received %d bytes", ctx, ret);
+
+	return ret;
+}
+
 int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 		       uint32_t *message_type, uint64_t *remaining, int32_t timeout)
 {
@@ -985,36 +1084,23 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 	}
 #endif /* CONFIG_NET_TEST */
 
+	/* Release any span handed out by websocket_recv_msg_view() */
+	if (ctx->view_pending > 0) {
+		size_t left = ctx->recv_buf.count - ctx->view_pending;
+
+		if (left > 0) {
+			memmove(ctx->recv_buf.buf,
+				&ctx->recv_buf.buf[ctx->view_pending], left);
+		}
+		ctx->recv_buf.count = left;
+		ctx->view_pending = 0;
+	}
+
 	do {
 		size_t parsed_count;
 
 		if (ctx->recv_buf.count == 0) {
-#if defined(CONFIG_NET_TEST)
-			size_t input_len = MIN(ctx->recv_buf.size,
-					       test_data->input_len - test_data->input_pos);
-
-			if (input_len > 0) {
-				memcpy(ctx->recv_buf.buf,
-				       &test_data->input_buf[test_data->input_pos], input_len);
-				test_data->input_pos += input_len;
-				ret = input_len;
-			} else {
-				/* emulate timeout */
-				ret = -EAGAIN;
-			}
-#else
-			tout = sys_timepoint_timeout(end);
-
-			ret = wait_rx(ctx->real_sock, timeout_to_ms(&tout));
-			if (ret == 0) {
-				ret = zsock_recv(ctx->real_sock, ctx->recv_buf.buf,
-						 ctx->recv_buf.size, ZSOCK_MSG_DONTWAIT);
-				if (ret < 0) {
-					ret = -errno;
-				}
-			}
-#endif /* CONFIG_NET_TEST */
-
+			ret = websocket_fill_recv_buf(ws_sock, ctx, end);
 			if (ret < 0) {
 				if ((ret == -EAGAIN) && (payload.count > 0)) {
 					/* go to unmasking */
@@ -1022,15 +1108,6 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 				}
 				return ret;
 			}
-
-			if (ret == 0) {
-				/* Socket closed */
-				return -ENOTCONN;
-			}
-
-			ctx->recv_buf.count = ret;
-
-			NET_DBG("[%p] Received %d bytes", ctx, ret);
 		}
 
 		ret = websocket_parse(ctx, &payload);
@@ -1063,15 +1140,10 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
 		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
 
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask_payload(payload.buf, payload.count,
+				       ctx->masking_value, data_buf_offset);
 	}
 
 	if (ctx->message_type == WEBSOCKET_FLAG_CLOSE) {
@@ -1081,6 +1153,136 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 	return payload.count;
 }
 
+int websocket_recv_msg_view(int ws_sock, uint8_t **payload_view,
+			    uint32_t *message_type, uint64_t *remaining,
+			    int32_t timeout)
+{
+	struct websocket_context *ctx;
+	k_timeout_t tout = K_FOREVER;
+	k_timepoint_t end;
+	size_t span = 0;
+	int ret;
+
+	if (payload_view == NULL) {
+		return -EINVAL;
+	}
+
+	if (timeout != SYS_FOREVER_MS) {
+		tout = K_MSEC(timeout);
+	}
+
+	end = sys_timepoint_calc(tout);
+
+#if defined(CONFIG_NET_TEST)
+	struct test_data *test_data = zvfs_get_fd_obj(ws_sock, NULL, 0);
+
+	if (test_data == NULL) {
+		return -EBADF;
+	}
+
+	ctx = test_data->ctx;
+#else
+	ctx = zvfs_get_fd_obj(ws_sock, NULL, 0);
+	if (ctx == NULL) {
+		return -EBADF;
+	}
+
+	if (!PART_OF_ARRAY(contexts, ctx)) {
+		return -ENOENT;
+	}
+#endif /* CONFIG_NET_TEST */
+
+	/* Release the span handed out by the previous call */
+	if (ctx->view_pending > 0) {
+		size_t left = ctx->recv_buf.count - ctx->view_pending;
+
+		if (left > 0) {
+			memmove(ctx->recv_buf.buf,
+				&ctx->recv_buf.buf[ctx->view_pending], left);
+		}
+		ctx->recv_buf.count = left;
+		ctx->view_pending = 0;
+	}
+
+	while (true) {
+		/* A zero-size payload buffer makes the parser consume
+		 * header bytes only and stop at the payload.
+		 */
+		struct websocket_buffer hdr_only = { 0 };
+		size_t parsed_count;
+
+		if (ctx->recv_buf.count == 0) {
+			ret = websocket_fill_recv_buf(ws_sock, ctx, end);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		ret = websocket_parse(ctx, &hdr_only);
+		if (ret < 0) {
+			return ret;
+		}
+		parsed_count = ret;
+
+		/* Drop the parsed header bytes so the payload starts at
+		 * the front of the receive buffer.
+		 */
+		if (parsed_count > 0) {
+			size_t left = ctx->recv_buf.count - parsed_count;
+
+			if (left > 0) {
+				memmove(ctx->recv_buf.buf,
+					&ctx->recv_buf.buf[parsed_count], left);
+			}
+			ctx->recv_buf.count = left;
+		}
+
+		if (ctx->parser_state == WEBSOCKET_PARSER_STATE_OPCODE) {
+			/* Frame without payload fully parsed */
+			break;
+		}
+
+		if ((ctx->parser_state != WEBSOCKET_PARSER_STATE_PAYLOAD) ||
+		    (ctx->recv_buf.count == 0)) {
+			/* Mid-header or no payload bytes yet; read more */
+			continue;
+		}
+
+		span = (size_t)MIN((uint64_t)ctx->recv_buf.count,
+				   ctx->parser_remaining);
+
+		if (ctx->masked) {
+			websocket_mask_payload(ctx->recv_buf.buf, span,
+					       ctx->masking_value,
+					       (size_t)(ctx->message_len -
+							ctx->parser_remaining));
+		}
+
+		ctx->parser_remaining -= span;
+		if (ctx->parser_remaining == 0) {
+			ctx->parser_state = WEBSOCKET_PARSER_STATE_OPCODE;
+		}
+
+		ctx->view_pending = span;
+		break;
+	}
+
+	*payload_view = ctx->recv_buf.buf;
+	if (message_type != NULL) {
+		*message_type = ctx->message_type;
+	}
+	if (remaining != NULL) {
+		*remaining = ctx->parser_remaining;
+	}
+
+	if (ctx->message_type == WEBSOCKET_FLAG_CLOSE) {
+		ret = websocket_internal_disconnect(ctx);
+		return (ret < 0) ? ret : 0;
+	}
+
+	return span;
+}
+
 static int websocket_send(struct websocket_context *ctx, const uint8_t *buf,
 			  size_t buf_len, int32_t timeout)
 {
@@ -109,6 +109,12 @@ __net_socket struct websocket_context {
 	/** Parser state */
 	enum websocket_parser_state parser_state;
 
+	/** Length of the payload span handed out by
+	 * websocket_recv_msg_view(), still held at the front of recv_buf
+	 * and reclaimed on the next call.
+	 */
+	size_t view_pending;
+
 	/** Is the message masked */
 	uint8_t masked : 1;
 
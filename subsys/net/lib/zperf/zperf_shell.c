@@ -569,6 +569,26 @@ static void shell_udp_upload_print_stats(const struct shell *sh,
 			shell_fprintf(sh, SHELL_NORMAL, ")\n");
 		}
 
+
+#ifdef CONFIG_NET_ZPERF_CSV_OUTPUT
+		/* one machine-parsable line per run for regression
+		 * tooling: proto,duration_us,client_duration_us,
+		 * pkts_sent,pkts_rcvd,outorder,lost,jitter_us,
+		 * rate_kbps,client_rate_kbps
+		 */
+		shell_fprintf(sh, SHELL_NORMAL,
+			      "CSV,udp_upload,%llu,%llu,%u,%u,%u,%u,%u,%llu,%llu\n",
+			      (unsigned long long)results->time_in_us,
+			      (unsigned long long)results->client_time_in_us,
+			      results->nb_packets_sent,
+			      results->nb_packets_rcvd,
+			      results->nb_packets_outorder,
+			      results->nb_packets_lost,
+			      results->jitter_in_us,
+			      (unsigned long long)rate_in_kbps,
+			      (unsigned long long)client_rate_in_kbps);
+#endif /* CONFIG_NET_ZPERF_CSV_OUTPUT */
+
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		if (is_async) {
 			struct session *ses = CONTAINER_OF(results,
@@ -626,6 +646,16 @@ static void shell_tcp_upload_print_stats(const struct shell *sh,
 		print_number(sh, client_rate_in_kbps, KBPS, KBPS_UNIT);
 		shell_fprintf(sh, SHELL_NORMAL, "\n");
 
+#ifdef CONFIG_NET_ZPERF_CSV_OUTPUT
+		/* proto,duration_us,pkts_sent,errors,rate_kbps */
+		shell_fprintf(sh, SHELL_NORMAL,
+			      "CSV,tcp_upload,%llu,%u,%u,%llu\n",
+			      (unsigned long long)results->client_time_in_us,
+			      results->nb_packets_sent,
+			      results->nb_packets_errors,
+			      (unsigned long long)client_rate_in_kbps);
+#endif /* CONFIG_NET_ZPERF_CSV_OUTPUT */
+
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		if (is_async) {
 			struct session *ses = CONTAINER_OF(results,
@@ -52,6 +52,69 @@ static struct k_work_q pm_device_runtime_wq;
  * @retval -EBUSY If the device is busy.
  * @retval -errno Other negative errno, result of the action callback.
  */
+#ifdef CONFIG_PM_DEVICE_RUNTIME_FAST_PATH
+/* The fast-path reference count is non-zero only while the device is
+ * active with no transition in flight, so references strictly above
+ * the 0<->1 boundary can be taken and dropped without the lock. The
+ * locked paths below keep base.usage mirrored for reporting.
+ */
+static bool runtime_fast_get(struct pm_device *pm)
+{
+	atomic_val_t cnt = atomic_get(&pm->base.fast_refs);
+
+	while (cnt > 0) {
+		if (atomic_cas(&pm->base.fast_refs, cnt, cnt + 1)) {
+			return true;
+		}
+
+		cnt = atomic_get(&pm->base.fast_refs);
+	}
+
+	return false;
+}
+
+static bool runtime_fast_put(struct pm_device *pm)
+{
+	atomic_val_t cnt = atomic_get(&pm->base.fast_refs);
+
+	while (cnt > 1) {
+		if (atomic_cas(&pm->base.fast_refs, cnt, cnt - 1)) {
+			return true;
+		}
+
+		cnt = atomic_get(&pm->base.fast_refs);
+	}
+
+	return false;
+}
+
+/* Called under the lock when usage is mutated, to publish (or
+ * withdraw) the lock-free count. Publish only in the ACTIVE state.
+ */
+static void runtime_fast_sync(struct pm_device *pm)
+{
+	atomic_set(&pm->base.fast_refs,
+		   (pm->base.state == PM_DEVICE_STATE_ACTIVE) ? (atomic_val_t)pm->base.usage : 0);
+}
+#else
+static inline bool runtime_fast_get(struct pm_device *pm)
+{
+	ARG_UNUSED(pm);
+	return false;
+}
+
+static inline bool runtime_fast_put(struct pm_device *pm)
+{
+	ARG_UNUSED(pm);
+	return false;
+}
+
+static inline void runtime_fast_sync(struct pm_device *pm)
+{
+	ARG_UNUSED(pm);
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_FAST_PATH */
+
 static int runtime_suspend(const struct device *dev, bool async,
 			k_timeout_t delay)
 {
@@ -65,6 +128,11 @@ static int runtime_suspend(const struct device *dev, bool async,
 		return 0;
 	}
 
+	if (runtime_fast_put(pm)) {
+		/* Reference dropped above the suspend boundary */
+		return 0;
+	}
+
 	if (k_is_pre_kernel()) {
 		async = false;
 	} else {
@@ -74,6 +142,23 @@ static int runtime_suspend(const struct device *dev, bool async,
 		}
 	}
 
+	/* Merge references taken lock-free since the last locked
+	 * operation into the canonical count.
+	 */
+#ifdef CONFIG_PM_DEVICE_RUNTIME_FAST_PATH
+	{
+		/* The swap keeps fast operations out while transitioning
+		 * and atomically captures any references taken lock-free
+		 * since the last locked operation.
+		 */
+		atomic_val_t grabbed = atomic_set(&pm->base.fast_refs, 0);
+
+		if (pm->base.state == PM_DEVICE_STATE_ACTIVE) {
+			pm->base.usage = (uint32_t)grabbed;
+		}
+	}
+#endif
+
 	if (pm->base.usage == 0U) {
 		LOG_WRN("Unbalanced suspend");
 		ret = -EALREADY;
@@ -113,6 +198,8 @@ static int runtime_suspend(const struct device *dev, bool async,
 	}
 
 unlock:
+	runtime_fast_sync(pm);
+
 	if (!k_is_pre_kernel()) {
 		k_sem_give(&pm->lock);
 	}
@@ -136,6 +223,7 @@ static void runtime_suspend_work(struct k_work *work)
 	} else {
 		pm->base.state = PM_DEVICE_STATE_SUSPENDED;
 	}
+	runtime_fast_sync(pm);
 	k_event_set(&pm->event, BIT(pm->base.state));
 	k_sem_give(&pm->lock);
 
@@ -218,6 +306,13 @@ int pm_device_runtime_get(const struct device *dev)
 		goto end;
 	}
 
+	if (runtime_fast_get(pm)) {
+		/* Device active with references outstanding: no
+		 * transition possible, nothing else to do.
+		 */
+		goto end;
+	}
+
 	if (!k_is_pre_kernel()) {
 		ret = k_sem_take(&pm->lock, k_is_in_isr() ? K_NO_WAIT : K_FOREVER);
 		if (ret < 0) {
@@ -225,6 +320,19 @@ int pm_device_runtime_get(const struct device *dev)
 		}
 	}
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_FAST_PATH
+	{
+		/* Merge lock-free references and keep fast operations out
+		 * while we may transition.
+		 */
+		atomic_val_t grabbed = atomic_set(&pm->base.fast_refs, 0);
+
+		if (pm->base.state == PM_DEVICE_STATE_ACTIVE) {
+			pm->base.usage = (uint32_t)grabbed;
+		}
+	}
+#endif
+
 	if (k_is_in_isr() && (pm->base.state == PM_DEVICE_STATE_SUSPENDING)) {
 		ret = -EWOULDBLOCK;
 		goto unlock;
@@ -298,6 +406,8 @@ int pm_device_runtime_get(const struct device *dev)
 	pm->base.state = PM_DEVICE_STATE_ACTIVE;
 
 unlock:
+	runtime_fast_sync(pm);
+
 	if (!k_is_pre_kernel()) {
 		k_sem_give(&pm->lock);
 	}
@@ -491,6 +601,7 @@ int pm_device_runtime_enable(const struct device *dev)
 	}
 
 	pm->base.usage = 0U;
+	runtime_fast_sync(pm);
 
 	atomic_set_bit(&pm->base.flags, PM_DEVICE_FLAG_RUNTIME_ENABLED);
 
@@ -585,6 +696,7 @@ int pm_device_runtime_disable(const struct device *dev)
 clear_bit:
 #endif
 	atomic_clear_bit(&pm->base.flags, PM_DEVICE_FLAG_RUNTIME_ENABLED);
+	runtime_fast_sync(pm);
 
 unlock:
 	if (!k_is_pre_kernel()) {
@@ -610,6 +722,16 @@ int pm_device_runtime_usage(const struct device *dev)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_FAST_PATH
+	{
+		atomic_val_t fast = atomic_get(&dev->pm_base->fast_refs);
+
+		if (fast > 0) {
+			return (int)fast;
+		}
+	}
+#endif
+
 	return dev->pm_base->usage;
 }
 
@@ -9,6 +9,33 @@
 #include <zephyr/sys_clock.h>
 #include <zephyr/pm/device.h>
 
+/* The residency threshold of each state is a build-time constant in
+ * microseconds; converting it to ticks involves 64-bit math that used
+ * to run for every candidate state on every idle entry. Precompute the
+ * per-CPU thresholds once, on first use.
+ */
+/* Covers substates too, hence not bounded by PM_STATE_COUNT; CPUs with
+ * more states than this fall back to computing per entry.
+ */
+#define PM_POLICY_MAX_CPU_STATES 16
+
+static uint32_t residency_ticks[CONFIG_MP_MAX_NUM_CPUS][PM_POLICY_MAX_CPU_STATES];
+static bool residency_ticks_ready[CONFIG_MP_MAX_NUM_CPUS];
+
+static void precompute_residency_ticks(uint8_t cpu, const struct pm_state_info *cpu_states,
+				       uint8_t num_cpu_states)
+{
+	for (uint8_t i = 0; i < num_cpu_states; i++) {
+		uint32_t min_residency_us =
+			cpu_states[i].min_residency_us + cpu_states[i].exit_latency_us;
+
+		residency_ticks[cpu][i] =
+			(min_residency_us > 0) ? k_us_to_ticks_ceil32(min_residency_us) : 0;
+	}
+
+	residency_ticks_ready[cpu] = true;
+}
+
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 {
 	uint8_t num_cpu_states;
@@ -23,14 +50,24 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 
 	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
 
+	if (unlikely(!residency_ticks_ready[cpu]) &&
+	    (num_cpu_states <= PM_POLICY_MAX_CPU_STATES)) {
+		precompute_residency_ticks(cpu, cpu_states, num_cpu_states);
+	}
+
 	for (uint32_t i = 0; i < num_cpu_states; i++) {
 		const struct pm_state_info *state = &cpu_states[i];
-		uint32_t min_residency_ticks = 0;
-		uint32_t min_residency_us = state->min_residency_us + state->exit_latency_us;
+		uint32_t min_residency_ticks;
+
+		if (likely(residency_ticks_ready[cpu])) {
+			min_residency_ticks = residency_ticks[cpu][i];
+		} else {
+			uint32_t min_residency_us =
+				state->min_residency_us + state->exit_latency_us;
 
-		/* If the input is zero, avoid 64-bit conversion from microseconds to ticks. */
-		if (min_residency_us > 0) {
-			min_residency_ticks = k_us_to_ticks_ceil32(min_residency_us);
+			min_residency_ticks = (min_residency_us > 0)
+						      ? k_us_to_ticks_ceil32(min_residency_us)
+						      : 0;
 		}
 
 		if (ticks < min_residency_ticks) {
@@ -12,6 +12,7 @@
 #include <zephyr/shell/shell_uart.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
@@ -25,6 +26,10 @@ struct perf_data_t {
 	size_t idx;
 	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
 	bool buf_full;
+#if defined(CONFIG_PROFILING_PERF_THREAD_FILTER)
+	/* when set, only samples taken while this thread runs are kept */
+	struct k_thread *filter_thread;
+#endif
 };
 
 static void perf_tracer(struct k_timer *timer);
@@ -41,6 +46,17 @@ static void perf_tracer(struct k_timer *timer)
 
 	size_t trace_length = 0;
 
+#if defined(CONFIG_PROFILING_PERF_THREAD_FILTER)
+	/* Sample only the thread (or CPU) of interest: skipping here
+	 * keeps the buffer budget for the workload being profiled
+	 * instead of whatever else happens to run.
+	 */
+	if ((perf_data_ptr->filter_thread != NULL) &&
+	    (perf_data_ptr->filter_thread != arch_current_thread())) {
+		return;
+	}
+#endif
+
 	if (++perf_data_ptr->idx < CONFIG_PROFILING_PERF_BUFFER_SIZE) {
 		trace_length = arch_perf_current_stack_trace(
 					perf_data_ptr->buf + perf_data_ptr->idx,
@@ -70,6 +86,33 @@ static void perf_dwork_handler(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_PROFILING_PERF_THREAD_FILTER)
+struct thread_name_match {
+	const char *name;
+	struct k_thread *found;
+};
+
+static void thread_name_cb(const struct k_thread *thread, void *user_data)
+{
+	struct thread_name_match *match = user_data;
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	if ((match->found == NULL) && (name != NULL) &&
+	    (strcmp(name, match->name) == 0)) {
+		match->found = (struct k_thread *)thread;
+	}
+}
+
+static struct k_thread *thread_find_by_name(const char *name)
+{
+	struct thread_name_match match = { .name = name, .found = NULL };
+
+	k_thread_foreach(thread_name_cb, &match);
+
+	return match.found;
+}
+#endif /* CONFIG_PROFILING_PERF_THREAD_FILTER */
+
 static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 {
 	if (k_work_delayable_is_pending(&perf_data.dwork)) {
@@ -87,6 +130,18 @@ static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 
 	perf_data.sh = sh;
 
+#if defined(CONFIG_PROFILING_PERF_THREAD_FILTER)
+	perf_data.filter_thread = NULL;
+	if (argc > 3) {
+		/* optional thread name to restrict sampling to */
+		perf_data.filter_thread = thread_find_by_name(argv[3]);
+		if (perf_data.filter_thread == NULL) {
+			shell_warn(sh, "No thread named %s", argv[3]);
+			return -EINVAL;
+		}
+	}
+#endif
+
 	k_timer_user_data_set(&perf_data.timer, &perf_data);
 	k_timer_start(&perf_data.timer, K_NO_WAIT, period);
 
@@ -147,7 +202,8 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 	"Usage: record <duration> <frequency>"
 
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
-	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
+	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3,
+		      IS_ENABLED(CONFIG_PROFILING_PERF_THREAD_FILTER) ? 1 : 0),
 	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
 	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
@@ -12,6 +12,67 @@
 static const struct device *const entropy_dev =
 	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
 
+#if CONFIG_ENTROPY_DEVICE_RANDOM_POOL_SIZE > 0
+/* Buffered entropy for the non-cryptographic path: small requests are
+ * served with a memcpy from the pool and the driver is only entered
+ * for pool-sized batched refills. Consumption takes a spinlock (so it
+ * works from any context); refills serialize on a semaphore and run
+ * the potentially-blocking driver call without any lock held.
+ */
+static uint8_t rand_pool[CONFIG_ENTROPY_DEVICE_RANDOM_POOL_SIZE];
+static size_t rand_pool_avail;
+static struct k_spinlock rand_pool_lock;
+static uint8_t rand_refill_buf[CONFIG_ENTROPY_DEVICE_RANDOM_POOL_SIZE];
+static K_SEM_DEFINE(rand_refill_sem, 1, 1);
+
+static bool rand_pool_take(uint8_t *dst, size_t outlen)
+{
+	k_spinlock_key_t key = k_spin_lock(&rand_pool_lock);
+	bool ok = (rand_pool_avail >= outlen);
+
+	if (ok) {
+		rand_pool_avail -= outlen;
+		memcpy(dst, &rand_pool[rand_pool_avail], outlen);
+	}
+
+	k_spin_unlock(&rand_pool_lock, key);
+
+	return ok;
+}
+
+static int rand_pool_refill(void)
+{
+	k_spinlock_key_t key;
+	size_t space;
+	int ret;
+
+	k_sem_take(&rand_refill_sem, K_FOREVER);
+
+	/* Another refiller may have topped the pool up meanwhile */
+	key = k_spin_lock(&rand_pool_lock);
+	space = sizeof(rand_pool) - rand_pool_avail;
+	k_spin_unlock(&rand_pool_lock, key);
+
+	if (space == 0U) {
+		k_sem_give(&rand_refill_sem);
+		return 0;
+	}
+
+	ret = entropy_get_entropy(entropy_dev, rand_refill_buf, space);
+	if (ret == 0) {
+		key = k_spin_lock(&rand_pool_lock);
+		space = MIN(space, sizeof(rand_pool) - rand_pool_avail);
+		memcpy(&rand_pool[rand_pool_avail], rand_refill_buf, space);
+		rand_pool_avail += space;
+		k_spin_unlock(&rand_pool_lock, key);
+	}
+
+	k_sem_give(&rand_refill_sem);
+
+	return ret;
+}
+#endif /* CONFIG_ENTROPY_DEVICE_RANDOM_POOL_SIZE > 0 */
+
 static int rand_get(uint8_t *dst, size_t outlen, bool csrand)
 {
 	uint32_t random_num;
@@ -21,6 +82,28 @@ static int rand_get(uint8_t *dst, size_t outlen, bool csrand)
 		return -ENODEV;
 	}
 
+#if CONFIG_ENTROPY_DEVICE_RANDOM_POOL_SIZE > 0
+	/* The pool only backs the non-cryptographic path: the CSPRNG
+	 * keeps its direct driver access and reseed policy. Requests
+	 * that would drain most of the pool, and misses in contexts
+	 * that cannot wait for a refill, go straight to the driver.
+	 */
+	if (!csrand && (outlen <= sizeof(rand_pool) / 2U)) {
+		while (true) {
+			if (rand_pool_take(dst, outlen)) {
+				return 0;
+			}
+
+			/* Misses fall through to the direct driver call
+			 * when a refill is impossible here.
+			 */
+			if (k_is_in_isr() || k_is_pre_kernel() || (rand_pool_refill() < 0)) {
+				break;
+			}
+		}
+	}
+#endif /* CONFIG_ENTROPY_DEVICE_RANDOM_POOL_SIZE > 0 */
+
 	ret = entropy_get_entropy(entropy_dev, dst, outlen);
 
 	if (unlikely(ret < 0)) {
@@ -72,6 +72,45 @@ static inline int z_vrfy_rtio_cqe_get_mempool_buffer(const struct rtio *r, struc
 }
 #include <zephyr/syscalls/rtio_cqe_get_mempool_buffer_mrsh.c>
 
+#ifdef CONFIG_RTIO_USER_RING
+int z_rtio_user_ring_attach_validated(struct rtio *r, struct rtio_user_ring *ring,
+				      const struct rtio_user_ring *snapshot,
+				      struct rtio_iodev *iodev, void *region,
+				      size_t region_size);
+
+static inline int z_vrfy_rtio_user_ring_attach(struct rtio *r, struct rtio_user_ring *ring,
+					       struct rtio_iodev *iodev, void *region,
+					       size_t region_size)
+{
+	struct rtio_user_ring cring;
+
+	K_OOPS(K_SYSCALL_OBJ(r, K_OBJ_RTIO));
+	K_OOPS(K_SYSCALL_OBJ(iodev, K_OBJ_RTIO_IODEV));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(ring, sizeof(*ring)));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(region, region_size));
+
+	/* Validate the entry arrays against a kernel copy of the control
+	 * block, then attach from that same copy so the geometry cannot
+	 * change between validation and use.
+	 */
+	cring = *ring;
+	K_OOPS(K_SYSCALL_VERIFY(is_power_of_two(cring.sq_size)));
+	K_OOPS(K_SYSCALL_VERIFY(is_power_of_two(cring.cq_size)));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(cring.sq, cring.sq_size * sizeof(struct rtio_sqe)));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(cring.cq, cring.cq_size * sizeof(struct rtio_user_cqe)));
+
+	return z_rtio_user_ring_attach_validated(r, ring, &cring, iodev, region, region_size);
+}
+#include <zephyr/syscalls/rtio_user_ring_attach_mrsh.c>
+
+static inline int z_vrfy_rtio_user_ring_kick(struct rtio *r)
+{
+	K_OOPS(K_SYSCALL_OBJ(r, K_OBJ_RTIO));
+	return z_impl_rtio_user_ring_kick(r);
+}
+#include <zephyr/syscalls/rtio_user_ring_kick_mrsh.c>
+#endif /* CONFIG_RTIO_USER_RING */
+
 static inline int z_vrfy_rtio_sqe_cancel(struct rtio_sqe *sqe)
 {
 	return z_impl_rtio_sqe_cancel(sqe);
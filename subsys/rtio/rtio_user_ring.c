@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(rtio_user_ring, CONFIG_RTIO_LOG_LEVEL);
+
+/* Ops a ring submission may carry. Everything here only references
+ * memory through the buffer fields checked against the attached
+ * region; ops with kernel callbacks or iodev choice stay syscall-only.
+ */
+static bool in_region(const struct rtio *r, const void *ptr, size_t len)
+{
+	uintptr_t addr = (uintptr_t)ptr;
+
+	/* Overflow-safe: offset and length are both bounded by the
+	 * region size before being combined.
+	 */
+	return (addr >= r->u_region) && (len <= r->u_region_size) &&
+	       ((addr - r->u_region) <= (r->u_region_size - len));
+}
+
+static bool user_ring_sqe_ok(const struct rtio *r, const struct rtio_sqe *sqe)
+{
+	switch (sqe->op) {
+	case RTIO_OP_NOP:
+		return true;
+	case RTIO_OP_TX:
+		return in_region(r, sqe->tx.buf, sqe->tx.buf_len);
+	case RTIO_OP_RX:
+		return in_region(r, sqe->rx.buf, sqe->rx.buf_len);
+	case RTIO_OP_TINY_TX:
+		return true;
+	case RTIO_OP_TXRX:
+		return in_region(r, sqe->txrx.tx_buf, sqe->txrx.buf_len) &&
+		       in_region(r, sqe->txrx.rx_buf, sqe->txrx.buf_len);
+	default:
+		return false;
+	}
+}
+
+void rtio_user_cq_produce(struct rtio *r, int result, void *userdata, uint32_t flags)
+{
+	struct rtio_user_ring *ring = r->u_ring;
+	uint32_t head;
+	uint32_t tail;
+	struct rtio_user_cqe *slot;
+
+	/* Claim a slot with a CAS on the free-running tail so concurrent
+	 * completion contexts cannot collide; the VALID bit publishes the
+	 * filled entry to the consumer afterwards.
+	 */
+	do {
+		head = (uint32_t)atomic_get(&ring->cq_head);
+		tail = (uint32_t)atomic_get(&ring->cq_tail);
+
+		if ((tail - head) >= r->u_cq_size) {
+			atomic_inc(&r->xcqcnt);
+			return;
+		}
+	} while (!atomic_cas(&ring->cq_tail, (atomic_val_t)tail, (atomic_val_t)(tail + 1U)));
+
+	slot = &r->u_cq[tail & (r->u_cq_size - 1U)];
+	slot->result = result;
+	slot->userdata = userdata;
+	slot->flags = (flags & ~RTIO_USER_CQE_F_VALID);
+	compiler_barrier();
+	slot->flags |= RTIO_USER_CQE_F_VALID;
+}
+
+void rtio_user_ring_drain(struct rtio *r)
+{
+	struct rtio_user_ring *ring = r->u_ring;
+
+	/* kernel_active hands the draining role between the doorbell
+	 * syscall, completion contexts and producers: whoever fails the
+	 * claim relies on the holder re-checking the ring before idling.
+	 */
+	while (atomic_set(&ring->kernel_active, 1) == 0) {
+		uint32_t head = (uint32_t)atomic_get(&ring->sq_head);
+		uint32_t tail = (uint32_t)atomic_get(&ring->sq_tail);
+		uint32_t submitted = 0U;
+		bool stalled = false;
+
+		/* sq_tail is user-writable and untrusted: a hostile
+		 * value (e.g. head - 1) must not turn this drain into
+		 * ~2^32 copy/validate iterations in kernel/completion
+		 * context.  A valid producer can never be more than
+		 * u_sq_size entries ahead, so a larger distance means
+		 * the user corrupted its ring: drop the claimed span
+		 * wholesale instead of walking it.
+		 */
+		if ((tail - head) > r->u_sq_size) {
+			atomic_set(&ring->sq_head, (atomic_val_t)tail);
+			tail = head;
+		}
+
+		while (head != tail) {
+			/* Copy to kernel memory before validating so the
+			 * user side cannot mutate the entry afterwards.
+			 */
+			struct rtio_sqe copy = r->u_sq[head & (r->u_sq_size - 1U)];
+			struct rtio_sqe *sqe;
+
+			if (!user_ring_sqe_ok(r, &copy)) {
+				head++;
+				atomic_set(&ring->sq_head, (atomic_val_t)head);
+				rtio_cqe_submit(r, -EINVAL, copy.userdata, 0);
+				continue;
+			}
+
+			sqe = rtio_sqe_acquire(r);
+			if (sqe == NULL) {
+				/* Pool exhausted: leave the entry in the
+				 * ring, the next completion drains again.
+				 */
+				stalled = true;
+				break;
+			}
+
+			*sqe = copy;
+			sqe->iodev = r->u_iodev;
+			/* Ring entries complete independently */
+			sqe->flags &= (uint16_t)~(RTIO_SQE_TRANSACTION | RTIO_SQE_CHAINED);
+
+			head++;
+			atomic_set(&ring->sq_head, (atomic_val_t)head);
+			submitted++;
+		}
+
+		if (submitted > 0U) {
+			(void)rtio_submit(r, 0);
+		}
+
+		atomic_clear(&ring->kernel_active);
+
+		if (stalled) {
+			/* Do not spin on an exhausted SQE pool; completions
+			 * re-enter this function.
+			 */
+			break;
+		}
+
+		if ((uint32_t)atomic_get(&ring->sq_head) ==
+		    (uint32_t)atomic_get(&ring->sq_tail)) {
+			break;
+		}
+
+		/* A producer slipped entries in while we cleared the flag
+		 * and saw us still active: reclaim and go around.
+		 */
+	}
+}
+
+/* Shared by the trusted and the user-mode entry points. The geometry
+ * comes from @p snapshot, a kernel-memory copy taken (and, for user
+ * callers, validated) by the caller, never re-read from user memory,
+ * so a user thread cannot swap the arrays between validation and use.
+ */
+int z_rtio_user_ring_attach_validated(struct rtio *r, struct rtio_user_ring *ring,
+				      const struct rtio_user_ring *snapshot,
+				      struct rtio_iodev *iodev, void *region,
+				      size_t region_size)
+{
+	if ((snapshot->sq_size == 0U) || !is_power_of_two(snapshot->sq_size) ||
+	    (snapshot->cq_size == 0U) || !is_power_of_two(snapshot->cq_size) ||
+	    (snapshot->sq == NULL) || (snapshot->cq == NULL)) {
+		return -EINVAL;
+	}
+
+	r->u_sq = snapshot->sq;
+	r->u_cq = snapshot->cq;
+	r->u_sq_size = snapshot->sq_size;
+	r->u_cq_size = snapshot->cq_size;
+	r->u_iodev = iodev;
+	r->u_region = (uintptr_t)region;
+	r->u_region_size = region_size;
+
+	atomic_set(&ring->sq_head, 0);
+	atomic_set(&ring->sq_tail, 0);
+	atomic_set(&ring->cq_head, 0);
+	atomic_set(&ring->cq_tail, 0);
+	atomic_clear(&ring->kernel_active);
+
+	/* Published last: rtio_cqe_submit() keys off u_ring/u_cq */
+	r->u_ring = ring;
+
+	return 0;
+}
+
+int z_impl_rtio_user_ring_attach(struct rtio *r, struct rtio_user_ring *ring,
+				 struct rtio_iodev *iodev, void *region, size_t region_size)
+{
+	struct rtio_user_ring snapshot = *ring;
+
+	return z_rtio_user_ring_attach_validated(r, ring, &snapshot, iodev, region, region_size);
+}
+
+int z_impl_rtio_user_ring_kick(struct rtio *r)
+{
+	if (r->u_ring == NULL) {
+		return -EINVAL;
+	}
+
+	rtio_user_ring_drain(r);
+
+	return 0;
+}
@@ -7,16 +7,46 @@
 
 #include <zephyr/rtio/work.h>
 #include <zephyr/kernel.h>
+#include <string.h>
 
 K_MEM_SLAB_DEFINE_STATIC(rtio_work_items_slab,
 			 sizeof(struct rtio_work_req),
 			 CONFIG_RTIO_WORKQ_POOL_ITEMS,
 			 4);
+#if defined(CONFIG_RTIO_WORKQ_PRIO)
+static void rtio_work_done_handler(struct k_p4wq_work *work);
+
+/* The done handler is where the p4wq hands the item back: the queue
+ * still touches the work struct after the work handler returns, so
+ * the slab free must not happen earlier.
+ */
+K_P4WQ_DEFINE_WITH_DONE_HANDLER(rtio_p4workq,
+				CONFIG_RTIO_WORKQ_THREADS_POOL,
+				CONFIG_RTIO_WORKQ_THREADS_POOL_STACK_SIZE,
+				rtio_work_done_handler);
+#else
 static K_THREAD_STACK_ARRAY_DEFINE(rtio_workq_threads_stack,
 				   CONFIG_RTIO_WORKQ_THREADS_POOL,
 				   CONFIG_RTIO_WORKQ_THREADS_POOL_STACK_SIZE);
 static struct k_thread rtio_work_threads[CONFIG_RTIO_WORKQ_THREADS_POOL];
 static K_QUEUE_DEFINE(rtio_workq);
+#endif
+
+#if defined(CONFIG_RTIO_WORKQ_PRIO)
+static void rtio_work_handler(struct k_p4wq_work *work)
+{
+	struct rtio_work_req *req = CONTAINER_OF(work, struct rtio_work_req, work);
+
+	req->handler(req->iodev_sqe);
+}
+
+static void rtio_work_done_handler(struct k_p4wq_work *work)
+{
+	struct rtio_work_req *req = CONTAINER_OF(work, struct rtio_work_req, work);
+
+	k_mem_slab_free(&rtio_work_items_slab, req);
+}
+#endif
 
 struct rtio_work_req *rtio_work_req_alloc(void)
 {
@@ -28,6 +58,13 @@ struct rtio_work_req *rtio_work_req_alloc(void)
 		return NULL;
 	}
 
+#if defined(CONFIG_RTIO_WORKQ_PRIO)
+	/* The p4wq rejects resubmission of an item that still looks
+	 * active; items from the slab may carry stale state.
+	 */
+	memset(&req->work, 0, sizeof(req->work));
+#endif
+
 	return req;
 }
 
@@ -47,11 +84,31 @@ void rtio_work_req_submit(struct rtio_work_req *req,
 	req->iodev_sqe = iodev_sqe;
 	req->handler = handler;
 
+#if defined(CONFIG_RTIO_WORKQ_PRIO)
+	/* Map the SQE priority (0..255, higher is more urgent) onto the
+	 * pool's thread priority space (lower is more urgent): HIGH runs
+	 * one level above the configured pool priority, LOW one below, so
+	 * a backlog of low-priority submissions cannot delay an urgent
+	 * one behind it.
+	 */
+	if (iodev_sqe->sqe.prio >= RTIO_PRIO_HIGH) {
+		req->work.priority = CONFIG_RTIO_WORKQ_THREADS_POOL_PRIO - 1;
+	} else if (iodev_sqe->sqe.prio <= RTIO_PRIO_LOW) {
+		req->work.priority = CONFIG_RTIO_WORKQ_THREADS_POOL_PRIO + 1;
+	} else {
+		req->work.priority = CONFIG_RTIO_WORKQ_THREADS_POOL_PRIO;
+	}
+	req->work.deadline = 0;
+	req->work.handler = rtio_work_handler;
+
+	k_p4wq_submit(&rtio_p4workq, &req->work);
+#else
 	/** For now we're simply treating this as a FIFO queue. It may be
 	 * desirable to expand this to handle queue ordering based on RTIO
 	 * SQE priority.
 	 */
 	k_queue_append(&rtio_workq, req);
+#endif
 }
 
 uint32_t rtio_work_req_used_count_get(void)
@@ -59,6 +116,7 @@ uint32_t rtio_work_req_used_count_get(void)
 	return k_mem_slab_num_used_get(&rtio_work_items_slab);
 }
 
+#if !defined(CONFIG_RTIO_WORKQ_PRIO)
 static void rtio_workq_thread_fn(void *arg1, void *arg2, void *arg3)
 {
 	ARG_UNUSED(arg1);
@@ -93,3 +151,4 @@ static int static_init(void)
 }
 
 SYS_INIT(static_init, POST_KERNEL, 1);
+#endif /* !CONFIG_RTIO_WORKQ_PRIO */
@@ -99,6 +99,7 @@ int sensing_set_config(sensing_sensor_handle_t handle,
 			break;
 
 		case SENSING_SENSOR_ATTRIBUTE_LATENCY:
+			ret |= set_latency(handle, cfg->latency);
 			break;
 
 		default:
@@ -139,6 +140,7 @@ int sensing_get_config(sensing_sensor_handle_t handle,
 			break;
 
 		case SENSING_SENSOR_ATTRIBUTE_LATENCY:
+			ret |= get_latency(handle, &cfg->latency);
 			break;
 
 		default:
@@ -130,6 +130,64 @@ static int config_interval(struct sensing_sensor *sensor)
 	return set_arbitrate_interval(sensor, interval);
 }
 
+/* The arbitrated latency is the tightest batching budget of any
+ * client: samples may stay in the hardware FIFO at most this long, so
+ * every client still meets its deadline while wakeups drop from one
+ * per sample to one per batch. A client with latency 0 disables
+ * batching entirely.
+ */
+static uint64_t arbitrate_latency(struct sensing_sensor *sensor)
+{
+	struct sensing_connection *conn;
+	uint64_t min_latency = UINT64_MAX;
+
+	for_each_client_conn(sensor, conn) {
+		if (!is_client_request_data(conn)) {
+			continue;
+		}
+		if (conn->latency < min_latency) {
+			min_latency = conn->latency;
+		}
+	}
+
+	return (min_latency == UINT64_MAX ? 0 : min_latency);
+}
+
+static int set_arbitrate_latency(struct sensing_sensor *sensor, uint64_t latency)
+{
+	struct sensing_submit_config *config = sensor->iodev->data;
+	struct sensor_value val = {0};
+	int ret;
+
+	sensor->latency = latency;
+
+	/* Batch duration is expressed in micro seconds, clamped to the
+	 * attribute value range.
+	 */
+	val.val1 = (int32_t)MIN(latency, (uint64_t)INT32_MAX);
+
+	LOG_INF("set arbitrate latency:%lld(us), sensor:%s", latency, sensor->dev->name);
+
+	ret = sensor_attr_set(sensor->dev, config->chan, SENSOR_ATTR_BATCH_DURATION, &val);
+	if (ret == -ENOTSUP || ret == -ENOSYS) {
+		/* Sensor has no hardware FIFO batching; samples keep being
+		 * delivered per interval.
+		 */
+		ret = 0;
+	}
+
+	return ret;
+}
+
+static int config_latency(struct sensing_sensor *sensor)
+{
+	uint64_t latency = arbitrate_latency(sensor);
+
+	LOG_INF("config latency, sensor:%s, latency:%lld", sensor->dev->name, latency);
+
+	return set_arbitrate_latency(sensor, latency);
+}
+
 static uint32_t arbitrate_sensitivity(struct sensing_sensor *sensor, int index)
 {
 	struct sensing_connection *conn;
@@ -193,6 +251,11 @@ static int config_sensor(struct sensing_sensor *sensor)
 		LOG_WRN("sensor:%s config interval error", sensor->dev->name);
 	}
 
+	ret = config_latency(sensor);
+	if (ret) {
+		LOG_WRN("sensor:%s config latency error:%d", sensor->dev->name, ret);
+	}
+
 	for (i = 0; i < sensor->sensitivity_count; i++) {
 		ret = config_sensitivity(sensor, i);
 		if (ret) {
@@ -286,6 +349,7 @@ static void init_connection(struct sensing_connection *conn,
 	}
 
 	conn->interval = 0;
+	conn->latency = 0;
 	memset(conn->sensitivity, 0x00, sizeof(conn->sensitivity));
 	/* link connection to its reporter's client_list */
 	sys_slist_append(&conn->source->client_list, &conn->snode);
@@ -434,6 +498,28 @@ int set_interval(struct sensing_connection *conn, uint32_t interval)
 	return 0;
 }
 
+int set_latency(struct sensing_connection *conn, uint64_t latency)
+{
+	__ASSERT(conn && conn->source, "set latency, connection or reporter not be NULL");
+
+	conn->latency = latency;
+
+	LOG_INF("set latency, sensor:%s, conn:%p, latency:%lld(us)",
+		conn->source->dev->name, conn, latency);
+
+	save_config_and_notify(conn->source);
+
+	return 0;
+}
+
+int get_latency(struct sensing_connection *conn, uint64_t *latency)
+{
+	__ASSERT(conn, "get latency, connection not be NULL");
+	*latency = conn->latency;
+
+	return 0;
+}
+
 int get_interval(struct sensing_connection *conn, uint32_t *interval)
 {
 	__ASSERT(conn, "get interval, connection not be NULL");
@@ -55,6 +55,8 @@ int sensing_register_callback(struct sensing_connection *conn,
 			      struct sensing_callback_list *cb_list);
 int set_interval(struct sensing_connection *conn, uint32_t interval);
 int get_interval(struct sensing_connection *con, uint32_t *sensitivity);
+int set_latency(struct sensing_connection *conn, uint64_t latency);
+int get_latency(struct sensing_connection *conn, uint64_t *latency);
 int set_sensitivity(struct sensing_connection *conn, int8_t index, uint32_t interval);
 int get_sensitivity(struct sensing_connection *con, int8_t index, uint32_t *sensitivity);
 
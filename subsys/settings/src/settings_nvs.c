@@ -155,6 +155,26 @@ static int settings_nvs_load(struct settings_store *cs,
 		 * setting's value.
 		 */
 		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+
+		if ((arg->subtree != NULL) && (rc1 > 0)) {
+			/* Names outside the requested subtree are
+			 * rejected by settings_call_set_handler()
+			 * anyway; skipping them here also saves the
+			 * value-presence probe below, so a subtree
+			 * load only pays one name read per foreign
+			 * item.  (Dirty-pair cleanup still happens on
+			 * full loads.)
+			 */
+			name[MIN(rc1, (ssize_t)(sizeof(name) - 1))] = '\0';
+			if (!settings_name_steq(name, arg->subtree, NULL)) {
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+				settings_nvs_cache_add(cf, name, name_id);
+				cached++;
+#endif
+				continue;
+			}
+		}
+
 		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
 			       &buf, sizeof(buf));
 
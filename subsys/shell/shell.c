@@ -6,6 +6,7 @@
 
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/shell/shell.h>
 #if defined(CONFIG_SHELL_BACKEND_DUMMY)
@@ -512,10 +513,128 @@ static void partial_autocomplete(const struct shell *sh,
 	}
 }
 
+#if defined(CONFIG_SHELL_BACKGROUND_CMDS)
+/* Small job table for commands launched with a trailing "&". Each job
+ * owns copies of its arguments, runs on a dedicated low-priority work
+ * queue and announces its completion through the thread-safe shell
+ * printing path, which interleaves cleanly with the interactive
+ * prompt.
+ */
+struct shell_bg_job {
+	struct k_work work;
+	const struct shell *sh;
+	shell_cmd_handler handler;
+	size_t argc;
+	char *argv[CONFIG_SHELL_ARGC_MAX + 1];
+	char buf[CONFIG_SHELL_CMD_BUFF_SIZE];
+	atomic_t busy;
+};
+
+static struct shell_bg_job bg_jobs[CONFIG_SHELL_BACKGROUND_CMDS_MAX];
+static struct k_work_q bg_workq;
+static K_THREAD_STACK_DEFINE(bg_workq_stack, CONFIG_SHELL_STACK_SIZE);
+static bool bg_workq_started;
+
+static void bg_job_fn(struct k_work *work)
+{
+	struct shell_bg_job *job = CONTAINER_OF(work, struct shell_bg_job, work);
+	int ret;
+
+	ret = job->handler(job->sh, job->argc, job->argv);
+
+	shell_fprintf(job->sh, (ret == 0) ? SHELL_NORMAL : SHELL_ERROR,
+		      "[%d] done: %s (%d)\n", (int)ARRAY_INDEX(bg_jobs, job),
+		      job->argv[0], ret);
+
+	atomic_clear(&job->busy);
+}
+
+static int bg_job_submit(const struct shell *sh, shell_cmd_handler handler,
+			 size_t argc, const char **argv)
+{
+	struct shell_bg_job *job = NULL;
+	size_t used = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(bg_jobs); i++) {
+		if (atomic_set(&bg_jobs[i].busy, 1) == 0) {
+			job = &bg_jobs[i];
+			break;
+		}
+	}
+
+	if (job == NULL) {
+		z_shell_fprintf(sh, SHELL_ERROR, "No free background job slot\n");
+		return -EBUSY;
+	}
+
+	/* The caller's argv points into the live command buffer, which is
+	 * reused as soon as the prompt returns: copy every argument into
+	 * the job's own storage.
+	 */
+	for (size_t i = 0; i < argc; i++) {
+		size_t len = strlen(argv[i]) + 1;
+
+		if ((used + len) > sizeof(job->buf)) {
+			atomic_clear(&job->busy);
+			return -ENOMEM;
+		}
+
+		memcpy(&job->buf[used], argv[i], len);
+		job->argv[i] = &job->buf[used];
+		used += len;
+	}
+	job->argv[argc] = NULL;
+
+	job->sh = sh;
+	job->handler = handler;
+	job->argc = argc;
+
+	if (!bg_workq_started) {
+		struct k_work_queue_config cfg = { .name = "shell_bg" };
+
+		k_work_queue_start(&bg_workq, bg_workq_stack,
+				   K_THREAD_STACK_SIZEOF(bg_workq_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, &cfg);
+		bg_workq_started = true;
+	}
+
+	k_work_init(&job->work, bg_job_fn);
+	(void)k_work_submit_to_queue(&bg_workq, &job->work);
+
+	z_shell_fprintf(sh, SHELL_NORMAL, "[%d] %s\n",
+			(int)ARRAY_INDEX(bg_jobs, job), job->argv[0]);
+
+	return 0;
+}
+
+static int cmd_jobs(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bg_jobs); i++) {
+		if ((atomic_get(&bg_jobs[i].busy) != 0) && (bg_jobs[i].argv[0] != NULL)) {
+			shell_print(sh, "[%d] running: %s", (int)i, bg_jobs[i].argv[0]);
+		}
+	}
+
+	return 0;
+}
+SHELL_CMD_ARG_REGISTER(jobs, NULL, "List background shell jobs", cmd_jobs, 1, 0);
+#endif /* CONFIG_SHELL_BACKGROUND_CMDS */
+
 static int exec_cmd(const struct shell *sh, size_t argc, const char **argv,
 		    const struct shell_static_entry *help_entry)
 {
 	int ret_val = 0;
+#if defined(CONFIG_SHELL_BACKGROUND_CMDS)
+	bool background = false;
+
+	if ((argc > 1) && (strcmp(argv[argc - 1], "&") == 0)) {
+		background = true;
+		argc--;
+	}
+#endif
 
 	if (sh->ctx->active_cmd.handler == NULL) {
 		if ((help_entry != NULL) && IS_ENABLED(CONFIG_SHELL_HELP)) {
@@ -548,6 +667,11 @@ static int exec_cmd(const struct shell *sh, size_t argc, const char **argv,
 	}
 
 	if (!ret_val) {
+#if defined(CONFIG_SHELL_BACKGROUND_CMDS)
+		if (background) {
+			return bg_job_submit(sh, sh->ctx->active_cmd.handler, argc, argv);
+		}
+#endif
 #if CONFIG_SHELL_GETOPT
 		sys_getopt_init();
 #endif
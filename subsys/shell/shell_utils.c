@@ -269,6 +269,31 @@ static inline uint32_t shell_root_cmd_count(void)
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
+#if defined(CONFIG_SHELL_ROOT_CMDS_BINARY_SEARCH)
+	/* Root command section entries are emitted as symbols named
+	 * shell_cmd_<syntax> and the linker sorts iterable sections by
+	 * name, so the section is ordered by syntax and can be searched
+	 * binarily.
+	 */
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		const struct shell_static_entry *entry = shell_root_cmd_get(mid)->entry;
+		int cmp = strcmp(syntax, entry->syntax);
+
+		if (cmp == 0) {
+			return entry;
+		} else if (cmp < 0) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+
+	return NULL;
+#else
 	const size_t cmd_count = shell_root_cmd_count();
 	const union shell_cmd_entry *cmd;
 
@@ -280,6 +305,7 @@ const struct shell_static_entry *root_cmd_find(const char *syntax)
 	}
 
 	return NULL;
+#endif /* CONFIG_SHELL_ROOT_CMDS_BINARY_SEARCH */
 }
 
 const struct shell_static_entry *z_shell_cmd_get(
@@ -352,6 +378,9 @@ const struct shell_static_entry *z_shell_find_cmd(
 	if (parent) {
 		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
 		parent = &parent_cpy;
+	} else {
+		/* Root level lookups share the (possibly binary) search */
+		return root_cmd_find(cmd_str);
 	}
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
@@ -139,3 +139,67 @@ uint8_t flash_area_erased_val(const struct flash_area *fa)
 
 	return param->erase_value;
 }
+
+#if defined(CONFIG_FLASH_MAP_ASYNC)
+static void flash_area_async_work(struct k_work *work)
+{
+	struct flash_area_async *req =
+		CONTAINER_OF(work, struct flash_area_async, work);
+	int rc;
+
+	switch (req->op) {
+	case FLASH_AREA_OP_ERASE:
+		rc = flash_area_erase(req->fa, req->off, req->len);
+		break;
+	case FLASH_AREA_OP_WRITE:
+		rc = flash_area_write(req->fa, req->off, req->data, req->len);
+		break;
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	req->result = rc;
+	if (req->signal != NULL) {
+		k_poll_signal_raise(req->signal, rc);
+	}
+}
+
+static int flash_area_submit_async(const struct flash_area *fa, uint8_t op,
+				   off_t off, const void *data, size_t len,
+				   struct flash_area_async *req,
+				   struct k_poll_signal *signal)
+{
+	if (req == NULL) {
+		return -EINVAL;
+	}
+
+	req->fa = fa;
+	req->op = op;
+	req->off = off;
+	req->data = data;
+	req->len = len;
+	req->signal = signal;
+	req->result = -EBUSY;
+	k_work_init(&req->work, flash_area_async_work);
+
+	return k_work_submit(&req->work) >= 0 ? 0 : -EBUSY;
+}
+
+int flash_area_erase_async(const struct flash_area *fa, off_t off, size_t len,
+			   struct flash_area_async *req,
+			   struct k_poll_signal *signal)
+{
+	return flash_area_submit_async(fa, FLASH_AREA_OP_ERASE, off, NULL,
+				       len, req, signal);
+}
+
+int flash_area_write_async(const struct flash_area *fa, off_t off,
+			   const void *src, size_t len,
+			   struct flash_area_async *req,
+			   struct k_poll_signal *signal)
+{
+	return flash_area_submit_async(fa, FLASH_AREA_OP_WRITE, off, src,
+				       len, req, signal);
+}
+#endif /* CONFIG_FLASH_MAP_ASYNC */
@@ -184,6 +184,54 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
+
+#if defined(CONFIG_STREAM_FLASH_PIPELINE)
+/* Double-buffered pipelining: when the active buffer fills, its
+ * program operation is handed to the system work queue and the
+ * transport keeps filling the shadow buffer, overlapping flash
+ * program latency with transport I/O.  Ordering is preserved by
+ * waiting for the in-flight program before submitting the next.
+ */
+static void stream_flash_program_work(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, pipe_work);
+
+	ctx->pipe_rc = flash_write(ctx->fdev, ctx->pipe_addr,
+				   ctx->pipe_buf, ctx->pipe_len);
+	k_sem_give(&ctx->pipe_done);
+}
+
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx,
+			       uint8_t *shadow_buf)
+{
+	if ((ctx == NULL) || (shadow_buf == NULL)) {
+		return -EINVAL;
+	}
+
+	ctx->pipe_shadow = shadow_buf;
+	ctx->pipe_rc = 0;
+	ctx->pipe_pending = false;
+	k_work_init(&ctx->pipe_work, stream_flash_program_work);
+	k_sem_init(&ctx->pipe_done, 0, 1);
+
+	return 0;
+}
+
+/* Wait for the in-flight program, surfacing its result */
+static int stream_flash_pipeline_drain(struct stream_flash_ctx *ctx)
+{
+	if ((ctx->pipe_shadow == NULL) || !ctx->pipe_pending) {
+		return 0;
+	}
+
+	k_sem_take(&ctx->pipe_done, K_FOREVER);
+	ctx->pipe_pending = false;
+
+	return ctx->pipe_rc;
+}
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
 static int flash_sync(struct stream_flash_ctx *ctx)
 {
 	int rc = 0;
@@ -218,6 +266,38 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	buf_bytes_aligned = ctx->buf_bytes + fill_length;
+
+#if defined(CONFIG_STREAM_FLASH_PIPELINE)
+	if ((ctx->pipe_shadow != NULL) &&
+	    !IS_ENABLED(CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK)) {
+		uint8_t *filled = ctx->buf;
+
+		/* previous program must land first (ordering, and it
+		 * owns the shadow buffer we are about to reuse)
+		 */
+		rc = stream_flash_pipeline_drain(ctx);
+		if (rc != 0) {
+			LOG_ERR("pipelined flash_write error %d", rc);
+			return rc;
+		}
+
+		ctx->pipe_buf = filled;
+		ctx->pipe_addr = write_addr;
+		ctx->pipe_len = buf_bytes_aligned;
+		ctx->pipe_pending = true;
+		k_work_submit(&ctx->pipe_work);
+
+		/* transport keeps filling the other buffer */
+		ctx->buf = ctx->pipe_shadow;
+		ctx->pipe_shadow = filled;
+
+		ctx->bytes_written += ctx->buf_bytes;
+		ctx->buf_bytes = 0U;
+
+		return 0;
+	}
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
 	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
 
 	if (rc != 0) {
@@ -299,6 +379,13 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#if defined(CONFIG_STREAM_FLASH_PIPELINE)
+	if (flush && (rc == 0)) {
+		/* a flush means "on flash when we return" */
+		rc = stream_flash_pipeline_drain(ctx);
+	}
+#endif
+
 	return rc;
 }
 
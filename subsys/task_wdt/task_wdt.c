@@ -245,7 +245,13 @@ int task_wdt_feed(int channel_id)
 	channels[channel_id].timeout_abs_ticks = current_ticks +
 		k_ms_to_ticks_ceil64(channels[channel_id].reload_period);
 
-	schedule_next_timeout(current_ticks);
+	/* Feeding always moves a deadline later, so the armed minimum can
+	 * only change when the armed channel itself is fed; for every
+	 * other channel the scan and timer reprogramming are skipped.
+	 */
+	if ((uintptr_t)k_timer_user_data_get(&timer) == (uintptr_t)channel_id) {
+		schedule_next_timeout(current_ticks);
+	}
 
 	k_sched_unlock();
 
@@ -113,6 +113,30 @@ uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
  */
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data);
 
+#if defined(CONFIG_RAM_TRACING_FLIGHT_RECORDER)
+/**
+ * @brief Stop the flight recorder, preserving its current contents.
+ */
+void tracing_buffer_freeze(void);
+
+/**
+ * @brief Freeze the flight recorder and return its contents.
+ *
+ * The ring holds up to two contiguous segments; @p oldest points at
+ * the older one.  When the ring has not wrapped yet, @p newest is
+ * NULL.
+ *
+ * @param oldest Filled with the older segment start.
+ * @param oldest_len Filled with the older segment length.
+ * @param newest Filled with the newer segment start, or NULL.
+ * @param newest_len Filled with the newer segment length.
+ *
+ * @return Total number of valid trace bytes.
+ */
+uint32_t tracing_buffer_snapshot(uint8_t **oldest, uint32_t *oldest_len,
+				 uint8_t **newest, uint32_t *newest_len);
+#endif /* CONFIG_RAM_TRACING_FLIGHT_RECORDER */
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,10 +15,67 @@ uint8_t ram_tracing[CONFIG_RAM_TRACING_BUFFER_SIZE];
 static uint32_t pos;
 static bool buffer_full;
 
+#if defined(CONFIG_RAM_TRACING_FLIGHT_RECORDER)
+/* Flight recorder mode: the buffer is a ring that always holds the
+ * most recent trace data instead of the oldest.  A freeze latch stops
+ * recording (e.g. from a fatal error hook) so the window of interest
+ * survives until it is read out.
+ */
+static bool frozen;
+static bool wrapped;
+
+void tracing_buffer_freeze(void)
+{
+	frozen = true;
+}
+
+uint32_t tracing_buffer_snapshot(uint8_t **oldest, uint32_t *oldest_len,
+				 uint8_t **newest, uint32_t *newest_len)
+{
+	frozen = true;
+
+	if (!wrapped) {
+		*oldest = ram_tracing;
+		*oldest_len = pos;
+		*newest = NULL;
+		*newest_len = 0;
+		return pos;
+	}
+
+	/* ring content: [pos..end) is the oldest part, [0..pos) the newest */
+	*oldest = &ram_tracing[pos];
+	*oldest_len = CONFIG_RAM_TRACING_BUFFER_SIZE - pos;
+	*newest = ram_tracing;
+	*newest_len = pos;
+
+	return CONFIG_RAM_TRACING_BUFFER_SIZE;
+}
+#endif /* CONFIG_RAM_TRACING_FLIGHT_RECORDER */
+
 static void tracing_backend_ram_output(
 		const struct tracing_backend *backend,
 		uint8_t *data, uint32_t length)
 {
+#if defined(CONFIG_RAM_TRACING_FLIGHT_RECORDER)
+	if (frozen) {
+		return;
+	}
+
+	while (length > 0) {
+		uint32_t space = CONFIG_RAM_TRACING_BUFFER_SIZE - pos;
+		uint32_t chunk = MIN(length, space);
+
+		memcpy(ram_tracing + pos, data, chunk);
+		pos += chunk;
+		data += chunk;
+		length -= chunk;
+
+		if (pos == CONFIG_RAM_TRACING_BUFFER_SIZE) {
+			pos = 0;
+			wrapped = true;
+		}
+	}
+#else
 	if (buffer_full) {
 		return;
 	}
@@ -30,6 +87,7 @@ static void tracing_backend_ram_output(
 
 	memcpy(ram_tracing + pos, data, length);
 	pos += length;
+#endif /* CONFIG_RAM_TRACING_FLIGHT_RECORDER */
 }
 
 static void tracing_backend_ram_init(void)
@@ -37,6 +95,10 @@ static void tracing_backend_ram_init(void)
 	memset(ram_tracing, 0, CONFIG_RAM_TRACING_BUFFER_SIZE);
 	pos = 0;
 	buffer_full = false;
+#if defined(CONFIG_RAM_TRACING_FLIGHT_RECORDER)
+	frozen = false;
+	wrapped = false;
+#endif
 }
 
 const struct tracing_backend_api tracing_backend_ram_api = {
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Intel corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Disable syscall tracing for all calls from this compilation unit to
+ * avoid recursing into the tracing machinery from its own transport.
+ */
+#define DISABLE_SYSCALL_TRACING
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/byteorder.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_backend.h>
+
+/* Each datagram carries a small header so the host can detect loss
+ * (sequence number) and reassemble in order; the payload is the raw
+ * tracing stream (CTF records when the CTF format is selected).
+ */
+struct tracing_udp_hdr {
+	uint32_t seq;
+	uint16_t len;
+	uint16_t _pad;
+} __packed;
+
+static int tracing_sock = -1;
+static uint32_t tx_seq;
+static uint32_t dropped;
+static uint8_t dgram[CONFIG_TRACING_BACKEND_UDP_MTU];
+static K_MUTEX_DEFINE(dgram_lock);
+
+static void tracing_backend_udp_output(const struct tracing_backend *backend,
+				       uint8_t *data, uint32_t length)
+{
+	ARG_UNUSED(backend);
+
+	/* sockets are unusable from interrupt context and the
+	 * datagram scratch buffer needs serialization in sync mode
+	 */
+	if (k_is_in_isr() || (tracing_sock < 0)) {
+		dropped++;
+		return;
+	}
+
+	k_mutex_lock(&dgram_lock, K_FOREVER);
+
+	while (length > 0) {
+		struct tracing_udp_hdr *hdr = (struct tracing_udp_hdr *)dgram;
+		uint32_t chunk = MIN(length,
+				     sizeof(dgram) - sizeof(*hdr));
+		int ret;
+
+		hdr->seq = sys_cpu_to_be32(tx_seq);
+		hdr->len = sys_cpu_to_be16((uint16_t)chunk);
+		hdr->_pad = 0;
+		memcpy(&dgram[sizeof(*hdr)], data, chunk);
+
+		ret = zsock_send(tracing_sock, dgram, sizeof(*hdr) + chunk,
+				 ZSOCK_MSG_DONTWAIT);
+		if (ret < 0) {
+			/* Never block the trace path: count the loss
+			 * and move on; the sequence gap tells the
+			 * host exactly what went missing.
+			 */
+			dropped++;
+		}
+
+		/* the sequence number advances even for dropped
+		 * datagrams so gaps are observable
+		 */
+		tx_seq++;
+		data += chunk;
+		length -= chunk;
+	}
+
+	k_mutex_unlock(&dgram_lock);
+}
+
+static void tracing_backend_udp_init(void)
+{
+	struct net_sockaddr_in addr = {
+		.sin_family = NET_AF_INET,
+		.sin_port = net_htons(CONFIG_TRACING_BACKEND_UDP_PORT),
+	};
+	int ret;
+
+	ret = zsock_inet_pton(NET_AF_INET,
+			      CONFIG_TRACING_BACKEND_UDP_HOST,
+			      &addr.sin_addr);
+	if (ret != 1) {
+		return;
+	}
+
+	tracing_sock = zsock_socket(NET_AF_INET, NET_SOCK_DGRAM,
+				    NET_IPPROTO_UDP);
+	if (tracing_sock < 0) {
+		return;
+	}
+
+	ret = zsock_connect(tracing_sock, (struct net_sockaddr *)&addr,
+			    sizeof(addr));
+	if (ret < 0) {
+		zsock_close(tracing_sock);
+		tracing_sock = -1;
+	}
+}
+
+const struct tracing_backend_api tracing_backend_udp_api = {
+	.init = tracing_backend_udp_init,
+	.output = tracing_backend_udp_output
+};
+
+TRACING_BACKEND_DEFINE(tracing_backend_udp, tracing_backend_udp_api);
@@ -110,6 +110,10 @@ struct cdc_acm_uart_data {
 	 * the TX FIFO during the user callback execution.
 	 */
 	bool zlp_needed;
+#if CONFIG_USBD_CDC_ACM_TX_INFLIGHT > 1
+	/* Number of bulk IN transfers currently enqueued with the UDC */
+	atomic_t tx_inflight;
+#endif
 	/* UART API IRQ callback */
 	uart_irq_callback_user_data_t cb;
 	/* UART API user callback data */
@@ -127,6 +131,49 @@ struct cdc_acm_uart_data {
 	struct k_spinlock lock;
 };
 
+/* With multiple transfers in flight the UDC's per-endpoint queue keeps
+ * the endpoint busy across completion processing; the busy bit
+ * degenerates into an in-flight counter capped by the configuration.
+ * cdc_acm_tx_claim() returns true when no further transfer may be
+ * started.
+ */
+#if CONFIG_USBD_CDC_ACM_TX_INFLIGHT > 1
+static bool cdc_acm_tx_claim(struct cdc_acm_uart_data *data)
+{
+	if (atomic_inc(&data->tx_inflight) >= CONFIG_USBD_CDC_ACM_TX_INFLIGHT) {
+		atomic_dec(&data->tx_inflight);
+		return true;
+	}
+
+	return false;
+}
+
+static void cdc_acm_tx_release(struct cdc_acm_uart_data *data)
+{
+	atomic_dec(&data->tx_inflight);
+}
+
+static bool cdc_acm_tx_idle(struct cdc_acm_uart_data *data)
+{
+	return atomic_get(&data->tx_inflight) == 0;
+}
+#else
+static bool cdc_acm_tx_claim(struct cdc_acm_uart_data *data)
+{
+	return atomic_test_and_set_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+}
+
+static void cdc_acm_tx_release(struct cdc_acm_uart_data *data)
+{
+	atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+}
+
+static bool cdc_acm_tx_idle(struct cdc_acm_uart_data *data)
+{
+	return !atomic_test_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+}
+#endif /* CONFIG_USBD_CDC_ACM_TX_INFLIGHT > 1 */
+
 static void cdc_acm_irq_rx_enable(const struct device *dev);
 
 #if CONFIG_USBD_CDC_ACM_BUF_POOL
@@ -294,7 +341,7 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 		}
 
 		if (bi->ep == cdc_acm_get_bulk_in(c_data)) {
-			atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+			cdc_acm_tx_release(data);
 		}
 
 		if (bi->ep == cdc_acm_get_int_in(c_data)) {
@@ -324,7 +371,7 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 			cdc_acm_work_submit(&data->irq_cb_work);
 		}
 
-		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+		cdc_acm_tx_release(data);
 
 		if (!ring_buf_is_empty(data->tx_fifo.rb)) {
 			/* Queue pending TX data on IN endpoint */
@@ -646,14 +693,14 @@ static void cdc_acm_tx_fifo_handler(struct k_work *work)
 		return;
 	}
 
-	if (atomic_test_and_set_bit(&data->state, CDC_ACM_TX_FIFO_BUSY)) {
-		LOG_DBG("TX transfer already in progress");
+	if (cdc_acm_tx_claim(data)) {
+		LOG_DBG("TX transfer limit reached");
 		return;
 	}
 
 	buf = cdc_acm_buf_alloc(c_data, cdc_acm_get_bulk_in(c_data));
 	if (buf == NULL) {
-		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+		cdc_acm_tx_release(data);
 		cdc_acm_work_schedule(&data->tx_fifo_work, K_MSEC(1));
 		return;
 	}
@@ -667,8 +714,19 @@ static void cdc_acm_tx_fifo_handler(struct k_work *work)
 	if (ret) {
 		LOG_ERR("Failed to enqueue");
 		net_buf_unref(buf);
-		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+		cdc_acm_tx_release(data);
+		return;
 	}
+
+#if CONFIG_USBD_CDC_ACM_TX_INFLIGHT > 1
+	/* Keep the endpoint queue fed while data and transfer slots
+	 * remain, so back-to-back transfers need no completion
+	 * round-trip in between.
+	 */
+	if (!ring_buf_is_empty(data->tx_fifo.rb)) {
+		cdc_acm_work_schedule(&data->tx_fifo_work, K_NO_WAIT);
+	}
+#endif
 }
 
 /*
@@ -936,7 +994,7 @@ static void cdc_acm_irq_cb_handler(struct k_work *work)
 		cdc_acm_work_submit(&data->rx_fifo_work);
 	}
 
-	if (!atomic_test_bit(&data->state, CDC_ACM_TX_FIFO_BUSY)) {
+	if (cdc_acm_tx_idle(data)) {
 		if (data->tx_fifo.altered) {
 			LOG_DBG("tx fifo altered, submit work");
 			cdc_acm_work_schedule(&data->tx_fifo_work, K_NO_WAIT);
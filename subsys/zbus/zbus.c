@@ -33,6 +33,24 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 	return net_buf_alloc_len(pool, size, timeout);
 }
 
+#elif defined(CONFIG_ZBUS_MSG_SUBSCRIBER_BUF_ALLOC_VAR)
+
+/* Variable-size pool over a static buffer: like the fixed pool it
+ * needs no heap, but its allocator supports data referencing, so the
+ * per-observer net_buf_clone() in the VDED shares one copy of the
+ * message instead of duplicating it per subscriber.
+ */
+NET_BUF_POOL_VAR_DEFINE(_zbus_msg_subscribers_pool,
+			CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_POOL_SIZE,
+			CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_DATA_POOL_SIZE,
+			sizeof(struct zbus_channel *), NULL);
+
+static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, size_t size,
+						   k_timeout_t timeout)
+{
+	return net_buf_alloc_len(pool, size, timeout);
+}
+
 #else
 
 NET_BUF_POOL_FIXED_DEFINE(_zbus_msg_subscribers_pool,
@@ -452,6 +470,73 @@ static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 }
 
+#if defined(CONFIG_ZBUS_SEQLOCK)
+/* Mark the message as being mutated (odd sequence) / stable again
+ * (even). Callers hold the channel semaphore, so the transitions
+ * themselves cannot race each other - only seqlock readers observe
+ * them concurrently.
+ */
+static inline void chan_seq_begin(const struct zbus_channel *chan)
+{
+	(void)atomic_inc(&chan->data->seq);
+}
+
+static inline void chan_seq_end(const struct zbus_channel *chan)
+{
+	(void)atomic_inc(&chan->data->seq);
+}
+
+/* Retry budget for zbus_chan_read_seq(): yields first, which resolves
+ * writers of equal or higher priority, then sleeps a tick at a time
+ * so a lower priority writer can run even when the reader outranks it
+ * (k_yield() never yields downward, so a pure yield loop would spin
+ * forever on UP in that case).
+ */
+#define ZBUS_READ_SEQ_YIELDS 2
+#define ZBUS_READ_SEQ_SLEEPS 3
+
+int zbus_chan_read_seq(const struct zbus_channel *chan, void *msg)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	for (int attempt = 0;
+	     attempt <= (ZBUS_READ_SEQ_YIELDS + ZBUS_READ_SEQ_SLEEPS);
+	     attempt++) {
+		atomic_val_t seq_begin = atomic_get(&chan->data->seq);
+
+		if ((seq_begin & 1) == 0) {
+			memcpy(msg, chan->message, chan->message_size);
+
+			if (atomic_get(&chan->data->seq) == seq_begin) {
+				return 0;
+			}
+		}
+
+		/* Torn or in-progress write. In an ISR the interrupted
+		 * writer cannot make progress, so retrying can never
+		 * succeed: bail out instead.
+		 */
+		if (k_is_in_isr()) {
+			return -EAGAIN;
+		}
+
+		if (attempt < ZBUS_READ_SEQ_YIELDS) {
+			k_yield();
+		} else if (attempt < (ZBUS_READ_SEQ_YIELDS +
+				      ZBUS_READ_SEQ_SLEEPS)) {
+			k_sleep(K_TICKS(1));
+		}
+	}
+
+	/* The writer still has not finished its claim window */
+	return -EAGAIN;
+}
+#else
+#define chan_seq_begin(_chan)
+#define chan_seq_end(_chan)
+#endif /* CONFIG_ZBUS_SEQLOCK */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
@@ -483,7 +568,9 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 	chan->data->publish_count += 1;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
 
+	chan_seq_begin(chan);
 	memcpy(chan->message, msg, chan->message_size);
+	chan_seq_end(chan);
 
 	err = _zbus_vded_exec(chan, end_time);
 
@@ -559,6 +646,9 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
+	/* The claimer may mutate the message in place */
+	chan_seq_begin(chan);
+
 	return 0;
 }
 
@@ -566,6 +656,8 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+	chan_seq_end(chan);
+
 	k_sem_give(&chan->data->sem);
 
 	return 0;
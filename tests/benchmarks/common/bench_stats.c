@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+#include "bench_stats.h"
+
+static int compare_u64(const void *a, const void *b)
+{
+	const uint64_t va = *(const uint64_t *)a;
+	const uint64_t vb = *(const uint64_t *)b;
+
+	return (va > vb) - (va < vb);
+}
+
+void bench_stats_compute(const char *name, uint64_t *samples,
+			 uint32_t num_samples, uint32_t iterations,
+			 struct bench_stats_result *result)
+{
+	uint64_t total = 0ULL;
+	uint32_t i;
+
+	for (i = 0; i < num_samples; i++) {
+		samples[i] /= (uint64_t)iterations;
+		total += samples[i];
+	}
+
+	qsort(samples, num_samples, sizeof(samples[0]), compare_u64);
+
+	result->name = name;
+	result->num_samples = num_samples;
+	result->min = samples[0];
+	result->p50 = samples[(num_samples - 1) / 2];
+	result->p99 = samples[((uint64_t)(num_samples - 1) * 99ULL) / 100ULL];
+	result->max = samples[num_samples - 1];
+	result->avg = total / num_samples;
+}
+
+void bench_stats_report(const struct bench_stats_result *result)
+{
+	printk("STATS: %-40s : min %7llu , p50 %7llu , p99 %7llu , "
+	       "max %7llu cycles\n",
+	       result->name, result->min, result->p50, result->p99,
+	       result->max);
+
+#ifdef CONFIG_BENCHMARK_JSON_OUTPUT
+	printk("BENCH_JSON: {\"name\": \"%s\", \"unit\": \"cycles\", "
+	       "\"samples\": %u, \"min\": %llu, \"p50\": %llu, "
+	       "\"p99\": %llu, \"max\": %llu, \"avg\": %llu, "
+	       "\"min_ns\": %u, \"p50_ns\": %u, \"p99_ns\": %u, "
+	       "\"max_ns\": %u}\n",
+	       result->name, result->num_samples, result->min, result->p50,
+	       result->p99, result->max, result->avg,
+	       (uint32_t)timing_cycles_to_ns(result->min),
+	       (uint32_t)timing_cycles_to_ns(result->p50),
+	       (uint32_t)timing_cycles_to_ns(result->p99),
+	       (uint32_t)timing_cycles_to_ns(result->max));
+#endif /* CONFIG_BENCHMARK_JSON_OUTPUT */
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TESTS_BENCHMARKS_COMMON_BENCH_STATS_H_
+#define TESTS_BENCHMARKS_COMMON_BENCH_STATS_H_
+/*
+ * @brief Shared benchmark statistics core.
+ *
+ * Computes distribution statistics over a set of cycle count samples
+ * and reports them in a common format, optionally as one JSON record
+ * per result that tests/benchmarks/common/compare_results.py can diff
+ * against a previous run.
+ */
+
+#include <stdint.h>
+
+/** Distribution statistics for one benchmark result */
+struct bench_stats_result {
+	const char *name;    /**< Identifier of the measured operation */
+	uint32_t num_samples; /**< Number of samples the stats cover */
+	uint64_t min;        /**< Smallest sample, in cycles */
+	uint64_t p50;        /**< Median sample, in cycles */
+	uint64_t p99;        /**< 99th percentile sample, in cycles */
+	uint64_t max;        /**< Largest sample, in cycles */
+	uint64_t avg;        /**< Mean over all samples, in cycles */
+};
+
+/**
+ * @brief Compute distribution statistics over cycle count samples
+ *
+ * Each sample is divided by @a iterations before the statistics are
+ * taken, allowing callers that accumulate cycles over repeated runs
+ * to pass their totals directly. The sample array is sorted in place.
+ *
+ * @param name Identifier to attach to the result
+ * @param samples Cycle count samples; reordered by this call
+ * @param num_samples Number of entries in @a samples
+ * @param iterations Accumulation count each sample is divided by
+ * @param result Filled with the computed statistics
+ */
+void bench_stats_compute(const char *name, uint64_t *samples,
+			 uint32_t num_samples, uint32_t iterations,
+			 struct bench_stats_result *result);
+
+/**
+ * @brief Report one benchmark result
+ *
+ * Prints the statistics as a single human-readable line and, when
+ * CONFIG_BENCHMARK_JSON_OUTPUT is enabled, as a "BENCH_JSON:" record
+ * for trend tracking.
+ *
+ * @param result Statistics to report
+ */
+void bench_stats_report(const struct bench_stats_result *result);
+
+#endif /* TESTS_BENCHMARKS_COMMON_BENCH_STATS_H_ */
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""Diff two benchmark result sets for performance regressions.
+
+Each input is either a console log containing "BENCH_JSON:" records
+(emitted by builds with CONFIG_BENCHMARK_JSON_OUTPUT=y) or a file of
+bare JSON objects, one per line. Results present in both sets are
+compared on the chosen metric; a relative increase beyond the
+threshold is reported as a regression and reflected in the exit code,
+so CI can gate merges on the comparison.
+"""
+
+import argparse
+import json
+import sys
+
+MARKER = "BENCH_JSON:"
+
+
+def load_results(path):
+    """Return {name: record} for every benchmark record in the file."""
+    results = {}
+    with open(path, encoding="utf-8", errors="replace") as fp:
+        for line in fp:
+            idx = line.find(MARKER)
+            if idx >= 0:
+                line = line[idx + len(MARKER):]
+            line = line.strip()
+            if not line.startswith("{"):
+                continue
+            try:
+                record = json.loads(line)
+            except json.JSONDecodeError:
+                continue
+            if "name" in record:
+                results[record["name"]] = record
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="result set to compare against")
+    parser.add_argument("candidate", help="result set under test")
+    parser.add_argument("-m", "--metric", default="p50",
+                        choices=["min", "p50", "p99", "max", "avg"],
+                        help="metric to compare (default: p50)")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="relative increase (%%) reported as a "
+                             "regression (default: 5)")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    candidate = load_results(args.candidate)
+    if not baseline:
+        sys.exit(f"no benchmark records found in {args.baseline}")
+    if not candidate:
+        sys.exit(f"no benchmark records found in {args.candidate}")
+
+    regressions = 0
+    common = sorted(set(baseline) & set(candidate))
+    print(f"{'name':<40} {'base':>10} {'cand':>10} {'delta':>8}")
+    for name in common:
+        base = baseline[name].get(args.metric)
+        cand = candidate[name].get(args.metric)
+        if not base or cand is None:
+            continue
+        delta = 100.0 * (cand - base) / base
+        flag = ""
+        if delta > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{name:<40} {base:>10} {cand:>10} {delta:>+7.1f}%{flag}")
+
+    for name in sorted(set(baseline) - set(candidate)):
+        print(f"{name:<40} missing from candidate")
+    for name in sorted(set(candidate) - set(baseline)):
+        print(f"{name:<40} new in candidate")
+
+    if regressions:
+        print(f"{regressions} regression(s) beyond {args.threshold}% "
+              f"on {args.metric}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
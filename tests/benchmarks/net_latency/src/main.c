@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measures the end-to-end latency of the network RX/TX path by sending
+ * UDP packets to itself over the loopback interface.  Application-level
+ * round trip times are reported as a histogram and as distribution
+ * statistics; the per-stage breakdown inside the stack comes from the
+ * in-stack timestamping enabled by CONFIG_NET_PKT_RXTIME_STATS_DETAIL
+ * and CONFIG_NET_PKT_TXTIME_STATS_DETAIL, whose checkpoints bracket
+ * driver hand-off, traffic class queueing, net_core processing and
+ * socket delivery.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/net_stats.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/tc_util.h>
+
+#include "bench_stats.h"
+
+#define UDP_PORT 4242
+
+/* Power-of-two microsecond buckets: bucket N counts samples in
+ * [2^(N-1), 2^N) microseconds, bucket 0 counts sub-microsecond ones.
+ */
+#define HIST_BUCKETS 16
+
+static uint64_t samples[CONFIG_BENCHMARK_NUM_ITERATIONS];
+static uint32_t histogram[HIST_BUCKETS];
+static uint8_t payload[CONFIG_BENCHMARK_PAYLOAD_SIZE];
+static uint8_t rx_buffer[CONFIG_BENCHMARK_PAYLOAD_SIZE];
+
+static void report_histogram(void)
+{
+	unsigned int i;
+
+	printk("Round trip time distribution:\n");
+	for (i = 0; i < HIST_BUCKETS; i++) {
+		if (histogram[i] == 0U) {
+			continue;
+		}
+
+		printk("    < %5u us : %u\n", BIT(i), histogram[i]);
+	}
+}
+
+static void report_stage_avg(const char *name, uint64_t sum, uint32_t count)
+{
+	if (count == 0U) {
+		return;
+	}
+
+	printk("    %-36s : %7llu us avg over %u packets\n", name,
+	       sum / count, count);
+}
+
+static void report_stack_stages(void)
+{
+	/* struct net_stats is sizable; keep it off the main stack */
+	static struct net_stats stats;
+	struct net_if *iface = net_if_get_default();
+	int ret;
+
+	ret = net_mgmt(NET_REQUEST_STATS_GET_ALL, iface, &stats, sizeof(stats));
+	if (ret != 0) {
+		printk("Failed to read network statistics (%d)\n", ret);
+		return;
+	}
+
+	printk("In-stack time, driver hand-off to socket delivery:\n");
+#if defined(CONFIG_NET_PKT_RXTIME_STATS)
+	report_stage_avg("net.rx", stats.rx_time.sum, stats.rx_time.count);
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		char name[24];
+
+		snprintk(name, sizeof(name), "net.rx.stage%d", i);
+		report_stage_avg(name, stats.rx_time_detail[i].sum,
+				 stats.rx_time_detail[i].count);
+	}
+#endif /* CONFIG_NET_PKT_RXTIME_STATS_DETAIL */
+#endif /* CONFIG_NET_PKT_RXTIME_STATS */
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS)
+	report_stage_avg("net.tx", stats.tx_time.sum, stats.tx_time.count);
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		char name[24];
+
+		snprintk(name, sizeof(name), "net.tx.stage%d", i);
+		report_stage_avg(name, stats.tx_time_detail[i].sum,
+				 stats.tx_time_detail[i].count);
+	}
+#endif /* CONFIG_NET_PKT_TXTIME_STATS_DETAIL */
+#endif /* CONFIG_NET_PKT_TXTIME_STATS */
+}
+
+int main(void)
+{
+	struct net_sockaddr_in addr = {
+		.sin_family = NET_AF_INET,
+		.sin_port = net_htons(UDP_PORT),
+	};
+	struct bench_stats_result result;
+	timing_t start, finish;
+	int rx_sock, tx_sock;
+	unsigned int i;
+	uint32_t us;
+	int ret;
+
+	printk("Network stack latency benchmark: %u UDP packets of %u bytes\n",
+	       CONFIG_BENCHMARK_NUM_ITERATIONS, CONFIG_BENCHMARK_PAYLOAD_SIZE);
+
+	zsock_inet_pton(NET_AF_INET, "127.0.0.1", &addr.sin_addr);
+
+	rx_sock = zsock_socket(NET_AF_INET, NET_SOCK_DGRAM, NET_IPPROTO_UDP);
+	tx_sock = zsock_socket(NET_AF_INET, NET_SOCK_DGRAM, NET_IPPROTO_UDP);
+	if ((rx_sock < 0) || (tx_sock < 0)) {
+		printk("Failed to create sockets\n");
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	ret = zsock_bind(rx_sock, (struct net_sockaddr *)&addr, sizeof(addr));
+	if (ret < 0) {
+		printk("Failed to bind (%d)\n", -errno);
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	timing_init();
+	timing_start();
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+
+		ret = zsock_sendto(tx_sock, payload, sizeof(payload), 0,
+				   (struct net_sockaddr *)&addr, sizeof(addr));
+		if (ret == sizeof(payload)) {
+			ret = zsock_recv(rx_sock, rx_buffer, sizeof(rx_buffer), 0);
+		}
+
+		finish = timing_counter_get();
+
+		if (ret != sizeof(payload)) {
+			printk("Packet %u lost or truncated (%d)\n", i, ret);
+			TC_END_REPORT(TC_FAIL);
+			return 0;
+		}
+
+		samples[i] = timing_cycles_get(&start, &finish);
+
+		us = (uint32_t)(timing_cycles_to_ns(samples[i]) / NSEC_PER_USEC);
+		histogram[MIN(us == 0U ? 0U : (uint32_t)find_msb_set(us),
+			      HIST_BUCKETS - 1)]++;
+	}
+
+	timing_stop();
+
+	bench_stats_compute("net.udp.loopback.rtt", samples,
+			    CONFIG_BENCHMARK_NUM_ITERATIONS, 1, &result);
+	bench_stats_report(&result);
+
+	report_histogram();
+	report_stack_stages();
+
+	zsock_close(tx_sock);
+	zsock_close(rx_sock);
+
+	TC_END_REPORT(TC_PASS);
+	return 0;
+}
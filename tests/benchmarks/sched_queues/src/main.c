@@ -12,6 +12,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/timestamp.h>
 #include "utils.h"
+#include "bench_stats.h"
 #include <zephyr/tc_util.h>
 #include <ksched.h>
 
@@ -220,6 +221,14 @@ static void compute_and_report_stats(unsigned int num_threads, unsigned int num_
 	printk("    Std Deviation: %7llu cycles (%7u nsec)\n", std_dev,
 	       (uint32_t)timing_cycles_to_ns(std_dev));
 #endif
+
+#ifdef CONFIG_BENCHMARK_JSON_OUTPUT
+	struct bench_stats_result result;
+
+	/* Rescales and reorders @a cycles; callers reset it before reuse. */
+	bench_stats_compute(tag, cycles, num_threads, num_iterations, &result);
+	bench_stats_report(&result);
+#endif /* CONFIG_BENCHMARK_JSON_OUTPUT */
 }
 
 int main(void)
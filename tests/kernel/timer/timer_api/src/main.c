@@ -284,6 +284,39 @@ ZTEST_USER(timer_api, test_timer_period_0)
  * @see k_timer_init(), k_timer_start(), k_timer_stop(), k_uptime_get(),
  * k_busy_wait()
  */
+/**
+ * @brief Test a timeout further out than a full timer wheel revolution
+ *
+ * A timeout beyond 2^24 ticks lands in the top level of the
+ * CONFIG_TIMEOUT_WHEEL backend in (or wrapping onto) the current slot.
+ * Verify the system keeps announcing ticks with such a timeout queued -
+ * a wheel that mistakes the parked entry for a due event livelocks in
+ * the timer interrupt - and that the timer neither fires early nor
+ * blocks other timeouts.  Also meaningful for the list backend as a
+ * plain far-future timeout test.
+ */
+ZTEST_USER(timer_api, test_timer_far_future)
+{
+	init_timer_data();
+	/** TESTPOINT: queue a > 2^24 tick timeout */
+	k_timer_start(&duration_timer, K_TICKS(BIT(24) + 1234), K_NO_WAIT);
+
+	/* Short sleeps exercise the announce path; they hang if the
+	 * far-future entry is reported as due now.
+	 */
+	for (int i = 0; i < 10; i++) {
+		k_sleep(K_TICKS(2));
+	}
+
+	/** TESTPOINT: the far-future timer has not fired */
+	TIMER_ASSERT(tdata.expire_cnt == 0, &duration_timer);
+	TIMER_ASSERT(k_timer_remaining_ticks(&duration_timer) > 0,
+		     &duration_timer);
+
+	/* cleanup environment */
+	k_timer_stop(&duration_timer);
+}
+
 ZTEST_USER(timer_api, test_timer_period_k_forever)
 {
 	init_timer_data();
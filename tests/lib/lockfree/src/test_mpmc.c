@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+/*
+ * @brief Push and pop through a size-1 queue, checking full/empty edges
+ *
+ * @see mpmc_push(), mpmc_pop()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_push_pop_size1)
+{
+	MPMC_DEFINE(ezmpmc, uint32_t, 1);
+
+	const uint32_t magic = 43219876;
+	uint32_t out = 0;
+
+	zassert_false(mpmc_pop(&ezmpmc, out), "Pop on empty should fail");
+
+	zassert_true(mpmc_push(&ezmpmc, magic), "Push should succeed");
+	zassert_false(mpmc_push(&ezmpmc, magic), "Push on full should fail");
+
+	zassert_true(mpmc_pop(&ezmpmc, out), "Pop should succeed");
+	zassert_equal(out, magic, "Popped value should equal magic");
+
+	zassert_false(mpmc_pop(&ezmpmc, out), "Pop on empty should fail");
+}
+
+/*
+ * @brief Wrap the queue several times and verify FIFO ordering
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_wrap_fifo)
+{
+	MPMC_DEFINE(wrapmpmc, uint32_t, 4);
+
+	uint32_t next_push = 0;
+	uint32_t next_pop = 0;
+	uint32_t out;
+
+	for (int round = 0; round < 10; round++) {
+		while (mpmc_push(&wrapmpmc, next_push)) {
+			next_push++;
+		}
+
+		zassert_equal(next_push - next_pop, mpmc_size(&wrapmpmc),
+			      "Queue should fill completely");
+
+		while (mpmc_pop(&wrapmpmc, out)) {
+			zassert_equal(out, next_pop, "FIFO order violated");
+			next_pop++;
+		}
+
+		zassert_equal(next_push, next_pop, "Queue should drain completely");
+	}
+}
+
+#define NUM_MPMC_THREADS 4
+#define PER_THREAD_ITEMS 256
+
+MPMC_DEFINE(thread_mpmc, uint32_t, 16);
+static struct k_thread mpmc_threads[NUM_MPMC_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(mpmc_stacks, NUM_MPMC_THREADS, 1024);
+static atomic_t mpmc_popped_sum;
+static atomic_t mpmc_popped_count;
+
+static void mpmc_producer_consumer(void *p1, void *p2, void *p3)
+{
+	bool producer = (uintptr_t)p1 & 1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < PER_THREAD_ITEMS;) {
+		if (producer) {
+			if (mpmc_push(&thread_mpmc, i)) {
+				i++;
+			} else {
+				k_yield();
+			}
+		} else {
+			uint32_t out;
+
+			if (mpmc_pop(&thread_mpmc, out)) {
+				atomic_add(&mpmc_popped_sum, (atomic_val_t)out);
+				atomic_inc(&mpmc_popped_count);
+				i++;
+			} else {
+				k_yield();
+			}
+		}
+	}
+}
+
+/*
+ * @brief Two producers and two consumers moving a known sum of values
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_threaded)
+{
+	uint32_t expected_sum = 2 * (PER_THREAD_ITEMS * (PER_THREAD_ITEMS - 1)) / 2;
+
+	atomic_clear(&mpmc_popped_sum);
+	atomic_clear(&mpmc_popped_count);
+
+	for (uintptr_t i = 0; i < NUM_MPMC_THREADS; i++) {
+		k_thread_create(&mpmc_threads[i], mpmc_stacks[i],
+				K_THREAD_STACK_SIZEOF(mpmc_stacks[i]),
+				mpmc_producer_consumer, (void *)i, NULL, NULL,
+				K_PRIO_PREEMPT(2), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < NUM_MPMC_THREADS; i++) {
+		k_thread_join(&mpmc_threads[i], K_FOREVER);
+	}
+
+	zassert_equal(atomic_get(&mpmc_popped_count), 2 * PER_THREAD_ITEMS,
+		      "All items should be consumed");
+	zassert_equal((uint32_t)atomic_get(&mpmc_popped_sum), expected_sum,
+		      "Consumed values should sum to the produced values");
+}
+
+ZTEST_SUITE(mpmc, NULL, NULL, NULL, NULL, NULL);
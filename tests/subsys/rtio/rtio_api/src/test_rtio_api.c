@@ -98,6 +98,45 @@ ZTEST(rtio_api, test_rtio_no_response)
 	zassert_equal(0, res, "Expected no CQEs");
 }
 
+/**
+ * @brief Test batched completion consumption
+ *
+ * Ensures that a batch consume claims every pending completion in one
+ * call and returns them in submission order.
+ */
+ZTEST(rtio_api, test_rtio_cqe_consume_batch)
+{
+	int res;
+	uintptr_t userdata[4] = {0, 1, 2, 3};
+	struct rtio_cqe *cqes[4];
+	struct rtio_sqe *sqe;
+	size_t num;
+
+	rtio_iodev_test_init(&iodev_test_simple);
+
+	for (size_t i = 0; i < ARRAY_SIZE(userdata); i++) {
+		sqe = rtio_sqe_acquire(&r_simple);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_simple, &userdata[i]);
+	}
+
+	res = rtio_submit(&r_simple, ARRAY_SIZE(userdata));
+	zassert_ok(res, "Should return ok from rtio_execute");
+
+	num = rtio_cqe_consume_batch_block(&r_simple, cqes, ARRAY_SIZE(cqes), K_MSEC(500));
+	zassert_equal(num, ARRAY_SIZE(cqes), "Expected all completions in one batch");
+
+	for (size_t i = 0; i < num; i++) {
+		zassert_ok(cqes[i]->result, "Result should be ok");
+		zassert_equal_ptr(cqes[i]->userdata, &userdata[i], "Expected userdata back");
+	}
+
+	rtio_cqe_release_batch(&r_simple, cqes, num);
+
+	num = rtio_cqe_consume_batch(&r_simple, cqes, ARRAY_SIZE(cqes));
+	zassert_equal(num, 0, "Expected an empty completion queue");
+}
+
 RTIO_DEFINE(r_chain, SQE_POOL_SIZE, CQE_POOL_SIZE);
 
 RTIO_IODEV_TEST_DEFINE(iodev_test_chain0);
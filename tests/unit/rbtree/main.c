@@ -277,4 +277,50 @@ ZTEST(rbtree_api, test_rb_get_minmax)
 	zassert_true(rb_get_max(&test_rbtree) == &nodes[7], "the tree is invalid");
 }
 
+/**
+ * @brief Test building a tree from a sorted array
+ *
+ * @details Build trees of various sizes with rb_build_sorted() and
+ * verify the red-black invariants and in-order contents against the
+ * source array.
+ *
+ * @ingroup lib_rbtree_tests
+ *
+ * @see rb_build_sorted()
+ */
+ZTEST(rbtree_api, test_rb_build_sorted)
+{
+	static struct rbnode *sorted[MAX_NODES];
+	static const int sizes[] = { 0, 1, 2, 3, 7, 8, 100, MAX_NODES };
+
+	for (size_t si = 0; si < ARRAY_SIZE(sizes); si++) {
+		int count = sizes[si];
+
+		(void)memset(&test_rbtree, 0, sizeof(test_rbtree));
+		test_rbtree.lessthan_fn = node_lessthan;
+		(void)memset(nodes, 0, sizeof(nodes));
+		(void)memset(node_mask, 0, sizeof(node_mask));
+
+		for (int i = 0; i < count; i++) {
+			sorted[i] = &nodes[i];
+			set_node_mask(i, 1);
+		}
+
+		rb_build_sorted(&test_rbtree, sorted, count);
+
+		if (count == 0) {
+			zassert_true(test_rbtree.root == NULL, "empty build");
+			continue;
+		}
+
+		zassert_true(is_black(test_rbtree.root), "root must be black");
+		zassert_true(rb_get_min(&test_rbtree) == &nodes[0], "wrong min");
+		zassert_true(rb_get_max(&test_rbtree) == &nodes[count - 1],
+			     "wrong max");
+
+		/* Full invariant and contents check */
+		check_rb();
+	}
+}
+
 ZTEST_SUITE(rbtree_api, NULL, NULL, NULL, NULL, NULL);
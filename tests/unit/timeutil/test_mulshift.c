@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Peter Bigot Consulting
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Tests for the multiply-shift reciprocal conversions */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/timeutil.h>
+#include "timeutil_test.h"
+
+static void check_ratio(uint32_t to_hz, uint32_t from_hz, uint64_t t)
+{
+	struct timeutil_mulshift ms;
+	uint64_t expected;
+	uint64_t got;
+
+	/* Skip combinations whose true result does not fit 64 bits */
+	if ((t / from_hz) > (UINT64_MAX / to_hz) / 2U) {
+		return;
+	}
+
+	expected = (t / from_hz) * to_hz + ((t % from_hz) * to_hz) / from_hz;
+
+	timeutil_mulshift_init(&ms, to_hz, from_hz);
+	got = timeutil_mulshift_convert(&ms, t);
+
+	/* Relative error below 2^-32: the absolute error is bounded by
+	 * t >> 32 plus one count of rounding.
+	 */
+	uint64_t bound = (t >> 32) + 1U;
+	uint64_t delta = (got > expected) ? (got - expected) : (expected - got);
+
+	zassert_true(delta <= bound,
+		     "%u/%u Hz t=%llu: got %llu expected %llu (delta %llu bound %llu)",
+		     to_hz, from_hz, t, got, expected, delta, bound);
+}
+
+ZTEST(timeutil_api, test_mulshift_ratios)
+{
+	static const uint32_t hz[] = { 1, 100, 32768, 1000000, 19200000, 1000000000 };
+
+	for (size_t i = 0; i < ARRAY_SIZE(hz); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(hz); j++) {
+			check_ratio(hz[i], hz[j], 0);
+			check_ratio(hz[i], hz[j], 1);
+			check_ratio(hz[i], hz[j], 12345678);
+			check_ratio(hz[i], hz[j], 0xffffffffULL);
+			check_ratio(hz[i], hz[j], 0x123456789abULL);
+		}
+	}
+}